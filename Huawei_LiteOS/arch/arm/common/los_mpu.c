@@ -0,0 +1,304 @@
+/*----------------------------------------------------------------------------
+ * Copyright (c) <2013-2015>, <Huawei Technologies Co., Ltd>
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *---------------------------------------------------------------------------*/
+/*----------------------------------------------------------------------------
+ * Notice of Export Control Law
+ * ===============================================
+ * Huawei LiteOS may be subject to applicable export control laws and regulations, which might
+ * include those applicable to Huawei LiteOS of U.S. and the country in which you are located.
+ * Import, export and usage of Huawei LiteOS in any manner by you shall be in compliance with such
+ * applicable export control laws and regulations.
+ *---------------------------------------------------------------------------*/
+
+#include "los_mpu.h"
+#include "los_hwi.h"
+#include "los_task.ph"
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+#endif /* __cplusplus */
+
+#if (LOSCFG_BASE_CORE_MPU == YES)
+
+#if (LOSCFG_MPU_MAX_SUPPORT <= OS_MPU_BACKGROUND_REGION_NUM + 1)
+#error "LOSCFG_MPU_MAX_SUPPORT leaves no region for the stack guard and LOS_MpuRegionSet"
+#endif
+
+/* memory management fault status, the low byte of CFSR */
+#define OS_MPU_MMFSR_MASK               0xFF
+#define OS_MPU_MMFSR_MSTKERR            0x10
+#define OS_MPU_MMFSR_MMARVALID          0x80
+
+/* SIZE field of RASR for a region of 2^(n + 1) bytes */
+#define OS_MPU_RASR_SIZE(n)             ((UINT32)(n) << MPU_RASR_SIZE_Pos)
+#define OS_MPU_RASR_AP(ap)              ((UINT32)(ap) << MPU_RASR_AP_Pos)
+
+#define OS_MPU_SIZE_4G                  31
+#define OS_MPU_SIZE_512M                28
+#define OS_MPU_SIZE_32B                 4
+
+/* background regions */
+#define OS_MPU_REGION_ALL               0
+#define OS_MPU_REGION_CODE              1
+#define OS_MPU_REGION_SRAM              2
+#define OS_MPU_REGION_EXT_RAM_WBWA      3
+#define OS_MPU_REGION_EXT_RAM_WT        4
+
+/* TEX, C and B of RASR for each MPU_MEMORY_TYPE_E */
+static const UINT32 s_auwMpuMemAttr[MPU_MEM_BUTT] =
+{
+    0,                                                                      /* strongly-ordered */
+    MPU_RASR_B_Msk,                                                         /* shared device    */
+    MPU_RASR_C_Msk,                                                         /* normal WT        */
+    MPU_RASR_C_Msk | MPU_RASR_B_Msk,                                        /* normal WB        */
+    (1UL << MPU_RASR_TEX_Pos),                                              /* normal NC        */
+    (1UL << MPU_RASR_TEX_Pos) | MPU_RASR_C_Msk | MPU_RASR_B_Msk             /* normal WBWA      */
+};
+
+/*****************************************************************************
+ Function    : osMpuRegionWrite
+ Description : Write the base address and the attributes of a region
+ Input       : uwRegion --- region number
+               uwBase   --- base address, aligned on the region size
+               uwAttr   --- RASR value
+ Output      : None
+ Return      : None
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_MINOR static VOID osMpuRegionWrite(UINT32 uwRegion, UINT32 uwBase, UINT32 uwAttr)
+{
+    UINTPTR uvIntSave;
+
+    /* a task switch rewrites RBAR of the guard, which selects another region */
+    uvIntSave = LOS_IntLock();
+    MPU->RNR = uwRegion;
+    MPU->RASR = 0;
+    MPU->RBAR = uwBase & MPU_RBAR_ADDR_Msk;
+    MPU->RASR = uwAttr;
+    __DSB();
+    __ISB();
+    LOS_IntRestore(uvIntSave);
+}
+
+/*****************************************************************************
+ Function    : LOS_MpuRegionSet
+ Description : Set the attributes of a region and enable it
+ Input       : uwRegion --- region number
+               pstInfo  --- attributes of the region
+ Output      : None
+ Return      : LOS_OK on success or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_MINOR UINT32 LOS_MpuRegionSet(UINT32 uwRegion, MPU_REGION_INFO_S *pstInfo)
+{
+    UINT32 uwAttr;
+
+    if (pstInfo == NULL)
+    {
+        return LOS_ERRNO_MPU_PTR_NULL;
+    }
+
+    if ((uwRegion < LOS_MPU_REGION_FIRST) || (uwRegion > LOS_MPU_REGION_LAST))
+    {
+        return LOS_ERRNO_MPU_REGION_INVALID;
+    }
+
+    if ((pstInfo->uwSize < 32) || (pstInfo->uwSize > 0x80000000) || (pstInfo->uwSize & (pstInfo->uwSize - 1)))
+    {
+        return LOS_ERRNO_MPU_SIZE_INVALID;
+    }
+
+    if ((pstInfo->uwBaseAddress & (pstInfo->uwSize - 1)) ||
+        (pstInfo->uwSize - 1 > LOSCFG_MPU_MAX_ADDRESS - pstInfo->uwBaseAddress))
+    {
+        return LOS_ERRNO_MPU_ADDR_INVALID;
+    }
+
+#if (LOSCFG_MPU_MIN_ADDRESS > 0)
+    if (pstInfo->uwBaseAddress < LOSCFG_MPU_MIN_ADDRESS)
+    {
+        return LOS_ERRNO_MPU_ADDR_INVALID;
+    }
+#endif
+
+    if ((pstInfo->ucMemoryType >= MPU_MEM_BUTT) ||
+        (pstInfo->ucAccessPermission > MPU_AP_READ_ONLY) || (pstInfo->ucAccessPermission == 4))
+    {
+        return LOS_ERRNO_MPU_ATTR_INVALID;
+    }
+
+    uwAttr = s_auwMpuMemAttr[pstInfo->ucMemoryType] | OS_MPU_RASR_AP(pstInfo->ucAccessPermission) |
+             OS_MPU_RASR_SIZE(30 - __CLZ(pstInfo->uwSize)) | MPU_RASR_ENABLE_Msk;
+    if (!pstInfo->ucExecute)
+    {
+        uwAttr |= MPU_RASR_XN_Msk;
+    }
+    if (pstInfo->ucShareable)
+    {
+        uwAttr |= MPU_RASR_S_Msk;
+    }
+
+    osMpuRegionWrite(uwRegion, pstInfo->uwBaseAddress, uwAttr);
+    return LOS_OK;
+}
+
+/*****************************************************************************
+ Function    : LOS_MpuRegionDisable
+ Description : Disable a region
+ Input       : uwRegion --- region number
+ Output      : None
+ Return      : LOS_OK on success or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_MINOR UINT32 LOS_MpuRegionDisable(UINT32 uwRegion)
+{
+    if ((uwRegion < LOS_MPU_REGION_FIRST) || (uwRegion > LOS_MPU_REGION_LAST))
+    {
+        return LOS_ERRNO_MPU_REGION_INVALID;
+    }
+
+    osMpuRegionWrite(uwRegion, 0, 0);
+    return LOS_OK;
+}
+
+/*****************************************************************************
+ Function    : osMpuFaultHandler
+ Description : MemManage handler, report the faulting address and the task, a stack overflow when the access
+               hit the guard of the running task
+ Input       : None
+ Output      : None
+ Return      : None
+ *****************************************************************************/
+/*lint -e529*/
+LITE_OS_SEC_TEXT_MINOR VOID osMpuFaultHandler(VOID)
+{
+    UINT32 uwMmfsr = SCB->CFSR & OS_MPU_MMFSR_MASK;
+    UINT32 uwMmfar = SCB->MMFAR;
+    UINT32 uwErrNo = LOS_ERRNO_MPU_ACCESS_VIOLATION;
+    LOS_TASK_CB *pstRunTask = g_stLosTask.pstRunTask;
+
+    PRINT_ERR("MemManage fault MMFSR: 0x%x MMFAR: 0x%x\n", uwMmfsr, uwMmfar);
+
+#if (LOSCFG_BASE_CORE_TSK_STACK_GUARD == YES)
+    if ((uwMmfsr & OS_MPU_MMFSR_MSTKERR) ||
+        ((uwMmfsr & OS_MPU_MMFSR_MMARVALID) &&
+         (uwMmfar - (pstRunTask->uwTopOfStack - OS_MPU_STACK_GUARD_SIZE) < OS_MPU_STACK_GUARD_SIZE)))
+    {
+        uwErrNo = LOS_ERRNO_MPU_STACK_OVERFLOW;
+        PRINT_ERR("CURRENT task ID: %s:%d stack overflow!\n", pstRunTask->pcTaskName, pstRunTask->uwTaskID);
+    }
+    else
+#endif
+    {
+        PRINT_ERR("CURRENT task ID: %s:%d access violation!\n", pstRunTask->pcTaskName, pstRunTask->uwTaskID);
+    }
+
+    (VOID)LOS_ErrHandle("los_mpu.c", __LINE__, uwErrNo, sizeof(uwMmfar), &uwMmfar);
+    while(1);
+}
+
+/*****************************************************************************
+ Function    : osMpuInit
+ Description : Map the memory for the unprivileged tasks, install the MemManage handler and enable the MPU
+ Input       : None
+ Output      : None
+ Return      : LOS_OK on success or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_INIT UINT32 osMpuInit(VOID)
+{
+    UINT32 uwRegion;
+
+    if (((MPU->TYPE & MPU_TYPE_DREGION_Msk) >> MPU_TYPE_DREGION_Pos) < LOSCFG_MPU_MAX_SUPPORT)
+    {
+        return LOS_ERRNO_MPU_NOT_SUPPORT;
+    }
+
+    MPU->CTRL = 0;
+    for (uwRegion = 0; uwRegion < LOSCFG_MPU_MAX_SUPPORT; uwRegion++)
+    {
+        MPU->RNR = uwRegion;
+        MPU->RASR = 0;
+    }
+
+    /*
+     * The regions below rebuild the default memory map, which the tasks lose when they run unprivileged:
+     * device and not executable anywhere, then normal memory for the code, the SRAM and the external RAM.
+     */
+    MPU->RBAR = 0x00000000 | MPU_RBAR_VALID_Msk | OS_MPU_REGION_ALL;
+    MPU->RASR = s_auwMpuMemAttr[MPU_MEM_DEVICE] | MPU_RASR_XN_Msk | OS_MPU_RASR_AP(MPU_AP_FULL_ACCESS) |
+                OS_MPU_RASR_SIZE(OS_MPU_SIZE_4G) | MPU_RASR_ENABLE_Msk;
+    MPU->RBAR = 0x00000000 | MPU_RBAR_VALID_Msk | OS_MPU_REGION_CODE;
+    MPU->RASR = s_auwMpuMemAttr[MPU_MEM_NORMAL_WT] | OS_MPU_RASR_AP(MPU_AP_FULL_ACCESS) |
+                OS_MPU_RASR_SIZE(OS_MPU_SIZE_512M) | MPU_RASR_ENABLE_Msk;
+    MPU->RBAR = 0x20000000 | MPU_RBAR_VALID_Msk | OS_MPU_REGION_SRAM;
+    MPU->RASR = s_auwMpuMemAttr[MPU_MEM_NORMAL_WBWA] | OS_MPU_RASR_AP(MPU_AP_FULL_ACCESS) |
+                OS_MPU_RASR_SIZE(OS_MPU_SIZE_512M) | MPU_RASR_ENABLE_Msk;
+    MPU->RBAR = 0x60000000 | MPU_RBAR_VALID_Msk | OS_MPU_REGION_EXT_RAM_WBWA;
+    MPU->RASR = s_auwMpuMemAttr[MPU_MEM_NORMAL_WBWA] | OS_MPU_RASR_AP(MPU_AP_FULL_ACCESS) |
+                OS_MPU_RASR_SIZE(OS_MPU_SIZE_512M) | MPU_RASR_ENABLE_Msk;
+    MPU->RBAR = 0x80000000 | MPU_RBAR_VALID_Msk | OS_MPU_REGION_EXT_RAM_WT;
+    MPU->RASR = s_auwMpuMemAttr[MPU_MEM_NORMAL_WT] | OS_MPU_RASR_AP(MPU_AP_FULL_ACCESS) |
+                OS_MPU_RASR_SIZE(OS_MPU_SIZE_512M) | MPU_RASR_ENABLE_Msk;
+
+#if (LOSCFG_BASE_CORE_TSK_STACK_GUARD == YES)
+    /* left disabled until osMpuStackGuardStart places it below the stack of the first task */
+    MPU->RBAR = 0x00000000 | MPU_RBAR_VALID_Msk | OS_MPU_GUARD_REGION;
+    MPU->RASR = MPU_RASR_XN_Msk | OS_MPU_RASR_AP(MPU_AP_NO_ACCESS) | OS_MPU_RASR_SIZE(OS_MPU_SIZE_32B);
+#endif
+
+    m_pstHwiForm[OS_EXC_MPU_FAULT] = osMpuFaultHandler;
+    SCB->SHCSR |= SCB_SHCSR_MEMFAULTENA_Msk;
+
+    MPU->CTRL = MPU_CTRL_PRIVDEFENA_Msk | MPU_CTRL_ENABLE_Msk;
+    __DSB();
+    __ISB();
+
+    return LOS_OK;
+}
+
+#if (LOSCFG_BASE_CORE_TSK_STACK_GUARD == YES)
+/*****************************************************************************
+ Function    : osMpuStackGuardStart
+ Description : Place the stack guard and enable it
+ Input       : uwGuardAddr --- base address of the guard
+ Output      : None
+ Return      : None
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_INIT VOID osMpuStackGuardStart(UINT32 uwGuardAddr)
+{
+    MPU->RBAR = uwGuardAddr | MPU_RBAR_VALID_Msk | OS_MPU_GUARD_REGION;
+    MPU->RASR = MPU_RASR_XN_Msk | OS_MPU_RASR_AP(MPU_AP_NO_ACCESS) | OS_MPU_RASR_SIZE(OS_MPU_SIZE_32B) |
+                MPU_RASR_ENABLE_Msk;
+    __DSB();
+    __ISB();
+}
+#endif
+
+#endif /* LOSCFG_BASE_CORE_MPU == YES */
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* __cplusplus */
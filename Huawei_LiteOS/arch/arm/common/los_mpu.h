@@ -0,0 +1,329 @@
+/*----------------------------------------------------------------------------
+ * Copyright (c) <2013-2015>, <Huawei Technologies Co., Ltd>
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *---------------------------------------------------------------------------*/
+/*----------------------------------------------------------------------------
+ * Notice of Export Control Law
+ * ===============================================
+ * Huawei LiteOS may be subject to applicable export control laws and regulations, which might
+ * include those applicable to Huawei LiteOS of U.S. and the country in which you are located.
+ * Import, export and usage of Huawei LiteOS in any manner by you shall be in compliance with such
+ * applicable export control laws and regulations.
+ *---------------------------------------------------------------------------*/
+
+ /**@defgroup los_mpu MPU
+   *@ingroup kernel
+ */
+
+#ifndef _LOS_MPU_H
+#define _LOS_MPU_H
+
+#include "los_base.h"
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+#endif /* __cplusplus */
+
+/**
+ * @ingroup los_mpu
+ * MPU error code: The MPU is absent or has fewer regions than LOSCFG_MPU_MAX_SUPPORT.
+ *
+ * Value: 0x02001200
+ *
+ * Solution: Check LOSCFG_MPU_MAX_SUPPORT against the chip manual, or set LOSCFG_BASE_CORE_MPU to NO.
+ */
+#define LOS_ERRNO_MPU_NOT_SUPPORT                   LOS_ERRNO_OS_ERROR(LOS_MOD_MPU, 0x00)
+
+/**
+ * @ingroup los_mpu
+ * MPU error code: Null pointer.
+ *
+ * Value: 0x02001201
+ *
+ * Solution: Check whether the input parameter is null.
+ */
+#define LOS_ERRNO_MPU_PTR_NULL                      LOS_ERRNO_OS_ERROR(LOS_MOD_MPU, 0x01)
+
+/**
+ * @ingroup los_mpu
+ * MPU error code: The region number is out of range or used by the kernel.
+ *
+ * Value: 0x02001202
+ *
+ * Solution: Use a region in [LOS_MPU_REGION_FIRST, LOS_MPU_REGION_LAST].
+ */
+#define LOS_ERRNO_MPU_REGION_INVALID                LOS_ERRNO_OS_ERROR(LOS_MOD_MPU, 0x02)
+
+/**
+ * @ingroup los_mpu
+ * MPU error code: The region size is not a power of two in [32, 0x80000000].
+ *
+ * Value: 0x02001203
+ *
+ * Solution: Round the size up to a power of two of at least 32 bytes.
+ */
+#define LOS_ERRNO_MPU_SIZE_INVALID                  LOS_ERRNO_OS_ERROR(LOS_MOD_MPU, 0x03)
+
+/**
+ * @ingroup los_mpu
+ * MPU error code: The base address is not aligned on the region size or the region is outside
+ * [LOSCFG_MPU_MIN_ADDRESS, LOSCFG_MPU_MAX_ADDRESS].
+ *
+ * Value: 0x02001204
+ *
+ * Solution: Align the base address on the region size.
+ */
+#define LOS_ERRNO_MPU_ADDR_INVALID                  LOS_ERRNO_OS_ERROR(LOS_MOD_MPU, 0x04)
+
+/**
+ * @ingroup los_mpu
+ * MPU error code: The access permission or the memory type is invalid.
+ *
+ * Value: 0x02001205
+ *
+ * Solution: Use a value of #MPU_ACCESS_PERMISSION_E and of #MPU_MEMORY_TYPE_E.
+ */
+#define LOS_ERRNO_MPU_ATTR_INVALID                  LOS_ERRNO_OS_ERROR(LOS_MOD_MPU, 0x05)
+
+/**
+ * @ingroup los_mpu
+ * MPU error code: A task overflowed its stack into the guard region.
+ *
+ * Value: 0x02001206
+ *
+ * Solution: Increase the stack size of the task reported.
+ */
+#define LOS_ERRNO_MPU_STACK_OVERFLOW                LOS_ERRNO_OS_ERROR(LOS_MOD_MPU, 0x06)
+
+/**
+ * @ingroup los_mpu
+ * MPU error code: An access violated the permission of a region.
+ *
+ * Value: 0x02001207
+ *
+ * Solution: Check the address reported against the regions set.
+ */
+#define LOS_ERRNO_MPU_ACCESS_VIOLATION              LOS_ERRNO_OS_ERROR(LOS_MOD_MPU, 0x07)
+
+/**
+ * @ingroup los_mpu
+ * Number of the regions rebuilding the default memory map for the unprivileged tasks, region 0 to
+ * OS_MPU_BACKGROUND_REGION_NUM - 1.
+ */
+#define OS_MPU_BACKGROUND_REGION_NUM                5
+
+#if (LOSCFG_BASE_CORE_TSK_STACK_GUARD == YES)
+/**
+ * @ingroup los_mpu
+ * Region moved to the stack guard of the task switched in, the highest one so it wins over any other region.
+ */
+#define OS_MPU_GUARD_REGION                         (LOSCFG_MPU_MAX_SUPPORT - 1)
+
+/**
+ * @ingroup los_mpu
+ * Size of the stack guard, the smallest region.
+ */
+#define OS_MPU_STACK_GUARD_SIZE                     32
+#endif
+
+/**
+ * @ingroup los_mpu
+ * First region available to LOS_MpuRegionSet.
+ */
+#define LOS_MPU_REGION_FIRST                        OS_MPU_BACKGROUND_REGION_NUM
+
+/**
+ * @ingroup los_mpu
+ * Last region available to LOS_MpuRegionSet.
+ */
+#if (LOSCFG_BASE_CORE_TSK_STACK_GUARD == YES)
+#define LOS_MPU_REGION_LAST                         (OS_MPU_GUARD_REGION - 1)
+#else
+#define LOS_MPU_REGION_LAST                         (LOSCFG_MPU_MAX_SUPPORT - 1)
+#endif
+
+/**
+ * @ingroup los_mpu
+ * Access permission of a region, for the privileged code and the unprivileged tasks.
+ */
+typedef enum
+{
+    MPU_AP_NO_ACCESS = 0,           /**< No access                                      */
+    MPU_AP_PRIV_RW = 1,             /**< Privileged read/write, unprivileged no access  */
+    MPU_AP_PRIV_RW_USER_RO = 2,     /**< Privileged read/write, unprivileged read only  */
+    MPU_AP_FULL_ACCESS = 3,         /**< Read/write                                     */
+    MPU_AP_PRIV_RO = 5,             /**< Privileged read only, unprivileged no access   */
+    MPU_AP_READ_ONLY = 6            /**< Read only                                      */
+} MPU_ACCESS_PERMISSION_E;
+
+/**
+ * @ingroup los_mpu
+ * Memory type of a region.
+ */
+typedef enum
+{
+    MPU_MEM_STRONGLY_ORDERED = 0,   /**< Strongly-ordered                               */
+    MPU_MEM_DEVICE,                 /**< Shared device                                  */
+    MPU_MEM_NORMAL_WT,              /**< Normal, write-through, no write allocate       */
+    MPU_MEM_NORMAL_WB,              /**< Normal, write-back, no write allocate          */
+    MPU_MEM_NORMAL_NC,              /**< Normal, not cacheable                          */
+    MPU_MEM_NORMAL_WBWA,            /**< Normal, write-back, write and read allocate    */
+    MPU_MEM_BUTT
+} MPU_MEMORY_TYPE_E;
+
+/**
+ * @ingroup los_mpu
+ * Attributes of a region.
+ */
+typedef struct tagMpuRegionInfo
+{
+    UINT32  uwBaseAddress;          /**< Base address, aligned on uwSize                */
+    UINT32  uwSize;                 /**< Size, a power of two in [32, 0x80000000]       */
+    UINT8   ucAccessPermission;     /**< Access permission, #MPU_ACCESS_PERMISSION_E    */
+    UINT8   ucMemoryType;           /**< Memory type, #MPU_MEMORY_TYPE_E                */
+    UINT8   ucExecute;              /**< Instructions may be fetched from the region    */
+    UINT8   ucShareable;            /**< Normal memory shared between bus masters       */
+} MPU_REGION_INFO_S;
+
+/**
+ * @ingroup los_mpu
+ * @brief Set a region.
+ *
+ * @par Description:
+ * This API is used to set the attributes of a region and enable it.
+ *
+ * @attention
+ * <ul>
+ * <li>The regions below LOS_MPU_REGION_FIRST map the memory for the tasks, which run unprivileged, and the stack
+ * guard takes the region after LOS_MPU_REGION_LAST, both are kept by the kernel.</li>
+ * <li>Where regions overlap, the attributes of the highest region apply.</li>
+ * </ul>
+ *
+ * @param  uwRegion  [IN] Type #UINT32 Region number, in [LOS_MPU_REGION_FIRST, LOS_MPU_REGION_LAST].
+ * @param  pstInfo   [IN] Type #MPU_REGION_INFO_S * Attributes of the region.
+ *
+ * @retval #LOS_ERRNO_MPU_PTR_NULL          pstInfo is NULL.
+ * @retval #LOS_ERRNO_MPU_REGION_INVALID    uwRegion is out of range.
+ * @retval #LOS_ERRNO_MPU_SIZE_INVALID      The size is not a power of two in [32, 0x80000000].
+ * @retval #LOS_ERRNO_MPU_ADDR_INVALID      The base address is not aligned on the size or out of range.
+ * @retval #LOS_ERRNO_MPU_ATTR_INVALID      The access permission or the memory type is invalid.
+ * @retval #LOS_OK                          The region is set.
+ * @par Dependency:
+ * <ul><li>los_mpu.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_MpuRegionDisable
+ * @since Huawei LiteOS V100R001C00
+ */
+extern UINT32 LOS_MpuRegionSet(UINT32 uwRegion, MPU_REGION_INFO_S *pstInfo);
+
+/**
+ * @ingroup los_mpu
+ * @brief Disable a region.
+ *
+ * @par Description:
+ * This API is used to disable a region set by LOS_MpuRegionSet.
+ *
+ * @attention
+ * <ul>
+ * <li>None.</li>
+ * </ul>
+ *
+ * @param  uwRegion  [IN] Type #UINT32 Region number, in [LOS_MPU_REGION_FIRST, LOS_MPU_REGION_LAST].
+ *
+ * @retval #LOS_ERRNO_MPU_REGION_INVALID    uwRegion is out of range.
+ * @retval #LOS_OK                          The region is disabled.
+ * @par Dependency:
+ * <ul><li>los_mpu.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_MpuRegionSet
+ * @since Huawei LiteOS V100R001C00
+ */
+extern UINT32 LOS_MpuRegionDisable(UINT32 uwRegion);
+
+/**
+ * @ingroup los_mpu
+ * @brief Initialize the MPU.
+ *
+ * @par Description:
+ * This API is used to map the memory for the unprivileged tasks, install the MemManage handler and enable the MPU.
+ * The privileged code keeps the default memory map.
+ *
+ * @attention
+ * <ul>
+ * <li>It must be called after osHwiInit, which moves the vector table to RAM.</li>
+ * </ul>
+ *
+ * @param  None.
+ *
+ * @retval #LOS_ERRNO_MPU_NOT_SUPPORT       The MPU has fewer regions than LOSCFG_MPU_MAX_SUPPORT.
+ * @retval #LOS_OK                          The MPU is enabled.
+ * @par Dependency:
+ * <ul><li>los_mpu.h: the header file that contains the API declaration.</li></ul>
+ * @see None.
+ * @since Huawei LiteOS V100R001C00
+ */
+extern UINT32 osMpuInit(VOID);
+
+#if (LOSCFG_BASE_CORE_TSK_STACK_GUARD == YES)
+/**
+ * @ingroup los_mpu
+ * @brief Enable the stack guard.
+ *
+ * @par Description:
+ * This API is used to place the stack guard at uwGuardAddr and enable it, before the first task is started.
+ *
+ * @attention
+ * <ul>
+ * <li>uwGuardAddr must be aligned on OS_MPU_STACK_GUARD_SIZE.</li>
+ * </ul>
+ *
+ * @param  uwGuardAddr  [IN] Type #UINT32 Base address of the guard.
+ *
+ * @retval None.
+ * @par Dependency:
+ * <ul><li>los_mpu.h: the header file that contains the API declaration.</li></ul>
+ * @see osMpuStackGuardSet
+ * @since Huawei LiteOS V100R001C00
+ */
+extern VOID osMpuStackGuardStart(UINT32 uwGuardAddr);
+
+/**
+ * @ingroup los_mpu
+ * Move the stack guard to uwGuardAddr on a task switch, the size and the attributes set by osMpuStackGuardStart
+ * are kept so a single write of RBAR is needed.
+ */
+#define osMpuStackGuardSet(uwGuardAddr) \
+    do { \
+        MPU->RBAR = (UINT32)(uwGuardAddr) | MPU_RBAR_VALID_Msk | OS_MPU_GUARD_REGION; \
+        __DSB(); \
+    } while (0)
+#endif
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* __cplusplus */
+
+#endif /* _LOS_MPU_H */
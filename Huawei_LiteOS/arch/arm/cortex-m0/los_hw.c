@@ -88,6 +88,37 @@ VOID LOS_Schedule(VOID)
     (VOID)LOS_IntRestore(uvIntSave);
 }
 
+/*****************************************************************************
+ Function    : osClz
+ Description : Count leading zeros by nibble table lookup
+ Input       : uwValue --- value to be counted
+ Output      : None
+ Return      : Number of leading zero bits
+ *****************************************************************************/
+LITE_OS_SEC_TEXT UINT32 osClz(UINT32 uwValue)
+{
+    static const UINT8 aucClzTable[16] = {4, 3, 2, 2, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0};
+    UINT32 uwCount = 0;
+
+    if (0 == (uwValue & 0xFFFF0000))
+    {
+        uwCount += 16;
+        uwValue <<= 16;
+    }
+    if (0 == (uwValue & 0xFF000000))
+    {
+        uwCount += 8;
+        uwValue <<= 8;
+    }
+    if (0 == (uwValue & 0xF0000000))
+    {
+        uwCount += 4;
+        uwValue <<= 4;
+    }
+
+    return uwCount + aucClzTable[uwValue >> 28];
+}
+
 /*****************************************************************************
  Function    : osTaskExit
  Description : Task exit function
@@ -65,6 +65,13 @@ extern "C" {
  */
 #define LOS_CHECK_SCHEDULE          ((!g_usLosTaskLock))
 
+/**
+ * @ingroup los_hw
+ * Count leading zeros, used to find the highest ready priority.
+ * Cortex-M0 has no CLZ instruction, so a table lookup is used instead.
+ */
+#define OS_CLZ(uwValue)             osClz(uwValue)
+
 /**
  * @ingroup los_hw
  * Define the type of a task context control block.
@@ -157,6 +164,26 @@ extern VOID osSchedule(VOID);
  */
 extern VOID LOS_Schedule(VOID);
 
+/**
+ * @ingroup  los_hw
+ * @brief: Count leading zeros.
+ *
+ * @par Description:
+ * This API is used to count the leading zero bits of a word without the CLZ instruction.
+ *
+ * @attention:
+ * <ul><li>None.</li></ul>
+ *
+ * @param  uwValue  [IN] Type#UINT32: Value to be counted.
+ *
+ * @retval: Number of leading zero bits, 32 if uwValue is 0.
+ * @par Dependency:
+ * <ul><li>los_hw.h: the header file that contains the API declaration.</li></ul>
+ * @see None.
+ * @since Huawei LiteOS V100R001C00
+ */
+extern UINT32 osClz(UINT32 uwValue);
+
 
 
 /**
@@ -38,6 +38,9 @@
 #include "los_task.ph"
 #include "los_swtmr.h"
 #include "los_hwi.h"
+#if (LOSCFG_KERNEL_TICKLESS == YES)
+#include "los_tickless.ph"
+#endif
 
 #ifdef __cplusplus
 #if __cplusplus
@@ -116,6 +119,103 @@ LITE_OS_SEC_TEXT_MINOR VOID LOS_GetCpuCycle(UINT32 *puwCntHi, UINT32 *puwCntLo)
 
     return;
 }
+
+#if (LOSCFG_KERNEL_TICKLESS == YES)
+LITE_OS_SEC_BSS BOOL g_bSysTickReload;
+
+/*****************************************************************************
+Function   : osSysTickSleepStart
+Description: Stop the periodic tick and arm SysTick to fire after the given ticks
+Input   : uwSleepTicks --- ticks to sleep, counting the tick in progress
+output  : none
+return  : ticks armed, 0 if a tick interrupt is already pending
+*****************************************************************************/
+LITE_OS_SEC_TEXT UINT32 osSysTickSleepStart(UINT32 uwSleepTicks)
+{
+    UINT32 uwMaxTicks;
+    UINT32 uwCycles;
+
+    SysTick->CTRL &= ~SysTick_CTRL_ENABLE_Msk;
+    uwCycles = SysTick->VAL;
+    if (((SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) != 0) || (uwCycles == 0))
+    {
+        SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+        return 0;
+    }
+
+    uwMaxTicks = ((SysTick_LOAD_RELOAD_Msk - uwCycles) / g_uwCyclesPerTick) + 1;
+    if (uwSleepTicks > uwMaxTicks)
+    {
+        uwSleepTicks = uwMaxTicks;
+    }
+
+    /* the rest of the tick in progress plus (uwSleepTicks - 1) whole ticks */
+    SysTick->LOAD = uwCycles + ((uwSleepTicks - 1) * g_uwCyclesPerTick);
+    SysTick->VAL = 0;
+    SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+
+    return uwSleepTicks;
+}
+
+/*****************************************************************************
+Function   : osSysTickSleepEnd
+Description: Restore the periodic tick after a tickless sleep
+Input   : uwSleepTicks --- ticks armed by osSysTickSleepStart
+output  : none
+return  : whole ticks that passed without a tick interrupt
+*****************************************************************************/
+LITE_OS_SEC_TEXT UINT32 osSysTickSleepEnd(UINT32 uwSleepTicks)
+{
+    UINT32 uwCycles;
+    UINT32 uwTicksLeft;
+
+    SysTick->CTRL &= ~SysTick_CTRL_ENABLE_Msk;
+    if ((SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) != 0)
+    {
+        /* slept to the end, the pending tick interrupt accounts for the last tick */
+        SysTick->LOAD = g_uwCyclesPerTick - 1;
+        SysTick->VAL = 0;
+        SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+        g_bSysTickReload = FALSE;
+        return uwSleepTicks - 1;
+    }
+
+    /* woken early by another interrupt, run out the current tick and keep the tick boundary */
+    uwCycles = SysTick->VAL;
+    if (uwCycles == 0)
+    {
+        uwCycles = 1;
+    }
+    uwTicksLeft = (uwCycles + g_uwCyclesPerTick - 1) / g_uwCyclesPerTick;
+    uwCycles -= (uwTicksLeft - 1) * g_uwCyclesPerTick;
+
+    SysTick->LOAD = (uwCycles > 1) ? (uwCycles - 1) : 1;
+    SysTick->VAL = 0;
+    SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+    g_bSysTickReload = TRUE;
+
+    return uwSleepTicks - uwTicksLeft;
+}
+
+/*****************************************************************************
+Function   : osSysTickReload
+Description: Restore the full tick period after a shortened tick
+Input   : none
+output  : none
+return  : none
+*****************************************************************************/
+LITE_OS_SEC_TEXT VOID osSysTickReload(VOID)
+{
+    if (g_bSysTickReload)
+    {
+        g_bSysTickReload = FALSE;
+        SysTick->CTRL &= ~SysTick_CTRL_ENABLE_Msk;
+        SysTick->LOAD = g_uwCyclesPerTick - 1;
+        SysTick->VAL = 0;
+        SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+    }
+}
+#endif
 #ifdef __cplusplus
 #if __cplusplus
 }
@@ -33,6 +33,10 @@
  *---------------------------------------------------------------------------*/
 
 #include "los_hwi.h"
+#if (LOSCFG_BASE_CORE_CPUP_HWI == YES)
+#include "los_cpup.ph"
+#endif
+#include "los_trace.ph"
 
 #ifdef __cplusplus
 #if __cplusplus
@@ -40,6 +44,10 @@ extern "C" {
 #endif /* __cplusplus */
 #endif /* __cplusplus */
 
+#if (LOSCFG_ARCH_INT_LOCK_BASEPRI == YES)
+#error "Cortex-M0/M0+ has no BASEPRI, set LOSCFG_ARCH_INT_LOCK_BASEPRI to NO"
+#endif
+
 UINT32  g_vuwIntCount = 0;
 #ifdef LOS_LOCATION_VECTOR_IAR
 #pragma  location = ".vector"
@@ -114,12 +122,20 @@ LITE_OS_SEC_TEXT VOID  osInterrupt(VOID)
     LOS_IntRestore(uwIntSave);
 
     uwHwiIndex = osIntNumGet();
+#if (LOSCFG_BASE_CORE_CPUP_HWI == YES)
+    osCpupIrqStart(uwHwiIndex);
+#endif
+    OS_TRACE(LOS_TRACE_IRQ_ENTER, uwHwiIndex, 0);
 
     if (m_pstHwiSlaveForm[uwHwiIndex] !=0)
     {
         m_pstHwiSlaveForm[uwHwiIndex]();
     }
 
+#if (LOSCFG_BASE_CORE_CPUP_HWI == YES)
+    osCpupIrqEnd();
+#endif
+    OS_TRACE(LOS_TRACE_IRQ_EXIT, uwHwiIndex, 0);
     uwIntSave = LOS_IntLock();
     g_vuwIntCount--;
     LOS_IntRestore(uwIntSave);
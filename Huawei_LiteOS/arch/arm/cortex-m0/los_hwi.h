@@ -150,6 +150,12 @@ extern UINT32  g_vuwIntCount;
  */
 #define OS_M0_VECTOR_CNT            (OS_M0_SYS_VECTOR_CNT + OS_M0_IRQ_VECTOR_CNT)
 
+/**
+ * @ingroup los_hwi
+ * Count of system interrupt vectors, the exception number of hardware interrupt 0.
+ */
+#define OS_SYS_VECTOR_CNT           OS_M0_SYS_VECTOR_CNT
+
 /**
  * @ingroup los_hwi
  * Hardware interrupt error code: Invalid interrupt number.
@@ -236,6 +242,12 @@ extern UINT32  g_vuwIntCount;
  */
 #define OS_NVIC_AIRCR_PRIGROUP      7
 
+/**
+ * @ingroup los_hwi
+ * Check of the caller's interrupt priority, Cortex-M0 locks through PRIMASK only so there is nothing to check.
+ */
+#define OS_INT_PRIO_CHECK()
+
 /**
  * @ingroup los_hwi
  * Boot interrupt vector table.
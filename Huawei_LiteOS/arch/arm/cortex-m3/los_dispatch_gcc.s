@@ -15,6 +15,7 @@
         .extern  g_stLosTask
         .extern  g_pfnTskSwitchHook
         .extern  g_bTaskScheduled
+        .extern  g_uwOsIntLockBasepri
 
 .equ	OS_NVIC_INT_CTRL,            0xE000ED04
 .equ	OS_NVIC_SYSPRI2,             0xE000ED20
@@ -63,6 +64,8 @@ LOS_StartToRun:
     mov     lr, r5
     ;MSR     xPSR, R7
 
+    mov     r12, #0
+    msr     BASEPRI, r12
     cpsie   I
     bx      r6
 
@@ -71,16 +74,39 @@ LOS_IntNumGet:
     bx      lr
 
 LOS_IntLock:
+    ldr     r1, =g_uwOsIntLockBasepri
+    ldr     r1, [r1]
+    cbz     r1, IntLockAll
+    mrs     r0, BASEPRI
+    msr     BASEPRI_MAX, r1
+    isb
+    bx      lr
+IntLockAll:
     mrs     r0, PRIMASK
     cpsid   I
     bx      lr
 
 LOS_IntUnLock:
+    ldr     r1, =g_uwOsIntLockBasepri
+    ldr     r1, [r1]
+    cbz     r1, IntUnLockAll
+    mrs     r0, BASEPRI
+    mov     r1, #0
+    msr     BASEPRI, r1
+    bx      lr
+IntUnLockAll:
     mrs     r0, PRIMASK
     cpsie   I
     bx      lr
 
 LOS_IntRestore:
+    ldr     r1, =g_uwOsIntLockBasepri
+    ldr     r1, [r1]
+    cbz     r1, IntRestoreAll
+    msr     BASEPRI, r0
+    isb
+    bx      lr
+IntRestoreAll:
     msr     PRIMASK, r0
     bx      lr
 
@@ -109,8 +135,15 @@ SVC_Handler:
   
     .type osPendSV, %function
 osPendSV:
+    ldr     r3, =g_uwOsIntLockBasepri
+    ldr     r3, [r3]
+    cbz     r3, PendSVMaskAll
+    msr     BASEPRI, r3
+    b       PendSVMasked
+PendSVMaskAll:
     mrs     r12, PRIMASK
     cpsid   I
+PendSVMasked:
 
     ldr     r2, =g_pfnTskSwitchHook
     ldr     r2, [r2]
@@ -149,7 +182,15 @@ TaskSwitch:
     ldmfd   r1!, {r4-r12}
     msr     psp,  r1
 
+    ldr     r2, =g_uwOsIntLockBasepri
+    ldr     r2, [r2]
+    cbz     r2, PendSVUnmaskAll
+    mov     r2, #0
+    msr     BASEPRI, r2
+    b       PendSVUnmasked
+PendSVUnmaskAll:
     msr     PRIMASK, r12
+PendSVUnmasked:
 
     mrs     r0, CONTROL
     orr     r0, r0, #1
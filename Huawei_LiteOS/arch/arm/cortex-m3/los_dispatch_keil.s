@@ -45,6 +45,7 @@
         IMPORT  g_stLosTask
         IMPORT  g_pfnTskSwitchHook
         IMPORT  g_bTaskScheduled
+        IMPORT  g_uwOsIntLockBasepri
 
 OS_NVIC_INT_CTRL            EQU     0xE000ED04
 OS_NVIC_SYSPRI2             EQU     0xE000ED20
@@ -90,6 +91,8 @@ LOS_StartToRun
     MOV     LR, R5
    ;MSR     xPSR, R7
 
+    MOV     R12, #0
+    MSR     BASEPRI, R12
     CPSIE   I
     BX      R6
 
@@ -98,16 +101,39 @@ LOS_IntNumGet
     BX      LR
 
 LOS_IntLock
+    LDR     R1, =g_uwOsIntLockBasepri
+    LDR     R1, [R1]
+    CBZ     R1, IntLockAll
+    MRS     R0, BASEPRI
+    MSR     BASEPRI_MAX, R1
+    ISB
+    BX      LR
+IntLockAll
     MRS     R0, PRIMASK
     CPSID   I
     BX      LR
 
 LOS_IntUnLock
+    LDR     R1, =g_uwOsIntLockBasepri
+    LDR     R1, [R1]
+    CBZ     R1, IntUnLockAll
+    MRS     R0, BASEPRI
+    MOV     R1, #0
+    MSR     BASEPRI, R1
+    BX      LR
+IntUnLockAll
     MRS     R0, PRIMASK
     CPSIE   I
     BX      LR
 
 LOS_IntRestore
+    LDR     R1, =g_uwOsIntLockBasepri
+    LDR     R1, [R1]
+    CBZ     R1, IntRestoreAll
+    MSR     BASEPRI, R0
+    ISB
+    BX      LR
+IntRestoreAll
     MSR     PRIMASK, R0
     BX      LR
 
@@ -118,8 +144,15 @@ osTaskSchedule
     BX      LR
 
 osPendSV
+    LDR     R3, =g_uwOsIntLockBasepri
+    LDR     R3, [R3]
+    CBZ     R3, PendSVMaskAll
+    MSR     BASEPRI, R3
+    B       PendSVMasked
+PendSVMaskAll
     MRS     R12, PRIMASK
     CPSID   I
+PendSVMasked
 
     LDR     R2, =g_pfnTskSwitchHook
     LDR     R2, [R2]
@@ -158,7 +191,15 @@ TaskSwitch
     LDMFD   R1!, {R4-R12}
     MSR     PSP,  R1
 
+    LDR     R2, =g_uwOsIntLockBasepri
+    LDR     R2, [R2]
+    CBZ     R2, PendSVUnmaskAll
+    MOV     R2, #0
+    MSR     BASEPRI, R2
+    B       PendSVUnmasked
+PendSVUnmaskAll
     MSR     PRIMASK, R12
+PendSVUnmasked
     BX      LR
 
     END
@@ -65,6 +65,12 @@ extern "C" {
  */
 #define LOS_CHECK_SCHEDULE          ((!g_usLosTaskLock))
 
+/**
+ * @ingroup los_hw
+ * Count leading zeros, used to find the highest ready priority.
+ */
+#define OS_CLZ(uwValue)             __CLZ(uwValue)
+
 /**
  * @ingroup los_hw
  * Define the type of a task context control block.
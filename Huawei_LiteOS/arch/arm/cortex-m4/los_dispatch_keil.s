@@ -45,11 +45,14 @@
         IMPORT  g_stLosTask
         IMPORT  g_pfnTskSwitchHook
         IMPORT  g_bTaskScheduled
+        IMPORT  g_uwOsIntLockBasepri
 
 OS_NVIC_INT_CTRL            EQU     0xE000ED04
 OS_NVIC_SYSPRI2             EQU     0xE000ED20
 OS_NVIC_PENDSV_PRI          EQU     0xF0F00000
 OS_NVIC_PENDSVSET           EQU     0x10000000
+OS_FPU_FPCCR                EQU     0xE000EF34
+OS_FPU_FPCCR_LAZY           EQU     0xC0000000
 OS_TASK_STATUS_RUNNING      EQU     0x0010
 
     AREA    |.text|, CODE, READONLY
@@ -61,6 +64,11 @@ LOS_StartToRun
     LDR     R5, =OS_NVIC_PENDSV_PRI
     STR     R5, [R4]
 
+    LDR     R4, =OS_FPU_FPCCR
+    LDR     R5, [R4]
+    ORR     R5, R5, #OS_FPU_FPCCR_LAZY
+    STR     R5, [R4]
+
     LDR     R0, =g_bTaskScheduled
     MOV     R1, #1
     STR     R1, [R0]
@@ -82,17 +90,16 @@ LOS_StartToRun
     STRH    R7,  [R0 , #4]
 
     LDR     R12, [R0]
-    ADD     R12, R12, #100
+    ADD     R12, R12, #40
 
     LDMFD   R12!, {R0-R7}
-    ADD     R12, R12, #72
     MSR     PSP, R12
-    VPUSH   S0;
-    VPOP    S0;
 
     MOV     LR, R5
    ;MSR     xPSR, R7
 
+    MOV     R12, #0
+    MSR     BASEPRI, R12
     CPSIE   I
     BX      R6
 
@@ -101,16 +108,39 @@ LOS_IntNumGet
     BX      LR
 
 LOS_IntLock
+    LDR     R1, =g_uwOsIntLockBasepri
+    LDR     R1, [R1]
+    CBZ     R1, IntLockAll
+    MRS     R0, BASEPRI
+    MSR     BASEPRI_MAX, R1
+    ISB
+    BX      LR
+IntLockAll
     MRS     R0, PRIMASK
     CPSID   I
     BX      LR
 
 LOS_IntUnLock
+    LDR     R1, =g_uwOsIntLockBasepri
+    LDR     R1, [R1]
+    CBZ     R1, IntUnLockAll
+    MRS     R0, BASEPRI
+    MOV     R1, #0
+    MSR     BASEPRI, R1
+    BX      LR
+IntUnLockAll
     MRS     R0, PRIMASK
     CPSIE   I
     BX      LR
 
 LOS_IntRestore
+    LDR     R1, =g_uwOsIntLockBasepri
+    LDR     R1, [R1]
+    CBZ     R1, IntRestoreAll
+    MSR     BASEPRI, R0
+    ISB
+    BX      LR
+IntRestoreAll
     MSR     PRIMASK, R0
     BX      LR
 
@@ -121,8 +151,15 @@ osTaskSchedule
     BX      LR
 
 osPendSV
+    LDR     R3, =g_uwOsIntLockBasepri
+    LDR     R3, [R3]
+    CBZ     R3, PendSVMaskAll
+    MSR     BASEPRI, R3
+    B       PendSVMasked
+PendSVMaskAll
     MRS     R12, PRIMASK
     CPSID   I
+PendSVMasked
 
     LDR     R2, =g_pfnTskSwitchHook
     LDR     R2, [R2]
@@ -134,8 +171,10 @@ osPendSV
 TaskSwitch
     MRS     R0, PSP
 
-    STMFD   R0!, {R4-R12}
-    VSTMDB  R0!, {D8-D15}
+    TST     LR, #0x10
+    IT      EQ
+    VSTMDBEQ R0!, {D8-D15}
+    STMFD   R0!, {R4-R12, LR}
 
     LDR     R5, =g_stLosTask
     LDR     R6, [R5]
@@ -159,11 +198,21 @@ TaskSwitch
     STRH    R7,  [R0 , #4]
 
     LDR     R1,   [R0]
-    VLDMIA  R1!, {D8-D15}
-    LDMFD   R1!, {R4-R12}
+    LDMFD   R1!, {R4-R12, LR}
+    TST     LR, #0x10
+    IT      EQ
+    VLDMIAEQ R1!, {D8-D15}
     MSR     PSP,  R1
 
+    LDR     R2, =g_uwOsIntLockBasepri
+    LDR     R2, [R2]
+    CBZ     R2, PendSVUnmaskAll
+    MOV     R2, #0
+    MSR     BASEPRI, R2
+    B       PendSVUnmasked
+PendSVUnmaskAll
     MSR     PRIMASK, R12
+PendSVUnmasked
     BX      LR
 
     END
@@ -65,28 +65,20 @@ extern "C" {
  */
 #define LOS_CHECK_SCHEDULE          ((!g_usLosTaskLock))
 
+/**
+ * @ingroup los_hw
+ * Count leading zeros, used to find the highest ready priority.
+ */
+#define OS_CLZ(uwValue)             __CLZ(uwValue)
+
 /**
  * @ingroup los_hw
  * Define the type of a task context control block.
+ * While a task owns an FP context (bit 4 of uwExcReturn clear), S16-S31 are saved between
+ * uwExcReturn and uwR0, and the hardware frame is extended with S0-S15 and FPSCR.
  */
 typedef struct tagTskContext
 {
-    UINT32 S16;
-    UINT32 S17;
-    UINT32 S18;
-    UINT32 S19;
-    UINT32 S20;
-    UINT32 S21;
-    UINT32 S22;
-    UINT32 S23;
-    UINT32 S24;
-    UINT32 S25;
-    UINT32 S26;
-    UINT32 S27;
-    UINT32 S28;
-    UINT32 S29;
-    UINT32 S30;
-    UINT32 S31;
     UINT32 uwR4;
     UINT32 uwR5;
     UINT32 uwR6;
@@ -96,6 +88,7 @@ typedef struct tagTskContext
     UINT32 uwR10;
     UINT32 uwR11;
     UINT32 uwPriMask;
+    UINT32 uwExcReturn;
     UINT32 uwR0;
     UINT32 uwR1;
     UINT32 uwR2;
@@ -104,24 +97,6 @@ typedef struct tagTskContext
     UINT32 uwLR;
     UINT32 uwPC;
     UINT32 uwxPSR;
-    UINT32 S0;
-    UINT32 S1;
-    UINT32 S2;
-    UINT32 S3;
-    UINT32 S4;
-    UINT32 S5;
-    UINT32 S6;
-    UINT32 S7;
-    UINT32 S8;
-    UINT32 S9;
-    UINT32 S10;
-    UINT32 S11;
-    UINT32 S12;
-    UINT32 S13;
-    UINT32 S14;
-    UINT32 S15;
-    UINT32 FPSCR;
-    UINT32 NO_NAME;
 } TSK_CONTEXT_S;
 
 
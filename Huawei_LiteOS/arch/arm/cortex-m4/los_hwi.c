@@ -33,6 +33,10 @@
  *---------------------------------------------------------------------------*/
 
 #include "los_hwi.h"
+#if (LOSCFG_BASE_CORE_CPUP_HWI == YES)
+#include "los_cpup.ph"
+#endif
+#include "los_trace.ph"
 //#include "los_sr.h"
 
 #ifdef __cplusplus
@@ -42,6 +46,16 @@ extern "C" {
 #endif /* __cplusplus */
 
 UINT32  g_vuwIntCount = 0;
+
+#if (LOSCFG_ARCH_INT_LOCK_BASEPRI == YES)
+#if ((LOSCFG_ARCH_INT_LOCK_BASEPRI_PRIO == 0) || (LOSCFG_ARCH_INT_LOCK_BASEPRI_PRIO > OS_HWI_PRIO_LOWEST))
+#error "LOSCFG_ARCH_INT_LOCK_BASEPRI_PRIO must be in [1, OS_HWI_PRIO_LOWEST]"
+#endif
+/* BASEPRI value written by LOS_IntLock and osPendSV, 0 selects PRIMASK */
+UINT32  g_uwOsIntLockBasepri = (LOSCFG_ARCH_INT_LOCK_BASEPRI_PRIO << (8 - __NVIC_PRIO_BITS));
+#else
+UINT32  g_uwOsIntLockBasepri = 0;
+#endif
 #ifdef LOS_LOCATION_VECTOR_IAR
 #pragma  location = ".vector"
 #endif
@@ -81,6 +95,38 @@ LITE_OS_SEC_TEXT_MINOR UINT32 osIntNumGet(VOID)
     return uwIntNum;
 }
 
+#if ((LOSCFG_ARCH_INT_LOCK_BASEPRI == YES) && (LOSCFG_ARCH_INT_PRIO_CHECK == YES))
+/*****************************************************************************
+ Function    : osIntPrioCheck
+ Description : Check that the running exception can be masked by LOS_IntLock
+ Input       : None
+ Output      : None
+ Return      : LOS_OK or OS_ERRNO_HWI_PRIO_ABOVE_LOCK
+ *****************************************************************************/
+LITE_OS_SEC_TEXT UINT32 osIntPrioCheck(VOID)
+{
+    UINT32 uwExcNum = __get_IPSR() & 0x1FF;
+
+    if (uwExcNum == 0)
+    {
+        return LOS_OK;
+    }
+
+    /* NMI and HardFault have fixed negative priorities, BASEPRI never masks them */
+    if (uwExcNum < 4)
+    {
+        return OS_ERRNO_HWI_PRIO_ABOVE_LOCK;
+    }
+
+    if (NVIC_GetPriority((IRQn_Type)((INT32)uwExcNum - OS_SYS_VECTOR_CNT)) < LOSCFG_ARCH_INT_LOCK_BASEPRI_PRIO)
+    {
+        return OS_ERRNO_HWI_PRIO_ABOVE_LOCK;
+    }
+
+    return LOS_OK;
+}
+#endif
+
 /*****************************************************************************
  Function    : osHwiDefaultHandler
  Description : default handler of the hardware interrupt
@@ -115,12 +161,20 @@ LITE_OS_SEC_TEXT VOID  osInterrupt(VOID)
     LOS_IntRestore(uwIntSave);
 
     uwHwiIndex = osIntNumGet();
+#if (LOSCFG_BASE_CORE_CPUP_HWI == YES)
+    osCpupIrqStart(uwHwiIndex);
+#endif
+    OS_TRACE(LOS_TRACE_IRQ_ENTER, uwHwiIndex, 0);
 
     if (m_pstHwiSlaveForm[uwHwiIndex] !=0)
     {
         m_pstHwiSlaveForm[uwHwiIndex]();
     }
 
+#if (LOSCFG_BASE_CORE_CPUP_HWI == YES)
+    osCpupIrqEnd();
+#endif
+    OS_TRACE(LOS_TRACE_IRQ_EXIT, uwHwiIndex, 0);
     uwIntSave = LOS_IntLock();
     g_vuwIntCount--;
     LOS_IntRestore(uwIntSave);
@@ -185,7 +239,17 @@ LITE_OS_SEC_TEXT_INIT UINT32 LOS_HwiCreate( HWI_HANDLE_T  uwHwiNum,
 
     uvIntSave = LOS_IntLock();
 
-    osSetVector(uwHwiNum, pfnHandler);
+#if (LOSCFG_ARCH_INT_LOCK_BASEPRI == YES)
+    if (usHwiPrio < LOSCFG_ARCH_INT_LOCK_BASEPRI_PRIO)
+    {
+        /* above the kernel mask: vector straight to the handler, it must not call the kernel */
+        m_pstHwiForm[uwHwiNum + OS_M4_SYS_VECTOR_CNT] = pfnHandler;
+    }
+    else
+#endif
+    {
+        osSetVector(uwHwiNum, pfnHandler);
+    }
 
     NVIC_EnableIRQ((IRQn_Type)uwHwiNum);
 
@@ -15,11 +15,14 @@
         .extern  g_stLosTask
         .extern  g_pfnTskSwitchHook
         .extern  g_bTaskScheduled
+        .extern  g_uwOsIntLockBasepri
 
 .equ	OS_NVIC_INT_CTRL,            0xE000ED04
 .equ	OS_NVIC_SYSPRI2,             0xE000ED20
 .equ	OS_NVIC_PENDSV_PRI,          0xF0F00000
 .equ	OS_NVIC_PENDSVSET,           0x10000000
+.equ	OS_FPU_FPCCR,                0xE000EF34
+.equ	OS_FPU_FPCCR_LAZY,           0xC0000000
 .equ	OS_TASK_STATUS_RUNNING,      0x0010
 
     .section .text 
@@ -30,6 +33,11 @@ LOS_StartToRun:
     ldr     r5, =OS_NVIC_PENDSV_PRI
     str     r5, [r4]
 
+    ldr     r4, =OS_FPU_FPCCR
+    ldr     r5, [r4]
+    orr     r5, r5, #OS_FPU_FPCCR_LAZY
+    str     r5, [r4]
+
     ldr     r0, =g_bTaskScheduled
     mov     r1, #1
     str     r1, [r0]
@@ -51,21 +59,20 @@ LOS_StartToRun:
     strh    r7,  [r0 , #4]
 
     ldr     r12, [r0]
-    add     r12, r12, #100
+    add     r12, r12, #40
 
     ldmfd   r12!, {r0-r7}
-    add     r12, r12, #72
     msr     psp, r12
     push    {r0}
     mov     r0, #3
     msr     CONTROL, r0
     pop     {r0}
-    vpush    {s0}
-    vpop     {s0}
 
     mov     lr, r5
     ;MSR     xPSR, R7
 
+    mov     r12, #0
+    msr     BASEPRI, r12
     cpsie   I
     bx      r6
 
@@ -74,16 +81,39 @@ LOS_IntNumGet:
     bx      lr
 
 LOS_IntLock:
+    ldr     r1, =g_uwOsIntLockBasepri
+    ldr     r1, [r1]
+    cbz     r1, IntLockAll
+    mrs     r0, BASEPRI
+    msr     BASEPRI_MAX, r1
+    isb
+    bx      lr
+IntLockAll:
     mrs     r0, PRIMASK
     cpsid   I
     bx      lr
 
 LOS_IntUnLock:
+    ldr     r1, =g_uwOsIntLockBasepri
+    ldr     r1, [r1]
+    cbz     r1, IntUnLockAll
+    mrs     r0, BASEPRI
+    mov     r1, #0
+    msr     BASEPRI, r1
+    bx      lr
+IntUnLockAll:
     mrs     r0, PRIMASK
     cpsie   I
     bx      lr
 
 LOS_IntRestore:
+    ldr     r1, =g_uwOsIntLockBasepri
+    ldr     r1, [r1]
+    cbz     r1, IntRestoreAll
+    msr     BASEPRI, r0
+    isb
+    bx      lr
+IntRestoreAll:
     msr     PRIMASK, r0
     bx      lr
 
@@ -112,8 +142,15 @@ SVC_Handler:
   
     .type osPendSV, %function
 osPendSV:
+    ldr     r3, =g_uwOsIntLockBasepri
+    ldr     r3, [r3]
+    cbz     r3, PendSVMaskAll
+    msr     BASEPRI, r3
+    b       PendSVMasked
+PendSVMaskAll:
     mrs     r12, PRIMASK
     cpsid   I
+PendSVMasked:
 
     ldr     r2, =g_pfnTskSwitchHook
     ldr     r2, [r2]
@@ -125,8 +162,10 @@ osPendSV:
 TaskSwitch:
     mrs     r0, psp
 
-    stmfd   r0!, {r4-r12}
-    vstmdb  r0!, {d8-d15}
+    tst     lr, #0x10
+    it      eq
+    vstmdbeq r0!, {d8-d15}
+    stmfd   r0!, {r4-r12, lr}
 
     ldr     r5, =g_stLosTask
     ldr     r6, [r5]
@@ -150,11 +189,21 @@ TaskSwitch:
     strh    r7,  [r0 , #4]
 
     ldr     r1,   [r0]
-    vldmia  r1!, {d8-d15}
-    ldmfd   r1!, {r4-r12}
+    ldmfd   r1!, {r4-r12, lr}
+    tst     lr, #0x10
+    it      eq
+    vldmiaeq r1!, {d8-d15}
     msr     psp,  r1
 
+    ldr     r2, =g_uwOsIntLockBasepri
+    ldr     r2, [r2]
+    cbz     r2, PendSVUnmaskAll
+    mov     r2, #0
+    msr     BASEPRI, r2
+    b       PendSVUnmasked
+PendSVUnmaskAll:
     msr     PRIMASK, r12
+PendSVUnmasked:
 
     mrs     r0, CONTROL
     orr     r0, r0, #1
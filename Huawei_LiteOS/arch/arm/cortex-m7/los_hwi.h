@@ -90,6 +90,12 @@ typedef VOID (**HWI_VECTOR_FUNC)(void);
  */
 extern UINT32  g_vuwIntCount;
 
+/**
+ * @ingroup los_hwi
+ * BASEPRI value used by LOS_IntLock, 0 when interrupts are locked through PRIMASK.
+ */
+extern UINT32  g_uwOsIntLockBasepri;
+
 /**
  * @ingroup los_hwi
  * An interrupt is active.
@@ -150,6 +156,12 @@ extern UINT32  g_vuwIntCount;
  */
 #define OS_M7_VECTOR_CNT            (OS_M7_SYS_VECTOR_CNT + OS_M7_IRQ_VECTOR_CNT)
 
+/**
+ * @ingroup los_hwi
+ * Count of system interrupt vectors, the exception number of hardware interrupt 0.
+ */
+#define OS_SYS_VECTOR_CNT           OS_M7_SYS_VECTOR_CNT
+
 /**
  * @ingroup los_hwi
  * Hardware interrupt error code: Invalid interrupt number.
@@ -230,11 +242,43 @@ extern UINT32  g_vuwIntCount;
  */
 #define OS_ERRNO_HWI_FASTMODE_ALREADY_CREATED               LOS_ERRNO_OS_ERROR(LOS_MOD_HWI, 0x07)
 
+/**
+ * @ingroup los_hwi
+ * Hardware interrupt error code: A kernel API is called from an interrupt above the BASEPRI lock threshold.
+ *
+ * Value: 0x02000908
+ *
+ * Solution: Do not call kernel APIs from interrupts with a priority higher than LOSCFG_ARCH_INT_LOCK_BASEPRI_PRIO.
+ */
+#define OS_ERRNO_HWI_PRIO_ABOVE_LOCK                        LOS_ERRNO_OS_ERROR(LOS_MOD_HWI, 0x08)
+
 /**
  * @ingroup los_hwi
  * AIRCR register priority group parameter .
+ * With BASEPRI locking every implemented priority bit must be a preemption bit, otherwise BASEPRI cannot
+ * tell the interrupts above the threshold from the ones below it.
  */
+#if (LOSCFG_ARCH_INT_LOCK_BASEPRI == YES)
+#define OS_NVIC_AIRCR_PRIGROUP      (7 - __NVIC_PRIO_BITS)
+#else
 #define OS_NVIC_AIRCR_PRIGROUP      7
+#endif
+
+#if ((LOSCFG_ARCH_INT_LOCK_BASEPRI == YES) && (LOSCFG_ARCH_INT_PRIO_CHECK == YES))
+/**
+ * @ingroup los_hwi
+ * Reject a kernel API call made from an interrupt above the BASEPRI lock threshold.
+ */
+#define OS_INT_PRIO_CHECK() \
+    do { \
+        if (osIntPrioCheck() != LOS_OK) \
+        { \
+            return OS_ERRNO_HWI_PRIO_ABOVE_LOCK; \
+        } \
+    } while (0)
+#else
+#define OS_INT_PRIO_CHECK()
+#endif
 
 /**
  * @ingroup los_hwi
@@ -514,6 +558,29 @@ extern VOID  osInterrupt(VOID);
  */
 extern UINT32 osIntNumGet(VOID);
 
+#if ((LOSCFG_ARCH_INT_LOCK_BASEPRI == YES) && (LOSCFG_ARCH_INT_PRIO_CHECK == YES))
+/**
+ * @ingroup  los_hwi
+ * @brief: Check the priority of the running exception.
+ *
+ * @par Description:
+ * This API is used to check that the caller does not run in an exception that LOS_IntLock cannot mask.
+ *
+ * @attention:
+ * <ul><li>Thread mode and exceptions at or below LOSCFG_ARCH_INT_LOCK_BASEPRI_PRIO pass. NMI and HardFault always fail.</li></ul>
+ *
+ * @param: None.
+ *
+ * @retval: #LOS_OK                          The caller may use the kernel.
+ * @retval: #OS_ERRNO_HWI_PRIO_ABOVE_LOCK    The caller runs above the BASEPRI lock threshold.
+ * @par Dependency:
+ * <ul><li>los_hwi.h: the header file that contains the API declaration.</li></ul>
+ * @see None.
+ * @since Huawei LiteOS V100R001C00
+ */
+extern UINT32 osIntPrioCheck(VOID);
+#endif
+
 
 
 /**
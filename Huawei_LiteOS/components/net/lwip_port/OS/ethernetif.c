@@ -53,13 +53,19 @@
 #include "ethernetif.h"
 #include "stm32f429_eth.h"
 #include "netconf.h"
+#include "los_workqueue.h"
 #include <string.h>
 
+#if (LOSCFG_KERNEL_WORKQUEUE == NO)
+#error "ethernetif receives through a threaded interrupt, should make LOSCFG_KERNEL_WORKQUEUE = YES"
+#endif
+
 
 
 
 #define netifINTERFACE_TASK_STACK_SIZE		      ( 4096u )
 #define netifINTERFACE_TASK_PRIORITY		        ( 4u   )
+#define netifINTERFACE_IRQ_PRIORITY		          ( 6u   )
 
 /* Define those to better describe your network interface. */
 #define IFNAME0 's'
@@ -86,8 +92,9 @@ extern ETH_DMADESCTypeDef  *DMARxDescToGet;
 extern ETH_DMA_Rx_Frame_infos *DMA_RX_FRAME_infos;
 
 
-//void ethernetif_input( void * pvParameters );
 static void arp_timer(void *arg);
+static UINT32 ethernetif_irq(HWI_ARG_T arg);
+static void ethernetif_irq_thread(HWI_ARG_T arg);
 
 
 /**
@@ -96,10 +103,13 @@ static void arp_timer(void *arg);
 *
 * @param netif the already initialized lwip network interface structure
 *        for this ethernetif
+* @return ERR_OK if the hardware is running
+*         ERR_IF if the receive interrupt could not be set up
 */
-static void low_level_init(struct netif *netif)
+static err_t low_level_init(struct netif *netif)
 {
   uint32_t i;
+  UINT32 wq;
 
   /* set netif MAC hardware address length */
   netif->hwaddr_len = ETHARP_HWADDR_LEN;
@@ -144,11 +154,24 @@ static void low_level_init(struct netif *netif)
   } 
 #endif
 
-  /* create the task that handles the ETH_MAC */
-  sys_thread_new((char *)"Eth_if",ethernetif_input,netif,netifINTERFACE_TASK_STACK_SIZE,netifINTERFACE_TASK_PRIORITY);
-	
+  /* received frames are handled by a threaded interrupt running in the Eth_if worker task */
+  if (LOS_WorkQueueCreate("Eth_if", netifINTERFACE_TASK_PRIORITY, 1, netifINTERFACE_TASK_STACK_SIZE, &wq) != LOS_OK)
+  {
+    printf("ethernetif: work queue create failed\r\n");
+    return ERR_IF;
+  }
+  if (LOS_HwiCreateThreaded(ETH_IRQn, netifINTERFACE_IRQ_PRIORITY, ethernetif_irq, ethernetif_irq_thread, (HWI_ARG_T)netif, wq) != LOS_OK)
+  {
+    printf("ethernetif: threaded interrupt create failed\r\n");
+    (void)LOS_WorkQueueDelete(wq);
+    return ERR_IF;
+  }
+  ETH_DMAITConfig(ETH_DMA_IT_NIS | ETH_DMA_IT_R, ENABLE);
+
 	/* Enable MAC and DMA transmission and reception */
 	ETH_Start();   
+
+  return ERR_OK;
 }
 
 
@@ -347,43 +370,55 @@ static struct pbuf * low_level_input(struct netif *netif)
 
 
 /**
-* This function is the ethernetif_input task, it is processed when a packet 
-* is ready to be read from the interface. It uses the function low_level_input() 
+* This function is called by the threaded receive interrupt when packets
+* are ready to be read from the interface. It uses the function low_level_input()
 * that should handle the actual reception of bytes from the network
-* interface. Then the type of the received packet is determined and
-* the appropriate input function is called.
+* interface, until no received frame is left. Then the type of each received
+* packet is determined and the appropriate input function is called.
 *
 * @param netif the lwip network interface structure for this ethernetif
 */
-void ethernetif_input( void * pvParameters )
+void ethernetif_input(struct netif *netif)
 {
   struct pbuf *p;
-  UINT32   uwInterval = 0;
-  //UINT32   uwRet = 0;
   err_t err;
-  
-  /* move received packet into a new pbuf */
+
+  /* move received packets into new pbufs */
   while (1)
   {
 		SYS_ARCH_DECL_PROTECT(sr);
 		
 		SYS_ARCH_PROTECT(sr);
-    p = low_level_input(s_pxNetIf);
+    p = low_level_input(netif);
 		SYS_ARCH_UNPROTECT(sr);
-    if (p == NULL)	
-      continue;
-		err = s_pxNetIf->input(p, s_pxNetIf);
+    if (p == NULL)
+      break;
+		err = netif->input(p, netif);
 		if (err != ERR_OK){
 			LWIP_DEBUGF(NETIF_DEBUG, ("ethernetif_input: IP input error\n"));
 			pbuf_free(p);
 			p = NULL;
 		}
-    /*sleep 5 ms*/ 
-    uwInterval = LOS_MS2Tick(5);
-    LOS_TaskDelay(uwInterval);
   }
 }
 
+/**
+* Top half of the Ethernet interrupt: acknowledge the receive interrupt and
+* wake the threaded handler, the interrupt stays masked until it returns.
+*/
+static UINT32 ethernetif_irq(HWI_ARG_T arg)
+{
+  (void)arg;
+  ETH_DMAClearITPendingBit(ETH_DMA_IT_R);
+  ETH_DMAClearITPendingBit(ETH_DMA_IT_NIS);
+  return LOS_HWI_WAKE_THREAD;
+}
+
+static void ethernetif_irq_thread(HWI_ARG_T arg)
+{
+  ethernetif_input((struct netif *)arg);
+}
+
 /**
 * Should be called at the beginning of the program to set up the
 * network interface. It calls the function low_level_init() to do the
@@ -413,7 +448,10 @@ err_t ethernetif_init(struct netif *netif)
 	
 
   /* initialize the hardware */
-  low_level_init(netif);
+  if (low_level_init(netif) != ERR_OK)
+  {
+    return ERR_IF;
+  }
 
   etharp_init();
   sys_timeout(ARP_TMR_INTERVAL, arp_timer, NULL);
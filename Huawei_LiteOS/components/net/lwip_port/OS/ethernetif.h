@@ -7,5 +7,5 @@
 
 
 err_t ethernetif_init(struct netif *netif);
-void ethernetif_input( void * pvParameters );
+void ethernetif_input(struct netif *netif);
 #endif 
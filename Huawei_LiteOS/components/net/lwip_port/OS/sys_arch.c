@@ -542,7 +542,7 @@ u32_t sys_arch_sem_wait(sys_sem_t *sem, u32_t timeout)
       if(!timeout)
         timeout = 1;
     }
-    retval = LOS_SemPend(sem->sem->usSemID, timeout);
+    retval = LOS_SemPend(sem->sem->uwSemID, timeout);
     if (retval != ERR_OK)
     {
         return SYS_ARCH_TIMEOUT;
@@ -571,7 +571,7 @@ void sys_sem_signal(sys_sem_t *sem)
         return;
     }
 
-    uwRet = LOS_SemPost(sem->sem->usSemID);
+    uwRet = LOS_SemPost(sem->sem->uwSemID);
     if (uwRet != ERR_OK)
     {
         return;
@@ -599,7 +599,7 @@ void sys_sem_free(sys_sem_t *sem)
         return;
     }
 
-    uwRet = LOS_SemDelete(sem->sem->usSemID);
+    uwRet = LOS_SemDelete(sem->sem->uwSemID);
     LWIP_ASSERT("LOS_SemDelete failed", (uwRet == 0));
 
     ((void)(uwRet));
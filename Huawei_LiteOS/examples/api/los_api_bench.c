@@ -0,0 +1,92 @@
+/*----------------------------------------------------------------------------
+ * Copyright (c) <2013-2015>, <Huawei Technologies Co., Ltd>
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *---------------------------------------------------------------------------*/
+/*----------------------------------------------------------------------------
+ * Notice of Export Control Law
+ * ===============================================
+ * Huawei LiteOS may be subject to applicable export control laws and regulations, which might
+ * include those applicable to Huawei LiteOS of U.S. and the country in which you are located.
+ * Import, export and usage of Huawei LiteOS in any manner by you shall be in compliance with such
+ * applicable export control laws and regulations.
+ *---------------------------------------------------------------------------*/
+
+#include "los_config.h"
+#include "los_sys.h"
+#include "los_api_bench.h"
+
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C" {
+#endif /* __cpluscplus */
+#endif /* __cpluscplus */
+
+/*
+ * Helpers shared by the los_api_*_bench.c cases: a 64-bit cycle stamp from
+ * LOS_GetCpuCycle and a min/avg/max accumulator printed through dprintf.
+ */
+UINT64 Example_BenchCycle(VOID)
+{
+    UINT32 uwHigh, uwLow;
+
+    LOS_GetCpuCycle(&uwHigh, &uwLow);
+    return ((UINT64)uwHigh << 32) | uwLow;
+}
+
+/* cost of taking two stamps back to back, to subtract from every sample */
+UINT32 Example_BenchOverhead(VOID)
+{
+    UINT64 ullStart;
+
+    ullStart = Example_BenchCycle();
+    return (UINT32)(Example_BenchCycle() - ullStart);
+}
+
+VOID Example_BenchAdd(BENCH_STAT *pstStat, UINT32 uwCycles)
+{
+    if (pstStat->uwCount == 0 || uwCycles < pstStat->uwMin)
+    {
+        pstStat->uwMin = uwCycles;
+    }
+    if (uwCycles > pstStat->uwMax)
+    {
+        pstStat->uwMax = uwCycles;
+    }
+    pstStat->ullSum += uwCycles;
+    pstStat->uwCount++;
+}
+
+VOID Example_BenchPrint(const CHAR *pcName, BENCH_STAT *pstStat)
+{
+    dprintf("%s: %d calls, cycles min %d avg %d max %d\n", pcName, pstStat->uwCount, pstStat->uwMin,
+            pstStat->uwCount ? (UINT32)(pstStat->ullSum / pstStat->uwCount) : 0, pstStat->uwMax);
+}
+
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif /* __cpluscplus */
+#endif /* __cpluscplus */
@@ -0,0 +1,159 @@
+/*----------------------------------------------------------------------------
+ * Copyright (c) <2013-2015>, <Huawei Technologies Co., Ltd>
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *---------------------------------------------------------------------------*/
+/*----------------------------------------------------------------------------
+ * Notice of Export Control Law
+ * ===============================================
+ * Huawei LiteOS may be subject to applicable export control laws and regulations, which might
+ * include those applicable to Huawei LiteOS of U.S. and the country in which you are located.
+ * Import, export and usage of Huawei LiteOS in any manner by you shall be in compliance with such
+ * applicable export control laws and regulations.
+ *---------------------------------------------------------------------------*/
+
+#include "los_config.h"
+#include "los_hwi.h"
+#include "los_memory.h"
+#include "los_api_bench.h"
+#include "los_api_irq_latency.h"
+
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C" {
+#endif /* __cpluscplus */
+#endif /* __cpluscplus */
+
+/*
+ * Worst-case interrupt latency while the kernel holds its interrupt lock.
+ * Each sample locks interrupts, pends a software-triggered IRQ, runs a
+ * LOS_MemAlloc/LOS_MemFree pair as a typical kernel critical section, then
+ * unlocks. The handler stamps DWT->CYCCNT on entry. Two IRQs are measured:
+ * - a kernel tier IRQ at LOSCFG_ARCH_INT_LOCK_BASEPRI_PRIO, always held off
+ *   until the critical section ends;
+ * - a zero-latency tier IRQ at priority 0, which is only held off when
+ *   LOS_IntLock masks through PRIMASK.
+ * Run once with LOSCFG_ARCH_INT_LOCK_BASEPRI NO and once with YES to compare.
+ * The handlers read the DWT counter only, because the zero-latency tier may
+ * not call LOS_GetCpuCycle. Cortex-M0 has no DWT counter and no BASEPRI.
+ */
+#ifdef DWT
+
+/* spare IRQs used as software triggers, EXTI1 and EXTI2 on the STM32 boards */
+#ifndef IRQ_LATENCY_KERNEL_IRQ
+#define IRQ_LATENCY_KERNEL_IRQ  7
+#endif
+#ifndef IRQ_LATENCY_FAST_IRQ
+#define IRQ_LATENCY_FAST_IRQ    8
+#endif
+#define IRQ_LATENCY_LOOPS       256
+#define IRQ_LATENCY_ALLOC_SIZE  64
+
+static volatile UINT32 g_uwIrqLatencyIn;
+
+static VOID Example_IrqLatencyHandler(VOID)
+{
+    g_uwIrqLatencyIn = DWT->CYCCNT;
+}
+
+static VOID Example_IrqLatencyRun(const CHAR *pcName, UINT32 uwIrq, BOOL bLocked)
+{
+    BENCH_STAT stLatency = {0};
+    UINTPTR uvIntSave = 0;
+    UINT32 uwStart;
+    UINT32 uwLoop;
+    VOID *pBuf;
+
+    for (uwLoop = 0; uwLoop < IRQ_LATENCY_LOOPS; uwLoop++)
+    {
+        g_uwIrqLatencyIn = 0;
+        if (bLocked)
+        {
+            uvIntSave = LOS_IntLock();
+        }
+        uwStart = DWT->CYCCNT;
+        NVIC_SetPendingIRQ((IRQn_Type)uwIrq);
+        pBuf = LOS_MemAlloc(OS_SYS_MEM_ADDR, IRQ_LATENCY_ALLOC_SIZE);
+        if (pBuf != NULL)
+        {
+            (VOID)LOS_MemFree(OS_SYS_MEM_ADDR, pBuf);
+        }
+        if (bLocked)
+        {
+            LOS_IntRestore(uvIntSave);
+        }
+        Example_BenchAdd(&stLatency, g_uwIrqLatencyIn - uwStart);
+    }
+    Example_BenchPrint(pcName, &stLatency);
+}
+
+UINT32 Example_IrqLatency(VOID)
+{
+    UINT32 uwRet;
+
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+    uwRet = LOS_HwiCreate(IRQ_LATENCY_KERNEL_IRQ, LOSCFG_ARCH_INT_LOCK_BASEPRI_PRIO, 0, Example_IrqLatencyHandler, 0);
+    if (uwRet != LOS_OK)
+    {
+        dprintf("irq latency kernel irq create failed 0x%x\n", uwRet);
+        return LOS_NOK;
+    }
+    uwRet = LOS_HwiCreate(IRQ_LATENCY_FAST_IRQ, 0, 0, Example_IrqLatencyHandler, 0);
+    if (uwRet != LOS_OK)
+    {
+        dprintf("irq latency fast irq create failed 0x%x\n", uwRet);
+        (VOID)LOS_HwiDelete(IRQ_LATENCY_KERNEL_IRQ);
+        return LOS_NOK;
+    }
+
+    dprintf("irq latency, %s lock, cycles from pend to handler:\n",
+            (g_uwOsIntLockBasepri != 0) ? "BASEPRI" : "PRIMASK");
+    Example_IrqLatencyRun("kernel tier, unlocked", IRQ_LATENCY_KERNEL_IRQ, FALSE);
+    Example_IrqLatencyRun("kernel tier, locked", IRQ_LATENCY_KERNEL_IRQ, TRUE);
+    Example_IrqLatencyRun("prio 0, unlocked", IRQ_LATENCY_FAST_IRQ, FALSE);
+    Example_IrqLatencyRun("prio 0, locked", IRQ_LATENCY_FAST_IRQ, TRUE);
+
+    (VOID)LOS_HwiDelete(IRQ_LATENCY_FAST_IRQ);
+    (VOID)LOS_HwiDelete(IRQ_LATENCY_KERNEL_IRQ);
+    return LOS_OK;
+}
+
+#else
+
+UINT32 Example_IrqLatency(VOID)
+{
+    dprintf("irq latency needs the DWT cycle counter, not available on this core\n");
+    return LOS_OK;
+}
+
+#endif
+
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif /* __cpluscplus */
+#endif /* __cpluscplus */
@@ -0,0 +1,145 @@
+/*----------------------------------------------------------------------------
+ * Copyright (c) <2013-2015>, <Huawei Technologies Co., Ltd>
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *---------------------------------------------------------------------------*/
+ /*----------------------------------------------------------------------------
+ * Notice of Export Control Law
+ * ===============================================
+ * Huawei LiteOS may be subject to applicable export control laws and regulations, which might
+ * include those applicable to Huawei LiteOS of U.S. and the country in which you are located.
+ * Import, export and usage of Huawei LiteOS in any manner by you shall be in compliance with such
+ * applicable export control laws and regulations.
+ *---------------------------------------------------------------------------*/
+
+#include "los_config.h"
+#include "los_memory.h"
+#include "los_sys.h"
+#include "los_api_bench.h"
+#include "los_api_mem_bench.h"
+#include "los_api_mem_replay.h"
+
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C" {
+#endif /* __cpluscplus */
+#endif /* __cpluscplus */
+
+/*
+ * Replays g_astMemReplay, an allocation sequence recorded with the kernel trace,
+ * on a private pool and prints the cycles spent per LOS_MemAlloc and LOS_MemFree.
+ * Build once with bestfit_little and once with tlsf (LOSCFG_MEMORY_TLSF and
+ * kernel/base/mem/Makefile) to compare them on the same sequence.
+ * kernel/base/mem/bestfit is not compared: it is not built in this tree. It has no
+ * Makefile, includes los_exc.h which no target provides, is switched on by
+ * LOSCFG_MEMORY_BESTFIT which no los_config.h defines, and lacks the LOS_Heap layer
+ * slab and memstat sit on, as well as LOS_MemStatisticsGet and LOS_MemGetMaxFreeBlkSize.
+ */
+#define MEM_BENCH_PASSES      4
+#define MEM_BENCH_POOL_SIZE   ((MEM_REPLAY_PEAK_SIZE * 2 + 0x1000) & ~7)
+
+static UINT64 g_aullMemBenchPool[MEM_BENCH_POOL_SIZE / sizeof(UINT64)];
+static VOID *g_apMemBenchSlot[MEM_REPLAY_SLOT_NUM];
+
+extern UINT32 LOS_MemInit(VOID *pPool, UINT32 uwSize);
+
+UINT32 Example_MemBench(VOID)
+{
+    VOID *pPool = (VOID *)g_aullMemBenchPool;
+    BENCH_STAT stAlloc = {0};
+    BENCH_STAT stFree = {0};
+    LOS_MEM_STATUS stStatus = {0};
+    UINT32 uwMaxFree = 0;
+    UINT32 uwFailCnt = 0;
+    UINT32 uwOverhead;
+    UINT32 uwPass, uwIdx, uwSlot;
+    UINT64 ullStart;
+
+    if (LOS_OK != LOS_MemInit(pPool, MEM_BENCH_POOL_SIZE))
+    {
+        dprintf("mem bench pool init failed!\n");
+        return LOS_NOK;
+    }
+
+    uwOverhead = Example_BenchOverhead();
+
+    for (uwPass = 0; uwPass < MEM_BENCH_PASSES; uwPass++)
+    {
+        for (uwIdx = 0; uwIdx < sizeof(g_astMemReplay) / sizeof(g_astMemReplay[0]); uwIdx++)
+        {
+            uwSlot = g_astMemReplay[uwIdx].uwSlot;
+            if (g_astMemReplay[uwIdx].uwSize != 0)
+            {
+                ullStart = Example_BenchCycle();
+                g_apMemBenchSlot[uwSlot] = LOS_MemAlloc(pPool, g_astMemReplay[uwIdx].uwSize);
+                Example_BenchAdd(&stAlloc, (UINT32)(Example_BenchCycle() - ullStart) - uwOverhead);
+                if (g_apMemBenchSlot[uwSlot] == NULL)
+                {
+                    uwFailCnt++;
+                }
+            }
+            else if (g_apMemBenchSlot[uwSlot] != NULL)
+            {
+                ullStart = Example_BenchCycle();
+                (VOID)LOS_MemFree(pPool, g_apMemBenchSlot[uwSlot]);
+                Example_BenchAdd(&stFree, (UINT32)(Example_BenchCycle() - ullStart) - uwOverhead);
+                g_apMemBenchSlot[uwSlot] = NULL;
+            }
+        }
+
+        /* fragmentation left by the sequence, before the survivors are dropped */
+        if (uwPass == MEM_BENCH_PASSES - 1)
+        {
+            (VOID)LOS_MemStatisticsGet(pPool, &stStatus);
+            uwMaxFree = LOS_MemGetMaxFreeBlkSize(pPool);
+        }
+
+        for (uwSlot = 0; uwSlot < MEM_REPLAY_SLOT_NUM; uwSlot++)
+        {
+            if (g_apMemBenchSlot[uwSlot] != NULL)
+            {
+                (VOID)LOS_MemFree(pPool, g_apMemBenchSlot[uwSlot]);
+                g_apMemBenchSlot[uwSlot] = NULL;
+            }
+        }
+    }
+
+    dprintf("mem bench: pool 0x%x, peak live 0x%x, %d failed allocs\n",
+            MEM_BENCH_POOL_SIZE, MEM_REPLAY_PEAK_SIZE, uwFailCnt);
+    Example_BenchPrint("LOS_MemAlloc", &stAlloc);
+    Example_BenchPrint("LOS_MemFree", &stFree);
+    dprintf("free 0x%x, largest free block 0x%x\n", stStatus.freeSize, uwMaxFree);
+
+#if (LOSCFG_MEM_MUL_POOL == YES)
+    (VOID)LOS_MemDeInit(pPool);
+#endif
+    return (uwFailCnt == 0) ? LOS_OK : LOS_NOK;
+}
+
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif /* __cpluscplus */
+#endif /* __cpluscplus */
@@ -0,0 +1,254 @@
+/*----------------------------------------------------------------------------
+ * Copyright (c) <2013-2015>, <Huawei Technologies Co., Ltd>
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *---------------------------------------------------------------------------*/
+/*----------------------------------------------------------------------------
+ * Notice of Export Control Law
+ * ===============================================
+ * Huawei LiteOS may be subject to applicable export control laws and regulations, which might
+ * include those applicable to Huawei LiteOS of U.S. and the country in which you are located.
+ * Import, export and usage of Huawei LiteOS in any manner by you shall be in compliance with such
+ * applicable export control laws and regulations.
+ *---------------------------------------------------------------------------*/
+
+#include "los_config.h"
+#include "los_sem.h"
+#include "los_queue.h"
+#include "los_event.h"
+#include "los_multiwait.h"
+#include "los_task.h"
+#include "los_sys.h"
+#include "los_api_multiwait.h"
+#include "los_inspect_entry.h"
+#ifdef LOSCFG_LIB_LIBC
+#include "string.h"
+#endif
+
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C" {
+#endif /* __cpluscplus */
+#endif /* __cpluscplus */
+
+#if (LOSCFG_BASE_IPC_MULTIWAIT == YES)
+
+/*
+ * A waiter above this task blocks in LOS_MultiWait on a semaphore, a queue and
+ * an event at once. The case checks that:
+ * - a queue write alone wakes it with only the queue item ready, and so does an event write;
+ * - with nothing ready the wait polls to LOS_ERRNO_MULTIWAIT_UNAVAILABLE and times out after its ticks;
+ * - deleting a task blocked in LOS_MultiWait unlinks it, so the objects can be deleted afterwards.
+ */
+#define MULTIWAIT_PRIO_MAIN     10
+#define MULTIWAIT_PRIO_WAITER   9
+#define MULTIWAIT_ITEM_CNT      3
+#define MULTIWAIT_EVENT_BIT     0x1
+#define MULTIWAIT_MSG           0x5A5A
+#define MULTIWAIT_TIMEOUT       5
+
+static UINT32 g_uwMultiWaitSemID;
+static UINT32 g_uwMultiWaitQueueID;
+static EVENT_CB_S g_stMultiWaitEvent;
+static MULTIWAIT_ITEM_S g_astMultiWaitItem[MULTIWAIT_ITEM_CNT];
+static UINT32 g_uwMultiWaitTaskID;
+static volatile UINT32 g_uwMultiWaitRet;
+static volatile UINT32 g_uwMultiWaitReady;
+static volatile UINT32 g_uwMultiWaitMsg;
+
+static VOID Example_MultiWaitItemsInit(VOID)
+{
+    memset(g_astMultiWaitItem, 0, sizeof(g_astMultiWaitItem));
+    g_astMultiWaitItem[0].uwType      = LOS_MULTIWAIT_SEM;
+    g_astMultiWaitItem[0].uwHandle    = g_uwMultiWaitSemID;
+    g_astMultiWaitItem[1].uwType      = LOS_MULTIWAIT_QUEUE_READ;
+    g_astMultiWaitItem[1].uwHandle    = g_uwMultiWaitQueueID;
+    g_astMultiWaitItem[2].uwType      = LOS_MULTIWAIT_EVENT;
+    g_astMultiWaitItem[2].pstEventCB  = &g_stMultiWaitEvent;
+    g_astMultiWaitItem[2].uwEventMask = MULTIWAIT_EVENT_BIT;
+    g_astMultiWaitItem[2].uwEventMode = LOS_WAITMODE_OR;
+}
+
+static UINT32 Example_MultiWaitReadyMask(VOID)
+{
+    UINT32 uwMask = 0;
+    UINT32 uwIdx;
+
+    for (uwIdx = 0; uwIdx < MULTIWAIT_ITEM_CNT; uwIdx++)
+    {
+        if (g_astMultiWaitItem[uwIdx].uwReady)
+        {
+            uwMask |= (1U << uwIdx);
+        }
+    }
+    return uwMask;
+}
+
+/* wait for any of the three objects, then consume what became ready */
+static VOID Example_MultiWaitTask(VOID)
+{
+    UINT32 uwLen = sizeof(UINT32);
+    UINT32 uwMsg = 0;
+
+    Example_MultiWaitItemsInit();
+    g_uwMultiWaitRet = LOS_MultiWait(g_astMultiWaitItem, MULTIWAIT_ITEM_CNT, LOS_WAIT_FOREVER);
+    g_uwMultiWaitReady = Example_MultiWaitReadyMask();
+
+    if (g_astMultiWaitItem[1].uwReady &&
+        LOS_OK == LOS_QueueReadCopy(g_uwMultiWaitQueueID, &uwMsg, &uwLen, LOS_NO_WAIT))
+    {
+        g_uwMultiWaitMsg = uwMsg;
+    }
+    if (g_astMultiWaitItem[2].uwReady)
+    {
+        (VOID)LOS_EventRead(&g_stMultiWaitEvent, MULTIWAIT_EVENT_BIT, LOS_WAITMODE_OR | LOS_WAITMODE_CLR, LOS_NO_WAIT);
+    }
+}
+
+/* the waiter is above us, so it is blocked in LOS_MultiWait when this returns */
+static UINT32 Example_MultiWaitSpawn(VOID)
+{
+    TSK_INIT_PARAM_S stTask;
+
+    g_uwMultiWaitRet = LOS_NOK;
+    g_uwMultiWaitReady = 0;
+    g_uwMultiWaitMsg = 0;
+
+    memset(&stTask, 0, sizeof(TSK_INIT_PARAM_S));
+    stTask.pfnTaskEntry = (TSK_ENTRY_FUNC)Example_MultiWaitTask;
+    stTask.pcName       = "MultiWaitTsk";
+    stTask.uwStackSize  = LOSCFG_BASE_CORE_TSK_IDLE_STACK_SIZE;
+    stTask.usTaskPrio   = MULTIWAIT_PRIO_WAITER;
+    return LOS_TaskCreate(&g_uwMultiWaitTaskID, &stTask);
+}
+
+static UINT32 Example_MultiWaitAny(VOID)
+{
+    UINT32 uwMsg = MULTIWAIT_MSG;
+
+    /* a queue message wakes the waiter with the queue item alone ready */
+    if (LOS_OK != Example_MultiWaitSpawn())
+    {
+        return LOS_NOK;
+    }
+    (VOID)LOS_QueueWriteCopy(g_uwMultiWaitQueueID, &uwMsg, sizeof(UINT32), LOS_NO_WAIT);
+    if (g_uwMultiWaitRet != LOS_OK || g_uwMultiWaitReady != (1U << 1) || g_uwMultiWaitMsg != MULTIWAIT_MSG)
+    {
+        dprintf("multiwait queue wake: ret 0x%x ready 0x%x msg 0x%x\n", g_uwMultiWaitRet, g_uwMultiWaitReady, g_uwMultiWaitMsg);
+        return LOS_NOK;
+    }
+
+    /* so does an event */
+    if (LOS_OK != Example_MultiWaitSpawn())
+    {
+        return LOS_NOK;
+    }
+    (VOID)LOS_EventWrite(&g_stMultiWaitEvent, MULTIWAIT_EVENT_BIT);
+    if (g_uwMultiWaitRet != LOS_OK || g_uwMultiWaitReady != (1U << 2))
+    {
+        dprintf("multiwait event wake: ret 0x%x ready 0x%x\n", g_uwMultiWaitRet, g_uwMultiWaitReady);
+        return LOS_NOK;
+    }
+    return LOS_OK;
+}
+
+static UINT32 Example_MultiWaitTimeout(VOID)
+{
+    UINT64 ullStart;
+    UINT32 uwRet;
+
+    Example_MultiWaitItemsInit();
+    uwRet = LOS_MultiWait(g_astMultiWaitItem, MULTIWAIT_ITEM_CNT, LOS_NO_WAIT);
+    if (uwRet != LOS_ERRNO_MULTIWAIT_UNAVAILABLE)
+    {
+        dprintf("multiwait poll returned 0x%x\n", uwRet);
+        return LOS_NOK;
+    }
+
+    ullStart = LOS_TickCountGet();
+    uwRet = LOS_MultiWait(g_astMultiWaitItem, MULTIWAIT_ITEM_CNT, MULTIWAIT_TIMEOUT);
+    if (uwRet != LOS_ERRNO_MULTIWAIT_TIMEOUT || LOS_TickCountGet() - ullStart < MULTIWAIT_TIMEOUT ||
+        Example_MultiWaitReadyMask() != 0)
+    {
+        dprintf("multiwait timeout returned 0x%x\n", uwRet);
+        return LOS_NOK;
+    }
+    return LOS_OK;
+}
+
+UINT32 Example_MultiWait(VOID)
+{
+    UINT32 uwRet = LOS_OK;
+    UINT16 usOldPrio;
+
+    usOldPrio = LOS_TaskPriGet(LOS_CurTaskIDGet());
+    if (LOS_OK != LOS_CurTaskPriSet(MULTIWAIT_PRIO_MAIN))
+    {
+        dprintf("multiwait priority set failed!\n");
+        return LOS_NOK;
+    }
+
+    if (LOS_OK != LOS_SemCreate(0, &g_uwMultiWaitSemID) ||
+        LOS_OK != LOS_QueueCreate("MultiWaitQ", 2, &g_uwMultiWaitQueueID, 0, sizeof(UINT32)) ||
+        LOS_OK != LOS_EventInit(&g_stMultiWaitEvent))
+    {
+        dprintf("multiwait objects create failed!\n");
+        (VOID)LOS_CurTaskPriSet(usOldPrio);
+        return LOS_NOK;
+    }
+
+    uwRet |= Example_MultiWaitAny();
+    uwRet |= Example_MultiWaitTimeout();
+
+    /* a deleted waiter must leave the objects, or they cannot be deleted */
+    if (LOS_OK != Example_MultiWaitSpawn() || LOS_OK != LOS_TaskDelete(g_uwMultiWaitTaskID))
+    {
+        dprintf("multiwait waiter delete failed!\n");
+        uwRet = LOS_NOK;
+    }
+    if (LOS_OK != LOS_SemDelete(g_uwMultiWaitSemID) ||
+        LOS_OK != LOS_QueueDelete(g_uwMultiWaitQueueID) ||
+        LOS_OK != LOS_EventDestory(&g_stMultiWaitEvent))
+    {
+        dprintf("multiwait objects still linked after the waiter is deleted!\n");
+        uwRet = LOS_NOK;
+    }
+
+    (VOID)LOS_CurTaskPriSet(usOldPrio);
+
+    if (LOS_OK != LOS_InspectStatusSetByID(LOS_INSPECT_MWAIT, (uwRet == LOS_OK) ? LOS_INSPECT_STU_SUCCESS : LOS_INSPECT_STU_ERROR))
+    {
+        dprintf("Set Inspect Status Err\n");
+    }
+    return uwRet;
+}
+
+#endif /* LOSCFG_BASE_IPC_MULTIWAIT == YES */
+
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif /* __cpluscplus */
+#endif /* __cpluscplus */
@@ -0,0 +1,218 @@
+/*----------------------------------------------------------------------------
+ * Copyright (c) <2013-2015>, <Huawei Technologies Co., Ltd>
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *---------------------------------------------------------------------------*/
+/*----------------------------------------------------------------------------
+ * Notice of Export Control Law
+ * ===============================================
+ * Huawei LiteOS may be subject to applicable export control laws and regulations, which might
+ * include those applicable to Huawei LiteOS of U.S. and the country in which you are located.
+ * Import, export and usage of Huawei LiteOS in any manner by you shall be in compliance with such
+ * applicable export control laws and regulations.
+ *---------------------------------------------------------------------------*/
+
+#include "los_config.h"
+#include "los_sem.h"
+#include "los_task.h"
+#include "los_api_bench.h"
+#include "los_api_notify_bench.h"
+#include "los_inspect_entry.h"
+#ifdef LOSCFG_LIB_LIBC
+#include "string.h"
+#endif
+
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C" {
+#endif /* __cpluscplus */
+#endif /* __cpluscplus */
+
+/*
+ * Ping-pong between this task and a higher priority partner, once through a
+ * pair of semaphores and once through task notifications. Every round trip
+ * is two signals and two context switches, timed with LOS_GetCpuCycle.
+ */
+#define NOTIFY_BENCH_PRIO       8
+#define NOTIFY_BENCH_LOOPS      256
+
+static UINT32 g_uwNotifyBenchPing;
+static UINT32 g_uwNotifyBenchPong;
+static UINT32 g_uwNotifyBenchMainID;
+static UINT32 g_uwNotifyBenchPeerID;
+static volatile UINT32 g_uwNotifyBenchErr;
+
+static VOID Example_NotifyBenchSemPeer(VOID)
+{
+    UINT32 uwLoop;
+
+    for (uwLoop = 0; uwLoop < NOTIFY_BENCH_LOOPS; uwLoop++)
+    {
+        if (LOS_OK != LOS_SemPend(g_uwNotifyBenchPing, LOS_WAIT_FOREVER) ||
+            LOS_OK != LOS_SemPost(g_uwNotifyBenchPong))
+        {
+            g_uwNotifyBenchErr++;
+        }
+    }
+}
+
+static VOID Example_NotifyBenchNotifyPeer(VOID)
+{
+    UINT32 uwLoop;
+
+    for (uwLoop = 0; uwLoop < NOTIFY_BENCH_LOOPS; uwLoop++)
+    {
+        if (LOS_OK != LOS_TaskNotifyTake(TRUE, LOS_WAIT_FOREVER, NULL) ||
+            LOS_OK != LOS_TaskNotify(g_uwNotifyBenchMainID, 0, LOS_NOTIFY_INCREMENT, NULL))
+        {
+            g_uwNotifyBenchErr++;
+        }
+    }
+}
+
+static UINT32 Example_NotifyBenchPeer(TSK_ENTRY_FUNC pfnEntry)
+{
+    TSK_INIT_PARAM_S stTask;
+
+    memset(&stTask, 0, sizeof(TSK_INIT_PARAM_S));
+    stTask.pfnTaskEntry = pfnEntry;
+    stTask.pcName       = "NotifyBench";
+    stTask.uwStackSize  = LOSCFG_BASE_CORE_TSK_IDLE_STACK_SIZE;
+    stTask.usTaskPrio   = NOTIFY_BENCH_PRIO - 1;
+    return LOS_TaskCreate(&g_uwNotifyBenchPeerID, &stTask);
+}
+
+static UINT32 Example_NotifyBenchSem(UINT32 uwOverhead)
+{
+    BENCH_STAT stTrip = {0};
+    UINT32 uwLoop;
+    UINT64 ullStart;
+
+    if (LOS_OK != LOS_SemCreate(0, &g_uwNotifyBenchPing))
+    {
+        return LOS_NOK;
+    }
+    if (LOS_OK != LOS_SemCreate(0, &g_uwNotifyBenchPong))
+    {
+        (VOID)LOS_SemDelete(g_uwNotifyBenchPing);
+        return LOS_NOK;
+    }
+    if (LOS_OK != Example_NotifyBenchPeer((TSK_ENTRY_FUNC)Example_NotifyBenchSemPeer))
+    {
+        (VOID)LOS_SemDelete(g_uwNotifyBenchPong);
+        (VOID)LOS_SemDelete(g_uwNotifyBenchPing);
+        return LOS_NOK;
+    }
+
+    for (uwLoop = 0; uwLoop < NOTIFY_BENCH_LOOPS; uwLoop++)
+    {
+        ullStart = Example_BenchCycle();
+        if (LOS_OK != LOS_SemPost(g_uwNotifyBenchPing) ||
+            LOS_OK != LOS_SemPend(g_uwNotifyBenchPong, LOS_WAIT_FOREVER))
+        {
+            g_uwNotifyBenchErr++;
+        }
+        Example_BenchAdd(&stTrip, (UINT32)(Example_BenchCycle() - ullStart) - uwOverhead);
+    }
+    Example_BenchPrint("sem ping-pong round trip", &stTrip);
+
+    (VOID)LOS_SemDelete(g_uwNotifyBenchPong);
+    (VOID)LOS_SemDelete(g_uwNotifyBenchPing);
+    return LOS_OK;
+}
+
+static UINT32 Example_NotifyBenchNotify(UINT32 uwOverhead)
+{
+    BENCH_STAT stTrip = {0};
+    UINT32 uwLoop;
+    UINT64 ullStart;
+
+    if (LOS_OK != Example_NotifyBenchPeer((TSK_ENTRY_FUNC)Example_NotifyBenchNotifyPeer))
+    {
+        return LOS_NOK;
+    }
+
+    for (uwLoop = 0; uwLoop < NOTIFY_BENCH_LOOPS; uwLoop++)
+    {
+        ullStart = Example_BenchCycle();
+        if (LOS_OK != LOS_TaskNotify(g_uwNotifyBenchPeerID, 0, LOS_NOTIFY_INCREMENT, NULL) ||
+            LOS_OK != LOS_TaskNotifyTake(TRUE, LOS_WAIT_FOREVER, NULL))
+        {
+            g_uwNotifyBenchErr++;
+        }
+        Example_BenchAdd(&stTrip, (UINT32)(Example_BenchCycle() - ullStart) - uwOverhead);
+    }
+    Example_BenchPrint("notify ping-pong round trip", &stTrip);
+    return LOS_OK;
+}
+
+UINT32 Example_NotifyBench(VOID)
+{
+    UINT32 uwOverhead;
+    UINT32 uwRet = LOS_OK;
+    UINT16 usOldPrio;
+
+    g_uwNotifyBenchMainID = LOS_CurTaskIDGet();
+    usOldPrio = LOS_TaskPriGet(g_uwNotifyBenchMainID);
+    if (LOS_OK != LOS_CurTaskPriSet(NOTIFY_BENCH_PRIO))
+    {
+        dprintf("notify bench priority set failed!\n");
+        return LOS_NOK;
+    }
+
+    g_uwNotifyBenchErr = 0;
+    (VOID)LOS_TaskNotifyClear(g_uwNotifyBenchMainID, 0xFFFFFFFF, NULL);
+    uwOverhead = Example_BenchOverhead();
+
+    if (LOS_OK != Example_NotifyBenchSem(uwOverhead))
+    {
+        dprintf("notify bench sem setup failed!\n");
+        uwRet = LOS_NOK;
+    }
+    if (LOS_OK != Example_NotifyBenchNotify(uwOverhead))
+    {
+        dprintf("notify bench peer create failed!\n");
+        uwRet = LOS_NOK;
+    }
+    if (g_uwNotifyBenchErr != 0)
+    {
+        dprintf("notify bench: %d failed calls\n", g_uwNotifyBenchErr);
+        uwRet = LOS_NOK;
+    }
+
+    (VOID)LOS_CurTaskPriSet(usOldPrio);
+
+    if (LOS_OK != LOS_InspectStatusSetByID(LOS_INSPECT_NTFY, (uwRet == LOS_OK) ? LOS_INSPECT_STU_SUCCESS : LOS_INSPECT_STU_ERROR))
+    {
+        dprintf("Set Inspect Status Err\n");
+    }
+    return uwRet;
+}
+
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif /* __cpluscplus */
+#endif /* __cpluscplus */
@@ -0,0 +1,267 @@
+/*----------------------------------------------------------------------------
+ * Copyright (c) <2013-2015>, <Huawei Technologies Co., Ltd>
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *---------------------------------------------------------------------------*/
+/*----------------------------------------------------------------------------
+ * Notice of Export Control Law
+ * ===============================================
+ * Huawei LiteOS may be subject to applicable export control laws and regulations, which might
+ * include those applicable to Huawei LiteOS of U.S. and the country in which you are located.
+ * Import, export and usage of Huawei LiteOS in any manner by you shall be in compliance with such
+ * applicable export control laws and regulations.
+ *---------------------------------------------------------------------------*/
+
+#include "los_config.h"
+#include "los_sem.h"
+#include "los_task.h"
+#include "los_api_bench.h"
+#include "los_api_pend_order.h"
+#include "los_inspect_entry.h"
+#ifdef LOSCFG_LIB_LIBC
+#include "string.h"
+#endif
+
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C" {
+#endif /* __cpluscplus */
+#endif /* __cpluscplus */
+
+/*
+ * Three waiters of low, medium and high priority pend on one semaphore, in that
+ * order of arrival, and are released one post at a time:
+ * - LOS_PEND_FIFO must wake them low, medium, high.
+ * - LOS_PEND_PRIO must wake them high, medium, low.
+ * - LOS_PEND_PRIO with the low waiter raised above the others while pending
+ *   must wake it first, then high, medium.
+ * The last round uses the semaphore as a lock held a few ticks by each low
+ * priority waiter and times how long the high priority waiter stays blocked
+ * behind them, under both orders.
+ */
+#define PEND_ORDER_PRIO_MAIN    8
+#define PEND_ORDER_PRIO_HIGH    10
+#define PEND_ORDER_PRIO_MED     11
+#define PEND_ORDER_PRIO_LOW     12
+#define PEND_ORDER_WAITERS      3
+#define PEND_ORDER_HOLD_TICKS   2
+
+static UINT32 g_uwPendOrderSemID;
+static UINT32 g_auwPendOrderTaskID[PEND_ORDER_WAITERS + 1];
+static volatile UINT32 g_auwPendOrderWoken[PEND_ORDER_WAITERS + 1];
+static volatile UINT32 g_uwPendOrderWokenCnt;
+static volatile UINT64 g_ullPendOrderHighIn;
+
+static VOID Example_PendOrderWaiter(UINT32 uwTag)
+{
+    if (LOS_OK == LOS_SemPend(g_uwPendOrderSemID, LOS_WAIT_FOREVER))
+    {
+        g_auwPendOrderWoken[g_uwPendOrderWokenCnt++] = uwTag;
+    }
+}
+
+/* a low priority user of the lock, it keeps the semaphore for a while */
+static VOID Example_PendOrderHolder(UINT32 uwTag)
+{
+    (VOID)uwTag;
+    if (LOS_OK == LOS_SemPend(g_uwPendOrderSemID, LOS_WAIT_FOREVER))
+    {
+        (VOID)LOS_TaskDelay(PEND_ORDER_HOLD_TICKS);
+        (VOID)LOS_SemPost(g_uwPendOrderSemID);
+    }
+}
+
+static VOID Example_PendOrderUrgent(UINT32 uwTag)
+{
+    (VOID)uwTag;
+    if (LOS_OK == LOS_SemPend(g_uwPendOrderSemID, LOS_WAIT_FOREVER))
+    {
+        g_ullPendOrderHighIn = Example_BenchCycle();
+        (VOID)LOS_SemPost(g_uwPendOrderSemID);
+    }
+}
+
+/* the new task is below us, the delay lets it run up to its LOS_SemPend */
+static UINT32 Example_PendOrderSpawn(UINT32 *puwTaskID, TSK_ENTRY_FUNC pfnEntry, UINT16 usPrio, UINT32 uwTag)
+{
+    TSK_INIT_PARAM_S stTask;
+    UINT32 uwRet;
+
+    memset(&stTask, 0, sizeof(TSK_INIT_PARAM_S));
+    stTask.pfnTaskEntry = pfnEntry;
+    stTask.pcName       = "PendOrderTsk";
+    stTask.uwStackSize  = LOSCFG_BASE_CORE_TSK_IDLE_STACK_SIZE;
+    stTask.usTaskPrio   = usPrio;
+    stTask.uwArg        = uwTag;
+    uwRet = LOS_TaskCreate(puwTaskID, &stTask);
+    if (uwRet == LOS_OK)
+    {
+        (VOID)LOS_TaskDelay(1);
+    }
+    return uwRet;
+}
+
+/* queue low, medium and high in that order, optionally bump the low one, then release one by one */
+static UINT32 Example_PendOrderRound(UINT32 uwOrder, BOOL bRaiseLow, const UINT16 *pusExpect)
+{
+    static const UINT16 ausPrio[PEND_ORDER_WAITERS] = {PEND_ORDER_PRIO_LOW, PEND_ORDER_PRIO_MED, PEND_ORDER_PRIO_HIGH};
+    UINT32 uwIdx;
+    UINT32 uwRet = LOS_OK;
+
+    if (LOS_OK != LOS_SemCreate(0, &g_uwPendOrderSemID))
+    {
+        dprintf("pend order sem create failed!\n");
+        return LOS_NOK;
+    }
+    (VOID)LOS_SemPendOrderSet(g_uwPendOrderSemID, uwOrder);
+
+    g_uwPendOrderWokenCnt = 0;
+    for (uwIdx = 0; uwIdx < PEND_ORDER_WAITERS; uwIdx++)
+    {
+        if (LOS_OK != Example_PendOrderSpawn(&g_auwPendOrderTaskID[uwIdx], (TSK_ENTRY_FUNC)Example_PendOrderWaiter,
+                                             ausPrio[uwIdx], ausPrio[uwIdx]))
+        {
+            dprintf("pend order task create failed!\n");
+            uwRet = LOS_NOK;
+            break;
+        }
+    }
+
+    if (uwRet == LOS_OK && bRaiseLow)
+    {
+        (VOID)LOS_TaskPriSet(g_auwPendOrderTaskID[0], PEND_ORDER_PRIO_HIGH - 1);
+    }
+
+    /* one post per waiter, each woken task records itself and exits */
+    for (uwIdx = 0; uwIdx < PEND_ORDER_WAITERS; uwIdx++)
+    {
+        (VOID)LOS_SemPost(g_uwPendOrderSemID);
+        (VOID)LOS_TaskDelay(1);
+    }
+
+    if (uwRet == LOS_OK)
+    {
+        for (uwIdx = 0; uwIdx < PEND_ORDER_WAITERS; uwIdx++)
+        {
+            if (uwIdx >= g_uwPendOrderWokenCnt || g_auwPendOrderWoken[uwIdx] != pusExpect[uwIdx])
+            {
+                dprintf("pend order %d: wake %d is prio %d, expected %d\n", uwOrder, uwIdx,
+                        (uwIdx < g_uwPendOrderWokenCnt) ? g_auwPendOrderWoken[uwIdx] : 0, pusExpect[uwIdx]);
+                uwRet = LOS_NOK;
+            }
+        }
+    }
+
+    (VOID)LOS_SemDelete(g_uwPendOrderSemID);
+    return uwRet;
+}
+
+/* holders L1..L3 queue on the locked semaphore before the urgent task, return cycles until it gets in */
+static UINT32 Example_PendOrderInversion(UINT32 uwOrder, UINT32 *puwCycles)
+{
+    UINT32 uwIdx;
+    UINT32 uwRet = LOS_OK;
+    UINT64 ullStart;
+
+    if (LOS_OK != LOS_SemCreate(0, &g_uwPendOrderSemID))
+    {
+        dprintf("pend order sem create failed!\n");
+        return LOS_NOK;
+    }
+    (VOID)LOS_SemPendOrderSet(g_uwPendOrderSemID, uwOrder);
+
+    g_ullPendOrderHighIn = 0;
+    for (uwIdx = 0; uwIdx < PEND_ORDER_WAITERS; uwIdx++)
+    {
+        uwRet |= Example_PendOrderSpawn(&g_auwPendOrderTaskID[uwIdx], (TSK_ENTRY_FUNC)Example_PendOrderHolder,
+                                        PEND_ORDER_PRIO_LOW, uwIdx);
+    }
+    uwRet |= Example_PendOrderSpawn(&g_auwPendOrderTaskID[PEND_ORDER_WAITERS], (TSK_ENTRY_FUNC)Example_PendOrderUrgent,
+                                    PEND_ORDER_PRIO_HIGH, PEND_ORDER_WAITERS);
+
+    /* release the lock, then wait for every holder to have passed it on */
+    ullStart = Example_BenchCycle();
+    (VOID)LOS_SemPost(g_uwPendOrderSemID);
+    (VOID)LOS_TaskDelay((PEND_ORDER_WAITERS + 1) * (PEND_ORDER_HOLD_TICKS + 1));
+
+    if (uwRet != LOS_OK || g_ullPendOrderHighIn == 0)
+    {
+        dprintf("pend order inversion round %d failed!\n", uwOrder);
+        uwRet = LOS_NOK;
+    }
+    else
+    {
+        *puwCycles = (UINT32)(g_ullPendOrderHighIn - ullStart);
+    }
+
+    (VOID)LOS_SemDelete(g_uwPendOrderSemID);
+    return uwRet;
+}
+
+UINT32 Example_PendOrder(VOID)
+{
+    static const UINT16 ausFifo[PEND_ORDER_WAITERS] = {PEND_ORDER_PRIO_LOW, PEND_ORDER_PRIO_MED, PEND_ORDER_PRIO_HIGH};
+    static const UINT16 ausPrio[PEND_ORDER_WAITERS] = {PEND_ORDER_PRIO_HIGH, PEND_ORDER_PRIO_MED, PEND_ORDER_PRIO_LOW};
+    static const UINT16 ausRaise[PEND_ORDER_WAITERS] = {PEND_ORDER_PRIO_LOW, PEND_ORDER_PRIO_HIGH, PEND_ORDER_PRIO_MED};
+    UINT32 uwFifoCycles = 0;
+    UINT32 uwPrioCycles = 0;
+    UINT32 uwRet = LOS_OK;
+    UINT16 usOldPrio;
+
+    usOldPrio = LOS_TaskPriGet(LOS_CurTaskIDGet());
+    if (LOS_OK != LOS_CurTaskPriSet(PEND_ORDER_PRIO_MAIN))
+    {
+        dprintf("pend order priority set failed!\n");
+        return LOS_NOK;
+    }
+
+    uwRet |= Example_PendOrderRound(LOS_PEND_FIFO, FALSE, ausFifo);
+    uwRet |= Example_PendOrderRound(LOS_PEND_PRIO, FALSE, ausPrio);
+    uwRet |= Example_PendOrderRound(LOS_PEND_PRIO, TRUE, ausRaise);
+
+    uwRet |= Example_PendOrderInversion(LOS_PEND_FIFO, &uwFifoCycles);
+    uwRet |= Example_PendOrderInversion(LOS_PEND_PRIO, &uwPrioCycles);
+    dprintf("high priority waiter blocked behind %d holders: fifo %d cycles, prio %d cycles\n",
+            PEND_ORDER_WAITERS, uwFifoCycles, uwPrioCycles);
+    if (uwRet == LOS_OK && uwPrioCycles >= uwFifoCycles)
+    {
+        dprintf("pend order prio did not shorten the wait!\n");
+        uwRet = LOS_NOK;
+    }
+
+    (VOID)LOS_CurTaskPriSet(usOldPrio);
+
+    if (LOS_OK != LOS_InspectStatusSetByID(LOS_INSPECT_PEND, (uwRet == LOS_OK) ? LOS_INSPECT_STU_SUCCESS : LOS_INSPECT_STU_ERROR))
+    {
+        dprintf("Set Inspect Status Err\n");
+    }
+    return uwRet;
+}
+
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif /* __cpluscplus */
+#endif /* __cpluscplus */
@@ -0,0 +1,247 @@
+/*----------------------------------------------------------------------------
+ * Copyright (c) <2013-2015>, <Huawei Technologies Co., Ltd>
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *---------------------------------------------------------------------------*/
+/*----------------------------------------------------------------------------
+ * Notice of Export Control Law
+ * ===============================================
+ * Huawei LiteOS may be subject to applicable export control laws and regulations, which might
+ * include those applicable to Huawei LiteOS of U.S. and the country in which you are located.
+ * Import, export and usage of Huawei LiteOS in any manner by you shall be in compliance with such
+ * applicable export control laws and regulations.
+ *---------------------------------------------------------------------------*/
+
+#include "los_config.h"
+#include "los_hwi.h"
+#include "los_sem.h"
+#include "los_sys.h"
+#include "los_task.h"
+#include "los_api_periodic.h"
+#include "los_inspect_entry.h"
+#ifdef LOSCFG_LIB_LIBC
+#include "string.h"
+#endif
+
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C" {
+#endif /* __cpluscplus */
+#endif /* __cpluscplus */
+
+#if (LOSCFG_BASE_CORE_TSK_PERIODIC == YES)
+
+/*
+ * A periodic task above this one records the tick each job starts at. Job
+ * PERIODIC_OVERRUN_JOB spins for two periods and two ticks:
+ * - the jobs before it start exactly on the release grid;
+ * - the deadline timer reports the miss at the deadline tick, while the job
+ *   still runs;
+ * - the release the job overran into is skipped, the late one after it starts
+ *   at once and the grid resumes.
+ */
+#define PERIODIC_PRIO_MAIN      10
+#define PERIODIC_PRIO_TASK      9
+#define PERIODIC_PERIOD         10
+#define PERIODIC_OFFSET         5
+#define PERIODIC_DEADLINE       5
+#define PERIODIC_JOBS           8
+#define PERIODIC_OVERRUN_JOB    3
+#define PERIODIC_OVERRUN_TICKS  (PERIODIC_PERIOD * 2 + 2)
+
+static UINT64 g_aullJobStart[PERIODIC_JOBS];
+static UINT64 g_ullOverrunTick;
+static UINT32 g_uwOverrunCount;
+static UINT32 g_uwPeriodicSem;
+static UINT32 g_uwPeriodicRet;
+static TSK_PERIOD_INFO_S g_stPeriodicInfo;
+
+/* called from the tick interrupt */
+static VOID Example_PeriodicOverrun(UINT32 uwTaskID, TSK_PERIOD_INFO_S *pstInfo)
+{
+    (VOID)uwTaskID;
+    (VOID)pstInfo;
+    g_ullOverrunTick = LOS_TickCountGet();
+    g_uwOverrunCount++;
+}
+
+static VOID Example_PeriodicTask(VOID)
+{
+    UINT64 ullEnd;
+    UINT32 uwJob;
+
+    g_uwPeriodicRet = LOS_OK;
+    for (uwJob = 0; uwJob < PERIODIC_JOBS; uwJob++)
+    {
+        g_uwPeriodicRet |= LOS_TaskPeriodWait();
+        g_aullJobStart[uwJob] = LOS_TickCountGet();
+        if (uwJob == PERIODIC_OVERRUN_JOB)
+        {
+            ullEnd = g_aullJobStart[uwJob] + PERIODIC_OVERRUN_TICKS;
+            while (LOS_TickCountGet() < ullEnd)
+            {
+            }
+        }
+    }
+
+    /* complete the last job */
+    g_uwPeriodicRet |= LOS_TaskPeriodWait();
+    g_uwPeriodicRet |= LOS_TaskPeriodInfoGet(LOS_CurTaskIDGet(), &g_stPeriodicInfo);
+    (VOID)LOS_SemPost(g_uwPeriodicSem);
+}
+
+static UINT32 Example_PeriodicCheck(UINT64 ullFirst)
+{
+    UINT64 ullRelease;
+    UINT32 uwJob;
+
+    for (uwJob = 0; uwJob < PERIODIC_JOBS; uwJob++)
+    {
+        /* the jobs after the overrun are one release further on */
+        ullRelease = ullFirst + (UINT64)(uwJob + ((uwJob > PERIODIC_OVERRUN_JOB) ? 1 : 0)) * PERIODIC_PERIOD;
+        if (uwJob == PERIODIC_OVERRUN_JOB + 1)
+        {
+            /* started late for the release after the skipped one */
+            if ((g_aullJobStart[uwJob] < ullRelease) || (g_aullJobStart[uwJob] >= ullRelease + PERIODIC_PERIOD))
+            {
+                break;
+            }
+        }
+        else if (g_aullJobStart[uwJob] != ullRelease)
+        {
+            break;
+        }
+    }
+    if (uwJob != PERIODIC_JOBS)
+    {
+        dprintf("periodic job %d started off the release grid\n", uwJob);
+        return LOS_NOK;
+    }
+
+    ullRelease = ullFirst + PERIODIC_OVERRUN_JOB * PERIODIC_PERIOD + PERIODIC_DEADLINE;
+    if ((g_uwOverrunCount != 1) || (g_ullOverrunTick != ullRelease))
+    {
+        dprintf("periodic overrun reported %d times, last at tick %d\n", g_uwOverrunCount, (UINT32)g_ullOverrunTick);
+        return LOS_NOK;
+    }
+
+    if ((g_stPeriodicInfo.uwJobCount != PERIODIC_JOBS) || (g_stPeriodicInfo.uwMissCount != 1) ||
+        (g_stPeriodicInfo.uwSkipCount != 1))
+    {
+        dprintf("periodic jobs %d missed %d skipped %d\n", g_stPeriodicInfo.uwJobCount,
+                g_stPeriodicInfo.uwMissCount, g_stPeriodicInfo.uwSkipCount);
+        return LOS_NOK;
+    }
+    return LOS_OK;
+}
+
+UINT32 Example_Periodic(VOID)
+{
+    UINT32 uwRet;
+    UINT32 uwTaskID;
+    UINT16 usOldPrio;
+    UINTPTR uvIntSave;
+    UINT64 ullFirst = 0;
+    TSK_INIT_PARAM_S stTask;
+    TSK_PERIOD_PARAM_S stPeriod;
+
+    usOldPrio = LOS_TaskPriGet(LOS_CurTaskIDGet());
+    if (LOS_OK != LOS_CurTaskPriSet(PERIODIC_PRIO_MAIN))
+    {
+        dprintf("periodic priority set failed!\n");
+        return LOS_NOK;
+    }
+
+    uwRet = LOS_SemCreate(0, &g_uwPeriodicSem);
+    if (LOS_OK != uwRet)
+    {
+        dprintf("periodic sem create failed!\n");
+        (VOID)LOS_CurTaskPriSet(usOldPrio);
+        return uwRet;
+    }
+    g_uwOverrunCount = 0;
+
+    memset(&stTask, 0, sizeof(TSK_INIT_PARAM_S));
+    stTask.pfnTaskEntry = (TSK_ENTRY_FUNC)Example_PeriodicTask;
+    stTask.pcName       = "PeriodicTsk";
+    stTask.uwStackSize  = LOSCFG_BASE_CORE_TSK_IDLE_STACK_SIZE;
+    stTask.usTaskPrio   = PERIODIC_PRIO_TASK;
+
+    memset(&stPeriod, 0, sizeof(TSK_PERIOD_PARAM_S));
+    stPeriod.uwPeriod   = PERIODIC_PERIOD;
+    stPeriod.uwOffset   = PERIODIC_OFFSET;
+    stPeriod.uwDeadline = PERIODIC_DEADLINE;
+    stPeriod.pfnOverrun = Example_PeriodicOverrun;
+
+    /* the task must not run before it is periodic */
+    LOS_TaskLock();
+    uwRet = LOS_TaskCreate(&uwTaskID, &stTask);
+    if (LOS_OK == uwRet)
+    {
+        /* no tick between the first release and the grid origin read here */
+        uvIntSave = LOS_IntLock();
+        uwRet = LOS_TaskPeriodSet(uwTaskID, &stPeriod);
+        ullFirst = LOS_TickCountGet() + PERIODIC_OFFSET;
+        (VOID)LOS_IntRestore(uvIntSave);
+    }
+    LOS_TaskUnlock();
+
+    if (LOS_OK != uwRet)
+    {
+        dprintf("periodic task create failed!\n");
+    }
+    else if (LOS_OK != LOS_SemPend(g_uwPeriodicSem, PERIODIC_PERIOD * (PERIODIC_JOBS + 4)))
+    {
+        dprintf("periodic task did not finish!\n");
+        (VOID)LOS_TaskDelete(uwTaskID);
+        uwRet = LOS_NOK;
+    }
+    else if (LOS_OK != g_uwPeriodicRet)
+    {
+        dprintf("periodic task api failed!\n");
+        uwRet = LOS_NOK;
+    }
+    else
+    {
+        uwRet = Example_PeriodicCheck(ullFirst);
+    }
+
+    (VOID)LOS_SemDelete(g_uwPeriodicSem);
+    (VOID)LOS_CurTaskPriSet(usOldPrio);
+
+    if (LOS_OK != LOS_InspectStatusSetByID(LOS_INSPECT_PERIOD, (uwRet == LOS_OK) ? LOS_INSPECT_STU_SUCCESS : LOS_INSPECT_STU_ERROR))
+    {
+        dprintf("Set Inspect Status Err\n");
+    }
+    return uwRet;
+}
+
+#endif /* LOSCFG_BASE_CORE_TSK_PERIODIC == YES */
+
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif /* __cpluscplus */
+#endif /* __cpluscplus */
@@ -0,0 +1,190 @@
+/*----------------------------------------------------------------------------
+ * Copyright (c) <2013-2015>, <Huawei Technologies Co., Ltd>
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *---------------------------------------------------------------------------*/
+/*----------------------------------------------------------------------------
+ * Notice of Export Control Law
+ * ===============================================
+ * Huawei LiteOS may be subject to applicable export control laws and regulations, which might
+ * include those applicable to Huawei LiteOS of U.S. and the country in which you are located.
+ * Import, export and usage of Huawei LiteOS in any manner by you shall be in compliance with such
+ * applicable export control laws and regulations.
+ *---------------------------------------------------------------------------*/
+
+#include "los_config.h"
+#include "los_queue.h"
+#include "los_api_bench.h"
+#include "los_api_queue_bench.h"
+#ifdef LOSCFG_LIB_LIBC
+#include "string.h"
+#endif
+
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C" {
+#endif /* __cpluscplus */
+#endif /* __cpluscplus */
+
+/*
+ * Message throughput of one queue, producer and consumer in the same task so
+ * that only the queue API is timed, for 4, 64 and 512 byte messages:
+ * - copy:    LOS_QueueWriteCopy then LOS_QueueReadCopy, one message per call;
+ * - reserve: LOS_QueueReserve, fill the node, LOS_QueueCommit, then
+ *            LOS_QueuePeek and LOS_QueueRelease, the consumer reads in place;
+ * - batch:   LOS_QueueWriteBatch then LOS_QueueReadBatch, QUEUE_BENCH_DEPTH
+ *            messages per call.
+ * Every variant fills the queue, then drains it, QUEUE_BENCH_ROUNDS times.
+ */
+#define QUEUE_BENCH_DEPTH       8
+#define QUEUE_BENCH_ROUNDS      64
+#define QUEUE_BENCH_MAX_SIZE    512
+
+static UINT32 g_auwQueueBenchBuf[QUEUE_BENCH_DEPTH * QUEUE_BENCH_MAX_SIZE / sizeof(UINT32)];
+
+static VOID Example_QueueBenchPrint(const CHAR *pcName, UINT32 uwSize, UINT64 ullCycles, UINT32 uwErr)
+{
+    UINT32 uwMsgs = QUEUE_BENCH_DEPTH * QUEUE_BENCH_ROUNDS;
+
+    dprintf("%s %d bytes: %d msgs in %d cycles, %d msgs/s, %d failed calls\n", pcName, uwSize, uwMsgs,
+            (UINT32)ullCycles, ullCycles ? (UINT32)((UINT64)uwMsgs * OS_SYS_CLOCK / ullCycles) : 0, uwErr);
+}
+
+static UINT32 Example_QueueBenchCopy(UINT32 uwQueueID, UINT32 uwSize)
+{
+    UINT32 uwRound, uwIdx, uwLen;
+    UINT32 uwErr = 0;
+    UINT64 ullStart;
+
+    ullStart = Example_BenchCycle();
+    for (uwRound = 0; uwRound < QUEUE_BENCH_ROUNDS; uwRound++)
+    {
+        for (uwIdx = 0; uwIdx < QUEUE_BENCH_DEPTH; uwIdx++)
+        {
+            g_auwQueueBenchBuf[0] = uwIdx;
+            uwErr += (LOS_OK != LOS_QueueWriteCopy(uwQueueID, g_auwQueueBenchBuf, uwSize, LOS_NO_WAIT));
+        }
+        for (uwIdx = 0; uwIdx < QUEUE_BENCH_DEPTH; uwIdx++)
+        {
+            uwLen = uwSize;
+            uwErr += (LOS_OK != LOS_QueueReadCopy(uwQueueID, g_auwQueueBenchBuf, &uwLen, LOS_NO_WAIT));
+        }
+    }
+    Example_QueueBenchPrint("copy", uwSize, Example_BenchCycle() - ullStart, uwErr);
+    return uwErr;
+}
+
+static UINT32 Example_QueueBenchReserve(UINT32 uwQueueID, UINT32 uwSize)
+{
+    UINT32 uwRound, uwIdx, uwLen;
+    UINT32 uwErr = 0;
+    UINT64 ullStart;
+    VOID *pNode;
+
+    ullStart = Example_BenchCycle();
+    for (uwRound = 0; uwRound < QUEUE_BENCH_ROUNDS; uwRound++)
+    {
+        for (uwIdx = 0; uwIdx < QUEUE_BENCH_DEPTH; uwIdx++)
+        {
+            if (LOS_OK != LOS_QueueReserve(uwQueueID, &pNode, LOS_NO_WAIT))
+            {
+                uwErr++;
+                continue;
+            }
+            memcpy(pNode, g_auwQueueBenchBuf, uwSize);
+            uwErr += (LOS_OK != LOS_QueueCommit(uwQueueID, pNode, uwSize));
+        }
+        for (uwIdx = 0; uwIdx < QUEUE_BENCH_DEPTH; uwIdx++)
+        {
+            if (LOS_OK != LOS_QueuePeek(uwQueueID, &pNode, &uwLen, LOS_NO_WAIT))
+            {
+                uwErr++;
+                continue;
+            }
+            uwErr += (LOS_OK != LOS_QueueRelease(uwQueueID, pNode));
+        }
+    }
+    Example_QueueBenchPrint("reserve", uwSize, Example_BenchCycle() - ullStart, uwErr);
+    return uwErr;
+}
+
+static UINT32 Example_QueueBenchBatch(UINT32 uwQueueID, UINT32 uwSize)
+{
+    UINT32 uwRound, uwCount;
+    UINT32 uwErr = 0;
+    UINT64 ullStart;
+
+    /* the same buffer is the source of the writes and the target of the reads */
+    ullStart = Example_BenchCycle();
+    for (uwRound = 0; uwRound < QUEUE_BENCH_ROUNDS; uwRound++)
+    {
+        uwCount = QUEUE_BENCH_DEPTH;
+        if (LOS_OK != LOS_QueueWriteBatch(uwQueueID, g_auwQueueBenchBuf, uwSize, &uwCount, LOS_NO_WAIT) ||
+            uwCount != QUEUE_BENCH_DEPTH)
+        {
+            uwErr++;
+        }
+        uwCount = QUEUE_BENCH_DEPTH;
+        if (LOS_OK != LOS_QueueReadBatch(uwQueueID, g_auwQueueBenchBuf, uwSize, NULL, &uwCount, LOS_NO_WAIT) ||
+            uwCount != QUEUE_BENCH_DEPTH)
+        {
+            uwErr++;
+        }
+    }
+    Example_QueueBenchPrint("batch", uwSize, Example_BenchCycle() - ullStart, uwErr);
+    return uwErr;
+}
+
+UINT32 Example_QueueBench(VOID)
+{
+    static const UINT16 ausSize[] = {4, 64, QUEUE_BENCH_MAX_SIZE};
+    UINT32 uwQueueID;
+    UINT32 uwErr = 0;
+    UINT32 uwIdx;
+
+    for (uwIdx = 0; uwIdx < sizeof(ausSize) / sizeof(ausSize[0]); uwIdx++)
+    {
+        if (LOS_OK != LOS_QueueCreate("QueueBench", QUEUE_BENCH_DEPTH, &uwQueueID, 0, ausSize[uwIdx]))
+        {
+            dprintf("queue bench create failed for %d bytes!\n", ausSize[uwIdx]);
+            uwErr++;
+            continue;
+        }
+
+        uwErr += Example_QueueBenchCopy(uwQueueID, ausSize[uwIdx]);
+        uwErr += Example_QueueBenchReserve(uwQueueID, ausSize[uwIdx]);
+        uwErr += Example_QueueBenchBatch(uwQueueID, ausSize[uwIdx]);
+
+        (VOID)LOS_QueueDelete(uwQueueID);
+    }
+
+    return (uwErr == 0) ? LOS_OK : LOS_NOK;
+}
+
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif /* __cpluscplus */
+#endif /* __cpluscplus */
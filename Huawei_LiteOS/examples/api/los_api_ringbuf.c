@@ -0,0 +1,231 @@
+/*----------------------------------------------------------------------------
+ * Copyright (c) <2013-2015>, <Huawei Technologies Co., Ltd>
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *---------------------------------------------------------------------------*/
+/*----------------------------------------------------------------------------
+ * Notice of Export Control Law
+ * ===============================================
+ * Huawei LiteOS may be subject to applicable export control laws and regulations, which might
+ * include those applicable to Huawei LiteOS of U.S. and the country in which you are located.
+ * Import, export and usage of Huawei LiteOS in any manner by you shall be in compliance with such
+ * applicable export control laws and regulations.
+ *---------------------------------------------------------------------------*/
+
+#include "los_config.h"
+#include "los_ringbuf.h"
+#include "los_task.h"
+#include "los_api_ringbuf.h"
+#include "los_inspect_entry.h"
+#ifdef LOSCFG_LIB_LIBC
+#include "string.h"
+#endif
+
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C" {
+#endif /* __cpluscplus */
+#endif /* __cpluscplus */
+
+#if (LOSCFG_BASE_IPC_RINGBUF == YES)
+
+/*
+ * A 16 byte ring buffer in both modes:
+ * - a push that crosses the end of the storage pops back in order;
+ * - a push larger than the free space stores what fits and returns that count,
+ *   a push into a full ring returns 0;
+ * - two producer tasks push 4 byte records into an MPSC ring that wraps many
+ *   times, while this task waits and pops; every record must arrive whole and
+ *   in order per producer.
+ */
+#define RINGBUF_SIZE            16
+#define RINGBUF_PRIO_MAIN       10
+#define RINGBUF_PRIO_PRODUCER   9
+#define RINGBUF_PRODUCERS       2
+#define RINGBUF_RECORDS         32
+#define RINGBUF_WAIT_TICKS      20
+
+static RINGBUF_S g_stRingBuf;
+static UINT8 g_aucRingBufStore[RINGBUF_SIZE];
+
+static UINT32 Example_RingBufCheck(UINT8 *pucData, UINT32 uwLen, UINT8 ucFirst)
+{
+    UINT32 uwIdx;
+
+    for (uwIdx = 0; uwIdx < uwLen; uwIdx++)
+    {
+        if (pucData[uwIdx] != (UINT8)(ucFirst + uwIdx))
+        {
+            return LOS_NOK;
+        }
+    }
+    return LOS_OK;
+}
+
+static UINT32 Example_RingBufSingle(UINT32 uwMode)
+{
+    UINT8 aucIn[RINGBUF_SIZE + 8];
+    UINT8 aucOut[RINGBUF_SIZE];
+    UINT32 uwIdx;
+
+    for (uwIdx = 0; uwIdx < sizeof(aucIn); uwIdx++)
+    {
+        aucIn[uwIdx] = (UINT8)uwIdx;
+    }
+    if (LOS_OK != LOS_RingBufInit(&g_stRingBuf, g_aucRingBufStore, RINGBUF_SIZE, uwMode))
+    {
+        return LOS_NOK;
+    }
+
+    /* move the indexes to 10, then push 12 bytes across the end of the storage */
+    if (LOS_RingBufPush(&g_stRingBuf, aucIn, 10) != 10 || LOS_RingBufPop(&g_stRingBuf, aucOut, 10) != 10 ||
+        LOS_RingBufPush(&g_stRingBuf, aucIn, 12) != 12 || LOS_RingBufUsed(&g_stRingBuf) != 12 ||
+        LOS_RingBufPop(&g_stRingBuf, aucOut, sizeof(aucOut)) != 12 || Example_RingBufCheck(aucOut, 12, 0) != LOS_OK)
+    {
+        dprintf("ringbuf mode %d wrap-around failed\n", uwMode);
+        return LOS_NOK;
+    }
+
+    /* 12 bytes in, then 8 more only fit 4, then nothing fits */
+    if (LOS_RingBufPush(&g_stRingBuf, aucIn, 12) != 12 || LOS_RingBufPush(&g_stRingBuf, &aucIn[12], 8) != 4 ||
+        LOS_RingBufPush(&g_stRingBuf, aucIn, 1) != 0 || LOS_RingBufUsed(&g_stRingBuf) != RINGBUF_SIZE ||
+        LOS_RingBufPop(&g_stRingBuf, aucOut, sizeof(aucOut)) != RINGBUF_SIZE ||
+        Example_RingBufCheck(aucOut, RINGBUF_SIZE, 0) != LOS_OK)
+    {
+        dprintf("ringbuf mode %d partial push failed\n", uwMode);
+        return LOS_NOK;
+    }
+    return LOS_OK;
+}
+
+/* record: producer number, sequence, and their complements */
+static VOID Example_RingBufProducer(UINT32 uwProducer)
+{
+    UINT8 aucRec[4];
+    UINT32 uwSeq = 0;
+
+    while (uwSeq < RINGBUF_RECORDS)
+    {
+        aucRec[0] = (UINT8)uwProducer;
+        aucRec[1] = (UINT8)uwSeq;
+        aucRec[2] = (UINT8)~uwProducer;
+        aucRec[3] = (UINT8)~uwSeq;
+        /* pops are whole records too, so the free space is always a multiple of 4 */
+        if (LOS_RingBufPush(&g_stRingBuf, aucRec, sizeof(aucRec)) == sizeof(aucRec))
+        {
+            uwSeq++;
+        }
+        else
+        {
+            (VOID)LOS_TaskDelay(1);
+        }
+    }
+}
+
+static UINT32 Example_RingBufMulti(VOID)
+{
+    UINT32 auwNext[RINGBUF_PRODUCERS] = {0};
+    TSK_INIT_PARAM_S stTask;
+    UINT32 uwTaskID;
+    UINT32 uwRecs = 0;
+    UINT32 uwIdx;
+    UINT8 aucRec[4];
+
+    if (LOS_OK != LOS_RingBufInit(&g_stRingBuf, g_aucRingBufStore, RINGBUF_SIZE, LOS_RINGBUF_MPSC))
+    {
+        return LOS_NOK;
+    }
+
+    for (uwIdx = 0; uwIdx < RINGBUF_PRODUCERS; uwIdx++)
+    {
+        memset(&stTask, 0, sizeof(TSK_INIT_PARAM_S));
+        stTask.pfnTaskEntry = (TSK_ENTRY_FUNC)Example_RingBufProducer;
+        stTask.pcName       = "RingBufTsk";
+        stTask.uwStackSize  = LOSCFG_BASE_CORE_TSK_IDLE_STACK_SIZE;
+        stTask.usTaskPrio   = RINGBUF_PRIO_PRODUCER;
+        stTask.uwArg        = uwIdx;
+        if (LOS_OK != LOS_TaskCreate(&uwTaskID, &stTask))
+        {
+            dprintf("ringbuf producer create failed\n");
+            return LOS_NOK;
+        }
+    }
+
+    while (uwRecs < RINGBUF_PRODUCERS * RINGBUF_RECORDS)
+    {
+        if (LOS_OK != LOS_RingBufWait(&g_stRingBuf, sizeof(aucRec), RINGBUF_WAIT_TICKS))
+        {
+            dprintf("ringbuf consumer starved after %d records\n", uwRecs);
+            return LOS_NOK;
+        }
+        while (LOS_RingBufPop(&g_stRingBuf, aucRec, sizeof(aucRec)) == sizeof(aucRec))
+        {
+            if (aucRec[0] >= RINGBUF_PRODUCERS || (UINT8)(aucRec[0] ^ aucRec[2]) != 0xFF ||
+                (UINT8)(aucRec[1] ^ aucRec[3]) != 0xFF || aucRec[1] != (UINT8)auwNext[aucRec[0]])
+            {
+                dprintf("ringbuf record %d torn or out of order\n", uwRecs);
+                return LOS_NOK;
+            }
+            auwNext[aucRec[0]]++;
+            uwRecs++;
+        }
+    }
+    return LOS_OK;
+}
+
+UINT32 Example_RingBuf(VOID)
+{
+    UINT32 uwRet = LOS_OK;
+    UINT16 usOldPrio;
+
+    usOldPrio = LOS_TaskPriGet(LOS_CurTaskIDGet());
+    if (LOS_OK != LOS_CurTaskPriSet(RINGBUF_PRIO_MAIN))
+    {
+        dprintf("ringbuf priority set failed!\n");
+        return LOS_NOK;
+    }
+
+    uwRet |= Example_RingBufSingle(LOS_RINGBUF_SPSC);
+    uwRet |= Example_RingBufSingle(LOS_RINGBUF_MPSC);
+    uwRet |= Example_RingBufMulti();
+
+    /* let producers left behind by a failure finish before the storage is reused */
+    (VOID)LOS_TaskDelay(RINGBUF_WAIT_TICKS);
+    (VOID)LOS_CurTaskPriSet(usOldPrio);
+
+    if (LOS_OK != LOS_InspectStatusSetByID(LOS_INSPECT_RBUF, (uwRet == LOS_OK) ? LOS_INSPECT_STU_SUCCESS : LOS_INSPECT_STU_ERROR))
+    {
+        dprintf("Set Inspect Status Err\n");
+    }
+    return uwRet;
+}
+
+#endif /* LOSCFG_BASE_IPC_RINGBUF == YES */
+
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif /* __cpluscplus */
+#endif /* __cpluscplus */
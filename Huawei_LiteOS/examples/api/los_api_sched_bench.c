@@ -0,0 +1,211 @@
+/*----------------------------------------------------------------------------
+ * Copyright (c) <2013-2015>, <Huawei Technologies Co., Ltd>
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *---------------------------------------------------------------------------*/
+/*----------------------------------------------------------------------------
+ * Notice of Export Control Law
+ * ===============================================
+ * Huawei LiteOS may be subject to applicable export control laws and regulations, which might
+ * include those applicable to Huawei LiteOS of U.S. and the country in which you are located.
+ * Import, export and usage of Huawei LiteOS in any manner by you shall be in compliance with such
+ * applicable export control laws and regulations.
+ *---------------------------------------------------------------------------*/
+
+#include "los_config.h"
+#include "los_task.h"
+#include "los_hwi.h"
+#include "los_priqueue.ph"
+#include "los_api_bench.h"
+#include "los_api_sched_bench.h"
+#ifdef LOSCFG_LIB_LIBC
+#include "string.h"
+#endif
+
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C" {
+#endif /* __cpluscplus */
+#endif /* __cpluscplus */
+
+/*
+ * Measures the two halves of a reschedule with LOS_GetCpuCycle:
+ * - osPriqueueTop, the ready queue lookup, with 0 to SCHED_BENCH_FILLERS extra
+ *   ready tasks spread over distinct priorities; it should not grow with them.
+ *   The list walk the bitmap replaced is timed next to it as the baseline, its
+ *   cost grows with the highest ready priority number, SCHED_BENCH_PRIO here.
+ * - LOS_TaskResume of a higher priority task up to its first instruction, that is
+ *   osSchedule plus the PendSV context switch.
+ */
+#define SCHED_BENCH_PRIO        10
+#define SCHED_BENCH_FILLERS     6
+#define SCHED_BENCH_LOOPS       64
+
+static UINT32 g_uwSchedBenchWakeID;
+static volatile UINT64 g_ullSchedBenchWoken;
+static volatile BOOL g_bSchedBenchStop;
+
+static VOID Example_SchedBenchFiller(VOID)
+{
+    return;
+}
+
+static VOID Example_SchedBenchWake(VOID)
+{
+    while (!g_bSchedBenchStop)
+    {
+        (VOID)LOS_TaskSuspend(g_uwSchedBenchWakeID);
+        g_ullSchedBenchWoken = Example_BenchCycle();
+    }
+}
+
+/* the ready queue lookup before the priority bitmap, kept as the baseline */
+static LOS_DL_LIST *Example_SchedBenchTopWalk(VOID)
+{
+    UINT32 uwPri;
+
+    for (uwPri = 0; uwPri < OS_PRIORITY_QUEUE_PRIORITYNUM; ++uwPri)
+    {
+        if (!LOS_ListEmpty(&g_pstLosPriorityQueueList[uwPri]))
+        {
+            return LOS_DL_LIST_FIRST(&g_pstLosPriorityQueueList[uwPri]);
+        }
+    }
+
+    return (LOS_DL_LIST *)NULL;
+}
+
+static UINT32 Example_SchedBenchTask(UINT32 *puwTaskID, TSK_ENTRY_FUNC pfnEntry, UINT16 usPrio)
+{
+    TSK_INIT_PARAM_S stTask;
+
+    memset(&stTask, 0, sizeof(TSK_INIT_PARAM_S));
+    stTask.pfnTaskEntry = pfnEntry;
+    stTask.pcName       = "SchedBench";
+    stTask.uwStackSize  = LOSCFG_BASE_CORE_TSK_IDLE_STACK_SIZE;
+    stTask.usTaskPrio   = usPrio;
+    return LOS_TaskCreate(puwTaskID, &stTask);
+}
+
+static VOID Example_SchedBenchTop(UINT32 uwReady, UINT32 uwOverhead)
+{
+    BENCH_STAT stTop = {0};
+    BENCH_STAT stWalk = {0};
+    LOS_DL_LIST *pstTop;
+    LOS_DL_LIST *pstWalk;
+    UINTPTR uvIntSave;
+    UINT64 ullStart;
+    UINT32 uwLoop;
+
+    for (uwLoop = 0; uwLoop < SCHED_BENCH_LOOPS; uwLoop++)
+    {
+        uvIntSave = LOS_IntLock();
+        ullStart = Example_BenchCycle();
+        pstTop = osPriqueueTop();
+        Example_BenchAdd(&stTop, (UINT32)(Example_BenchCycle() - ullStart) - uwOverhead);
+
+        ullStart = Example_BenchCycle();
+        pstWalk = Example_SchedBenchTopWalk();
+        Example_BenchAdd(&stWalk, (UINT32)(Example_BenchCycle() - ullStart) - uwOverhead);
+        LOS_IntRestore(uvIntSave);
+
+        if (pstTop != pstWalk)
+        {
+            dprintf("sched bench: bitmap and list walk disagree!\n");
+            return;
+        }
+    }
+
+    dprintf("%d tasks ready, highest priority %d\n", uwReady, SCHED_BENCH_PRIO);
+    Example_BenchPrint("osPriqueueTop (bitmap)", &stTop);
+    Example_BenchPrint("list walk (baseline)", &stWalk);
+}
+
+UINT32 Example_SchedBench(VOID)
+{
+    BENCH_STAT stSwitch = {0};
+    UINT32 uwFillerID;
+    UINT32 uwOverhead;
+    UINT32 uwLoop;
+    UINT32 uwRet = LOS_OK;
+    UINT16 usOldPrio;
+    UINT64 ullStart;
+
+    usOldPrio = LOS_TaskPriGet(LOS_CurTaskIDGet());
+    if (LOS_OK != LOS_CurTaskPriSet(SCHED_BENCH_PRIO))
+    {
+        dprintf("sched bench priority set failed!\n");
+        return LOS_NOK;
+    }
+
+    uwOverhead = Example_BenchOverhead();
+
+    /* fillers are below us, so they stay ready until we give up the CPU */
+    Example_SchedBenchTop(osPriqueueTotalSize(), uwOverhead);
+    for (uwLoop = 0; uwLoop < SCHED_BENCH_FILLERS; uwLoop++)
+    {
+        if (LOS_OK != Example_SchedBenchTask(&uwFillerID, (TSK_ENTRY_FUNC)Example_SchedBenchFiller,
+                                             SCHED_BENCH_PRIO + 1 + uwLoop))
+        {
+            dprintf("sched bench filler create failed!\n");
+            uwRet = LOS_NOK;
+            break;
+        }
+    }
+    Example_SchedBenchTop(osPriqueueTotalSize(), uwOverhead);
+
+    /* the waker runs above us and suspends itself right away */
+    g_bSchedBenchStop = FALSE;
+    if (LOS_OK != Example_SchedBenchTask(&g_uwSchedBenchWakeID, (TSK_ENTRY_FUNC)Example_SchedBenchWake,
+                                         SCHED_BENCH_PRIO - 1))
+    {
+        dprintf("sched bench waker create failed!\n");
+        (VOID)LOS_CurTaskPriSet(usOldPrio);
+        return LOS_NOK;
+    }
+
+    for (uwLoop = 0; uwLoop < SCHED_BENCH_LOOPS; uwLoop++)
+    {
+        ullStart = Example_BenchCycle();
+        (VOID)LOS_TaskResume(g_uwSchedBenchWakeID);
+        Example_BenchAdd(&stSwitch, (UINT32)(g_ullSchedBenchWoken - ullStart) - uwOverhead);
+    }
+    Example_BenchPrint("LOS_TaskResume to switch-in", &stSwitch);
+
+    g_bSchedBenchStop = TRUE;
+    (VOID)LOS_TaskResume(g_uwSchedBenchWakeID);
+
+    /* let the fillers and the waker run to completion */
+    (VOID)LOS_CurTaskPriSet(usOldPrio);
+    (VOID)LOS_TaskDelay(2);
+
+    return uwRet;
+}
+
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif /* __cpluscplus */
+#endif /* __cpluscplus */
@@ -0,0 +1,205 @@
+/*----------------------------------------------------------------------------
+ * Copyright (c) <2013-2015>, <Huawei Technologies Co., Ltd>
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *---------------------------------------------------------------------------*/
+/*----------------------------------------------------------------------------
+ * Notice of Export Control Law
+ * ===============================================
+ * Huawei LiteOS may be subject to applicable export control laws and regulations, which might
+ * include those applicable to Huawei LiteOS of U.S. and the country in which you are located.
+ * Import, export and usage of Huawei LiteOS in any manner by you shall be in compliance with such
+ * applicable export control laws and regulations.
+ *---------------------------------------------------------------------------*/
+
+#include "los_config.h"
+#include "los_sem.h"
+#include "los_task.h"
+#include "los_workqueue.h"
+#include "los_api_workqueue.h"
+#include "los_inspect_entry.h"
+#ifdef LOSCFG_LIB_LIBC
+#include "string.h"
+#endif
+
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C" {
+#endif /* __cpluscplus */
+#endif /* __cpluscplus */
+
+#if (LOSCFG_KERNEL_WORKQUEUE == YES)
+
+/*
+ * One worker above this task, so a submitted item runs before the submit returns
+ * control here:
+ * - a submitted item runs once with its argument;
+ * - with the scheduler locked, a second submit reports WORK_PENDING and a cancel
+ *   removes the item before it runs;
+ * - a cancelled delayed item never runs, an uncancelled one does;
+ * - cancelling an item that is blocked in its function reports WORK_RUNNING
+ *   until the function returns.
+ */
+#define WORKQ_PRIO_MAIN     10
+#define WORKQ_PRIO_WORKER   9
+#define WORKQ_ARG           0x5a
+#define WORKQ_DELAY_TICKS   5
+
+static UINT32 g_uwWorkCount;
+static UINT32 g_uwWorkArg;
+static UINT32 g_uwWorkSem;
+
+static VOID Example_WorkFunc(UINT32 uwArg)
+{
+    g_uwWorkArg = uwArg;
+    g_uwWorkCount++;
+}
+
+static VOID Example_WorkBlock(UINT32 uwArg)
+{
+    (VOID)uwArg;
+    (VOID)LOS_SemPend(g_uwWorkSem, LOS_WAIT_FOREVER);
+    g_uwWorkCount++;
+}
+
+static UINT32 Example_WorkQueueRun(UINT32 uwWqID)
+{
+    WORK_S stWork;
+    WORK_S stBlock;
+    UINT32 uwRet;
+
+    (VOID)LOS_WorkInit(&stWork, Example_WorkFunc, WORKQ_ARG);
+    (VOID)LOS_WorkInit(&stBlock, Example_WorkBlock, 0);
+
+    /* runs */
+    g_uwWorkCount = 0;
+    if (LOS_OK != LOS_WorkQueueSubmit(uwWqID, &stWork) || g_uwWorkCount != 1 || g_uwWorkArg != WORKQ_ARG)
+    {
+        dprintf("workqueue item did not run, count %d\n", g_uwWorkCount);
+        return LOS_NOK;
+    }
+
+    /* queued twice, then cancelled before the worker gets the cpu */
+    LOS_TaskLock();
+    (VOID)LOS_WorkQueueSubmit(uwWqID, &stWork);
+    uwRet = LOS_WorkQueueSubmit(uwWqID, &stWork);
+    if (LOS_ERRNO_WORKQUEUE_WORK_PENDING == uwRet)
+    {
+        uwRet = LOS_WorkCancel(&stWork);
+    }
+    LOS_TaskUnlock();
+    (VOID)LOS_TaskDelay(1);
+    if (LOS_OK != uwRet || g_uwWorkCount != 1)
+    {
+        dprintf("workqueue cancel of a queued item failed, ret 0x%x count %d\n", uwRet, g_uwWorkCount);
+        return LOS_NOK;
+    }
+
+    /* delayed: the cancelled one never runs, the other one does */
+    if (LOS_OK != LOS_WorkQueueSubmitDelayed(uwWqID, &stWork, WORKQ_DELAY_TICKS) || LOS_OK != LOS_WorkCancel(&stWork))
+    {
+        dprintf("workqueue cancel of a delayed item failed\n");
+        return LOS_NOK;
+    }
+    (VOID)LOS_TaskDelay(WORKQ_DELAY_TICKS * 2);
+    if (g_uwWorkCount != 1 || LOS_OK != LOS_WorkQueueSubmitDelayed(uwWqID, &stWork, WORKQ_DELAY_TICKS))
+    {
+        dprintf("workqueue cancelled delayed item ran\n");
+        return LOS_NOK;
+    }
+    (VOID)LOS_TaskDelay(WORKQ_DELAY_TICKS * 2);
+    if (g_uwWorkCount != 2)
+    {
+        dprintf("workqueue delayed item did not run\n");
+        return LOS_NOK;
+    }
+
+    /* the worker is blocked inside the function, cancel cannot stop it */
+    if (LOS_OK != LOS_WorkQueueSubmit(uwWqID, &stBlock) || LOS_ERRNO_WORKQUEUE_WORK_RUNNING != LOS_WorkCancel(&stBlock))
+    {
+        dprintf("workqueue cancel of a running item did not report it\n");
+        (VOID)LOS_SemPost(g_uwWorkSem);
+        return LOS_NOK;
+    }
+    (VOID)LOS_SemPost(g_uwWorkSem);
+    if (LOS_OK != LOS_WorkCancel(&stBlock) || g_uwWorkCount != 3)
+    {
+        dprintf("workqueue running item did not finish\n");
+        return LOS_NOK;
+    }
+    return LOS_OK;
+}
+
+UINT32 Example_WorkQueue(VOID)
+{
+    UINT32 uwRet;
+    UINT32 uwWqID;
+    UINT16 usOldPrio;
+
+    usOldPrio = LOS_TaskPriGet(LOS_CurTaskIDGet());
+    if (LOS_OK != LOS_CurTaskPriSet(WORKQ_PRIO_MAIN))
+    {
+        dprintf("workqueue priority set failed!\n");
+        return LOS_NOK;
+    }
+
+    uwRet = LOS_SemCreate(0, &g_uwWorkSem);
+    if (LOS_OK != uwRet)
+    {
+        dprintf("workqueue sem create failed!\n");
+        (VOID)LOS_CurTaskPriSet(usOldPrio);
+        return uwRet;
+    }
+    uwRet = LOS_WorkQueueCreate("WorkQTest", WORKQ_PRIO_WORKER, 1, LOSCFG_BASE_CORE_TSK_IDLE_STACK_SIZE, &uwWqID);
+    if (LOS_OK == uwRet)
+    {
+        uwRet = Example_WorkQueueRun(uwWqID);
+        if (LOS_OK != LOS_WorkQueueDelete(uwWqID))
+        {
+            dprintf("workqueue delete failed!\n");
+            uwRet = LOS_NOK;
+        }
+    }
+    else
+    {
+        dprintf("workqueue create failed!\n");
+    }
+    (VOID)LOS_SemDelete(g_uwWorkSem);
+    (VOID)LOS_CurTaskPriSet(usOldPrio);
+
+    if (LOS_OK != LOS_InspectStatusSetByID(LOS_INSPECT_WORKQ, (uwRet == LOS_OK) ? LOS_INSPECT_STU_SUCCESS : LOS_INSPECT_STU_ERROR))
+    {
+        dprintf("Set Inspect Status Err\n");
+    }
+    return uwRet;
+}
+
+#endif /* LOSCFG_KERNEL_WORKQUEUE == YES */
+
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif /* __cpluscplus */
+#endif /* __cpluscplus */
@@ -115,6 +115,36 @@ static LITE_OS_SEC_TEXT VOID LOS_Demo_Tskfunc(VOID)
 #ifdef LOS_KERNEL_TEST_LIST
     Example_list();
 #endif
+#ifdef LOS_KERNEL_TEST_MEM_BENCH
+    Example_MemBench();
+#endif
+#ifdef LOS_KERNEL_TEST_SCHED_BENCH
+    Example_SchedBench();
+#endif
+#ifdef LOS_KERNEL_TEST_PEND_ORDER
+    Example_PendOrder();
+#endif
+#ifdef LOS_KERNEL_TEST_IRQ_LATENCY
+    Example_IrqLatency();
+#endif
+#ifdef LOS_KERNEL_TEST_NOTIFY_BENCH
+    Example_NotifyBench();
+#endif
+#ifdef LOS_KERNEL_TEST_QUEUE_BENCH
+    Example_QueueBench();
+#endif
+#ifdef LOS_KERNEL_TEST_MULTIWAIT
+    Example_MultiWait();
+#endif
+#ifdef LOS_KERNEL_TEST_RINGBUF
+    Example_RingBuf();
+#endif
+#ifdef LOS_KERNEL_TEST_WORKQUEUE
+    Example_WorkQueue();
+#endif
+#ifdef LOS_KERNEL_TEST_PERIODIC
+    Example_Periodic();
+#endif
 #endif/* LOS_KERNEL_TEST_ALL */
 
     while (1)
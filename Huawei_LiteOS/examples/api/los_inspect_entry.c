@@ -74,6 +74,18 @@ extern "C" {
 #include "los_api_systick.h"
 /* dlist */
 #include "los_api_list.h"
+/* pend order */
+#include "los_api_pend_order.h"
+/* notify vs semaphore benchmark */
+#include "los_api_notify_bench.h"
+/* multi-wait */
+#include "los_api_multiwait.h"
+/* ring buffer */
+#include "los_api_ringbuf.h"
+/* work queue */
+#include "los_api_workqueue.h"
+/* periodic task */
+#include "los_api_periodic.h"
 
 
 /*****************************************************************************
@@ -109,6 +121,26 @@ static osInspect_Def gInspect[LOS_INSPECT_BUFF] = {
     
     //{LOS_INSPECT_INTERRUPT,LOS_INSPECT_STU_START,Example_Interrupt},
     
+    {LOS_INSPECT_PEND,LOS_INSPECT_STU_START,Example_PendOrder,"PEND"},
+    
+    {LOS_INSPECT_NTFY,LOS_INSPECT_STU_START,Example_NotifyBench,"NTFY"},
+    
+#if (LOSCFG_BASE_IPC_MULTIWAIT == YES)
+    {LOS_INSPECT_MWAIT,LOS_INSPECT_STU_START,Example_MultiWait,"MWAIT"},
+#endif
+    
+#if (LOSCFG_BASE_IPC_RINGBUF == YES)
+    {LOS_INSPECT_RBUF,LOS_INSPECT_STU_START,Example_RingBuf,"RBUF"},
+#endif
+    
+#if (LOSCFG_KERNEL_WORKQUEUE == YES)
+    {LOS_INSPECT_WORKQ,LOS_INSPECT_STU_START,Example_WorkQueue,"WORKQ"},
+#endif
+    
+#if (LOSCFG_BASE_CORE_TSK_PERIODIC == YES)
+    {LOS_INSPECT_PERIOD,LOS_INSPECT_STU_START,Example_Periodic,"PERIO"},
+#endif
+    
 };
 
 
@@ -0,0 +1,131 @@
+/* Generated by kernel/extended/trace/trace_decode.py --mem-replay, 708 operations. */
+
+#ifndef _LOS_API_MEM_REPLAY_H
+#define _LOS_API_MEM_REPLAY_H
+
+#define MEM_REPLAY_SLOT_NUM             21
+#define MEM_REPLAY_PEAK_SIZE            0x2484
+
+/* {size, slot}: a size allocates the slot, 0 frees it */
+static const MEM_REPLAY_OP g_astMemReplay[] = {
+    {256, 0}, {512, 1}, {96, 2}, {1024, 3}, {64, 4}, {200, 5},
+    {48, 6}, {2048, 7}, {128, 8}, {0, 8}, {96, 8}, {0, 8},
+    {1500, 8}, {768, 9}, {0, 8}, {0, 9}, {300, 8}, {1500, 9},
+    {0, 9}, {300, 9}, {0, 9}, {0, 8}, {300, 8}, {32, 9},
+    {0, 8}, {512, 8}, {0, 8}, {128, 8}, {768, 10}, {1500, 11},
+    {1500, 12}, {0, 12}, {768, 12}, {24, 13}, {256, 14}, {0, 13},
+    {0, 12}, {512, 12}, {32, 13}, {512, 15}, {24, 16}, {0, 16},
+    {0, 13}, {0, 8}, {0, 9}, {128, 8}, {0, 12}, {0, 8},
+    {0, 10}, {1500, 8}, {0, 8}, {40, 8}, {0, 14}, {512, 9},
+    {96, 10}, {256, 12}, {256, 13}, {0, 11}, {300, 11}, {0, 8},
+    {0, 9}, {0, 10}, {96, 8}, {300, 9}, {0, 9}, {0, 11},
+    {24, 9}, {0, 13}, {0, 8}, {16, 8}, {0, 9}, {768, 9},
+    {32, 10}, {0, 15}, {0, 12}, {0, 9}, {0, 10}, {64, 9},
+    {64, 10}, {16, 11}, {128, 12}, {0, 9}, {32, 9}, {16, 13},
+    {0, 9}, {64, 9}, {0, 8}, {0, 11}, {0, 9}, {32, 8},
+    {0, 10}, {40, 9}, {0, 9}, {40, 9}, {0, 8}, {32, 8},
+    {96, 10}, {256, 11}, {0, 13}, {300, 13}, {0, 12}, {0, 13},
+    {0, 11}, {128, 11}, {0, 8}, {128, 8}, {0, 8}, {0, 10},
+    {0, 11}, {40, 8}, {256, 10}, {0, 10}, {0, 9}, {64, 9},
+    {128, 10}, {64, 11}, {0, 10}, {0, 11}, {0, 9}, {0, 8},
+    {128, 8}, {0, 8}, {32, 8}, {0, 8}, {96, 8}, {0, 8},
+    {40, 8}, {0, 8}, {96, 8}, {0, 8}, {24, 8}, {0, 8},
+    {128, 8}, {0, 8}, {64, 8}, {64, 9}, {0, 8}, {1500, 8},
+    {0, 8}, {128, 8}, {0, 8}, {1500, 8}, {0, 8}, {0, 9},
+    {64, 8}, {64, 9}, {256, 10}, {0, 10}, {0, 9}, {300, 9},
+    {16, 10}, {64, 11}, {64, 12}, {0, 12}, {0, 8}, {96, 8},
+    {0, 10}, {768, 10}, {128, 12}, {0, 12}, {0, 11}, {0, 9},
+    {0, 10}, {40, 9}, {512, 10}, {0, 10}, {0, 8}, {64, 8},
+    {0, 8}, {0, 9}, {96, 8}, {24, 9}, {768, 10}, {64, 11},
+    {96, 12}, {0, 10}, {0, 12}, {0, 11}, {0, 9}, {0, 8},
+    {64, 8}, {128, 9}, {300, 10}, {64, 11}, {0, 8}, {0, 10},
+    {0, 9}, {96, 8}, {96, 9}, {0, 8}, {128, 8}, {0, 8},
+    {0, 9}, {0, 11}, {256, 8}, {0, 8}, {768, 8}, {0, 8},
+    {24, 8}, {128, 9}, {64, 10}, {512, 11}, {32, 12}, {0, 9},
+    {768, 9}, {300, 13}, {0, 8}, {16, 8}, {512, 14}, {256, 15},
+    {0, 12}, {0, 11}, {0, 10}, {0, 9}, {0, 13}, {128, 9},
+    {128, 10}, {0, 8}, {0, 14}, {0, 10}, {40, 8}, {0, 8},
+    {300, 8}, {1500, 10}, {64, 11}, {1500, 12}, {64, 13}, {96, 14},
+    {0, 13}, {128, 13}, {0, 13}, {0, 10}, {768, 10}, {0, 14},
+    {0, 11}, {0, 9}, {128, 9}, {0, 8}, {0, 9}, {0, 10},
+    {0, 12}, {0, 15}, {128, 8}, {0, 8}, {768, 8}, {0, 8},
+    {128, 8}, {0, 8}, {64, 8}, {0, 8}, {32, 8}, {0, 8},
+    {16, 8}, {0, 8}, {256, 8}, {1500, 9}, {0, 8}, {32, 8},
+    {300, 10}, {32, 11}, {1500, 12}, {0, 11}, {256, 11}, {0, 9},
+    {0, 8}, {0, 11}, {0, 12}, {768, 8}, {0, 8}, {0, 10},
+    {16, 8}, {256, 9}, {300, 10}, {0, 9}, {256, 9}, {0, 10},
+    {0, 8}, {64, 8}, {0, 8}, {0, 9}, {128, 8}, {64, 9},
+    {16, 10}, {0, 10}, {0, 8}, {128, 8}, {32, 10}, {300, 11},
+    {64, 12}, {24, 13}, {0, 13}, {128, 13}, {24, 14}, {0, 14},
+    {0, 13}, {128, 13}, {512, 14}, {40, 15}, {128, 16}, {512, 17},
+    {16, 18}, {0, 18}, {0, 17}, {0, 11}, {0, 10}, {768, 10},
+    {0, 12}, {0, 16}, {0, 10}, {0, 9}, {0, 15}, {16, 9},
+    {0, 13}, {96, 10}, {0, 14}, {0, 10}, {40, 10}, {64, 11},
+    {32, 12}, {0, 9}, {0, 12}, {512, 9}, {0, 9}, {0, 11},
+    {300, 9}, {1500, 11}, {0, 8}, {0, 10}, {32, 8}, {0, 8},
+    {0, 11}, {0, 9}, {40, 8}, {0, 8}, {96, 8}, {0, 8},
+    {256, 8}, {0, 8}, {16, 8}, {0, 8}, {24, 8}, {96, 9},
+    {0, 8}, {0, 9}, {300, 8}, {768, 9}, {0, 8}, {64, 8},
+    {768, 10}, {0, 8}, {40, 8}, {0, 9}, {0, 10}, {0, 8},
+    {512, 8}, {32, 9}, {0, 9}, {16, 9}, {0, 8}, {768, 8},
+    {1500, 10}, {0, 8}, {0, 10}, {64, 8}, {16, 10}, {0, 8},
+    {0, 9}, {0, 10}, {16, 8}, {0, 8}, {1500, 8}, {128, 9},
+    {0, 9}, {0, 8}, {512, 8}, {32, 9}, {0, 8}, {0, 9},
+    {32, 8}, {512, 9}, {0, 9}, {0, 8}, {40, 8}, {24, 9},
+    {0, 8}, {0, 9}, {256, 8}, {0, 8}, {32, 8}, {0, 8},
+    {96, 8}, {64, 9}, {96, 10}, {0, 10}, {0, 9}, {0, 8},
+    {96, 8}, {0, 8}, {24, 8}, {0, 8}, {256, 8}, {0, 8},
+    {40, 8}, {0, 8}, {32, 8}, {512, 9}, {0, 8}, {40, 8},
+    {0, 9}, {0, 8}, {16, 8}, {0, 8}, {300, 8}, {128, 9},
+    {64, 10}, {256, 11}, {256, 12}, {0, 9}, {0, 12}, {1500, 9},
+    {0, 8}, {0, 9}, {64, 8}, {0, 11}, {0, 10}, {768, 9},
+    {256, 10}, {256, 11}, {300, 12}, {0, 8}, {32, 8}, {0, 8},
+    {0, 10}, {0, 12}, {1500, 8}, {0, 9}, {64, 9}, {0, 9},
+    {0, 8}, {24, 8}, {0, 11}, {64, 9}, {0, 9}, {1500, 9},
+    {0, 9}, {256, 9}, {300, 10}, {64, 11}, {40, 12}, {96, 13},
+    {0, 11}, {40, 11}, {1500, 14}, {128, 15}, {0, 13}, {128, 13},
+    {0, 8}, {0, 15}, {0, 13}, {300, 8}, {128, 13}, {256, 15},
+    {96, 16}, {0, 12}, {0, 10}, {24, 10}, {0, 16}, {0, 14},
+    {24, 12}, {0, 12}, {256, 12}, {24, 14}, {32, 16}, {0, 14},
+    {32, 14}, {64, 17}, {128, 18}, {0, 16}, {40, 16}, {0, 13},
+    {0, 11}, {0, 14}, {0, 16}, {0, 8}, {512, 8}, {0, 9},
+    {0, 8}, {0, 18}, {0, 12}, {0, 17}, {0, 10}, {768, 8},
+    {0, 15}, {0, 8}, {16, 8}, {0, 8}, {96, 8}, {0, 8},
+    {1500, 8}, {256, 9}, {0, 9}, {0, 8}, {40, 8}, {0, 8},
+    {512, 8}, {0, 8}, {512, 8}, {0, 8}, {32, 8}, {0, 8},
+    {300, 8}, {0, 8}, {64, 8}, {128, 9}, {1500, 10}, {24, 11},
+    {1500, 12}, {768, 13}, {64, 14}, {64, 15}, {0, 15}, {0, 14},
+    {300, 14}, {0, 9}, {0, 8}, {128, 8}, {0, 10}, {64, 9},
+    {64, 10}, {1500, 15}, {0, 8}, {768, 8}, {96, 16}, {16, 17},
+    {0, 9}, {0, 12}, {40, 9}, {300, 12}, {128, 18}, {0, 17},
+    {0, 10}, {0, 14}, {512, 10}, {16, 14}, {0, 18}, {768, 17},
+    {0, 12}, {0, 15}, {256, 12}, {512, 15}, {300, 18}, {0, 16},
+    {300, 16}, {64, 19}, {40, 20}, {0, 19}, {0, 20}, {0, 16},
+    {300, 16}, {0, 17}, {96, 17}, {0, 9}, {0, 15}, {0, 18},
+    {512, 9}, {0, 13}, {0, 16}, {40, 13}, {24, 15}, {0, 9},
+    {0, 15}, {0, 12}, {768, 9}, {300, 12}, {0, 11}, {128, 11},
+    {0, 17}, {0, 9}, {0, 10}, {0, 11}, {0, 14}, {0, 13},
+    {0, 8}, {0, 12}, {24, 8}, {256, 9}, {256, 10}, {24, 11},
+    {0, 11}, {0, 10}, {768, 10}, {768, 11}, {128, 12}, {256, 13},
+    {0, 13}, {0, 12}, {128, 12}, {64, 13}, {128, 14}, {64, 15},
+    {1500, 16}, {300, 17}, {0, 15}, {0, 10}, {0, 17}, {0, 12},
+    {0, 11}, {32, 10}, {0, 8}, {0, 10}, {0, 9}, {1500, 8},
+    {128, 9}, {0, 9}, {768, 9}, {300, 10}, {96, 11}, {0, 9},
+    {32, 9}, {96, 12}, {0, 8}, {0, 12}, {0, 14}, {64, 8},
+    {0, 11}, {0, 8}, {0, 13}, {0, 9}, {0, 10}, {0, 16},
+    {512, 8}, {0, 8}, {1500, 8}, {0, 8}, {24, 8}, {1500, 9},
+    {0, 9}, {0, 8}, {1500, 8}, {0, 8}, {64, 8}, {0, 8},
+    {16, 8}, {0, 8}, {300, 8}, {0, 8}, {24, 8}, {256, 9},
+    {1500, 10}, {0, 10}, {32, 10}, {24, 11}, {300, 12}, {256, 13},
+    {0, 13}, {0, 11}, {0, 10}, {128, 10}, {0, 9}, {0, 10},
+    {32, 9}, {24, 10}, {0, 12}, {768, 11}, {0, 10}, {96, 10},
+    {16, 12}, {0, 9}, {0, 10}, {0, 12}, {0, 11}, {128, 9},
+    {0, 9}, {128, 9}, {16, 10}, {0, 8}, {0, 9}, {0, 10},
+    {96, 8}, {0, 8}, {128, 8}, {0, 8}, {32, 8}, {0, 8},
+    {32, 8}, {16, 9}, {0, 8}, {0, 9}, {24, 8}, {0, 8},
+    {32, 8}, {256, 9}, {0, 8}, {0, 9}, {128, 8}, {128, 9},
+    {0, 9}, {768, 9}, {0, 8}, {0, 9}, {128, 8}, {64, 9},
+    {0, 9}, {512, 9}, {256, 10}, {0, 10}, {40, 10}, {0, 9},
+};
+
+#endif /* _LOS_API_MEM_REPLAY_H */
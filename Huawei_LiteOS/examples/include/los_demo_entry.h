@@ -66,6 +66,26 @@
 #include "los_api_systick.h"
 /* dlist */
 #include "los_api_list.h"
+/* dynamic memory benchmark */
+#include "los_api_mem_bench.h"
+/* scheduler latency benchmark */
+#include "los_api_sched_bench.h"
+/* pend order */
+#include "los_api_pend_order.h"
+/* interrupt latency under the kernel lock */
+#include "los_api_irq_latency.h"
+/* notify vs semaphore benchmark */
+#include "los_api_notify_bench.h"
+/* queue throughput benchmark */
+#include "los_api_queue_bench.h"
+/* multi-wait */
+#include "los_api_multiwait.h"
+/* ring buffer */
+#include "los_api_ringbuf.h"
+/* work queue */
+#include "los_api_workqueue.h"
+/* periodic task */
+#include "los_api_periodic.h"
 
 /* test task schedule */
 //#define LOS_KERNEL_TEST_TASK
@@ -100,6 +120,36 @@
 /* test list */
 //#define LOS_KERNEL_TEST_LIST
 
+/* replay a recorded allocation sequence on the dynamic memory algorithm */
+//#define LOS_KERNEL_TEST_MEM_BENCH
+
+/* time the ready queue lookup and a resume-triggered context switch */
+//#define LOS_KERNEL_TEST_SCHED_BENCH
+
+/* test fifo and priority ordered wait queues */
+//#define LOS_KERNEL_TEST_PEND_ORDER
+
+/* measure interrupt latency while the kernel holds its interrupt lock */
+//#define LOS_KERNEL_TEST_IRQ_LATENCY
+
+/* compare semaphore and task notify ping-pong round trips */
+//#define LOS_KERNEL_TEST_NOTIFY_BENCH
+
+/* compare queue copy, reserve/commit and batch throughput */
+//#define LOS_KERNEL_TEST_QUEUE_BENCH
+
+/* test waiting on several objects at once */
+//#define LOS_KERNEL_TEST_MULTIWAIT
+
+/* test the lock-free ring buffer */
+//#define LOS_KERNEL_TEST_RINGBUF
+
+/* test work queue submit and cancel */
+//#define LOS_KERNEL_TEST_WORKQUEUE
+
+/* test periodic task releases and overrun */
+//#define LOS_KERNEL_TEST_PERIODIC
+
 /* test ALL */
 //#define LOS_KERNEL_TEST_ALL
 
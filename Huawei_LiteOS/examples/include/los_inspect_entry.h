@@ -40,6 +40,7 @@
 #define _LOS_INSPECT_ENTRY_H
 
 #include "los_typedef.h"
+#include "los_config.h"
 
 ///LiteOS Inspect status.
 typedef enum  {
@@ -61,6 +62,20 @@ typedef enum {
     LOS_INSPECT_SMEM,
     LOS_INSPECT_DMEM,
     //LOS_INSPECT_INTERRUPT,
+    LOS_INSPECT_PEND,
+    LOS_INSPECT_NTFY,
+#if (LOSCFG_BASE_IPC_MULTIWAIT == YES)
+    LOS_INSPECT_MWAIT,
+#endif
+#if (LOSCFG_BASE_IPC_RINGBUF == YES)
+    LOS_INSPECT_RBUF,
+#endif
+#if (LOSCFG_KERNEL_WORKQUEUE == YES)
+    LOS_INSPECT_WORKQ,
+#endif
+#if (LOSCFG_BASE_CORE_TSK_PERIODIC == YES)
+    LOS_INSPECT_PERIOD,
+#endif
     LOS_INSPECT_BUFF
 } enInspectID;
 
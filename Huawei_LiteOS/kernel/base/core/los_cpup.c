@@ -0,0 +1,635 @@
+/*----------------------------------------------------------------------------
+ * Copyright (c) <2013-2015>, <Huawei Technologies Co., Ltd>
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *---------------------------------------------------------------------------*/
+/*----------------------------------------------------------------------------
+ * Notice of Export Control Law
+ * ===============================================
+ * Huawei LiteOS may be subject to applicable export control laws and regulations, which might
+ * include those applicable to Huawei LiteOS of U.S. and the country in which you are located.
+ * Import, export and usage of Huawei LiteOS in any manner by you shall be in compliance with such
+ * applicable export control laws and regulations.
+ *---------------------------------------------------------------------------*/
+#include "string.h"
+#include "los_cpup.inc"
+#include "los_base.ph"
+#include "los_memory.ph"
+#include "los_task.ph"
+#include "los_tick.ph"
+#include "los_hwi.h"
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+#endif /* __cplusplus */
+
+#if (LOSCFG_BASE_CORE_CPUP == YES)
+
+LITE_OS_SEC_BSS OS_CPUP_S   *g_pstCpup;
+LITE_OS_SEC_BSS UINT16      g_usCpupInitFlg;
+
+LITE_OS_SEC_BSS UINT64      *m_pullCpupCur;                                         /* account charged now */
+LITE_OS_SEC_BSS UINT64      m_ullCpupMark;                                          /* cycle count of the last charge */
+LITE_OS_SEC_BSS UINT64      m_ullCpupSink;                                          /* account before the first switch */
+LITE_OS_SEC_BSS UINT64      m_ullCpupStartTime;
+LITE_OS_SEC_BSS UINT64      m_ullCpupSampleTick;
+LITE_OS_SEC_BSS UINT64      m_aullCpupSampleTime[OS_CPUP_HISTORY_RECORD_NUM + 1];
+LITE_OS_SEC_BSS UINT32      m_uwCpupSamplePos;                                      /* newest sample */
+LITE_OS_SEC_BSS UINT32      m_uwCpupSampleCnt;                                      /* valid samples */
+
+#if (LOSCFG_BASE_CORE_CPUP_HWI == YES)
+LITE_OS_SEC_BSS OS_CPUP_S   *m_pstHwiCpup;
+LITE_OS_SEC_BSS UINT64      *m_apullCpupNest[OS_CPUP_HWI_NEST_MAX];                 /* accounts interrupted */
+LITE_OS_SEC_BSS UINT32      m_uwCpupNest;
+#endif
+
+/*****************************************************************************
+Function   : osCpupCycleGet
+Description: Get the cycle count
+Input      : None
+Output     : None
+Return     : cycles since the system started
+*****************************************************************************/
+LITE_OS_SEC_TEXT static UINT64 osCpupCycleGet(VOID)
+{
+    UINT32 uwHigh;
+    UINT32 uwLow;
+
+    LOS_GetCpuCycle(&uwHigh, &uwLow);
+    return (((UINT64)uwHigh << 32) | uwLow);
+}
+
+/*****************************************************************************
+Function   : osCpupCharge
+Description: Charge the cycles since the last mark to the current account, with interrupts locked
+Input      : ullNow --- current cycle count
+Output     : None
+Return     : None
+*****************************************************************************/
+LITE_OS_SEC_TEXT static VOID osCpupCharge(UINT64 ullNow)
+{
+    *m_pullCpupCur += ullNow - m_ullCpupMark;
+    m_ullCpupMark = ullNow;
+}
+
+/*****************************************************************************
+Function   : osCpupClear
+Description: Clear the records and restart measuring from now, with interrupts locked
+Input      : None
+Output     : None
+Return     : None
+*****************************************************************************/
+LITE_OS_SEC_TEXT_MINOR static VOID osCpupClear(VOID)
+{
+    UINT32 uwLoop;
+    UINT64 ullNow;
+
+    for (uwLoop = 0; uwLoop < g_uwTskMaxNum; uwLoop++)
+    {
+        g_pstCpup[uwLoop].ullAllTime = 0;
+        (VOID)memset(g_pstCpup[uwLoop].ullHistoryTime, 0, sizeof(g_pstCpup[uwLoop].ullHistoryTime));
+    }
+
+#if (LOSCFG_BASE_CORE_CPUP_HWI == YES)
+    for (uwLoop = 0; uwLoop < OS_CPUP_HWI_NUM; uwLoop++)
+    {
+        m_pstHwiCpup[uwLoop].ullAllTime = 0;
+        (VOID)memset(m_pstHwiCpup[uwLoop].ullHistoryTime, 0, sizeof(m_pstHwiCpup[uwLoop].ullHistoryTime));
+    }
+#endif
+
+    ullNow = osCpupCycleGet();
+    m_ullCpupMark = ullNow;
+    m_ullCpupStartTime = ullNow;
+    m_ullCpupSampleTick = g_ullTickCount;
+
+    /* the start is the first sample, every history entry of it is 0 */
+    m_uwCpupSamplePos = 0;
+    m_uwCpupSampleCnt = 1;
+    m_aullCpupSampleTime[0] = ullNow;
+}
+
+/*****************************************************************************
+Function   : osCpupInit
+Description: CPUP initialization
+Input      : None
+Output     : None
+Return     : LOS_OK on success or error code on failure
+*****************************************************************************/
+LITE_OS_SEC_TEXT_INIT UINT32 osCpupInit(VOID)
+{
+    UINT32 uwSize;
+    UINT32 uwLoop;
+    UINTPTR uvIntSave;
+
+    uwSize = g_uwTskMaxNum * sizeof(OS_CPUP_S);
+    g_pstCpup = (OS_CPUP_S *)LOS_MemAlloc(m_aucSysMem0, uwSize);
+    if (NULL == g_pstCpup)
+    {
+        return LOS_ERRNO_CPUP_NO_MEMORY;
+    }
+    (VOID)memset(g_pstCpup, 0, uwSize);
+
+#if (LOSCFG_BASE_CORE_CPUP_HWI == YES)
+    uwSize = OS_CPUP_HWI_NUM * sizeof(OS_CPUP_S);
+    m_pstHwiCpup = (OS_CPUP_S *)LOS_MemAlloc(m_aucSysMem0, uwSize);
+    if (NULL == m_pstHwiCpup)
+    {
+        (VOID)LOS_MemFree(m_aucSysMem0, g_pstCpup);
+        g_pstCpup = (OS_CPUP_S *)NULL;
+        return LOS_ERRNO_CPUP_NO_MEMORY;
+    }
+    (VOID)memset(m_pstHwiCpup, 0, uwSize);
+
+    for (uwLoop = 0; uwLoop < OS_CPUP_HWI_NUM; uwLoop++)
+    {
+        m_pstHwiCpup[uwLoop].uwID = uwLoop;
+    }
+    m_uwCpupNest = 0;
+#endif
+
+    for (uwLoop = 0; uwLoop < g_uwTskMaxNum; uwLoop++)
+    {
+        g_pstCpup[uwLoop].uwID = uwLoop;
+        g_pstCpup[uwLoop].usStatus = OS_TASK_STATUS_UNUSED;
+    }
+
+    uvIntSave = LOS_IntLock();
+    m_pullCpupCur = &m_ullCpupSink;
+    osCpupClear();
+    g_usCpupInitFlg = 1;
+    LOS_IntRestore(uvIntSave);
+
+    return LOS_OK;
+}
+
+/*****************************************************************************
+Function   : osTskCycleEndStart
+Description: Charge the task switched out and start charging the new task
+Input      : None
+Output     : None
+Return     : None
+*****************************************************************************/
+LITE_OS_SEC_TEXT VOID osTskCycleEndStart(VOID)
+{
+    UINT32 uwTaskID;
+    UINTPTR uvIntSave;
+
+    if (g_usCpupInitFlg == 0)
+    {
+        return;
+    }
+
+    uvIntSave = LOS_IntLock();
+    osCpupCharge(osCpupCycleGet());
+
+    uwTaskID = g_stLosTask.pstNewTask->uwTaskID;
+    if (uwTaskID < g_uwTskMaxNum)
+    {
+        m_pullCpupCur = &g_pstCpup[uwTaskID].ullAllTime;
+    }
+    else
+    {
+        m_pullCpupCur = &m_ullCpupSink;
+    }
+    LOS_IntRestore(uvIntSave);
+}
+
+/*****************************************************************************
+Function   : osCpupTaskCycleGet
+Description: Get the cycles charged to a task, including the running part
+Input      : uwTaskID --- task ID
+Output     : None
+Return     : cycles charged since the last reset
+*****************************************************************************/
+LITE_OS_SEC_TEXT UINT64 osCpupTaskCycleGet(UINT32 uwTaskID)
+{
+    UINT64 ullCycle;
+    UINTPTR uvIntSave;
+
+    if (g_usCpupInitFlg == 0)
+    {
+        return 0;
+    }
+
+    uvIntSave = LOS_IntLock();
+    ullCycle = g_pstCpup[uwTaskID].ullAllTime;
+    if (m_pullCpupCur == &g_pstCpup[uwTaskID].ullAllTime)
+    {
+        ullCycle += osCpupCycleGet() - m_ullCpupMark;
+    }
+    LOS_IntRestore(uvIntSave);
+
+    return ullCycle;
+}
+
+#if (LOSCFG_BASE_CORE_CPUP_HWI == YES)
+/*****************************************************************************
+Function   : osCpupIrqStart
+Description: Charge what the interrupt preempts and start charging the interrupt
+Input      : uwHwiNum --- exception number
+Output     : None
+Return     : None
+*****************************************************************************/
+LITE_OS_SEC_TEXT VOID osCpupIrqStart(UINT32 uwHwiNum)
+{
+    UINTPTR uvIntSave;
+
+    if (g_usCpupInitFlg == 0)
+    {
+        return;
+    }
+
+    uvIntSave = LOS_IntLock();
+    if (m_uwCpupNest < OS_CPUP_HWI_NEST_MAX)
+    {
+        osCpupCharge(osCpupCycleGet());
+        m_apullCpupNest[m_uwCpupNest] = m_pullCpupCur;
+        m_pullCpupCur = (uwHwiNum < OS_CPUP_HWI_NUM) ? &m_pstHwiCpup[uwHwiNum].ullAllTime : &m_ullCpupSink;
+    }
+    m_uwCpupNest++;
+    LOS_IntRestore(uvIntSave);
+}
+
+/*****************************************************************************
+Function   : osCpupIrqEnd
+Description: Charge the interrupt and resume charging what it preempted
+Input      : None
+Output     : None
+Return     : None
+*****************************************************************************/
+LITE_OS_SEC_TEXT VOID osCpupIrqEnd(VOID)
+{
+    UINTPTR uvIntSave;
+
+    if ((g_usCpupInitFlg == 0) || (m_uwCpupNest == 0))
+    {
+        return;
+    }
+
+    uvIntSave = LOS_IntLock();
+    m_uwCpupNest--;
+    if (m_uwCpupNest < OS_CPUP_HWI_NEST_MAX)
+    {
+        osCpupCharge(osCpupCycleGet());
+        m_pullCpupCur = m_apullCpupNest[m_uwCpupNest];
+    }
+    LOS_IntRestore(uvIntSave);
+}
+#endif
+
+/*****************************************************************************
+Function   : osCpupGuard
+Description: Take a sample of every record once a second, called from the tick handler
+Input      : None
+Output     : None
+Return     : None
+*****************************************************************************/
+LITE_OS_SEC_TEXT VOID osCpupGuard(VOID)
+{
+    UINT32 uwLoop;
+    UINT32 uwPos;
+    UINT64 ullNow;
+    UINTPTR uvIntSave;
+
+    if ((g_usCpupInitFlg == 0) || ((g_ullTickCount - m_ullCpupSampleTick) < LOSCFG_BASE_CORE_TICK_PER_SECOND))
+    {
+        return;
+    }
+
+    uvIntSave = LOS_IntLock();
+    m_ullCpupSampleTick = g_ullTickCount;
+    ullNow = osCpupCycleGet();
+    osCpupCharge(ullNow);
+
+    uwPos = (m_uwCpupSamplePos + 1) % (OS_CPUP_HISTORY_RECORD_NUM + 1);
+    for (uwLoop = 0; uwLoop < g_uwTskMaxNum; uwLoop++)
+    {
+        g_pstCpup[uwLoop].ullHistoryTime[uwPos] = g_pstCpup[uwLoop].ullAllTime;
+    }
+
+#if (LOSCFG_BASE_CORE_CPUP_HWI == YES)
+    for (uwLoop = 0; uwLoop < OS_CPUP_HWI_NUM; uwLoop++)
+    {
+        m_pstHwiCpup[uwLoop].ullHistoryTime[uwPos] = m_pstHwiCpup[uwLoop].ullAllTime;
+    }
+#endif
+
+    m_aullCpupSampleTime[uwPos] = ullNow;
+    m_uwCpupSamplePos = uwPos;
+    if (m_uwCpupSampleCnt < (OS_CPUP_HISTORY_RECORD_NUM + 1))
+    {
+        m_uwCpupSampleCnt++;
+    }
+    LOS_IntRestore(uvIntSave);
+}
+
+/*****************************************************************************
+Function   : osCpupUsageGet
+Description: Get the usage of a record over a window, with interrupts locked
+Input      : pstCpup --- usage record
+             usMode  --- CPUP_LAST_ONE_SECONDS, CPUP_LAST_TEN_SECONDS or CPUP_ALL_TIME
+             ullNow  --- current cycle count, the running account charged up to it
+Output     : None
+Return     : usage in [0, LOS_CPUP_PRECISION]
+*****************************************************************************/
+LITE_OS_SEC_TEXT_MINOR static UINT32 osCpupUsageGet(OS_CPUP_S *pstCpup, UINT16 usMode, UINT64 ullNow)
+{
+    UINT32 uwWindow;
+    UINT32 uwOld;
+    UINT64 ullTime;
+    UINT64 ullTotal;
+
+    if (CPUP_ALL_TIME == usMode)
+    {
+        ullTime = pstCpup->ullAllTime;
+        ullTotal = ullNow - m_ullCpupStartTime;
+    }
+    else if (m_uwCpupSampleCnt < 2)
+    {
+        /* no full second yet, measure from the start */
+        ullTime = pstCpup->ullAllTime - pstCpup->ullHistoryTime[m_uwCpupSamplePos];
+        ullTotal = ullNow - m_aullCpupSampleTime[m_uwCpupSamplePos];
+    }
+    else
+    {
+        uwWindow = (CPUP_LAST_ONE_SECONDS == usMode) ? 1 : OS_CPUP_HISTORY_RECORD_NUM;
+        if (uwWindow > (m_uwCpupSampleCnt - 1))
+        {
+            uwWindow = m_uwCpupSampleCnt - 1;
+        }
+
+        uwOld = (m_uwCpupSamplePos + (OS_CPUP_HISTORY_RECORD_NUM + 1) - uwWindow) % (OS_CPUP_HISTORY_RECORD_NUM + 1);
+        ullTime = pstCpup->ullHistoryTime[m_uwCpupSamplePos] - pstCpup->ullHistoryTime[uwOld];
+        ullTotal = m_aullCpupSampleTime[m_uwCpupSamplePos] - m_aullCpupSampleTime[uwOld];
+    }
+
+    if ((ullTotal == 0) || (ullTime >= ullTotal))
+    {
+        return (ullTotal == 0) ? 0 : LOS_CPUP_PRECISION;
+    }
+
+    return (UINT32)((ullTime * LOS_CPUP_PRECISION) / ullTotal);
+}
+
+/*****************************************************************************
+Function   : osCpupModeCheck
+Description: Check a usage mode
+Input      : usMode --- mode
+Output     : None
+Return     : TRUE if the mode is valid
+*****************************************************************************/
+LITE_OS_SEC_TEXT_MINOR static BOOL osCpupModeCheck(UINT16 usMode)
+{
+    return (BOOL)((CPUP_LAST_TEN_SECONDS == usMode) || (CPUP_LAST_ONE_SECONDS == usMode) || (CPUP_ALL_TIME == usMode));
+}
+
+/*****************************************************************************
+Function   : LOS_HistorySysCpuUsage
+Description: Get the CPU usage of the system over a window
+Input      : usMode --- CPUP_LAST_ONE_SECONDS, CPUP_LAST_TEN_SECONDS or CPUP_ALL_TIME
+Output     : None
+Return     : usage in [0, LOS_CPUP_PRECISION] or error code
+*****************************************************************************/
+LITE_OS_SEC_TEXT_MINOR UINT32 LOS_HistorySysCpuUsage(UINT16 usMode)
+{
+    UINT32 uwIdle;
+    UINTPTR uvIntSave;
+    UINT64 ullNow;
+
+    if (g_usCpupInitFlg == 0)
+    {
+        return LOS_ERRNO_CPUP_NO_INIT;
+    }
+
+    if (!osCpupModeCheck(usMode))
+    {
+        return LOS_ERRNO_CPUP_MODE_INVALID;
+    }
+
+    uvIntSave = LOS_IntLock();
+    ullNow = osCpupCycleGet();
+    osCpupCharge(ullNow);
+    uwIdle = osCpupUsageGet(&g_pstCpup[g_uwIdleTaskID], usMode, ullNow);
+    LOS_IntRestore(uvIntSave);
+
+    return (LOS_CPUP_PRECISION - uwIdle);
+}
+
+/*****************************************************************************
+Function   : LOS_SysCpuUsage
+Description: Get the CPU usage of the system since the start
+Input      : None
+Output     : None
+Return     : usage in [0, LOS_CPUP_PRECISION] or error code
+*****************************************************************************/
+LITE_OS_SEC_TEXT_MINOR UINT32 LOS_SysCpuUsage(VOID)
+{
+    return LOS_HistorySysCpuUsage(CPUP_ALL_TIME);
+}
+
+/*****************************************************************************
+Function   : LOS_HistoryTaskCpuUsage
+Description: Get the CPU usage of a task over a window
+Input      : uwTaskID --- task ID
+             usMode   --- CPUP_LAST_ONE_SECONDS, CPUP_LAST_TEN_SECONDS or CPUP_ALL_TIME
+Output     : None
+Return     : usage in [0, LOS_CPUP_PRECISION] or error code
+*****************************************************************************/
+LITE_OS_SEC_TEXT_MINOR UINT32 LOS_HistoryTaskCpuUsage(UINT32 uwTaskID, UINT16 usMode)
+{
+    UINT32 uwUsage;
+    UINTPTR uvIntSave;
+    UINT64 ullNow;
+
+    if (g_usCpupInitFlg == 0)
+    {
+        return LOS_ERRNO_CPUP_NO_INIT;
+    }
+
+    if (OS_TSK_GET_INDEX(uwTaskID) >= g_uwTskMaxNum)
+    {
+        return LOS_ERRNO_CPUP_TSK_ID_INVALID;
+    }
+
+    if (!osCpupModeCheck(usMode))
+    {
+        return LOS_ERRNO_CPUP_MODE_INVALID;
+    }
+
+    uvIntSave = LOS_IntLock();
+    if (OS_TCB_FROM_TID(uwTaskID)->usTaskStatus & OS_TASK_STATUS_UNUSED)
+    {
+        LOS_IntRestore(uvIntSave);
+        return LOS_ERRNO_CPUP_THREAD_NO_CREATED;
+    }
+
+    ullNow = osCpupCycleGet();
+    osCpupCharge(ullNow);
+    uwUsage = osCpupUsageGet(&g_pstCpup[uwTaskID], usMode, ullNow);
+    LOS_IntRestore(uvIntSave);
+
+    return uwUsage;
+}
+
+/*****************************************************************************
+Function   : LOS_TaskCpuUsage
+Description: Get the CPU usage of a task since the start
+Input      : uwTaskID --- task ID
+Output     : None
+Return     : usage in [0, LOS_CPUP_PRECISION] or error code
+*****************************************************************************/
+LITE_OS_SEC_TEXT_MINOR UINT32 LOS_TaskCpuUsage(UINT32 uwTaskID)
+{
+    return LOS_HistoryTaskCpuUsage(uwTaskID, CPUP_ALL_TIME);
+}
+
+/*****************************************************************************
+Function   : LOS_AllTaskCpuUsage
+Description: Get the CPU usage of all tasks over a window
+Input      : uwMaxNum    --- number of entries
+             usMode      --- CPUP_LAST_ONE_SECONDS, CPUP_LAST_TEN_SECONDS or CPUP_ALL_TIME
+Output     : pstCpupInfo --- usage of each task
+Return     : LOS_OK on success or error code on failure
+*****************************************************************************/
+LITE_OS_SEC_TEXT_MINOR UINT32 LOS_AllTaskCpuUsage(UINT32 uwMaxNum, CPUP_INFO_S *pstCpupInfo, UINT16 usMode)
+{
+    UINT32 uwLoop;
+    UINTPTR uvIntSave;
+    UINT64 ullNow;
+    LOS_TASK_CB *pstTaskCB;
+
+    if (g_usCpupInitFlg == 0)
+    {
+        return LOS_ERRNO_CPUP_NO_INIT;
+    }
+
+    if (NULL == pstCpupInfo)
+    {
+        return LOS_ERRNO_CPUP_TASK_PTR_NULL;
+    }
+
+    if ((uwMaxNum == 0) || (uwMaxNum > g_uwTskMaxNum))
+    {
+        return LOS_ERRNO_CPUP_MAXNUM_INVALID;
+    }
+
+    if (!osCpupModeCheck(usMode))
+    {
+        return LOS_ERRNO_CPUP_MODE_INVALID;
+    }
+
+    uvIntSave = LOS_IntLock();
+    ullNow = osCpupCycleGet();
+    osCpupCharge(ullNow);
+    for (uwLoop = 0; uwLoop < uwMaxNum; uwLoop++)
+    {
+        pstTaskCB = OS_TCB_FROM_TID(uwLoop);
+        pstCpupInfo[uwLoop].usStatus = pstTaskCB->usTaskStatus;
+        if (pstTaskCB->usTaskStatus & OS_TASK_STATUS_UNUSED)
+        {
+            pstCpupInfo[uwLoop].uwUsage = 0;
+            continue;
+        }
+
+        pstCpupInfo[uwLoop].uwUsage = osCpupUsageGet(&g_pstCpup[uwLoop], usMode, ullNow);
+    }
+    LOS_IntRestore(uvIntSave);
+
+    return LOS_OK;
+}
+
+/*****************************************************************************
+Function   : LOS_HwiCpuUsage
+Description: Get the CPU usage of an interrupt over a window
+Input      : uwHwiNum --- exception number
+             usMode   --- CPUP_LAST_ONE_SECONDS, CPUP_LAST_TEN_SECONDS or CPUP_ALL_TIME
+Output     : None
+Return     : usage in [0, LOS_CPUP_PRECISION] or error code
+*****************************************************************************/
+LITE_OS_SEC_TEXT_MINOR UINT32 LOS_HwiCpuUsage(UINT32 uwHwiNum, UINT16 usMode)
+{
+#if (LOSCFG_BASE_CORE_CPUP_HWI == YES)
+    UINT32 uwUsage;
+    UINTPTR uvIntSave;
+    UINT64 ullNow;
+
+    if (g_usCpupInitFlg == 0)
+    {
+        return LOS_ERRNO_CPUP_NO_INIT;
+    }
+
+    if (uwHwiNum >= OS_CPUP_HWI_NUM)
+    {
+        return LOS_ERRNO_CPUP_HWI_NUM_INVALID;
+    }
+
+    if (!osCpupModeCheck(usMode))
+    {
+        return LOS_ERRNO_CPUP_MODE_INVALID;
+    }
+
+    uvIntSave = LOS_IntLock();
+    ullNow = osCpupCycleGet();
+    osCpupCharge(ullNow);
+    uwUsage = osCpupUsageGet(&m_pstHwiCpup[uwHwiNum], usMode, ullNow);
+    LOS_IntRestore(uvIntSave);
+
+    return uwUsage;
+#else
+    (VOID)uwHwiNum;
+    (VOID)usMode;
+    return LOS_ERRNO_CPUP_HWI_NUM_INVALID;
+#endif
+}
+
+/*****************************************************************************
+Function   : LOS_CpupReset
+Description: Clear the records and restart measuring
+Input      : None
+Output     : None
+Return     : None
+*****************************************************************************/
+LITE_OS_SEC_TEXT_MINOR VOID LOS_CpupReset(VOID)
+{
+    UINTPTR uvIntSave;
+
+    if (g_usCpupInitFlg == 0)
+    {
+        return;
+    }
+
+    uvIntSave = LOS_IntLock();
+    osCpupClear();
+    LOS_IntRestore(uvIntSave);
+}
+
+#endif /* (LOSCFG_BASE_CORE_CPUP == YES) */
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* __cplusplus */
@@ -0,0 +1,152 @@
+/*----------------------------------------------------------------------------
+ * Copyright (c) <2013-2015>, <Huawei Technologies Co., Ltd>
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *---------------------------------------------------------------------------*/
+/*----------------------------------------------------------------------------
+ * Notice of Export Control Law
+ * ===============================================
+ * Huawei LiteOS may be subject to applicable export control laws and regulations, which might
+ * include those applicable to Huawei LiteOS of U.S. and the country in which you are located.
+ * Import, export and usage of Huawei LiteOS in any manner by you shall be in compliance with such
+ * applicable export control laws and regulations.
+ *---------------------------------------------------------------------------*/
+
+#include "los_objtable.inc"
+#include "los_base.ph"
+#include "los_memory.h"
+#include "los_hwi.h"
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+#endif /* __cplusplus */
+
+/*****************************************************************************
+ Function : osObjTableInit
+ Description : Allocate the block pointers of an object table.
+ Input       : uwObjSize    --- size of an object
+               uwLimit      --- maximum number of objects
+               uwBlockSize  --- number of objects per block
+               uwHandleBits --- width of a handle
+ Output      : pstTable     --- object table
+ Return      : LOS_OK on success or LOS_NOK on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_INIT UINT32 osObjTableInit(OS_OBJ_TABLE_S *pstTable, UINT32 uwObjSize, UINT32 uwLimit,
+                                            UINT32 uwBlockSize, UINT32 uwHandleBits)
+{
+    UINT32 uwBlockNum;
+    UINT16 usBlockShift = 0;
+    UINT16 usIndexBits = 0;
+
+    while ((1U << usBlockShift) < uwBlockSize)
+    {
+        usBlockShift++;
+    }
+
+    while ((1U << usIndexBits) < uwLimit)
+    {
+        usIndexBits++;
+    }
+
+    uwBlockNum = (uwLimit + (1U << usBlockShift) - 1) >> usBlockShift;
+    pstTable->ppucBlock = (UINT8 **)LOS_MemAlloc(m_aucSysMem0, uwBlockNum * sizeof(UINT8 *));
+    if (NULL == pstTable->ppucBlock)
+    {
+        return LOS_NOK;
+    }
+
+    (VOID)memset((VOID *)pstTable->ppucBlock, 0, uwBlockNum * sizeof(UINT8 *));
+    pstTable->uwObjSize = uwObjSize;
+    pstTable->uwLimit = uwLimit;
+    pstTable->uwCount = 0;
+    pstTable->usBlockShift = usBlockShift;
+    pstTable->usIndexBits = usIndexBits;
+    pstTable->uwHandleMask = (uwHandleBits >= 32) ? OS_NULL_INT : ((1U << uwHandleBits) - 1);
+
+    return LOS_OK;
+}
+
+/*****************************************************************************
+ Function : osObjTableExtend
+ Description : Allocate the next block of an object table.
+ Input       : pstTable --- object table
+               pfnInit  --- called for every new object with the interrupts locked
+ Output      : None
+ Return      : LOS_OK on success or LOS_NOK on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT UINT32 osObjTableExtend(OS_OBJ_TABLE_S *pstTable, OS_OBJ_INIT_FUNC pfnInit)
+{
+    UINT32 uwCount;
+    UINT32 uwNum;
+    UINT32 uwIndex;
+    UINT8 *pucBlock;
+    UINTPTR uvIntSave;
+
+    uwCount = pstTable->uwCount;
+    if (uwCount >= pstTable->uwLimit)
+    {
+        return LOS_OK;
+    }
+
+    /* the last block only holds the objects up to the limit */
+    uwNum = pstTable->uwLimit - uwCount;
+    if (uwNum > (1U << pstTable->usBlockShift))
+    {
+        uwNum = 1U << pstTable->usBlockShift;
+    }
+
+    pucBlock = (UINT8 *)LOS_MemAlloc(m_aucSysMem0, uwNum * pstTable->uwObjSize);
+    if (NULL == pucBlock)
+    {
+        return LOS_NOK;
+    }
+
+    (VOID)memset((VOID *)pucBlock, 0, uwNum * pstTable->uwObjSize);
+
+    uvIntSave = LOS_IntLock();
+    if (pstTable->uwCount != uwCount)
+    {
+        /* another task extended the table meanwhile */
+        LOS_IntRestore(uvIntSave);
+        (VOID)LOS_MemFree(m_aucSysMem0, pucBlock);
+        return LOS_OK;
+    }
+
+    pstTable->ppucBlock[uwCount >> pstTable->usBlockShift] = pucBlock;
+    pstTable->uwCount = uwCount + uwNum;
+    for (uwIndex = 0; uwIndex < uwNum; uwIndex++)
+    {
+        pfnInit((VOID *)(pucBlock + (uwIndex * pstTable->uwObjSize)), uwCount + uwIndex);
+    }
+    LOS_IntRestore(uvIntSave);
+
+    return LOS_OK;
+}
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* __cplusplus */
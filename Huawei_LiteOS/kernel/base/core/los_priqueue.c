@@ -36,14 +36,18 @@
 #include "los_base.ph"
 #include "los_task.ph"
 #include "los_memory.h"
+#include "los_hw.h"
 
 LITE_OS_SEC_BSS LOS_DL_LIST *g_pstLosPriorityQueueList;
+LITE_OS_SEC_BSS UINT32      g_uwPriQueueBitmap;
+LITE_OS_SEC_BSS UINT32      g_auwPriQueueCount[OS_PRIORITY_QUEUE_PRIORITYNUM];
 
 VOID osPriqueueInit(VOID)
 {
     UINT32 uwPri = 0;
     UINT32 uwSize = 0;
 
+    g_uwPriQueueBitmap = 0;
     uwSize = OS_PRIORITY_QUEUE_PRIORITYNUM * sizeof(LOS_DL_LIST);
     g_pstLosPriorityQueueList = (LOS_DL_LIST *)LOS_MemAlloc(m_aucSysMem0, uwSize);
     if (NULL == g_pstLosPriorityQueueList)
@@ -54,45 +58,47 @@ VOID osPriqueueInit(VOID)
     for (uwPri = 0; uwPri < OS_PRIORITY_QUEUE_PRIORITYNUM; ++uwPri)
     {
         LOS_ListInit(&g_pstLosPriorityQueueList[uwPri]);
+        g_auwPriQueueCount[uwPri] = 0;
     }
 }
 
 VOID osPriqueueEnqueue(LOS_DL_LIST *ptrPQItem, UINT32 uwPri)
 {
     LOS_ListTailInsert(&g_pstLosPriorityQueueList[uwPri], ptrPQItem);
+    g_auwPriQueueCount[uwPri]++;
+    g_uwPriQueueBitmap |= OS_PRIORITY_QUEUE_PRI_BIT(uwPri);
 }
 
 VOID osPriqueueDequeue(LOS_DL_LIST *ptrPQItem)
 {
+    UINT32 uwPri;
+
+    /* The item is always the stPendList of a ready task, whose priority is not changed while queued */
+    uwPri = OS_TCB_FROM_PENDLIST(ptrPQItem)->usPriority; /*lint !e413*/
     LOS_ListDelete(ptrPQItem);
+    if (--g_auwPriQueueCount[uwPri] == 0)
+    {
+        g_uwPriQueueBitmap &= ~OS_PRIORITY_QUEUE_PRI_BIT(uwPri);
+    }
 }
 
 LOS_DL_LIST *osPriqueueTop(VOID)
 {
-    UINT32 uwPri = 0;
+    UINT32 uwPri;
 
-    for (uwPri = 0; uwPri < OS_PRIORITY_QUEUE_PRIORITYNUM; ++uwPri)
+    if (0 == g_uwPriQueueBitmap)
     {
-        if (!LOS_ListEmpty(&g_pstLosPriorityQueueList[uwPri]))
-        {
-            return LOS_DL_LIST_FIRST(&g_pstLosPriorityQueueList[uwPri]);
-        }
+        return (LOS_DL_LIST *)NULL;
     }
 
-    return (LOS_DL_LIST *)NULL;
+    /* The highest priority is stored in the most significant bit */
+    uwPri = OS_CLZ(g_uwPriQueueBitmap);
+    return LOS_DL_LIST_FIRST(&g_pstLosPriorityQueueList[uwPri]);
 }
 
 UINT32 osPriqueueSize(UINT32 uwPri)
 {
-    UINT32      uwItemCnt = 0;
-    LOS_DL_LIST *pstCurPQNode = (LOS_DL_LIST *)NULL;
-
-    LOS_DL_LIST_FOR_EACH(pstCurPQNode, &g_pstLosPriorityQueueList[uwPri])
-    {
-        ++uwItemCnt;
-    }
-
-    return uwItemCnt;
+    return g_auwPriQueueCount[uwPri];
 }
 
 UINT32 osPriqueueTotalSize(VOID)
@@ -102,7 +108,7 @@ UINT32 osPriqueueTotalSize(VOID)
 
     for (uwPri = 0; uwPri < OS_PRIORITY_QUEUE_PRIORITYNUM; ++uwPri)
     {
-        uwTotalSize += osPriqueueSize(uwPri);
+        uwTotalSize += g_auwPriQueueCount[uwPri];
     }
 
     return uwTotalSize;
@@ -0,0 +1,246 @@
+/*----------------------------------------------------------------------------
+ * Copyright (c) <2013-2015>, <Huawei Technologies Co., Ltd>
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *---------------------------------------------------------------------------*/
+/*----------------------------------------------------------------------------
+ * Notice of Export Control Law
+ * ===============================================
+ * Huawei LiteOS may be subject to applicable export control laws and regulations, which might
+ * include those applicable to Huawei LiteOS of U.S. and the country in which you are located.
+ * Import, export and usage of Huawei LiteOS in any manner by you shall be in compliance with such
+ * applicable export control laws and regulations.
+ *---------------------------------------------------------------------------*/
+
+#include "los_sortlink.inc"
+#include "los_base.ph"
+#include "los_memory.h"
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+#endif /* __cplusplus */
+
+/*****************************************************************************
+ Function : osSortLinkInit
+ Description : Allocate the buckets of a timing wheel.
+ Input       : pstSortLinkHeader --- timing wheel
+ Output      : None
+ Return      : LOS_OK on success or LOS_NOK on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_INIT UINT32 osSortLinkInit(SORTLINK_ATTRIBUTE_S *pstSortLinkHeader)
+{
+    UINT32 uwSize;
+    UINT32 uwIndex;
+    LOS_DL_LIST *pstListObject;
+
+    uwSize = sizeof(LOS_DL_LIST) * OS_SORTLINK_LEVELS * OS_SORTLINK_SIZE;
+    pstListObject = (LOS_DL_LIST *)LOS_MemAlloc(m_aucSysMem0, uwSize);
+    if (NULL == pstListObject)
+    {
+        return LOS_NOK;
+    }
+
+    pstSortLinkHeader->pstSortLink = pstListObject;
+    pstSortLinkHeader->uwCursor = 0;
+    for (uwIndex = 0; uwIndex < (OS_SORTLINK_LEVELS * OS_SORTLINK_SIZE); uwIndex++, pstListObject++)
+    {
+        LOS_ListInit(pstListObject);
+    }
+
+    return LOS_OK;
+}
+
+/*****************************************************************************
+ Function : osSortLinkInsert
+ Description : Put a node into the bucket of its expire time.
+ Input       : pstSortLinkHeader --- timing wheel
+               pstSortList       --- node
+               uwBaseTime        --- first wheel time not scanned yet
+ Output      : None
+ Return      : None
+ *****************************************************************************/
+LITE_OS_SEC_TEXT VOID osSortLinkInsert(SORTLINK_ATTRIBUTE_S *pstSortLinkHeader, SORTLINK_LIST_S *pstSortList, UINT32 uwBaseTime)
+{
+    UINT32 uwExpireTime = pstSortList->uwExpireTime;
+    UINT32 uwDelta = uwExpireTime - uwBaseTime;
+    UINT32 uwLevel;
+
+    if (uwDelta > OS_SORTLINK_MAX_DELAY)
+    {
+        /* park in the farthest bucket, the node is placed again when it is cascaded */
+        uwDelta = OS_SORTLINK_MAX_DELAY;
+        uwExpireTime = uwBaseTime + OS_SORTLINK_MAX_DELAY;
+    }
+
+    for (uwLevel = 0; uwLevel < (OS_SORTLINK_LEVELS - 1); uwLevel++)
+    {
+        if (uwDelta < (1U << OS_SORTLINK_SHIFT(uwLevel + 1)))
+        {
+            break;
+        }
+    }
+
+    LOS_ListTailInsert(OS_SORTLINK_BUCKET(pstSortLinkHeader, uwLevel, OS_SORTLINK_SLOT(uwExpireTime, uwLevel)), &pstSortList->stList);
+}
+
+/*****************************************************************************
+ Function : osSortLinkAdd
+ Description : Add a node that expires after uwTimeout ticks.
+ Input       : pstSortLinkHeader --- timing wheel
+               pstSortList       --- node
+               uwTimeout         --- ticks
+ Output      : None
+ Return      : None
+ *****************************************************************************/
+LITE_OS_SEC_TEXT VOID osSortLinkAdd(SORTLINK_ATTRIBUTE_S *pstSortLinkHeader, SORTLINK_LIST_S *pstSortList, UINT32 uwTimeout)
+{
+    pstSortList->uwExpireTime = pstSortLinkHeader->uwCursor + uwTimeout;
+    osSortLinkInsert(pstSortLinkHeader, pstSortList, pstSortLinkHeader->uwCursor + 1);
+}
+
+LITE_OS_SEC_TEXT VOID osSortLinkDelete(SORTLINK_LIST_S *pstSortList)
+{
+    LOS_ListDelete(&pstSortList->stList);
+}
+
+/*****************************************************************************
+ Function : osSortLinkCascade
+ Description : Move the nodes of a bucket down to the lower levels.
+ Input       : pstSortLinkHeader --- timing wheel
+               uwLevel           --- wheel level, greater than 0
+               uwTime            --- wheel time being scanned
+ Output      : None
+ Return      : None
+ *****************************************************************************/
+LITE_OS_SEC_TEXT VOID osSortLinkCascade(SORTLINK_ATTRIBUTE_S *pstSortLinkHeader, UINT32 uwLevel, UINT32 uwTime)
+{
+    LOS_DL_LIST *pstListObject;
+    SORTLINK_LIST_S *pstSortList;
+
+    /* the nodes never land in the bucket being emptied */
+    pstListObject = OS_SORTLINK_BUCKET(pstSortLinkHeader, uwLevel, OS_SORTLINK_SLOT(uwTime, uwLevel));
+    while (pstListObject->pstNext != pstListObject)
+    {
+        pstSortList = LOS_DL_LIST_ENTRY(pstListObject->pstNext, SORTLINK_LIST_S, stList); /*lint !e413*/
+        LOS_ListDelete(&pstSortList->stList);
+        osSortLinkInsert(pstSortLinkHeader, pstSortList, uwTime);
+    }
+}
+
+/*****************************************************************************
+ Function : osSortLinkScan
+ Description : Advance the timing wheel by one tick.
+ Input       : pstSortLinkHeader --- timing wheel
+ Output      : None
+ Return      : bucket of the nodes expiring now
+ *****************************************************************************/
+LITE_OS_SEC_TEXT LOS_DL_LIST *osSortLinkScan(SORTLINK_ATTRIBUTE_S *pstSortLinkHeader)
+{
+    UINT32 uwTime;
+    UINT32 uwLevel;
+
+    uwTime = ++pstSortLinkHeader->uwCursor;
+
+    /* a bucket of level n is cascaded when the lower OS_SORTLINK_SHIFT(n) bits of the time wrap */
+    for (uwLevel = 1; uwLevel < OS_SORTLINK_LEVELS; uwLevel++)
+    {
+        if ((uwTime & ((1U << OS_SORTLINK_SHIFT(uwLevel)) - 1)) != 0)
+        {
+            break;
+        }
+        osSortLinkCascade(pstSortLinkHeader, uwLevel, uwTime);
+    }
+
+    /* every node of the current level 0 bucket expires now */
+    return OS_SORTLINK_BUCKET(pstSortLinkHeader, 0, OS_SORTLINK_SLOT(uwTime, 0));
+}
+
+/*****************************************************************************
+ Function : osSortLinkNextExpireGet
+ Description : Get the ticks left until the timing wheel needs the next scan,
+               i.e. the first timeout or the first cascade of a non-empty bucket.
+ Input       : pstSortLinkHeader --- timing wheel
+ Output      : None
+ Return      : ticks to the next wheel event, OS_NULL_INT if the wheel is empty
+ *****************************************************************************/
+LITE_OS_SEC_TEXT UINT32 osSortLinkNextExpireGet(SORTLINK_ATTRIBUTE_S *pstSortLinkHeader)
+{
+    UINT32 uwNextTime = pstSortLinkHeader->uwCursor + 1;
+    UINT32 uwMinTicks = OS_NULL_INT;
+    UINT32 uwTicks;
+    UINT32 uwLevel;
+    UINT32 uwUnit;
+    UINT32 uwOffset;
+
+    for (uwLevel = 0; uwLevel < OS_SORTLINK_LEVELS; uwLevel++)
+    {
+        /* first bucket time unit of this level that is scanned from now on */
+        uwUnit = uwNextTime >> OS_SORTLINK_SHIFT(uwLevel);
+        if ((uwNextTime & ((1U << OS_SORTLINK_SHIFT(uwLevel)) - 1)) != 0)
+        {
+            uwUnit++;
+        }
+
+        for (uwOffset = 0; uwOffset < OS_SORTLINK_SIZE; uwOffset++)
+        {
+            if (!LOS_ListEmpty(OS_SORTLINK_BUCKET(pstSortLinkHeader, uwLevel, (uwUnit + uwOffset) & OS_SORTLINK_MASK)))
+            {
+                uwTicks = ((uwUnit + uwOffset) << OS_SORTLINK_SHIFT(uwLevel)) - pstSortLinkHeader->uwCursor;
+                if (uwTicks < uwMinTicks)
+                {
+                    uwMinTicks = uwTicks;
+                }
+                break;
+            }
+        }
+    }
+
+    return uwMinTicks;
+}
+
+/*****************************************************************************
+ Function : osSortLinkAdjust
+ Description : Advance the timing wheel by ticks that passed without a scan.
+ Input       : pstSortLinkHeader --- timing wheel
+               uwTicks           --- elapsed ticks, less than the value of osSortLinkNextExpireGet
+ Output      : None
+ Return      : None
+ *****************************************************************************/
+LITE_OS_SEC_TEXT VOID osSortLinkAdjust(SORTLINK_ATTRIBUTE_S *pstSortLinkHeader, UINT32 uwTicks)
+{
+    /* neither a timeout nor a cascade falls into the skipped ticks */
+    pstSortLinkHeader->uwCursor += uwTicks;
+}
+
+LITE_OS_SEC_TEXT UINT32 osSortLinkRemainGet(SORTLINK_ATTRIBUTE_S *pstSortLinkHeader, SORTLINK_LIST_S *pstSortList)
+{
+    return pstSortList->uwExpireTime - pstSortLinkHeader->uwCursor;
+}
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* __cplusplus */
@@ -38,6 +38,7 @@
 #include "los_memory.ph"
 #include "los_queue.ph"
 #include "los_task.ph"
+#include "los_trace.ph"
 #include "los_hwi.h"
 #if (LOSCFG_PLATFORM_EXC == YES)
 #include "los_exc.h"
@@ -51,28 +52,36 @@ extern "C" {
 
 #if (LOSCFG_BASE_CORE_SWTMR == YES)
 
-LITE_OS_SEC_BSS UINT32            m_uwSwTmrHandlerQueue;       /*Software Timer timeout queue ID*/
-LITE_OS_SEC_BSS SWTMR_CTRL_S     *m_pstSwtmrCBArray;           /*first address in Timer memory space  */
+#if (LOSCFG_BASE_CORE_SWTMR_ALLOC_STEP & (LOSCFG_BASE_CORE_SWTMR_ALLOC_STEP - 1))
+#error "LOSCFG_BASE_CORE_SWTMR_ALLOC_STEP must be a power of 2"
+#endif
+
+LITE_OS_SEC_BSS UINT32            m_uwSwTmrHandlerQueue;       /*Software Timer wakeup queue ID*/
+LITE_OS_SEC_BSS OS_OBJ_TABLE_S    m_stSwtmrTable;              /*Control blocks allocated so far*/
+LITE_OS_SEC_BSS UINT32            g_uwSwtmrLimit;              /*Maximum number of Software Timers*/
 LITE_OS_SEC_BSS SWTMR_CTRL_S     *m_pstSwtmrFreeList;          /*Free list of Softwaer Timer*/
-LITE_OS_SEC_BSS SWTMR_CTRL_S     *m_pstSwtmrSortList;          /*The software timer count list*/
+LITE_OS_SEC_BSS SORTLINK_ATTRIBUTE_S m_stSwtmrSortLink;        /*The software timer timing wheel*/
+LITE_OS_SEC_BSS SWTMR_HANDLER_ITEM_S *m_pstSwtmrHandlerRing;   /*Expired handlers waiting for the timer task*/
+LITE_OS_SEC_BSS UINT32            m_uwSwtmrHandlerHead;        /*Next handler run by the timer task*/
+LITE_OS_SEC_BSS UINT32            m_uwSwtmrHandlerCount;       /*Number of handlers in the ring*/
+LITE_OS_SEC_BSS UINT32            m_uwSwtmrHandlerSize;        /*Ring entries, g_uwSwtmrLimit*/
+LITE_OS_SEC_BSS UINT32            g_uwSwtmrHandlerDropCount;   /*Expired handlers dropped on a full ring*/
 
 #if (LOSCFG_BASE_CORE_SWTMR_ALIGN == YES)
-LITE_OS_SEC_BSS UINT32            m_uwSwTmrAlignID[LOSCFG_BASE_CORE_SWTMR_LIMIT] = {0};    /* store swtmr align */
-static UINT32                     m_uwSwtimerRousesTime = 0;          // suspend time
-static SWTMR_CTRL_S               *m_pstRouses = NULL;              // first swtmr that can wake up
-static SWTMR_CTRL_S               *m_pstRousesPrev = NULL;
+LITE_OS_SEC_BSS UINT32            *m_uwSwTmrAlignID;           /* store swtmr align, g_uwSwtmrLimit entries */
+LITE_OS_SEC_BSS SORTLINK_ATTRIBUTE_S m_stSwtmrIgnoreSortLink;  /*Timers that do not wake the system up*/
+
+#define OS_SWTMR_SORTLINK(pstSwtmr) \
+    ((OS_SWTMR_ROUSES_IGNORE == (pstSwtmr)->ucRouses) ? &m_stSwtmrIgnoreSortLink : &m_stSwtmrSortLink)
+#else
+#define OS_SWTMR_SORTLINK(pstSwtmr) (&m_stSwtmrSortLink)
 #endif
 
-#define CHECK_SWTMRID(usSwTmrID, uvIntSave, usSwTmrCBID, pstSwtmr)\
+#define CHECK_SWTMRID(usSwTmrID, uvIntSave, pstSwtmr)\
 {\
-    if (usSwTmrID >= OS_SWTMR_MAX_TIMERID)\
-   {\
-       return LOS_ERRNO_SWTMR_ID_INVALID;\
-   }\
    uvIntSave = LOS_IntLock();\
-   usSwTmrCBID = usSwTmrID % LOSCFG_BASE_CORE_SWTMR_LIMIT;\
-   pstSwtmr = m_pstSwtmrCBArray + usSwTmrCBID;\
-   if (pstSwtmr->usTimerID != usSwTmrID)\
+   pstSwtmr = (SWTMR_CTRL_S *)OS_OBJ_GET(&m_stSwtmrTable, usSwTmrID);\
+   if ((NULL == pstSwtmr) || (pstSwtmr->usTimerID != usSwTmrID))\
    {\
        LOS_IntRestore(uvIntSave);\
        return LOS_ERRNO_SWTMR_ID_INVALID;\
@@ -91,15 +100,36 @@ Return     : None
 LITE_OS_SEC_TEXT VOID osSwTmrTask(VOID)
 {
     SWTMR_HANDLER_ITEM_S stSwtmrHandle;
+    UINT32 uwSignal;
     UINT32 uwReadSzie;
     UINT32 uwRet;
+    UINTPTR uvIntSave;
     UINT64 ullTick;
-    uwReadSzie = sizeof(SWTMR_HANDLER_ITEM_S);
+    UINT32 uwDropReported = 0;
+
     for ( ; ; )
     {
-        uwRet = LOS_QueueReadCopy(m_uwSwTmrHandlerQueue, &stSwtmrHandle, &uwReadSzie, LOS_WAIT_FOREVER);
-        if (uwRet == LOS_OK && uwReadSzie == sizeof(SWTMR_HANDLER_ITEM_S))
+        uwReadSzie = sizeof(UINT32);
+        uwRet = LOS_QueueReadCopy(m_uwSwTmrHandlerQueue, &uwSignal, &uwReadSzie, LOS_WAIT_FOREVER);
+        if (uwRet != LOS_OK)
         {
+            continue;
+        }
+
+        /* one wakeup hands over every handler expired since the ring was last drained */
+        for ( ; ; )
+        {
+            uvIntSave = LOS_IntLock();
+            if (0 == m_uwSwtmrHandlerCount)
+            {
+                LOS_IntRestore(uvIntSave);
+                break;
+            }
+            stSwtmrHandle = m_pstSwtmrHandlerRing[m_uwSwtmrHandlerHead];
+            m_uwSwtmrHandlerHead = (m_uwSwtmrHandlerHead + 1) % m_uwSwtmrHandlerSize;
+            m_uwSwtmrHandlerCount--;
+            LOS_IntRestore(uvIntSave);
+
             if (stSwtmrHandle.pfnHandler != NULL)
             {
                 ullTick = LOS_TickCountGet();
@@ -113,6 +143,13 @@ LITE_OS_SEC_TEXT VOID osSwTmrTask(VOID)
 #endif
             }
         }
+
+        /* the tick interrupt only counts the drops, report them here */
+        if (uwDropReported != g_uwSwtmrHandlerDropCount)
+        {
+            PRINT_ERR("swtmr handler ring full, %u handlers dropped\n", g_uwSwtmrHandlerDropCount - uwDropReported);
+            uwDropReported = g_uwSwtmrHandlerDropCount;
+        }
     }//end of for
 }
 
@@ -137,6 +174,45 @@ LITE_OS_SEC_TEXT_INIT UINT32 osSwTmrTaskCreate(VOID)
     return uwRet;
 }
 
+/*****************************************************************************
+Function   : osSwTmrNodeInit
+Description: Put a Software Timer control block of a new block on the free list
+Input      : pObj    ---------- Software Timer control block
+             uwIndex ---------- index of the control block
+Output     : None
+Return     : None
+*****************************************************************************/
+LITE_OS_SEC_TEXT_INIT static VOID osSwTmrNodeInit(VOID *pObj, UINT32 uwIndex)
+{
+    SWTMR_CTRL_S *pstSwtmr = (SWTMR_CTRL_S *)pObj;
+
+    pstSwtmr->usTimerID = (UINT16)uwIndex;
+    pstSwtmr->pstNext = m_pstSwtmrFreeList;
+    m_pstSwtmrFreeList = pstSwtmr;
+}
+
+/*****************************************************************************
+Function   : osSwTmrCBExtend
+Description: Allocate a block of Software Timer control blocks
+Input      : None
+Output     : None
+Return     : LOS_OK on success or error code on failure
+*****************************************************************************/
+LITE_OS_SEC_TEXT_INIT UINT32 osSwTmrCBExtend(VOID)
+{
+    if (OS_OBJ_TABLE_FULL(&m_stSwtmrTable))
+    {
+        return LOS_ERRNO_SWTMR_MAXSIZE;
+    }
+
+    if (LOS_OK != osObjTableExtend(&m_stSwtmrTable, osSwTmrNodeInit))
+    {
+        return LOS_ERRNO_SWTMR_NO_MEMORY;
+    }
+
+    return LOS_OK;
+}
+
 /*****************************************************************************
 Function   : osSwTmrInit
 Description: Initializes Software Timer
@@ -147,42 +223,60 @@ Return     : LOS_OK on success or error code on failure
 LITE_OS_SEC_TEXT_INIT UINT32 osSwTmrInit(VOID)
 {
     UINT32 uwSize;
-    UINT16 usIndex;
     UINT32 uwRet;
-    SWTMR_CTRL_S *pstSwtmr;
-    SWTMR_CTRL_S *pstTemp;
 
-    if (0 == LOSCFG_BASE_CORE_SWTMR_LIMIT)  /*lint !e506*/
+    if (0 == g_uwSwtmrLimit)
     {
         return LOS_ERRNO_SWTMR_MAXSIZE_INVALID;
     }
 
 #if (LOSCFG_BASE_CORE_SWTMR_ALIGN == YES)
-    (VOID)memset((VOID *)m_uwSwTmrAlignID, 0, LOSCFG_BASE_CORE_SWTMR_LIMIT);
- #endif
+    uwSize = sizeof(UINT32) * g_uwSwtmrLimit;
+    m_uwSwTmrAlignID = (UINT32 *)LOS_MemAlloc(m_aucSysMem0, uwSize);
+    if (NULL == m_uwSwTmrAlignID)
+    {
+        return LOS_ERRNO_SWTMR_NO_MEMORY;
+    }
+    (VOID)memset((VOID *)m_uwSwTmrAlignID, 0, uwSize);
+    if (LOS_OK != osSortLinkInit(&m_stSwtmrIgnoreSortLink))
+    {
+        return LOS_ERRNO_SWTMR_NO_MEMORY;
+    }
+#endif
 
-    m_pstSwtmrSortList = (SWTMR_CTRL_S *)NULL;
-    uwSize = sizeof(SWTMR_CTRL_S) * LOSCFG_BASE_CORE_SWTMR_LIMIT;
-    pstSwtmr = (SWTMR_CTRL_S *)LOS_MemAlloc(m_aucSysMem0, uwSize);
-    if (NULL == pstSwtmr)
+    if (LOS_OK != osSortLinkInit(&m_stSwtmrSortLink))
     {
         return LOS_ERRNO_SWTMR_NO_MEMORY;
     }
 
-    (VOID)memset((VOID *)pstSwtmr, 0, uwSize);
-    m_pstSwtmrCBArray = pstSwtmr;
-    m_pstSwtmrFreeList = pstSwtmr;
-    pstSwtmr->usTimerID = 0;
-    pstTemp = pstSwtmr;
-    pstSwtmr++;
-    for (usIndex = 1; usIndex < LOSCFG_BASE_CORE_SWTMR_LIMIT; usIndex++, pstSwtmr++)
+    /* every timer can expire on the same tick, so the ring holds one handler per timer */
+    m_uwSwtmrHandlerSize = g_uwSwtmrLimit;
+    uwSize = sizeof(SWTMR_HANDLER_ITEM_S) * m_uwSwtmrHandlerSize;
+    m_pstSwtmrHandlerRing = (SWTMR_HANDLER_ITEM_S *)LOS_MemAlloc(m_aucSysMem0, uwSize);
+    if (NULL == m_pstSwtmrHandlerRing)
+    {
+        return LOS_ERRNO_SWTMR_HANDLER_POOL_NO_MEM;
+    }
+    m_uwSwtmrHandlerHead = 0;
+    m_uwSwtmrHandlerCount = 0;
+    g_uwSwtmrHandlerDropCount = 0;
+
+    /* control blocks are allocated on demand, the first block right away */
+    m_pstSwtmrFreeList = (SWTMR_CTRL_S *)NULL;
+    if (LOS_OK != osObjTableInit(&m_stSwtmrTable, sizeof(SWTMR_CTRL_S), g_uwSwtmrLimit,
+                                 LOSCFG_BASE_CORE_SWTMR_ALLOC_STEP, 16))
+    {
+        return LOS_ERRNO_SWTMR_NO_MEMORY;
+    }
+
+    uwRet = osSwTmrCBExtend();
+    if (uwRet != LOS_OK)
     {
-        pstSwtmr->usTimerID = usIndex;
-        pstTemp->pstNext = pstSwtmr;
-        pstTemp = pstSwtmr;
+        return uwRet;
     }
 
-    uwRet = LOS_QueueCreate((CHAR *)NULL, OS_SWTMR_HANDLE_QUEUE_SIZE, &m_uwSwTmrHandlerQueue, 0, sizeof(SWTMR_HANDLER_ITEM_S));
+    /* the queue only wakes the timer task up, the handlers are passed in the ring */
+    uwRet = LOS_QueueCreate((CHAR *)NULL, 1, &m_uwSwTmrHandlerQueue, 0, sizeof(UINT32));
     if (uwRet != LOS_OK)
     {
         return LOS_ERRNO_SWTMR_QUEUE_CREATE_FAILED;
@@ -197,146 +291,115 @@ LITE_OS_SEC_TEXT_INIT UINT32 osSwTmrInit(VOID)
     return LOS_OK;
 }
 
+#if (LOSCFG_BASE_CORE_SWTMR_ALIGN == YES)
 /*****************************************************************************
-Function   : osSwTmrStart
-Description: Start Software Timer
-Input      : pstSwtmr ---------- Need to start Software Timer
+Function   : osSwTmrAlignTimeout
+Description: Get the first timeout of an align insensitive Software Timer
+Input      : pstSwtmr ---------- Software Timer being started
 Output     : None
-Return     : None
+Return     : ticks to the first timeout
 *****************************************************************************/
-LITE_OS_SEC_TEXT VOID osSwTmrStart(SWTMR_CTRL_S *pstSwtmr)
+LITE_OS_SEC_TEXT UINT32 osSwTmrAlignTimeout(SWTMR_CTRL_S *pstSwtmr)
 {
-    SWTMR_CTRL_S *pstPrev = (SWTMR_CTRL_S *)NULL;
-    SWTMR_CTRL_S *pstCur = (SWTMR_CTRL_S *)NULL;
-
-#if (LOSCFG_BASE_CORE_SWTMR_ALIGN == YES)
+    SWTMR_CTRL_S *pstCur;
     UINT32 uwCurrSwtmrTimes, uwSwtmrTimes;
     UINT32 uwMinInLarge = 0xFFFFFFFF, uwMaxInLitte = 0xFFFFFFFF;
-    UINT32 uwMinInLargeID = LOSCFG_BASE_CORE_SWTMR_LIMIT;
-    UINT32 uwMaxInLitteID = LOSCFG_BASE_CORE_SWTMR_LIMIT;
+    UINT32 uwMinInLargeID = OS_NULL_INT;
+    UINT32 uwMaxInLitteID = OS_NULL_INT;
+    UINT32 uwRemain;
     UINT16 usSwTmrCBID;
     UINT16 usSwtmrIdIndex;
-    UINT32 uwCount = 0;
-#endif
-
-    pstSwtmr->uwCount = pstSwtmr->uwInterval;
 
-#if (LOSCFG_BASE_CORE_SWTMR_ALIGN == YES)
-    usSwTmrCBID = pstSwtmr->usTimerID % LOSCFG_BASE_CORE_SWTMR_LIMIT;
-    if(CHECK_ALIGN_SWTMR_CAN_MULTI_ALIGN(m_uwSwTmrAlignID[usSwTmrCBID]))
+    usSwTmrCBID = OS_SWT_CBID(pstSwtmr->usTimerID);
+    if (CHECK_ALIGN_SWTMR_CAN_MULTI_ALIGN(m_uwSwTmrAlignID[usSwTmrCBID]))
     {
         SET_ALIGN_SWTMR_ALREADY_ALIGNED(m_uwSwTmrAlignID[usSwTmrCBID]);
         uwCurrSwtmrTimes = GET_ALIGN_SWTMR_DIVISOR_TIMERS(m_uwSwTmrAlignID[usSwTmrCBID]);
-        for(usSwtmrIdIndex = 0; usSwtmrIdIndex < LOSCFG_BASE_CORE_SWTMR_LIMIT; usSwtmrIdIndex++)
+        for (usSwtmrIdIndex = 0; usSwtmrIdIndex < m_stSwtmrTable.uwCount; usSwtmrIdIndex++)
         {
             uwSwtmrTimes = GET_ALIGN_SWTMR_DIVISOR_TIMERS(m_uwSwTmrAlignID[usSwtmrIdIndex]);
-            if(uwSwtmrTimes == 0 //swtmr not creat
+            if (uwSwtmrTimes == 0 //swtmr not creat
                 || usSwtmrIdIndex == usSwTmrCBID //swtmr is pstSwtmr
                 || !CHECK_ALIGN_SWTMR_ALREADY_ALIGN(m_uwSwTmrAlignID[usSwtmrIdIndex])) //swtmr not start
             {
                 continue;
             }
-            if(uwSwtmrTimes >= uwCurrSwtmrTimes && uwSwtmrTimes % uwCurrSwtmrTimes == 0)
+            if (uwSwtmrTimes >= uwCurrSwtmrTimes && uwSwtmrTimes % uwCurrSwtmrTimes == 0)
             {
-                if(uwMinInLarge > uwSwtmrTimes / uwCurrSwtmrTimes)
+                if (uwMinInLarge > uwSwtmrTimes / uwCurrSwtmrTimes)
                 {
                     uwMinInLarge = uwSwtmrTimes / uwCurrSwtmrTimes;
                     uwMinInLargeID = usSwtmrIdIndex;
                 }
             }
-            else if(uwSwtmrTimes < uwCurrSwtmrTimes && uwCurrSwtmrTimes % uwSwtmrTimes == 0)
+            else if (uwSwtmrTimes < uwCurrSwtmrTimes && uwCurrSwtmrTimes % uwSwtmrTimes == 0)
             {
-                if(uwMaxInLitte > uwCurrSwtmrTimes / uwSwtmrTimes)
+                if (uwMaxInLitte > uwCurrSwtmrTimes / uwSwtmrTimes)
                 {
                     uwMaxInLitte = uwCurrSwtmrTimes / uwSwtmrTimes;
                     uwMaxInLitteID = usSwtmrIdIndex;
                 }
             }
         }
-        if(uwMinInLargeID != LOSCFG_BASE_CORE_SWTMR_LIMIT)
+
+        if (uwMinInLargeID != OS_NULL_INT)
         {
-            pstCur = m_pstSwtmrSortList;
-            while (pstCur != NULL)
-            {
-                uwCount += pstCur->uwCount;
-                if (pstCur->usTimerID == ((SWTMR_CTRL_S  *)(m_pstSwtmrCBArray + uwMinInLargeID))->usTimerID)
-                {
-                    break;
-                }
-                pstCur = pstCur->pstNext;
-            }
-            if(pstCur != NULL)
+            /* keep the phase of the larger timer, it expires together with one of our periods */
+            pstCur = OS_SWT_FROM_SID(uwMinInLargeID);
+            if (OS_SWTMR_STATUS_TICKING == pstCur->ucState)
             {
-                pstSwtmr->uwCount = pstSwtmr->uwInterval - (pstCur->uwInterval - uwCount)% pstSwtmr->uwInterval;
+                uwRemain = osSortLinkRemainGet(OS_SWTMR_SORTLINK(pstCur), &pstCur->stSortList) % pstSwtmr->uwInterval;
+                return (uwRemain == 0) ? pstSwtmr->uwInterval : uwRemain;
             }
         }
-        else if(uwMaxInLitteID != LOSCFG_BASE_CORE_SWTMR_LIMIT)
+        else if (uwMaxInLitteID != OS_NULL_INT)
         {
-            pstSwtmr->uwCount = 0;
-            pstPrev = m_pstSwtmrCBArray + uwMaxInLitteID;
-            pstCur = pstPrev->pstNext;
-            goto Inset_list;
+            /* first timeout together with the next timeout of the smaller timer */
+            pstCur = OS_SWT_FROM_SID(uwMaxInLitteID);
+            if (OS_SWTMR_STATUS_TICKING == pstCur->ucState)
+            {
+                return osSortLinkRemainGet(OS_SWTMR_SORTLINK(pstCur), &pstCur->stSortList);
+            }
         }
     }
-    else if(CHECK_ALIGN_SWTMR_CAN_PERIODIC_ALIGN(m_uwSwTmrAlignID[usSwTmrCBID]))
+    else if (CHECK_ALIGN_SWTMR_CAN_PERIODIC_ALIGN(m_uwSwTmrAlignID[usSwTmrCBID]))
     {
         SET_ALIGN_SWTMR_ALREADY_ALIGNED(m_uwSwTmrAlignID[usSwTmrCBID]);
-        pstCur = m_pstSwtmrSortList;
-        while (pstCur != NULL)
+        for (usSwtmrIdIndex = 0; usSwtmrIdIndex < m_stSwtmrTable.uwCount; usSwtmrIdIndex++)
         {
-            if (pstCur->uwInterval ==  pstSwtmr->uwInterval
-                && CHECK_ALIGN_SWTMR_ALREADY_ALIGN(m_uwSwTmrAlignID[pstCur->usTimerID % LOSCFG_BASE_CORE_SWTMR_LIMIT]))
+            if (usSwtmrIdIndex == usSwTmrCBID
+                || !CHECK_ALIGN_SWTMR_ALREADY_ALIGN(m_uwSwTmrAlignID[usSwtmrIdIndex]))
             {
-                break;
+                continue;
             }
-            pstCur = pstCur->pstNext;
-        }
-        if(pstCur != NULL)
-        {
-            pstSwtmr->uwCount = 0;
-            pstPrev = pstCur;
-            pstCur = pstCur->pstNext;
-            goto Inset_list;
-        }
-    }
-#endif
 
-    pstCur = m_pstSwtmrSortList;
-    while (pstCur != NULL)
-    {
-        if (pstCur->uwCount > pstSwtmr->uwCount)
-        {
-            break;
+            pstCur = OS_SWT_FROM_SID(usSwtmrIdIndex);
+            if (pstCur->uwInterval == pstSwtmr->uwInterval && OS_SWTMR_STATUS_TICKING == pstCur->ucState)
+            {
+                return osSortLinkRemainGet(OS_SWTMR_SORTLINK(pstCur), &pstCur->stSortList);
+            }
         }
-
-        pstSwtmr->uwCount -= pstCur->uwCount;
-        pstPrev = pstCur;
-        pstCur = pstCur->pstNext;
     }
 
-#if (LOSCFG_BASE_CORE_SWTMR_ALIGN == YES)
-Inset_list:
+    return pstSwtmr->uwInterval;
+}
 #endif
 
-    pstSwtmr->pstNext = pstCur;
-
-    if (pstCur != NULL)
-    {
-        pstCur->uwCount -= pstSwtmr->uwCount;
-    }
-
-    if (pstPrev == NULL)
-    {
-        m_pstSwtmrSortList = pstSwtmr;
-    }
-    else
-    {
-        pstPrev->pstNext = pstSwtmr;
-    }
-
+/*****************************************************************************
+Function   : osSwTmrStart
+Description: Start Software Timer
+Input      : pstSwtmr ---------- Need to start Software Timer
+Output     : None
+Return     : None
+*****************************************************************************/
+LITE_OS_SEC_TEXT VOID osSwTmrStart(SWTMR_CTRL_S *pstSwtmr)
+{
+#if (LOSCFG_BASE_CORE_SWTMR_ALIGN == YES)
+    osSortLinkAdd(OS_SWTMR_SORTLINK(pstSwtmr), &pstSwtmr->stSortList, osSwTmrAlignTimeout(pstSwtmr));
+#else
+    osSortLinkAdd(OS_SWTMR_SORTLINK(pstSwtmr), &pstSwtmr->stSortList, pstSwtmr->uwInterval);
+#endif
     pstSwtmr->ucState = OS_SWTMR_STATUS_TICKING;
-
-    return;
 }
 
 /*****************************************************************************
@@ -354,8 +417,10 @@ INLINE VOID osSwtmrDelete(SWTMR_CTRL_S *pstSwtmr)
     pstSwtmr->ucState = OS_SWTMR_STATUS_UNUSED;
 
 #if (LOSCFG_BASE_CORE_SWTMR_ALIGN == YES)
-    m_uwSwTmrAlignID[pstSwtmr->usTimerID % LOSCFG_BASE_CORE_SWTMR_LIMIT] = 0;
+    m_uwSwTmrAlignID[OS_SWT_CBID(pstSwtmr->usTimerID)] = 0;
 #endif
+    /* the ID of the next timer using this control block rejects the stale one */
+    pstSwtmr->usTimerID = (UINT16)OS_OBJ_NEXT_HANDLE(&m_stSwtmrTable, pstSwtmr->usTimerID);
 }
 
 /*****************************************************************************
@@ -367,78 +432,80 @@ Return     : None
 *****************************************************************************/
 LITE_OS_SEC_TEXT VOID osSwtmrStop(SWTMR_CTRL_S *pstSwtmr)
 {
-    SWTMR_CTRL_S *pstPrev = (SWTMR_CTRL_S *)NULL;
-    SWTMR_CTRL_S *pstCur = (SWTMR_CTRL_S *)NULL;
-
-    if(!m_pstSwtmrSortList)
-        return;
-
-    pstCur = m_pstSwtmrSortList;
-
-    while (pstCur != pstSwtmr)
-    {
-        pstPrev = pstCur;
-        pstCur = pstCur->pstNext;
-    }
-
-    if (pstCur->pstNext != NULL)
-    {
-        pstCur->pstNext->uwCount += pstCur->uwCount;
-    }
-
-    if (pstPrev == NULL)
-    {
-        m_pstSwtmrSortList = pstCur->pstNext;
-    }
-    else
-    {
-        pstPrev->pstNext = pstCur->pstNext;
-    }
-
-    pstCur->pstNext = (SWTMR_CTRL_S *)NULL;
-    pstCur->ucState = OS_SWTMR_STATUS_CREATED;
+    osSortLinkDelete(&pstSwtmr->stSortList);
+    pstSwtmr->ucState = OS_SWTMR_STATUS_CREATED;
 
 #if (LOSCFG_BASE_CORE_SWTMR_ALIGN == YES)
-    SET_ALIGN_SWTMR_ALREADY_NOT_ALIGNED(m_uwSwTmrAlignID[pstSwtmr->usTimerID % LOSCFG_BASE_CORE_SWTMR_LIMIT]);
+    SET_ALIGN_SWTMR_ALREADY_NOT_ALIGNED(m_uwSwTmrAlignID[OS_SWT_CBID(pstSwtmr->usTimerID)]);
 #endif
 }
 
 /*****************************************************************************
 Function   : osSwTmrTimeoutHandle
-Description: Software Timer time out handler
-Input      : None
+Description: Advance a Software Timer wheel by one tick and hand the expired
+             timers over to the timer task
+Input      : pstSortLinkHeader --- timing wheel
 Output     : None
 Return     : None
 *****************************************************************************/
-LITE_OS_SEC_TEXT static VOID osSwTmrTimeoutHandle(VOID)
+LITE_OS_SEC_TEXT static VOID osSwTmrTimeoutHandle(SORTLINK_ATTRIBUTE_S *pstSortLinkHeader)
 {
-    SWTMR_CTRL_S *pstSwtmr = m_pstSwtmrSortList;
-    SWTMR_HANDLER_ITEM_S stSwtmrHandler;
+    LOS_DL_LIST *pstListObject;
+    LOS_DL_LIST stExpiredList;
+    SWTMR_CTRL_S *pstSwtmr;
+    UINT32 uwSignal = 0;
+    UINT32 uwTail;
 
-    while (pstSwtmr != NULL && pstSwtmr->uwCount == 0)
+    pstListObject = osSortLinkScan(pstSortLinkHeader);
+    if (pstListObject->pstNext == pstListObject)
     {
-        m_pstSwtmrSortList = pstSwtmr->pstNext;
-        stSwtmrHandler.pfnHandler = pstSwtmr->pfnHandler;
-        stSwtmrHandler.uwArg = pstSwtmr->uwArg;
-        (VOID)LOS_QueueWriteCopy(m_uwSwTmrHandlerQueue, &stSwtmrHandler, sizeof(SWTMR_HANDLER_ITEM_S), LOS_NO_WAIT);
+        return;
+    }
+
+    /* detach the bucket first, a restarted periodic timer may map to the same bucket */
+    stExpiredList.pstNext = pstListObject->pstNext;
+    stExpiredList.pstPrev = pstListObject->pstPrev;
+    stExpiredList.pstNext->pstPrev = &stExpiredList;
+    stExpiredList.pstPrev->pstNext = &stExpiredList;
+    LOS_ListInit(pstListObject);
+
+    while (!LOS_ListEmpty(&stExpiredList))
+    {
+        pstSwtmr = LOS_DL_LIST_ENTRY(stExpiredList.pstNext, SWTMR_CTRL_S, stSortList.stList); /*lint !e413*/
+        osSortLinkDelete(&pstSwtmr->stSortList);
+        OS_TRACE(LOS_TRACE_SWTMR_EXPIRE, pstSwtmr->usTimerID, pstSwtmr->pfnHandler);
+
+        /* the whole batch costs one wakeup of the timer task */
+        if (m_uwSwtmrHandlerCount < m_uwSwtmrHandlerSize)
+        {
+            uwTail = (m_uwSwtmrHandlerHead + m_uwSwtmrHandlerCount) % m_uwSwtmrHandlerSize;
+            m_pstSwtmrHandlerRing[uwTail].pfnHandler = pstSwtmr->pfnHandler;
+            m_pstSwtmrHandlerRing[uwTail].uwArg = pstSwtmr->uwArg;
+            if (0 == m_uwSwtmrHandlerCount++)
+            {
+                (VOID)LOS_QueueWriteCopy(m_uwSwTmrHandlerQueue, &uwSignal, sizeof(UINT32), LOS_NO_WAIT);
+            }
+        }
+        else
+        {
+            /* only a timer task starved for several periods of a periodic timer gets here */
+            g_uwSwtmrHandlerDropCount++;
+            OS_TRACE(LOS_TRACE_SWTMR_DROP, pstSwtmr->usTimerID, pstSwtmr->pfnHandler);
+        }
+
         if (pstSwtmr->ucMode == LOS_SWTMR_MODE_ONCE)
         {
             osSwtmrDelete(pstSwtmr);
-            if (pstSwtmr->usTimerID < OS_SWTMR_MAX_TIMERID - LOSCFG_BASE_CORE_SWTMR_LIMIT)
-                pstSwtmr->usTimerID += LOSCFG_BASE_CORE_SWTMR_LIMIT;
-            else
-                pstSwtmr->usTimerID %= LOSCFG_BASE_CORE_SWTMR_LIMIT;
         }
         else if ( pstSwtmr->ucMode == LOS_SWTMR_MODE_PERIOD)
         {
+            /* the next period counts from this expiry, not from the handler run */
             osSwTmrStart(pstSwtmr);
         }
         else if (pstSwtmr->ucMode == LOS_SWTMR_MODE_NO_SELFDELETE)
         {
             pstSwtmr->ucState = OS_SWTMR_STATUS_CREATED;
         }
-
-        pstSwtmr = m_pstSwtmrSortList;
     }
 }
 
@@ -451,181 +518,47 @@ Return     : LOS_OK on success or error code on failure
 *****************************************************************************/
 LITE_OS_SEC_TEXT UINT32 osSwtmrScan(VOID)
 {
-    if (m_pstSwtmrSortList != NULL)
-    {
-        if (--(m_pstSwtmrSortList->uwCount) == 0)
-        {
-            osSwTmrTimeoutHandle();
-        }
-    }
+    osSwTmrTimeoutHandle(&m_stSwtmrSortLink);
+#if (LOSCFG_BASE_CORE_SWTMR_ALIGN == YES)
+    osSwTmrTimeoutHandle(&m_stSwtmrIgnoreSortLink);
+#endif
     return LOS_OK;
 }
 
 /*****************************************************************************
 Function   : osSwTmrGetNextTimeout
-Description: Get next timeout
+Description: Get the ticks until the Software Timer wheel needs the next scan,
+             timers that do not wake the system up are not counted
 Input      : None
 Output     : None
-Return     : Count of the Timer list
+Return     : ticks, 0xFFFFFFFF if no timer is ticking
 *****************************************************************************/
-#if (LOSCFG_BASE_CORE_SWTMR_ALIGN == YES)
 LITE_OS_SEC_TEXT UINT32 osSwTmrGetNextTimeout(VOID)
 {
-    SWTMR_CTRL_S *pstCur = NULL;
-    UINT32 uwTmpTime = 0, uwSleepTime = 0;
-
-    pstCur = m_pstSwtmrSortList;
-
-    //find first timer can wakeup the system
-    while (pstCur != NULL)
-    {
-        if(OS_SWTMR_ROUSES_ALLOW == pstCur->ucRouses)
-        {
-            m_pstRouses = pstCur;
-            break;
-        }
-
-        uwTmpTime += pstCur->uwCount;
-        m_pstRousesPrev = pstCur;
-        pstCur = pstCur->pstNext;
-    }
-
-    if(pstCur != NULL)
-    {
-        uwSleepTime = pstCur->uwCount + uwTmpTime;
-        m_uwSwtimerRousesTime  = uwSleepTime;
-    }
-    else
-    {
-        return	0xFFFFFFFF;
-    }
-
-    return uwSleepTime;
-}
-#else
-LITE_OS_SEC_TEXT UINT32 osSwTmrGetNextTimeout(VOID)
-{
-    if (m_pstSwtmrSortList == NULL)
-    {
-        return 0xFFFFFFFF;
-    }
-    return m_pstSwtmrSortList->uwCount;
+    return osSortLinkNextExpireGet(&m_stSwtmrSortLink);
 }
-#endif
 
-/*****************************************************************************
-Function   : osSwtimerInsert
-Description: Insert a list of swtmr
-Input      : None
-Output     : None
-Return     : None
-*****************************************************************************/
-VOID osSwtimerInsert(SWTMR_CTRL_S **pstHead, SWTMR_CTRL_S *pstSwtmr)
-{
-    SWTMR_CTRL_S *pstPrev = NULL;
-    SWTMR_CTRL_S *pstNextTmp = pstSwtmr->pstNext;
-    SWTMR_CTRL_S *pstCur = *pstHead;
-
-    while(pstSwtmr!=NULL)
-    {
-        while (pstCur != NULL)
-        {
-            if (pstCur->uwCount > pstSwtmr->uwCount)
-            {
-                break;
-            }
-
-            pstSwtmr->uwCount -= pstCur->uwCount;
-            pstPrev = pstCur;
-            pstCur = pstCur->pstNext;
-        }
-        pstSwtmr->pstNext = pstCur;
-
-        if (pstCur != NULL)
-        {
-            pstCur->uwCount -= pstSwtmr->uwCount;
-        }
-        if (pstPrev == NULL)
-        {
-            *pstHead = pstSwtmr;
-        }
-        else
-        {
-            pstPrev->pstNext = pstSwtmr;
-        }
-
-        pstPrev = pstSwtmr;
-        pstSwtmr = pstNextTmp;
-        pstNextTmp = pstNextTmp->pstNext;
-    }
-
-    return;
-}
 /*****************************************************************************
 Function   : osSwTmrAdjust
-Description: Adjust Software Timer list
+Description: Adjust Software Timer wheel
 Input      : sleep_time
 Output     : None
 Return     : None
 *****************************************************************************/
-#if (LOSCFG_BASE_CORE_SWTMR_ALIGN == YES)
 LITE_OS_SEC_TEXT VOID osSwTmrAdjust(UINT32 uwSleepTime)
 {
-    SWTMR_CTRL_S  *pstCur = NULL;
-
-    if(m_pstRouses == NULL)
-        return;
-
-    if (uwSleepTime > m_uwSwtimerRousesTime)
-    {
-        uwSleepTime = m_uwSwtimerRousesTime;
-    }
-
-    if(uwSleepTime <= m_pstRouses->uwCount)
-    {
-        m_pstRouses->uwCount -= uwSleepTime;
-    }
-    else
-    {
-        m_pstRouses->uwCount = m_uwSwtimerRousesTime - uwSleepTime;
-
-        if(m_pstRousesPrev!=NULL)
-        {
-            m_pstRousesPrev->pstNext = NULL;
-            pstCur = m_pstSwtmrSortList;
-            osSwtimerInsert(&m_pstRouses,pstCur);
-            m_pstSwtmrSortList = m_pstRouses;
-        }
-    }
-    if (m_pstSwtmrSortList->uwCount == 0)
+#if (LOSCFG_BASE_CORE_SWTMR_ALIGN == YES)
+    /* the timers that did not wake the system up expire late, tick by tick */
+    while (uwSleepTime > 0)
     {
-        osSwTmrTimeoutHandle();
+        osSortLinkAdjust(&m_stSwtmrSortLink, 1);
+        osSwTmrTimeoutHandle(&m_stSwtmrIgnoreSortLink);
+        uwSleepTime--;
     }
-
-    m_pstRouses = NULL;
-    m_pstRousesPrev = NULL;
-}
 #else
-LITE_OS_SEC_TEXT VOID osSwTmrAdjust(UINT32 uwSleepTime)
-{
-    if (m_pstSwtmrSortList == NULL)
-    {
-        return ;
-    }
-
-    if (uwSleepTime > m_pstSwtmrSortList->uwCount)
-    {
-        uwSleepTime = m_pstSwtmrSortList->uwCount;
-    }
-
-    m_pstSwtmrSortList->uwCount -= uwSleepTime;
-
-    if (m_pstSwtmrSortList->uwCount == 0)
-    {
-        osSwTmrTimeoutHandle();
-    }
-}
+    osSortLinkAdjust(&m_stSwtmrSortLink, uwSleepTime);
 #endif
+}
 
 /*****************************************************************************
 Function   : osSwtmrTimeGet
@@ -637,22 +570,7 @@ Other      : None
 *****************************************************************************/
 LITE_OS_SEC_TEXT UINT32 osSwtmrTimeGet(SWTMR_CTRL_S *pstSwtmr)
 {
-    SWTMR_CTRL_S *pstCur = (SWTMR_CTRL_S *)NULL;
-    UINT32 uwTick = 0;
-
-    pstCur = m_pstSwtmrSortList;
-    while (1)
-    {
-        uwTick += pstCur->uwCount;
-        if (pstCur == pstSwtmr)
-        {
-            break;
-        }
-
-        pstCur = pstCur->pstNext;
-    }
-
-    return uwTick;
+    return osSortLinkRemainGet(OS_SWTMR_SORTLINK(pstSwtmr), &pstSwtmr->stSortList);
 }
 
 /*****************************************************************************
@@ -673,6 +591,7 @@ LITE_OS_SEC_TEXT_INIT UINT32 LOS_SwtmrCreate(UINT32 uwInterval, UINT8 ucMode, SW
 {
     SWTMR_CTRL_S  *pstSwtmr;
     UINTPTR  uvIntSave;
+    UINT32 uwRet;
 
     if (0 == uwInterval)
     {
@@ -709,10 +628,15 @@ LITE_OS_SEC_TEXT_INIT UINT32 LOS_SwtmrCreate(UINT32 uwInterval, UINT8 ucMode, SW
 #endif
 
     uvIntSave = LOS_IntLock();
-    if (NULL == m_pstSwtmrFreeList)
+    while (NULL == m_pstSwtmrFreeList)
     {
         LOS_IntRestore(uvIntSave);
-        return LOS_ERRNO_SWTMR_MAXSIZE;
+        uwRet = osSwTmrCBExtend();
+        if (LOS_OK != uwRet)
+        {
+            return uwRet;
+        }
+        uvIntSave = LOS_IntLock();
     }
 
     pstSwtmr = m_pstSwtmrFreeList;
@@ -722,7 +646,6 @@ LITE_OS_SEC_TEXT_INIT UINT32 LOS_SwtmrCreate(UINT32 uwInterval, UINT8 ucMode, SW
     pstSwtmr->ucMode        = ucMode;
     pstSwtmr->uwInterval    = uwInterval;
     pstSwtmr->pstNext       = (SWTMR_CTRL_S *)NULL;
-    pstSwtmr->uwCount       = 0;
     pstSwtmr->uwArg         = uwArg;
 #if (LOSCFG_BASE_CORE_SWTMR_ALIGN == YES)
     pstSwtmr->ucRouses      = ucRouses;
@@ -747,20 +670,23 @@ LITE_OS_SEC_TEXT UINT32 LOS_SwtmrStart(UINT16 usSwTmrID)
     UINTPTR  uvIntSave;
 #if (LOSCFG_BASE_CORE_SWTMR_ALIGN == YES)
     UINT32 uwTimes;
+    UINT16 usSwTmrCBID;
 #endif
     UINT32 uwRet = LOS_OK;
-    UINT16 usSwTmrCBID;
 
-    CHECK_SWTMRID(usSwTmrID, uvIntSave, usSwTmrCBID, pstSwtmr);
+    OS_INT_PRIO_CHECK();
+
+    CHECK_SWTMRID(usSwTmrID, uvIntSave, pstSwtmr);
 #if (LOSCFG_BASE_CORE_SWTMR_ALIGN == YES)
+    usSwTmrCBID = OS_SWT_CBID(usSwTmrID);
     if( OS_SWTMR_ALIGN_INSENSITIVE == pstSwtmr->ucSensitive && LOS_SWTMR_MODE_PERIOD == pstSwtmr->ucMode )
     {
-        SET_ALIGN_SWTMR_CAN_ALIGNED(m_uwSwTmrAlignID[pstSwtmr->usTimerID % LOSCFG_BASE_CORE_SWTMR_LIMIT]);
+        SET_ALIGN_SWTMR_CAN_ALIGNED(m_uwSwTmrAlignID[usSwTmrCBID]);
         if(pstSwtmr->uwInterval % LOS_COMMON_DIVISOR == 0)
         {
-            SET_ALIGN_SWTMR_CAN_MULTIPLE(m_uwSwTmrAlignID[pstSwtmr->usTimerID % LOSCFG_BASE_CORE_SWTMR_LIMIT]);
+            SET_ALIGN_SWTMR_CAN_MULTIPLE(m_uwSwTmrAlignID[usSwTmrCBID]);
             uwTimes = pstSwtmr->uwInterval / (LOS_COMMON_DIVISOR);
-            SET_ALIGN_SWTMR_DIVISOR_TIMERS(m_uwSwTmrAlignID[pstSwtmr->usTimerID % LOSCFG_BASE_CORE_SWTMR_LIMIT], uwTimes);
+            SET_ALIGN_SWTMR_DIVISOR_TIMERS(m_uwSwTmrAlignID[usSwTmrCBID], uwTimes);
         }
     }
  #endif
@@ -795,10 +721,11 @@ LITE_OS_SEC_TEXT UINT32 LOS_SwtmrStop(UINT16 usSwTmrID)
 {
     SWTMR_CTRL_S *pstSwtmr;
     UINTPTR uvIntSave;
-    UINT16 usSwTmrCBID;
     UINT32 uwRet = LOS_OK;
 
-    CHECK_SWTMRID(usSwTmrID, uvIntSave, usSwTmrCBID, pstSwtmr);
+    OS_INT_PRIO_CHECK();
+
+    CHECK_SWTMRID(usSwTmrID, uvIntSave, pstSwtmr);
     switch (pstSwtmr->ucState)
     {
     case OS_SWTMR_STATUS_UNUSED:
@@ -824,27 +751,15 @@ LITE_OS_SEC_TEXT UINT32 LOS_SwtmrTimeGet(UINT16 usSwTmrID, UINT32 *uwTick)
     SWTMR_CTRL_S  *pstSwtmr;
     UINTPTR  uvIntSave;
     UINT32 uwRet = LOS_OK;
-    UINT16 usSwTmrCBID;
 
-    if (usSwTmrID >= OS_SWTMR_MAX_TIMERID)
-    {
-        return LOS_ERRNO_SWTMR_ID_INVALID;
-    }
+    OS_INT_PRIO_CHECK();
 
     if (uwTick == NULL)
     {
         return LOS_ERRNO_SWTMR_TICK_PTR_NULL;
     }
 
-    uvIntSave = LOS_IntLock();
-    usSwTmrCBID = usSwTmrID % LOSCFG_BASE_CORE_SWTMR_LIMIT;
-    pstSwtmr = m_pstSwtmrCBArray + usSwTmrCBID;
-
-    if (pstSwtmr->usTimerID != usSwTmrID)
-    {
-        LOS_IntRestore(uvIntSave);
-        return LOS_ERRNO_SWTMR_ID_INVALID;
-    }
+    CHECK_SWTMRID(usSwTmrID, uvIntSave, pstSwtmr);
     switch (pstSwtmr->ucState)
     {
     case OS_SWTMR_STATUS_UNUSED:
@@ -876,9 +791,10 @@ LITE_OS_SEC_TEXT UINT32 LOS_SwtmrDelete(UINT16 usSwTmrID)
     SWTMR_CTRL_S  *pstSwtmr;
     UINTPTR  uvIntSave;
     UINT32 uwRet = LOS_OK;
-    UINT16 usSwTmrCBID;
 
-    CHECK_SWTMRID(usSwTmrID, uvIntSave, usSwTmrCBID, pstSwtmr);
+    OS_INT_PRIO_CHECK();
+
+    CHECK_SWTMRID(usSwTmrID, uvIntSave, pstSwtmr);
     switch (pstSwtmr->ucState)
     {
     case OS_SWTMR_STATUS_UNUSED:
@@ -45,7 +45,15 @@
 #if (LOSCFG_BASE_CORE_CPUP == YES)
 #include "los_cpup.ph"
 #endif
+#include "los_trace.ph"
+#include "los_tick.ph"
+#if (LOSCFG_BASE_IPC_MULTIWAIT == YES)
+#include "los_multiwait.ph"
+#endif
 #include "los_hw.h"
+#if (LOSCFG_BASE_CORE_TSK_STACK_GUARD == YES)
+#include "los_mpu.h"
+#endif
 
 #ifdef __cplusplus
 #if __cplusplus
@@ -53,6 +61,13 @@ extern "C" {
 #endif /* __cplusplus */
 #endif /* __cplusplus */
 
+/* bytes below uwTopOfStack kept by the stack guard, they belong to the stack allocation */
+#if (LOSCFG_BASE_CORE_TSK_STACK_GUARD == YES)
+#define OS_TASK_STACK_GUARD_SIZE    OS_MPU_STACK_GUARD_SIZE
+#else
+#define OS_TASK_STACK_GUARD_SIZE    0
+#endif
+
 LITE_OS_SEC_BSS  LOS_TASK_CB                         *g_pstTaskCBArray;
 LITE_OS_SEC_BSS  ST_LOS_TASK                         g_stLosTask;
 LITE_OS_SEC_BSS  UINT16                                  g_usLosTaskLock;
@@ -62,11 +77,15 @@ LITE_OS_SEC_BSS  UINT32                                  g_uwSwtmrTaskID;
 LITE_OS_SEC_DATA LOS_DL_LIST                         g_stTaskTimerList;
 LITE_OS_SEC_DATA_INIT LOS_DL_LIST                    g_stLosFreeTask;
 LITE_OS_SEC_DATA_INIT LOS_DL_LIST                    g_stTskRecyleList;
-LITE_OS_SEC_BSS  TSK_SORTLINK_ATTRIBUTE_S            g_stTskSortLink;
+LITE_OS_SEC_BSS  SORTLINK_ATTRIBUTE_S                g_stTskSortLink;
+#if (LOSCFG_BASE_CORE_TSK_PERIODIC == YES)
+LITE_OS_SEC_BSS  SORTLINK_ATTRIBUTE_S                g_stTskPeriodSortLink;
+#endif
 LITE_OS_SEC_BSS  BOOL                                g_bTaskScheduled;
 
-#if (LOSCFG_BASE_CORE_TSK_MONITOR == YES)
+/* called by osPendSV, which references it whatever the configuration */
 TSKSWITCHHOOK g_pfnTskSwitchHook = (TSKSWITCHHOOK)NULL; /*lint !e611*/
+#if (LOSCFG_BASE_CORE_TSK_MONITOR == YES)
 TSKSWITCHHOOK g_pfnUsrTskSwitchHook = (TSKSWITCHHOOK)NULL; /*lint !e611*/
 #endif /* LOSCFG_BASE_CORE_TSK_MONITOR == YES */
 
@@ -90,6 +109,30 @@ OS_TASK_SWITCH_INFO g_astTskSwitchInfo;
    }\
 }
 
+/*****************************************************************************
+ Function : osTaskPendInsert
+ Description : Insert task into a pend list, behind the tasks of higher or equal
+               priority if the list is priority ordered.
+ Input       : pstList      --- pend list
+               pstTaskCB    --- task control block
+ Output      : None
+ Return      : None
+ *****************************************************************************/
+LITE_OS_SEC_TEXT VOID osTaskPendInsert(LOS_DL_LIST *pstList, LOS_TASK_CB *pstTaskCB)
+{
+    LOS_DL_LIST *pstPrev = pstList->pstPrev;
+
+    if (pstTaskCB->pstPendHead != NULL)
+    {
+        while ((pstPrev != pstList) && (OS_TCB_FROM_PENDLIST(pstPrev)->usPriority > pstTaskCB->usPriority)) /*lint !e413*/
+        {
+            pstPrev = pstPrev->pstPrev;
+        }
+    }
+
+    LOS_ListAdd(pstPrev, &pstTaskCB->stPendList);
+}
+
 /*****************************************************************************
  Function : osTaskPriModify
  Description : Change task priority.
@@ -108,6 +151,13 @@ LITE_OS_SEC_TEXT_MINOR VOID osTaskPriModify(LOS_TASK_CB *pstTaskCB, UINT16 usPri
         pstTaskCB->usTaskStatus |= OS_TASK_STATUS_READY;
         osPriqueueEnqueue(&pstTaskCB->stPendList, pstTaskCB->usPriority);
     }
+    else if ((pstTaskCB->pstPendHead != NULL) && (pstTaskCB->usTaskStatus & (OS_TASK_STATUS_PEND | OS_TASK_STATUS_PEND_QUEUE)))
+    {
+        /* keep the priority ordered pend list sorted */
+        LOS_ListDelete(&pstTaskCB->stPendList);
+        pstTaskCB->usPriority = usPriority;
+        osTaskPendInsert(pstTaskCB->pstPendHead, pstTaskCB);
+    }
     else
     {
         pstTaskCB->usPriority = usPriority;
@@ -124,62 +174,13 @@ LITE_OS_SEC_TEXT_MINOR VOID osTaskPriModify(LOS_TASK_CB *pstTaskCB, UINT16 usPri
  *****************************************************************************/
 LITE_OS_SEC_TEXT VOID osTaskAdd2TimerList(LOS_TASK_CB *pstTaskCB, UINT32 uwTimeout)
 {
-    LOS_TASK_CB *pstTskDelay;
-    LOS_DL_LIST *pstListObject;
-    UINT32 uwSortIndex;
-    UINT32 uwRollNum;
-
-    uwSortIndex = uwTimeout & OS_TSK_SORTLINK_MASK;
-    uwRollNum = (uwTimeout >> OS_TSK_SORTLINK_LOGLEN);
-    (uwSortIndex > 0) ? 0 : (uwRollNum--);
-    EVALUATE_L(pstTaskCB->uwIdxRollNum, uwRollNum);
-    uwSortIndex = (uwSortIndex + g_stTskSortLink.usCursor);
-    uwSortIndex = uwSortIndex & OS_TSK_SORTLINK_MASK;
-    EVALUATE_H(pstTaskCB->uwIdxRollNum, uwSortIndex);
-    pstListObject = g_stTskSortLink.pstSortLink + uwSortIndex;
-    if (pstListObject->pstNext == pstListObject)
-    {
-        LOS_ListTailInsert(pstListObject, &pstTaskCB->stTimerList);
-    }
-    else
-    {
-        pstTskDelay = LOS_DL_LIST_ENTRY((pstListObject)->pstNext, LOS_TASK_CB, stTimerList); /*lint !e413*/
-        do
-        {
-            if (UWROLLNUM(pstTskDelay->uwIdxRollNum) <= UWROLLNUM(pstTaskCB->uwIdxRollNum))
-            {
-                UWROLLNUMSUB(pstTaskCB->uwIdxRollNum, pstTskDelay->uwIdxRollNum);
-            }
-            else
-            {
-                UWROLLNUMSUB(pstTskDelay->uwIdxRollNum, pstTaskCB->uwIdxRollNum);
-                break;
-            }
-
-            pstTskDelay = LOS_DL_LIST_ENTRY(pstTskDelay->stTimerList.pstNext, LOS_TASK_CB, stTimerList); /*lint !e413*/
-        } while (&pstTskDelay->stTimerList != (pstListObject));
-
-        LOS_ListTailInsert(&pstTskDelay->stTimerList, &pstTaskCB->stTimerList);
-    }
+    osSortLinkAdd(&g_stTskSortLink, &pstTaskCB->stSortList, uwTimeout);
 }
 
 
 LITE_OS_SEC_TEXT VOID osTimerListDelete(LOS_TASK_CB *pstTaskCB)
 {
-    LOS_DL_LIST  *pstListObject;
-    LOS_TASK_CB  *pstNextTask;
-    UINT32 uwSortIndex;
-
-    uwSortIndex = UWSORTINDEX(pstTaskCB->uwIdxRollNum);
-    pstListObject = g_stTskSortLink.pstSortLink + uwSortIndex;
-
-    if (pstListObject != pstTaskCB->stTimerList.pstNext)
-    {
-        pstNextTask = LOS_DL_LIST_ENTRY(pstTaskCB->stTimerList.pstNext, LOS_TASK_CB, stTimerList); /*lint !e413*/
-        UWROLLNUMADD(pstNextTask->uwIdxRollNum, pstTaskCB->uwIdxRollNum);
-    }
-
-    LOS_ListDelete(&pstTaskCB->stTimerList);
+    osSortLinkDelete(&pstTaskCB->stSortList);
 }
 
 LITE_OS_SEC_TEXT VOID osTaskScan(VOID)
@@ -188,37 +189,54 @@ LITE_OS_SEC_TEXT VOID osTaskScan(VOID)
     BOOL bNeedSchedule = FALSE;
     LOS_DL_LIST *pstListObject;
     UINT16 usTempStatus;
+#if (LOSCFG_BASE_IPC_MUX == YES)
+    MUX_CB_S *pstMux;
+#endif
 
-    g_stTskSortLink.usCursor = (g_stTskSortLink.usCursor + 1) % OS_TSK_SORTLINK_LEN;
-    pstListObject = g_stTskSortLink.pstSortLink + g_stTskSortLink.usCursor;
+#if (LOSCFG_BASE_CORE_TSK_PERIODIC == YES)
+    osTaskPeriodScan();
+#endif
+
+    pstListObject = osSortLinkScan(&g_stTskSortLink);
     if (pstListObject->pstNext == pstListObject)
     {
         return;
     }
 
-    for (pstTaskCB = LOS_DL_LIST_ENTRY((pstListObject)->pstNext, LOS_TASK_CB, stTimerList);&pstTaskCB->stTimerList != (pstListObject);) /*lint !e413*/
+    /* every task of the current level 0 bucket expires now */
+    while (pstListObject->pstNext != pstListObject)
     {
+        pstTaskCB = LOS_DL_LIST_ENTRY(pstListObject->pstNext, LOS_TASK_CB, stSortList.stList); /*lint !e413*/
         usTempStatus = pstTaskCB->usTaskStatus;
-        if (UWROLLNUM(pstTaskCB->uwIdxRollNum) > 0)
-        {
-            UWROLLNUMDEC(pstTaskCB->uwIdxRollNum);
-            break;
-        }
 
-        LOS_ListDelete(&pstTaskCB->stTimerList);
+        osSortLinkDelete(&pstTaskCB->stSortList);
         if (OS_TASK_STATUS_PEND & usTempStatus)
         {
+            OS_TRACE(LOS_TRACE_TASK_TIMEOUT, pstTaskCB->uwTaskID, usTempStatus);
             pstTaskCB->usTaskStatus &= ~(OS_TASK_STATUS_PEND);
             LOS_ListDelete(&pstTaskCB->stPendList);
-            pstTaskCB->pTaskSem = NULL;
+#if (LOSCFG_BASE_IPC_MUX == YES)
+            pstMux = (MUX_CB_S *)pstTaskCB->pTaskMux;
+            pstTaskCB->pTaskMux = NULL;
+            if (pstMux != NULL)
+            {
+                /* the owner may be boosted by this task only */
+                osMuxPriUpdate(pstMux->pstOwner);
+            }
+#else
             pstTaskCB->pTaskMux = NULL;
+#endif
+            pstTaskCB->pTaskSem = NULL;
         }
-        else if (OS_TASK_STATUS_EVENT & usTempStatus)
+        else if ((OS_TASK_STATUS_EVENT | OS_TASK_STATUS_PEND_MULTI) & usTempStatus)
         {
-            pstTaskCB->usTaskStatus &= ~(OS_TASK_STATUS_EVENT);
+            /* not on a pend list, a multi-wait task unlinks its items itself */
+            OS_TRACE(LOS_TRACE_TASK_TIMEOUT, pstTaskCB->uwTaskID, usTempStatus);
+            pstTaskCB->usTaskStatus &= ~(OS_TASK_STATUS_EVENT | OS_TASK_STATUS_PEND_MULTI);
         }
         else if (OS_TASK_STATUS_PEND_QUEUE & usTempStatus)
         {
+            OS_TRACE(LOS_TRACE_TASK_TIMEOUT, pstTaskCB->uwTaskID, usTempStatus);
             LOS_ListDelete(&pstTaskCB->stPendList);
             pstTaskCB->usTaskStatus &= ~(OS_TASK_STATUS_PEND_QUEUE);
         }
@@ -233,8 +251,6 @@ LITE_OS_SEC_TEXT VOID osTaskScan(VOID)
             osPriqueueEnqueue(&pstTaskCB->stPendList, pstTaskCB->usPriority);
             bNeedSchedule = TRUE;
         }
-
-        pstTaskCB = LOS_DL_LIST_ENTRY(pstListObject->pstNext, LOS_TASK_CB, stTimerList); /*lint !e413*/
     }
 
     if (bNeedSchedule)
@@ -243,6 +259,46 @@ LITE_OS_SEC_TEXT VOID osTaskScan(VOID)
     }
 }
 
+/*****************************************************************************
+ Function : osTaskNextSwitchTimeGet
+ Description : Get the ticks left until the timing wheel needs the next scan,
+               i.e. the first task timeout, deadline or cascade of a non-empty bucket.
+ Input       : None
+ Output      : None
+ Return      : ticks to the next wheel event, OS_NULL_INT if no task is delayed
+ *****************************************************************************/
+LITE_OS_SEC_TEXT UINT32 osTaskNextSwitchTimeGet(VOID)
+{
+    UINT32 uwTicks = osSortLinkNextExpireGet(&g_stTskSortLink);
+#if (LOSCFG_BASE_CORE_TSK_PERIODIC == YES)
+    UINT32 uwDeadlineTicks = osSortLinkNextExpireGet(&g_stTskPeriodSortLink);
+
+    if (uwDeadlineTicks < uwTicks)
+    {
+        uwTicks = uwDeadlineTicks;
+    }
+#endif
+
+    return uwTicks;
+}
+
+#if (LOSCFG_KERNEL_TICKLESS == YES)
+/*****************************************************************************
+ Function : osTaskSortLinkAdjust
+ Description : Advance the timing wheel by ticks that passed without a tick interrupt.
+ Input       : uwTicks --- elapsed ticks, less than the value of osTaskNextSwitchTimeGet
+ Output      : None
+ Return      : None
+ *****************************************************************************/
+LITE_OS_SEC_TEXT VOID osTaskSortLinkAdjust(UINT32 uwTicks)
+{
+    osSortLinkAdjust(&g_stTskSortLink, uwTicks);
+#if (LOSCFG_BASE_CORE_TSK_PERIODIC == YES)
+    osSortLinkAdjust(&g_stTskPeriodSortLink, uwTicks);
+#endif
+}
+#endif
+
 /*****************************************************************************
  Function : osConvertTskStatus
  Description : Convert task status to string.
@@ -277,6 +333,14 @@ LITE_OS_SEC_TEXT_MINOR UINT8 *osConvertTskStatus(UINT16 usTaskStatus)
     {
         return (UINT8 *)"Suspend";
     }
+    else if (OS_TASK_STATUS_EVENT & usTaskStatus)
+    {
+        return (UINT8 *)"NotifyPend";
+    }
+    else if (OS_TASK_STATUS_PEND_MULTI & usTaskStatus)
+    {
+        return (UINT8 *)"MultiPend";
+    }
     else if (OS_TASK_STATUS_PEND_QUEUE& usTaskStatus)
     {
         if (OS_TASK_STATUS_TIMEOUT & usTaskStatus)
@@ -398,7 +462,7 @@ LITE_OS_SEC_TEXT_MINOR UINT32 osGetAllTskInfo(VOID)
 
         if (pstTaskCB->pTaskSem != NULL)
         {
-            PRINT_ERR("0x%-7x", ((SEM_CB_S *)pstTaskCB->pTaskSem)->usSemID);/*lint !e516*/
+            PRINT_ERR("0x%-7x", ((SEM_CB_S *)pstTaskCB->pTaskSem)->uwSemID);/*lint !e516*/
         }
         else
         {
@@ -439,7 +503,6 @@ LITE_OS_SEC_TEXT_INIT UINT32 osTaskInit(VOID)
 {
     UINT32 uwSize;
     UINT32 uwIndex;
-    LOS_DL_LIST *pstListObject;
 
     uwSize = (g_uwTskMaxNum + 1) * sizeof(LOS_TASK_CB);
     g_pstTaskCBArray = (LOS_TASK_CB *)LOS_MemAlloc(m_aucSysMem0, uwSize);
@@ -452,7 +515,7 @@ LITE_OS_SEC_TEXT_INIT UINT32 osTaskInit(VOID)
     LOS_ListInit(&g_stTaskTimerList);
     LOS_ListInit(&g_stLosFreeTask);
     LOS_ListInit(&g_stTskRecyleList);
-    for (uwIndex = 0; uwIndex <= LOSCFG_BASE_CORE_TSK_LIMIT; uwIndex++)
+    for (uwIndex = 0; uwIndex < g_uwTskMaxNum; uwIndex++)
     {
         g_pstTaskCBArray[uwIndex].usTaskStatus = OS_TASK_STATUS_UNUSED;
         g_pstTaskCBArray[uwIndex].uwTaskID = uwIndex;
@@ -465,23 +528,23 @@ LITE_OS_SEC_TEXT_INIT UINT32 osTaskInit(VOID)
     g_stLosTask.pstRunTask->usTaskStatus = (OS_TASK_STATUS_UNUSED | OS_TASK_STATUS_RUNNING);
     g_stLosTask.pstRunTask->usPriority = OS_TASK_PRIORITY_LOWEST + 1;
     osPriqueueInit();
-    uwSize = sizeof(LOS_DL_LIST) * OS_TSK_SORTLINK_LEN;
-    pstListObject = (LOS_DL_LIST *)LOS_MemAlloc(m_aucSysMem0, uwSize);
-    if (NULL == pstListObject)
+    if (LOS_OK != osSortLinkInit(&g_stTskSortLink))
     {
         return LOS_ERRNO_TSK_NO_MEMORY;
     }
-
-    (VOID)memset((VOID *)pstListObject, 0, uwSize);
-    g_stTskSortLink.pstSortLink = pstListObject;
-    g_stTskSortLink.usCursor = 0;
-    for (uwIndex = 0; uwIndex < OS_TSK_SORTLINK_LEN; uwIndex++, pstListObject++)
+#if (LOSCFG_BASE_CORE_TSK_PERIODIC == YES)
+    if (LOS_OK != osSortLinkInit(&g_stTskPeriodSortLink))
     {
-        LOS_ListInit(pstListObject);
+        return LOS_ERRNO_TSK_NO_MEMORY;
     }
+#endif
 
 #if (LOSCFG_PLATFORM_EXC == YES)
     osExcRegister((EXC_INFO_TYPE)OS_EXC_TYPE_TSK, (EXC_INFO_SAVE_CALLBACK)LOS_TaskInfoGet, &g_uwTskMaxNum);
+#endif
+#if (LOSCFG_BASE_CORE_TSK_STACK_GUARD == YES)
+    /* osTaskMonInit replaces it with osTaskSwitchCheck, which moves the guard as well */
+    g_pfnTskSwitchHook = osTaskStackGuardSwitch;
 #endif
     return LOS_OK;
 }
@@ -626,6 +689,20 @@ LITE_OS_SEC_TEXT_INIT UINT32 osTaskSelfDelete(UINT32 uwTaskID, UINTPTR uvIntSave
     return LOS_OK;
 }
 
+#if (LOSCFG_BASE_CORE_TSK_STACK_GUARD == YES)
+/*****************************************************************************
+ Function : osTaskStackGuardSwitch
+ Description : Move the stack guard below the stack of the task switched in
+ Input       : None
+ Output      : None
+ Return      : None
+ *****************************************************************************/
+LITE_OS_SEC_TEXT VOID osTaskStackGuardSwitch(VOID)
+{
+    osMpuStackGuardSet(g_stLosTask.pstNewTask->uwTopOfStack - OS_TASK_STACK_GUARD_SIZE);
+}
+#endif
+
 /*****************************************************************************
  Function : osTaskSwitchCheck
  Description : Check task switch
@@ -636,6 +713,10 @@ LITE_OS_SEC_TEXT_INIT UINT32 osTaskSelfDelete(UINT32 uwTaskID, UINTPTR uvIntSave
 #if (LOSCFG_BASE_CORE_TSK_MONITOR == YES)
 LITE_OS_SEC_TEXT VOID osTaskSwitchCheck(VOID)
 {
+#if (LOSCFG_BASE_CORE_TSK_STACK_GUARD == YES)
+    /* an overflow faults on the guard, the stack checks are not needed */
+    osTaskStackGuardSwitch();
+#else
     if ((*(UINT32 *)(g_stLosTask.pstRunTask->uwTopOfStack)) != OS_TASK_MAGIC_WORD)
     {
         PRINT_ERR("CURRENT task ID: %s:%d stack overflow!\n", g_stLosTask.pstRunTask->pcTaskName, g_stLosTask.pstRunTask->uwTaskID);
@@ -646,6 +727,7 @@ LITE_OS_SEC_TEXT VOID osTaskSwitchCheck(VOID)
         PRINT_ERR("HIGHEST task ID: %s:%d SP error!\n", g_stLosTask.pstNewTask->pcTaskName, g_stLosTask.pstNewTask->uwTaskID);
         PRINT_ERR("HIGHEST task StackPointer: 0x%x TopOfStack: 0x%x\n", (UINT32)(g_stLosTask.pstNewTask->pStackPointer), g_stLosTask.pstNewTask->uwTopOfStack);
     }
+#endif
 
 #if (LOSCFG_BASE_CORE_EXC_TSK_SWITCH == YES)
     /* record task switch info */
@@ -668,6 +750,8 @@ LITE_OS_SEC_TEXT VOID osTaskSwitchCheck(VOID)
 #if (LOSCFG_BASE_CORE_CPUP == YES)
     osTskCycleEndStart();
 #endif /* LOSCFG_BASE_CORE_CPUP */
+
+    OS_TRACE(LOS_TRACE_TASK_SWITCH, g_stLosTask.pstRunTask->uwTaskID, g_stLosTask.pstNewTask->uwTaskID);
 }
 
 LITE_OS_SEC_TEXT_MINOR VOID osTaskMonInit(VOID)
@@ -709,13 +793,14 @@ LITE_OS_SEC_TEXT_INIT VOID osTaskEntry(UINT32 uwTaskID)
 }
 
 /*****************************************************************************
- Function : LOS_TaskCreateOnly
+ Function : osTaskCreateOnly
  Description : Create a task and suspend
  Input       : pstInitParam --- Task init parameters
+               pStackMem    --- Stack provided by the caller, NULL to allocate it from the system heap
  Output      : puwTaskID    --- Save task ID
  Return      : LOS_OK on success or error code on failure
  *****************************************************************************/
-LITE_OS_SEC_TEXT_INIT UINT32 LOS_TaskCreateOnly(UINT32 *puwTaskID, TSK_INIT_PARAM_S *pstInitParam)
+LITE_OS_SEC_TEXT_INIT static UINT32 osTaskCreateOnly(UINT32 *puwTaskID, TSK_INIT_PARAM_S *pstInitParam, VOID *pStackMem)
 {
     UINT32 uwTaskID = 0;
     UINTPTR uvIntSave;
@@ -723,6 +808,9 @@ LITE_OS_SEC_TEXT_INIT UINT32 LOS_TaskCreateOnly(UINT32 *puwTaskID, TSK_INIT_PARA
     VOID  *pStackPtr;
     LOS_TASK_CB *pstTaskCB;
     UINT32 uwErrRet = OS_ERROR;
+#if (LOSCFG_BASE_CORE_TSK_STACK_GUARD == YES)
+    UINT32 uwGuard;
+#endif
 
     if (NULL == puwTaskID)
     {
@@ -755,16 +843,41 @@ LITE_OS_SEC_TEXT_INIT UINT32 LOS_TaskCreateOnly(UINT32 *puwTaskID, TSK_INIT_PARA
         return LOS_ERRNO_TSK_PRIOR_ERROR;
     }
 
-    if (pstInitParam->uwStackSize > OS_SYS_MEM_SIZE)
+    if (pStackMem != NULL)
+    {
+        /* the caller's buffer can be neither grown nor moved */
+        if ((((UINT32)pStackMem | pstInitParam->uwStackSize) & 7) != 0)
+        {
+            return LOS_ERRNO_TSK_STKSZ_NOT_ALIGN;
+        }
+    }
+    else
     {
-        return LOS_ERRNO_TSK_STKSZ_TOO_LARGE;
+        if (pstInitParam->uwStackSize > OS_SYS_MEM_SIZE)
+        {
+            return LOS_ERRNO_TSK_STKSZ_TOO_LARGE;
+        }
+
+        if (0 == pstInitParam->uwStackSize)
+        {
+            pstInitParam->uwStackSize = LOSCFG_BASE_CORE_TSK_DEFAULT_STACK_SIZE;
+        }
+        pstInitParam->uwStackSize = ALIGN(pstInitParam->uwStackSize , 8);
     }
 
-    if (0 == pstInitParam->uwStackSize)
+#if (LOSCFG_BASE_CORE_TSK_STACK_GUARD == YES)
+    if (pStackMem != NULL)
     {
-        pstInitParam->uwStackSize = LOSCFG_BASE_CORE_TSK_DEFAULT_STACK_SIZE;
+        /* the guard takes the first aligned bytes of the caller's buffer */
+        uwGuard = ALIGN((UINT32)pStackMem, OS_TASK_STACK_GUARD_SIZE) + OS_TASK_STACK_GUARD_SIZE - (UINT32)pStackMem;
+        if (uwGuard >= pstInitParam->uwStackSize)
+        {
+            return LOS_ERRNO_TSK_STKSZ_TOO_SMALL;
+        }
+        pstInitParam->uwStackSize -= uwGuard;
+        pStackMem = (VOID *)((UINT32)pStackMem + uwGuard);
     }
-    pstInitParam->uwStackSize = ALIGN(pstInitParam->uwStackSize , 8);
+#endif
 
     if (pstInitParam->uwStackSize < LOS_TASK_MIN_STACK_SIZE)
     {
@@ -777,7 +890,10 @@ LITE_OS_SEC_TEXT_INIT UINT32 LOS_TaskCreateOnly(UINT32 *puwTaskID, TSK_INIT_PARA
         pstTaskCB = OS_TCB_FROM_PENDLIST(LOS_DL_LIST_FIRST(&g_stTskRecyleList)); /*lint !e413*/
         LOS_ListDelete(LOS_DL_LIST_FIRST(&g_stTskRecyleList));
         LOS_ListAdd(&g_stLosFreeTask, &pstTaskCB->stPendList);
-        (VOID)LOS_MemFree(m_aucSysMem0, (VOID *)pstTaskCB->uwTopOfStack);
+        if (!pstTaskCB->usStaticStack)
+        {
+            (VOID)LOS_MemFree(m_aucSysMem0, (VOID *)(pstTaskCB->uwTopOfStack - OS_TASK_STACK_GUARD_SIZE));
+        }
         pstTaskCB->uwTopOfStack = (UINT32)NULL;
     }
 
@@ -792,7 +908,20 @@ LITE_OS_SEC_TEXT_INIT UINT32 LOS_TaskCreateOnly(UINT32 *puwTaskID, TSK_INIT_PARA
     (VOID)LOS_IntRestore(uvIntSave);
     uwTaskID = pstTaskCB->uwTaskID;
 
-    pTopStack = (VOID *)LOS_MemAllocAlign(m_aucSysMem0, pstInitParam->uwStackSize, 8);
+    pTopStack = pStackMem;
+    if (NULL == pTopStack)
+    {
+#if (LOSCFG_BASE_CORE_TSK_STACK_GUARD == YES)
+        pTopStack = (VOID *)LOS_MemAllocAlign(m_aucSysMem0, pstInitParam->uwStackSize + OS_TASK_STACK_GUARD_SIZE,
+                                              OS_TASK_STACK_GUARD_SIZE);
+        if (pTopStack != NULL)
+        {
+            pTopStack = (VOID *)((UINT32)pTopStack + OS_TASK_STACK_GUARD_SIZE);
+        }
+#else
+        pTopStack = (VOID *)LOS_MemAllocAlign(m_aucSysMem0, pstInitParam->uwStackSize, 8);
+#endif
+    }
 
     if (NULL == pTopStack)
     {
@@ -807,15 +936,26 @@ LITE_OS_SEC_TEXT_INIT UINT32 LOS_TaskCreateOnly(UINT32 *puwTaskID, TSK_INIT_PARA
     pstTaskCB->uwArg             = pstInitParam->uwArg;
     pstTaskCB->uwTopOfStack      = (UINT32)pTopStack;
     pstTaskCB->uwStackSize       = pstInitParam->uwStackSize;
+    pstTaskCB->usStaticStack     = (pStackMem != NULL);
     pstTaskCB->pTaskSem          = NULL;
     pstTaskCB->pTaskMux          = NULL;
+    LOS_ListInit(&pstTaskCB->stHeldMuxList);
     pstTaskCB->usTaskStatus      = OS_TASK_STATUS_SUSPEND;
     pstTaskCB->usPriority        = pstInitParam->usTaskPrio;
+    pstTaskCB->usBasePriority    = pstInitParam->usTaskPrio;
     pstTaskCB->pfnTaskEntry      = pstInitParam->pfnTaskEntry;
     pstTaskCB->uwEvent.uwEventID = 0xFFFFFFFF;
     pstTaskCB->uwEventMask       = 0;
+    pstTaskCB->uwNotifyValue     = 0;
+#if (LOSCFG_BASE_IPC_MULTIWAIT == YES)
+    pstTaskCB->pMultiWait        = NULL;
+    pstTaskCB->uwMultiWaitCount  = 0;
+#endif
     pstTaskCB->pcTaskName        = pstInitParam->pcName;
     pstTaskCB->puwMsg = NULL;
+#if (LOSCFG_BASE_CORE_TSK_PERIODIC == YES)
+    (VOID)memset((VOID *)&pstTaskCB->stPeriod, 0, sizeof(OS_TASK_PERIOD_S));
+#endif
 
     *puwTaskID = uwTaskID;
     return LOS_OK;
@@ -825,21 +965,51 @@ LOS_ERREND:
     return uwErrRet;
 }
 
+/*****************************************************************************
+ Function : LOS_TaskCreateOnly
+ Description : Create a task and suspend
+ Input       : pstInitParam --- Task init parameters
+ Output      : puwTaskID    --- Save task ID
+ Return      : LOS_OK on success or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_INIT UINT32 LOS_TaskCreateOnly(UINT32 *puwTaskID, TSK_INIT_PARAM_S *pstInitParam)
+{
+    return osTaskCreateOnly(puwTaskID, pstInitParam, NULL);
+}
+
+/*****************************************************************************
+ Function : LOS_TaskCreateOnlyStatic
+ Description : Create a task on a stack provided by the caller and suspend
+ Input       : pstInitParam --- Task init parameters, uwStackSize is the size of pStackMem
+               pStackMem    --- Task stack, 8 bytes aligned
+ Output      : puwTaskID    --- Save task ID
+ Return      : LOS_OK on success or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_INIT UINT32 LOS_TaskCreateOnlyStatic(UINT32 *puwTaskID, TSK_INIT_PARAM_S *pstInitParam, VOID *pStackMem)
+{
+    if (NULL == pStackMem)
+    {
+        return LOS_ERRNO_TSK_PTR_NULL;
+    }
+
+    return osTaskCreateOnly(puwTaskID, pstInitParam, pStackMem);
+}
 
 /*****************************************************************************
- Function : LOS_TaskCreate
+ Function : osTaskCreate
  Description : Create a task
  Input       : pstInitParam --- Task init parameters
+               pStackMem    --- Stack provided by the caller, NULL to allocate it from the system heap
  Output      : puwTaskID    --- Save task ID
  Return      : LOS_OK on success or error code on failure
  *****************************************************************************/
-LITE_OS_SEC_TEXT_INIT UINT32 LOS_TaskCreate(UINT32 *puwTaskID, TSK_INIT_PARAM_S *pstInitParam)
+LITE_OS_SEC_TEXT_INIT static UINT32 osTaskCreate(UINT32 *puwTaskID, TSK_INIT_PARAM_S *pstInitParam, VOID *pStackMem)
 {
     UINT32 uwRet = LOS_OK;
     UINTPTR uvIntSave;
     LOS_TASK_CB *pstTaskCB;
 
-    uwRet = LOS_TaskCreateOnly(puwTaskID, pstInitParam);
+    uwRet = osTaskCreateOnly(puwTaskID, pstInitParam, pStackMem);
     if (LOS_OK != uwRet)
     {
         return uwRet;
@@ -875,6 +1045,36 @@ LITE_OS_SEC_TEXT_INIT UINT32 LOS_TaskCreate(UINT32 *puwTaskID, TSK_INIT_PARAM_S
     return LOS_OK;
 }
 
+/*****************************************************************************
+ Function : LOS_TaskCreate
+ Description : Create a task
+ Input       : pstInitParam --- Task init parameters
+ Output      : puwTaskID    --- Save task ID
+ Return      : LOS_OK on success or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_INIT UINT32 LOS_TaskCreate(UINT32 *puwTaskID, TSK_INIT_PARAM_S *pstInitParam)
+{
+    return osTaskCreate(puwTaskID, pstInitParam, NULL);
+}
+
+/*****************************************************************************
+ Function : LOS_TaskCreateStatic
+ Description : Create a task on a stack provided by the caller
+ Input       : pstInitParam --- Task init parameters, uwStackSize is the size of pStackMem
+               pStackMem    --- Task stack, 8 bytes aligned
+ Output      : puwTaskID    --- Save task ID
+ Return      : LOS_OK on success or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_INIT UINT32 LOS_TaskCreateStatic(UINT32 *puwTaskID, TSK_INIT_PARAM_S *pstInitParam, VOID *pStackMem)
+{
+    if (NULL == pStackMem)
+    {
+        return LOS_ERRNO_TSK_PTR_NULL;
+    }
+
+    return osTaskCreate(puwTaskID, pstInitParam, pStackMem);
+}
+
 /*****************************************************************************
  Function : LOS_TaskResume
  Description : Resume suspend task
@@ -889,7 +1089,9 @@ LITE_OS_SEC_TEXT_INIT UINT32 LOS_TaskResume(UINT32 uwTaskID)
     UINT16 usTempStatus;
     UINT32 uwErrRet = OS_ERROR;
 
-    if (uwTaskID > LOSCFG_BASE_CORE_TSK_LIMIT)
+    OS_INT_PRIO_CHECK();
+
+    if (OS_TSK_GET_INDEX(uwTaskID) >= g_uwTskMaxNum)
     {
         return LOS_ERRNO_TSK_ID_INVALID;
     }
@@ -945,6 +1147,8 @@ LITE_OS_SEC_TEXT_INIT UINT32 LOS_TaskSuspend(UINT32 uwTaskID)
     UINT16 usTempStatus;
     UINT32 uwErrRet = OS_ERROR;
 
+    OS_INT_PRIO_CHECK();
+
     CHECK_TASKID(uwTaskID);
     pstTaskCB = OS_TCB_FROM_TID(uwTaskID);
     uvIntSave = LOS_IntLock();
@@ -1031,13 +1235,34 @@ LITE_OS_SEC_TEXT_INIT UINT32 LOS_TaskDelete(UINT32 uwTaskID)
     else if ((OS_TASK_STATUS_PEND & usTempStatus) || (OS_TASK_STATUS_PEND_QUEUE & usTempStatus))
     {
         LOS_ListDelete(&pstTaskCB->stPendList);
+#if (LOSCFG_BASE_IPC_MUX == YES)
+        if ((OS_TASK_STATUS_PEND & usTempStatus) && (pstTaskCB->pTaskMux != NULL))
+        {
+            osMuxPriUpdate(((MUX_CB_S *)pstTaskCB->pTaskMux)->pstOwner);
+            pstTaskCB->pTaskMux = NULL;
+        }
+#endif
+    }
+#if (LOSCFG_BASE_IPC_MULTIWAIT == YES)
+    else if (OS_TASK_STATUS_PEND_MULTI & usTempStatus)
+    {
+        osMultiWaitUnlink(pstTaskCB);
     }
+#endif
 
     if ((OS_TASK_STATUS_DELAY | OS_TASK_STATUS_TIMEOUT) & usTempStatus)
     {
         osTimerListDelete(pstTaskCB);
     }
 
+#if (LOSCFG_BASE_CORE_TSK_PERIODIC == YES)
+    if (pstTaskCB->stPeriod.bDeadlineArmed)
+    {
+        osSortLinkDelete(&pstTaskCB->stPeriod.stDeadline);
+        pstTaskCB->stPeriod.bDeadlineArmed = FALSE;
+    }
+#endif
+
     pstTaskCB->usTaskStatus &= (~(OS_TASK_STATUS_SUSPEND));
     pstTaskCB->usTaskStatus |= OS_TASK_STATUS_UNUSED;
     pstTaskCB->uwEvent.uwEventID = 0xFFFFFFFF;
@@ -1063,7 +1288,10 @@ LITE_OS_SEC_TEXT_INIT UINT32 LOS_TaskDelete(UINT32 uwTaskID)
     {
         pstTaskCB->usTaskStatus = OS_TASK_STATUS_UNUSED;
         LOS_ListAdd(&g_stLosFreeTask, &pstTaskCB->stPendList);
-        (VOID)LOS_MemFree(m_aucSysMem0, (VOID *)pstTaskCB->uwTopOfStack);
+        if (!pstTaskCB->usStaticStack)
+        {
+            (VOID)LOS_MemFree(m_aucSysMem0, (VOID *)(pstTaskCB->uwTopOfStack - OS_TASK_STACK_GUARD_SIZE));
+        }
         pstTaskCB->uwTopOfStack = (UINT32)NULL;
     }
 
@@ -1114,6 +1342,66 @@ LITE_OS_SEC_TEXT UINT32 LOS_TaskDelay(UINT32 uwTick)
     return LOS_OK;
 }
 
+/*****************************************************************************
+ Function : osTaskSleepUntil
+ Description : Delay the current task until the tick count reaches ullTick, with
+               the interrupts locked
+ Input       : ullTick --- tick count to wake up at
+ Output      : None
+ Return      : TRUE if the task is delayed, FALSE if ullTick has been reached
+ *****************************************************************************/
+LITE_OS_SEC_TEXT static BOOL osTaskSleepUntil(UINT64 ullTick)
+{
+    LOS_TASK_CB *pstRunTsk = g_stLosTask.pstRunTask;
+    UINT64 ullTicks;
+
+    if (ullTick <= g_ullTickCount)
+    {
+        return FALSE;
+    }
+
+    /* the timing wheel moves with g_ullTickCount, a longer delay is resumed by the caller */
+    ullTicks = ullTick - g_ullTickCount;
+    osPriqueueDequeue(&pstRunTsk->stPendList);
+    pstRunTsk->usTaskStatus &= (~OS_TASK_STATUS_READY);
+    osTaskAdd2TimerList(pstRunTsk, (ullTicks > OS_NULL_INT) ? OS_NULL_INT : (UINT32)ullTicks);
+    pstRunTsk->usTaskStatus |= OS_TASK_STATUS_DELAY;
+    return TRUE;
+}
+
+/*****************************************************************************
+ Function : LOS_TaskDelayUntil
+ Description : delay the current task until a tick count
+ Input       : ullTick --- tick count to wake up at
+ Output      : None
+ Return      : LOS_OK on success or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT UINT32 LOS_TaskDelayUntil(UINT64 ullTick)
+{
+    UINTPTR uvIntSave;
+
+    if (OS_INT_ACTIVE)
+    {
+        return LOS_ERRNO_TSK_DELAY_IN_INT;
+    }
+
+    if (g_usLosTaskLock != 0)
+    {
+        return LOS_ERRNO_TSK_DELAY_IN_LOCK;
+    }
+
+    uvIntSave = LOS_IntLock();
+    while (osTaskSleepUntil(ullTick))
+    {
+        (VOID)LOS_IntRestore(uvIntSave);
+        LOS_Schedule();
+        uvIntSave = LOS_IntLock();
+    }
+    (VOID)LOS_IntRestore(uvIntSave);
+
+    return LOS_OK;
+}
+
 /*****************************************************************************
  Function : LOS_TaskPriGet
  Description : Get the priority of the task
@@ -1187,18 +1475,13 @@ LITE_OS_SEC_TEXT_MINOR UINT32 LOS_TaskPriSet(UINT32 uwTaskID, UINT16 usTaskPrio)
     }
     /* delete the task and insert with right priority into ready queue */
     bIsReady = (OS_TASK_STATUS_READY & usTempStatus);
-    if (bIsReady)
-    {
-        osPriqueueDequeue(&pstTaskCB->stPendList);
-        pstTaskCB->usTaskStatus &= (~OS_TASK_STATUS_READY);
-        pstTaskCB->usPriority = usTaskPrio;
-        pstTaskCB->usTaskStatus |= OS_TASK_STATUS_READY;
-        osPriqueueEnqueue(&pstTaskCB->stPendList, pstTaskCB->usPriority);
-    }
-    else
-    {
-        pstTaskCB->usPriority = usTaskPrio;
-    }
+    pstTaskCB->usBasePriority = usTaskPrio;
+#if (LOSCFG_BASE_IPC_MUX == YES)
+    /* keep any inherited priority, and pass the change on to the owner we wait for */
+    osMuxPriUpdate(pstTaskCB);
+#else
+    osTaskPriModify(pstTaskCB, usTaskPrio);
+#endif
 
     (VOID)LOS_IntRestore(uvIntSave);
     /* delete the task and insert with right priority into ready queue */
@@ -1229,20 +1512,20 @@ LITE_OS_SEC_TEXT_MINOR UINT32 LOS_CurTaskPriSet(UINT16 usTaskPrio)
  Description : pend a task in pstList
  Input       : pstList
                uwTimeOut -- Expiry time
+               uwPendOrder -- LOS_PEND_FIFO or LOS_PEND_PRIO
  Output      : none
  Return      : LOS_OK on success or LOS_NOK on failure
 **************************************************************************/
-VOID osTaskWait(LOS_DL_LIST *pstList, UINT32 uwTaskStatus, UINT32 uwTimeOut)
+VOID osTaskWait(LOS_DL_LIST *pstList, UINT32 uwTaskStatus, UINT32 uwTimeOut, UINT32 uwPendOrder)
 {
     LOS_TASK_CB *pstRunTsk;
-    LOS_DL_LIST *pstPendObj;
 
     pstRunTsk = g_stLosTask.pstRunTask;
     osPriqueueDequeue(&pstRunTsk->stPendList);
     pstRunTsk->usTaskStatus &= (~OS_TASK_STATUS_READY);
-    pstPendObj = &pstRunTsk->stPendList;
     pstRunTsk->usTaskStatus |= uwTaskStatus;
-    LOS_ListTailInsert(pstList,pstPendObj);
+    pstRunTsk->pstPendHead = (LOS_PEND_PRIO == uwPendOrder) ? pstList : (LOS_DL_LIST *)NULL;
+    osTaskPendInsert(pstList, pstRunTsk);
     if (uwTimeOut != LOS_WAIT_FOREVER)
     {
         pstRunTsk->usTaskStatus |= OS_TASK_STATUS_TIMEOUT;
@@ -1273,24 +1556,803 @@ VOID osTaskWake(LOS_TASK_CB *pstResumedTask, UINT32 uwTaskStatus)
     }
 }
 
-/*****************************************************************************
- Function : LOS_TaskYield
- Description : Adjust the procedure order of specified task
- Input       : usTaskPrio
-               uwNextTask
- Output      : None
- Return      : LOS_OK on success or error code on failure
- *****************************************************************************/
-LITE_OS_SEC_TEXT_MINOR UINT32 LOS_TaskYield(VOID)
+/**************************************************************************
+ Function    : osTaskPendOrderSet
+ Description : change the order of pstList, the tasks pended are reordered
+ Input       : pstList
+               uwPendOrder -- LOS_PEND_FIFO or LOS_PEND_PRIO
+ Output      : none
+ Return      : none
+**************************************************************************/
+VOID osTaskPendOrderSet(LOS_DL_LIST *pstList, UINT32 uwPendOrder)
 {
-    UINT32 uwTskCount = 0;
-    UINTPTR uvIntSave;
+    LOS_DL_LIST stPended;
+    LOS_TASK_CB *pstTaskCB;
 
-    if(g_stLosTask.pstRunTask->uwTaskID >= g_uwTskMaxNum)
+    if (LOS_ListEmpty(pstList))
     {
-        return LOS_ERRNO_TSK_ID_INVALID;
+        return;
     }
-    if(!(g_stLosTask.pstRunTask->usTaskStatus & OS_TASK_STATUS_READY))
+
+    /* take the tasks out in their current order and insert them again */
+    stPended.pstNext = pstList->pstNext;
+    stPended.pstPrev = pstList->pstPrev;
+    stPended.pstNext->pstPrev = &stPended;
+    stPended.pstPrev->pstNext = &stPended;
+    LOS_ListInit(pstList);
+
+    while (!LOS_ListEmpty(&stPended))
+    {
+        pstTaskCB = OS_TCB_FROM_PENDLIST(LOS_DL_LIST_FIRST(&stPended)); /*lint !e413*/
+        LOS_ListDelete(&pstTaskCB->stPendList);
+        pstTaskCB->pstPendHead = (LOS_PEND_PRIO == uwPendOrder) ? pstList : (LOS_DL_LIST *)NULL;
+        osTaskPendInsert(pstList, pstTaskCB);
+    }
+}
+
+/**************************************************************************
+ Function    : osTaskBlock
+ Description : block the running task without linking it into a pend list
+ Input       : uwTaskStatus -- blocked status
+               uwTimeOut -- Expiry time
+ Output      : none
+ Return      : none
+**************************************************************************/
+VOID osTaskBlock(UINT32 uwTaskStatus, UINT32 uwTimeOut)
+{
+    LOS_TASK_CB *pstRunTsk = g_stLosTask.pstRunTask;
+
+    osPriqueueDequeue(&pstRunTsk->stPendList);
+    pstRunTsk->usTaskStatus &= (~OS_TASK_STATUS_READY);
+    pstRunTsk->usTaskStatus |= uwTaskStatus;
+    if (uwTimeOut != LOS_WAIT_FOREVER)
+    {
+        pstRunTsk->usTaskStatus |= OS_TASK_STATUS_TIMEOUT;
+        osTaskAdd2TimerList(pstRunTsk, uwTimeOut);
+    }
+}
+
+/**************************************************************************
+ Function    : osTaskUnblock
+ Description : make a task blocked by osTaskBlock ready again
+ Input       : pstTaskCB --> blocked task
+               uwTaskStatus -- blocked status
+ Output      : none
+ Return      : none
+**************************************************************************/
+VOID osTaskUnblock(LOS_TASK_CB *pstTaskCB, UINT32 uwTaskStatus)
+{
+    pstTaskCB->usTaskStatus &= (~uwTaskStatus);
+    if (pstTaskCB->usTaskStatus & OS_TASK_STATUS_TIMEOUT)
+    {
+        osTimerListDelete(pstTaskCB);
+        pstTaskCB->usTaskStatus &= (~OS_TASK_STATUS_TIMEOUT);
+    }
+    if (!(pstTaskCB->usTaskStatus & OS_TASK_STATUS_SUSPEND))
+    {
+        pstTaskCB->usTaskStatus |= OS_TASK_STATUS_READY;
+        osPriqueueEnqueue(&pstTaskCB->stPendList, pstTaskCB->usPriority);
+    }
+}
+
+/*****************************************************************************
+ Function : osTaskNotifyMatch
+ Description : Check whether the notification value satisfies the wait condition
+               the task stored in uwEventMask and uwEventMode.
+ Input       : pstTaskCB --- task control block
+ Output      : None
+ Return      : TRUE if the wait condition is satisfied
+ *****************************************************************************/
+LITE_OS_SEC_TEXT static BOOL osTaskNotifyMatch(LOS_TASK_CB *pstTaskCB)
+{
+    UINT32 uwBits = pstTaskCB->uwNotifyValue & pstTaskCB->uwEventMask;
+
+    if (pstTaskCB->uwEventMode & LOS_WAITMODE_AND)
+    {
+        return (BOOL)(uwBits == pstTaskCB->uwEventMask);
+    }
+
+    return (BOOL)(uwBits != 0);
+}
+
+/*****************************************************************************
+ Function : osTaskNotifyPend
+ Description : Block the running task until its notification value satisfies
+               the wait condition, called with interrupts locked.
+ Input       : uwBits    --- bits to wait for
+               uwMode    --- LOS_WAITMODE_AND or LOS_WAITMODE_OR
+               uwTimeOut --- timeout in ticks
+               puvIntSave --- interrupt state, interrupts are locked again on return
+ Output      : None
+ Return      : LOS_OK on success or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT static UINT32 osTaskNotifyPend(UINT32 uwBits, UINT32 uwMode, UINT32 uwTimeOut, UINTPTR *puvIntSave)
+{
+    LOS_TASK_CB *pstRunTsk = g_stLosTask.pstRunTask;
+
+    pstRunTsk->uwEventMask = uwBits;
+    pstRunTsk->uwEventMode = uwMode;
+    if (osTaskNotifyMatch(pstRunTsk))
+    {
+        return LOS_OK;
+    }
+
+    if (uwTimeOut == 0)
+    {
+        return LOS_ERRNO_TSK_NOTIFY_UNAVAILABLE;
+    }
+
+    if (g_usLosTaskLock)
+    {
+        return LOS_ERRNO_TSK_NOTIFY_IN_LOCK;
+    }
+
+    /* not on any pend list, the notifier finds the task by its ID */
+    osTaskBlock(OS_TASK_STATUS_EVENT, uwTimeOut);
+    OS_TRACE(LOS_TRACE_NOTIFY_WAIT, pstRunTsk->uwTaskID, uwBits);
+    (VOID)LOS_IntRestore(*puvIntSave);
+    LOS_Schedule();
+
+    *puvIntSave = LOS_IntLock();
+    if (pstRunTsk->usTaskStatus & OS_TASK_STATUS_TIMEOUT)
+    {
+        pstRunTsk->usTaskStatus &= (~OS_TASK_STATUS_TIMEOUT);
+        return LOS_ERRNO_TSK_NOTIFY_TIMEOUT;
+    }
+
+    return LOS_OK;
+}
+
+/*****************************************************************************
+ Function : LOS_TaskNotify
+ Description : Update the notification value of a task and wake it up if its
+               wait condition is satisfied
+ Input       : uwTaskID     --- Task ID
+               uwValue      --- value applied by uwAction
+               uwAction     --- LOS_NOTIFY_SET_BITS, LOS_NOTIFY_INCREMENT or LOS_NOTIFY_OVERWRITE
+ Output      : puwPrevValue --- value before the update, may be NULL
+ Return      : LOS_OK on success or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT UINT32 LOS_TaskNotify(UINT32 uwTaskID, UINT32 uwValue, UINT32 uwAction, UINT32 *puwPrevValue)
+{
+    UINTPTR uvIntSave;
+    LOS_TASK_CB *pstTaskCB;
+
+    OS_INT_PRIO_CHECK();
+
+    if (OS_TSK_GET_INDEX(uwTaskID) >= g_uwTskMaxNum)
+    {
+        return LOS_ERRNO_TSK_ID_INVALID;
+    }
+
+    if (uwAction > LOS_NOTIFY_OVERWRITE)
+    {
+        return LOS_ERRNO_TSK_NOTIFY_ACTION_INVALID;
+    }
+
+    pstTaskCB = OS_TCB_FROM_TID(uwTaskID);
+    uvIntSave = LOS_IntLock();
+    if (pstTaskCB->usTaskStatus & OS_TASK_STATUS_UNUSED)
+    {
+        (VOID)LOS_IntRestore(uvIntSave);
+        return LOS_ERRNO_TSK_NOT_CREATED;
+    }
+
+    if (puwPrevValue != NULL)
+    {
+        *puwPrevValue = pstTaskCB->uwNotifyValue;
+    }
+
+    if (uwAction == LOS_NOTIFY_SET_BITS)
+    {
+        pstTaskCB->uwNotifyValue |= uwValue;
+    }
+    else if (uwAction == LOS_NOTIFY_INCREMENT)
+    {
+        pstTaskCB->uwNotifyValue++;
+    }
+    else
+    {
+        pstTaskCB->uwNotifyValue = uwValue;
+    }
+    OS_TRACE(LOS_TRACE_NOTIFY, uwTaskID, pstTaskCB->uwNotifyValue);
+
+    if ((pstTaskCB->usTaskStatus & OS_TASK_STATUS_EVENT) && osTaskNotifyMatch(pstTaskCB))
+    {
+        osTaskUnblock(pstTaskCB, OS_TASK_STATUS_EVENT);
+        (VOID)LOS_IntRestore(uvIntSave);
+        LOS_Schedule();
+        return LOS_OK;
+    }
+
+    (VOID)LOS_IntRestore(uvIntSave);
+    return LOS_OK;
+}
+
+/*****************************************************************************
+ Function : LOS_TaskNotifyWait
+ Description : Wait for any or all of uwBits in the notification value of the current task
+ Input       : uwBits    --- bits to wait for
+               uwMode    --- LOS_WAITMODE_AND or LOS_WAITMODE_OR, optionally with LOS_WAITMODE_CLR
+               uwTimeOut --- timeout in ticks
+ Output      : puwValue  --- value before the bits are cleared, may be NULL
+ Return      : LOS_OK on success or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT UINT32 LOS_TaskNotifyWait(UINT32 uwBits, UINT32 uwMode, UINT32 uwTimeOut, UINT32 *puwValue)
+{
+    UINTPTR uvIntSave;
+    UINT32 uwRet;
+    LOS_TASK_CB *pstRunTsk;
+
+    OS_INT_PRIO_CHECK();
+
+    if ((uwBits == 0) ||
+        ((uwMode & LOS_WAITMODE_OR) && (uwMode & LOS_WAITMODE_AND)) ||
+        (uwMode & ~(LOS_WAITMODE_OR | LOS_WAITMODE_AND | LOS_WAITMODE_CLR)) ||
+        !(uwMode & (LOS_WAITMODE_OR | LOS_WAITMODE_AND)))
+    {
+        return LOS_ERRNO_TSK_NOTIFY_MODE_INVALID;
+    }
+
+    if (OS_INT_ACTIVE)
+    {
+        return LOS_ERRNO_TSK_NOTIFY_IN_INT;
+    }
+
+    uvIntSave = LOS_IntLock();
+    uwRet = osTaskNotifyPend(uwBits, uwMode, uwTimeOut, &uvIntSave);
+    if (uwRet == LOS_OK)
+    {
+        pstRunTsk = g_stLosTask.pstRunTask;
+        if (puwValue != NULL)
+        {
+            *puwValue = pstRunTsk->uwNotifyValue;
+        }
+
+        if (uwMode & LOS_WAITMODE_CLR)
+        {
+            pstRunTsk->uwNotifyValue &= ~uwBits;
+        }
+    }
+
+    (VOID)LOS_IntRestore(uvIntSave);
+    return uwRet;
+}
+
+/*****************************************************************************
+ Function : LOS_TaskNotifyTake
+ Description : Wait for a non-zero notification value of the current task and
+               decrement or clear it
+ Input       : bClear    --- TRUE to clear the value, FALSE to decrement it
+               uwTimeOut --- timeout in ticks
+ Output      : puwValue  --- value before it is taken, may be NULL
+ Return      : LOS_OK on success or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT UINT32 LOS_TaskNotifyTake(BOOL bClear, UINT32 uwTimeOut, UINT32 *puwValue)
+{
+    UINTPTR uvIntSave;
+    UINT32 uwRet;
+    LOS_TASK_CB *pstRunTsk;
+
+    OS_INT_PRIO_CHECK();
+
+    if (OS_INT_ACTIVE)
+    {
+        return LOS_ERRNO_TSK_NOTIFY_IN_INT;
+    }
+
+    uvIntSave = LOS_IntLock();
+    uwRet = osTaskNotifyPend(0xFFFFFFFF, LOS_WAITMODE_OR, uwTimeOut, &uvIntSave);
+    if (uwRet == LOS_OK)
+    {
+        pstRunTsk = g_stLosTask.pstRunTask;
+        if (puwValue != NULL)
+        {
+            *puwValue = pstRunTsk->uwNotifyValue;
+        }
+
+        if (bClear)
+        {
+            pstRunTsk->uwNotifyValue = 0;
+        }
+        else
+        {
+            pstRunTsk->uwNotifyValue--;
+        }
+    }
+
+    (VOID)LOS_IntRestore(uvIntSave);
+    return uwRet;
+}
+
+/*****************************************************************************
+ Function : LOS_TaskNotifyClear
+ Description : Clear bits of the notification value of a task
+ Input       : uwTaskID     --- Task ID
+               uwBits       --- bits to clear, 0 to read the value only
+ Output      : puwPrevValue --- value before the bits are cleared, may be NULL
+ Return      : LOS_OK on success or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT UINT32 LOS_TaskNotifyClear(UINT32 uwTaskID, UINT32 uwBits, UINT32 *puwPrevValue)
+{
+    UINTPTR uvIntSave;
+    LOS_TASK_CB *pstTaskCB;
+
+    OS_INT_PRIO_CHECK();
+
+    if (OS_TSK_GET_INDEX(uwTaskID) >= g_uwTskMaxNum)
+    {
+        return LOS_ERRNO_TSK_ID_INVALID;
+    }
+
+    pstTaskCB = OS_TCB_FROM_TID(uwTaskID);
+    uvIntSave = LOS_IntLock();
+    if (pstTaskCB->usTaskStatus & OS_TASK_STATUS_UNUSED)
+    {
+        (VOID)LOS_IntRestore(uvIntSave);
+        return LOS_ERRNO_TSK_NOT_CREATED;
+    }
+
+    if (puwPrevValue != NULL)
+    {
+        *puwPrevValue = pstTaskCB->uwNotifyValue;
+    }
+    pstTaskCB->uwNotifyValue &= ~uwBits;
+    (VOID)LOS_IntRestore(uvIntSave);
+
+    return LOS_OK;
+}
+
+#if (LOSCFG_BASE_CORE_TSK_PERIODIC == YES)
+/*****************************************************************************
+ Function : osTaskCycleGet
+ Description : Get the cycle count
+ Input       : None
+ Output      : None
+ Return      : cycles since the system started
+ *****************************************************************************/
+LITE_OS_SEC_TEXT static UINT64 osTaskCycleGet(VOID)
+{
+    UINT32 uwHigh;
+    UINT32 uwLow;
+
+    LOS_GetCpuCycle(&uwHigh, &uwLow);
+    return (((UINT64)uwHigh << 32) | uwLow);
+}
+
+/*****************************************************************************
+ Function : osTaskPeriodDisarm
+ Description : Stop the deadline timer of a periodic task, with the interrupts locked
+ Input       : pstPeriod --- release state
+ Output      : None
+ Return      : None
+ *****************************************************************************/
+LITE_OS_SEC_TEXT static VOID osTaskPeriodDisarm(OS_TASK_PERIOD_S *pstPeriod)
+{
+    if (pstPeriod->bDeadlineArmed)
+    {
+        osSortLinkDelete(&pstPeriod->stDeadline);
+        pstPeriod->bDeadlineArmed = FALSE;
+    }
+}
+
+/*****************************************************************************
+ Function : osTaskPeriodArm
+ Description : Start the deadline timer of the next release of a periodic task,
+               with the interrupts locked
+ Input       : pstPeriod --- release state
+ Output      : None
+ Return      : None
+ *****************************************************************************/
+LITE_OS_SEC_TEXT static VOID osTaskPeriodArm(OS_TASK_PERIOD_S *pstPeriod)
+{
+    UINT64 ullDeadline = pstPeriod->ullRelease + pstPeriod->stInfo.uwDeadline;
+    UINT64 ullTicks = 1;
+
+    osTaskPeriodDisarm(pstPeriod);
+    if (ullDeadline > g_ullTickCount)
+    {
+        ullTicks = ullDeadline - g_ullTickCount;
+    }
+
+    /* the wheel moves with g_ullTickCount, so the timer fires in the tick that reaches the deadline */
+    osSortLinkAdd(&g_stTskPeriodSortLink, &pstPeriod->stDeadline, (ullTicks > OS_NULL_INT) ? OS_NULL_INT : (UINT32)ullTicks);
+    pstPeriod->bDeadlineArmed = TRUE;
+    pstPeriod->bMissReported = FALSE;
+}
+
+/*****************************************************************************
+ Function : osTaskPeriodScan
+ Description : Advance the deadline wheel by one tick and report the jobs whose
+               deadline passes before they complete
+ Input       : None
+ Output      : None
+ Return      : None
+ *****************************************************************************/
+LITE_OS_SEC_TEXT VOID osTaskPeriodScan(VOID)
+{
+    LOS_DL_LIST *pstListObject;
+    OS_TASK_PERIOD_S *pstPeriod;
+    LOS_TASK_CB *pstTaskCB;
+    TSK_PERIOD_INFO_S stInfo;
+
+    pstListObject = osSortLinkScan(&g_stTskPeriodSortLink);
+    while (pstListObject->pstNext != pstListObject)
+    {
+        pstPeriod = LOS_DL_LIST_ENTRY(pstListObject->pstNext, OS_TASK_PERIOD_S, stDeadline.stList); /*lint !e413*/
+        pstTaskCB = LOS_DL_LIST_ENTRY(pstPeriod, LOS_TASK_CB, stPeriod); /*lint !e413*/
+
+        osSortLinkDelete(&pstPeriod->stDeadline);
+        pstPeriod->bDeadlineArmed = FALSE;
+        pstPeriod->bMissReported = TRUE;
+        pstPeriod->stInfo.uwMissCount++;
+        if (pstPeriod->pfnOverrun != NULL)
+        {
+            stInfo = pstPeriod->stInfo;
+            pstPeriod->pfnOverrun(pstTaskCB->uwTaskID, &stInfo);
+        }
+    }
+}
+
+/*****************************************************************************
+ Function : osTaskPeriodComplete
+ Description : Account the job a periodic task completes, with the interrupts locked
+ Input       : pstTaskCB --- task control block
+ Output      : None
+ Return      : TRUE if the job missed its deadline
+ *****************************************************************************/
+LITE_OS_SEC_TEXT static BOOL osTaskPeriodComplete(LOS_TASK_CB *pstTaskCB)
+{
+    OS_TASK_PERIOD_S *pstPeriod = &pstTaskCB->stPeriod;
+    TSK_PERIOD_INFO_S *pstInfo = &pstPeriod->stInfo;
+    UINT64 ullCycle;
+    UINT64 ullRelease;
+    UINT64 ullResp = 0;
+    UINT64 ullExec = 0;
+
+    pstPeriod->bJobActive = FALSE;
+    pstInfo->uwJobCount++;
+    osTaskPeriodDisarm(pstPeriod);
+
+    /* the cycle count is g_ullTickCount * g_uwCyclesPerTick when the tick of the release starts */
+    ullCycle = osTaskCycleGet();
+    ullRelease = pstPeriod->ullRelease * g_uwCyclesPerTick;
+    if (ullCycle > ullRelease)
+    {
+        ullResp = ullCycle - ullRelease;
+    }
+
+#if (LOSCFG_BASE_CORE_CPUP == YES)
+    /* the records may have been reset during the job */
+    ullCycle = osCpupTaskCycleGet(pstTaskCB->uwTaskID);
+    ullExec = (ullCycle >= pstPeriod->ullExecStart) ? (ullCycle - pstPeriod->ullExecStart) : ullCycle;
+#endif
+
+    pstInfo->uwRespLast = (ullResp > OS_NULL_INT) ? OS_NULL_INT : (UINT32)ullResp;
+    pstInfo->uwExecLast = (ullExec > OS_NULL_INT) ? OS_NULL_INT : (UINT32)ullExec;
+    if (pstInfo->uwRespLast > pstInfo->uwRespMax)
+    {
+        pstInfo->uwRespMax = pstInfo->uwRespLast;
+    }
+    if (pstInfo->uwExecLast > pstInfo->uwExecMax)
+    {
+        pstInfo->uwExecMax = pstInfo->uwExecLast;
+    }
+
+    /* a job completing between the deadline and the tick that reports it is counted here */
+    if ((ullResp > ((UINT64)pstInfo->uwDeadline * g_uwCyclesPerTick)) && (!pstPeriod->bMissReported))
+    {
+        pstInfo->uwMissCount++;
+        return TRUE;
+    }
+
+    return FALSE;
+}
+
+/*****************************************************************************
+ Function : osTaskPeriodCatchUp
+ Description : Move the next release of a periodic task to the latest release that
+               has passed, with the interrupts locked
+ Input       : pstPeriod --- release state
+ Output      : None
+ Return      : None
+ *****************************************************************************/
+LITE_OS_SEC_TEXT static VOID osTaskPeriodCatchUp(OS_TASK_PERIOD_S *pstPeriod)
+{
+    UINT64 ullSkip;
+
+    if (pstPeriod->ullRelease >= g_ullTickCount)
+    {
+        return;
+    }
+
+    /* drop the older releases instead of running late jobs back to back */
+    ullSkip = (g_ullTickCount - pstPeriod->ullRelease) / pstPeriod->stInfo.uwPeriod;
+    pstPeriod->ullRelease += ullSkip * pstPeriod->stInfo.uwPeriod;
+    pstPeriod->stInfo.uwSkipCount += (UINT32)ullSkip;
+}
+
+/*****************************************************************************
+ Function : LOS_TaskPeriodSet
+ Description : Make a task periodic or aperiodic
+ Input       : uwTaskID --- Task ID
+               pstParam --- period, offset, deadline and overrun function, NULL to clear
+ Output      : None
+ Return      : LOS_OK on success or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_MINOR UINT32 LOS_TaskPeriodSet(UINT32 uwTaskID, TSK_PERIOD_PARAM_S *pstParam)
+{
+    UINTPTR uvIntSave;
+    LOS_TASK_CB *pstTaskCB;
+    OS_TASK_PERIOD_S *pstPeriod;
+
+    if (uwTaskID == g_uwIdleTaskID)
+    {
+        return LOS_ERRNO_TSK_OPERATE_IDLE;
+    }
+
+    if (OS_CHECK_TSK_PID_NOIDLE(uwTaskID))
+    {
+        return LOS_ERRNO_TSK_ID_INVALID;
+    }
+
+    if ((pstParam != NULL) && (0 == pstParam->uwPeriod))
+    {
+        return LOS_ERRNO_TSK_PERIOD_INVALID;
+    }
+
+    pstTaskCB = OS_TCB_FROM_TID(uwTaskID);
+    pstPeriod = &pstTaskCB->stPeriod;
+    uvIntSave = LOS_IntLock();
+    if (OS_TASK_STATUS_UNUSED & pstTaskCB->usTaskStatus)
+    {
+        (VOID)LOS_IntRestore(uvIntSave);
+        return LOS_ERRNO_TSK_NOT_CREATED;
+    }
+
+    osTaskPeriodDisarm(pstPeriod);
+    (VOID)memset((VOID *)pstPeriod, 0, sizeof(OS_TASK_PERIOD_S));
+    if (pstParam != NULL)
+    {
+        pstPeriod->ullRelease = g_ullTickCount + pstParam->uwOffset;
+        pstPeriod->pfnOverrun = pstParam->pfnOverrun;
+        pstPeriod->stInfo.uwPeriod = pstParam->uwPeriod;
+        pstPeriod->stInfo.uwDeadline = (0 == pstParam->uwDeadline) ? pstParam->uwPeriod : pstParam->uwDeadline;
+    }
+    (VOID)LOS_IntRestore(uvIntSave);
+
+    return LOS_OK;
+}
+
+/*****************************************************************************
+ Function : LOS_TaskPeriodWait
+ Description : Complete the current job of the current task and wait for its next release
+ Input       : None
+ Output      : None
+ Return      : LOS_OK on success or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT UINT32 LOS_TaskPeriodWait(VOID)
+{
+    UINTPTR uvIntSave;
+    LOS_TASK_CB *pstRunTsk;
+    OS_TASK_PERIOD_S *pstPeriod;
+    TSK_OVERRUN_FUNC pfnOverrun = (TSK_OVERRUN_FUNC)NULL;
+    TSK_PERIOD_INFO_S stInfo;
+
+    if (OS_INT_ACTIVE)
+    {
+        return LOS_ERRNO_TSK_DELAY_IN_INT;
+    }
+
+    if (g_usLosTaskLock != 0)
+    {
+        return LOS_ERRNO_TSK_DELAY_IN_LOCK;
+    }
+
+    pstRunTsk = g_stLosTask.pstRunTask;
+    pstPeriod = &pstRunTsk->stPeriod;
+    uvIntSave = LOS_IntLock();
+    if (0 == pstPeriod->stInfo.uwPeriod)
+    {
+        (VOID)LOS_IntRestore(uvIntSave);
+        return LOS_ERRNO_TSK_PERIOD_NOT_SET;
+    }
+
+    if (pstPeriod->bJobActive)
+    {
+        if (osTaskPeriodComplete(pstRunTsk))
+        {
+            pfnOverrun = pstPeriod->pfnOverrun;
+            stInfo = pstPeriod->stInfo;
+        }
+        pstPeriod->ullRelease += pstPeriod->stInfo.uwPeriod;
+    }
+    (VOID)LOS_IntRestore(uvIntSave);
+
+    if (pfnOverrun != NULL)
+    {
+        pfnOverrun(pstRunTsk->uwTaskID, &stInfo);
+    }
+
+    uvIntSave = LOS_IntLock();
+    osTaskPeriodCatchUp(pstPeriod);
+
+    /* armed before the wait, so a job that does not get the CPU in time is reported too */
+    osTaskPeriodArm(pstPeriod);
+
+    /* LOS_TaskPeriodSet may move the release while the task waits for it */
+    while (osTaskSleepUntil(pstPeriod->ullRelease))
+    {
+        (VOID)LOS_IntRestore(uvIntSave);
+        LOS_Schedule();
+        uvIntSave = LOS_IntLock();
+    }
+
+    if (0 == pstPeriod->stInfo.uwPeriod)
+    {
+        (VOID)LOS_IntRestore(uvIntSave);
+        return LOS_ERRNO_TSK_PERIOD_NOT_SET;
+    }
+
+    /* LOS_TaskPeriodSet during the wait stops the timer */
+    if ((!pstPeriod->bDeadlineArmed) && (!pstPeriod->bMissReported))
+    {
+        osTaskPeriodArm(pstPeriod);
+    }
+
+    pstPeriod->bJobActive = TRUE;
+#if (LOSCFG_BASE_CORE_CPUP == YES)
+    pstPeriod->ullExecStart = osCpupTaskCycleGet(pstRunTsk->uwTaskID);
+#endif
+    (VOID)LOS_IntRestore(uvIntSave);
+
+    return LOS_OK;
+}
+
+/*****************************************************************************
+ Function : LOS_TaskPeriodInfoGet
+ Description : Get the statistics of a periodic task
+ Input       : uwTaskID --- Task ID
+ Output      : pstInfo  --- statistics
+ Return      : LOS_OK on success or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_MINOR UINT32 LOS_TaskPeriodInfoGet(UINT32 uwTaskID, TSK_PERIOD_INFO_S *pstInfo)
+{
+    UINTPTR uvIntSave;
+    LOS_TASK_CB *pstTaskCB;
+
+    if (NULL == pstInfo)
+    {
+        return LOS_ERRNO_TSK_PTR_NULL;
+    }
+
+    if (OS_CHECK_TSK_PID_NOIDLE(uwTaskID))
+    {
+        return LOS_ERRNO_TSK_ID_INVALID;
+    }
+
+    pstTaskCB = OS_TCB_FROM_TID(uwTaskID);
+    uvIntSave = LOS_IntLock();
+    if (OS_TASK_STATUS_UNUSED & pstTaskCB->usTaskStatus)
+    {
+        (VOID)LOS_IntRestore(uvIntSave);
+        return LOS_ERRNO_TSK_NOT_CREATED;
+    }
+
+    if (0 == pstTaskCB->stPeriod.stInfo.uwPeriod)
+    {
+        (VOID)LOS_IntRestore(uvIntSave);
+        return LOS_ERRNO_TSK_PERIOD_NOT_SET;
+    }
+
+    *pstInfo = pstTaskCB->stPeriod.stInfo;
+    (VOID)LOS_IntRestore(uvIntSave);
+
+    return LOS_OK;
+}
+
+/*****************************************************************************
+ Function : osTaskPeriodNextGet
+ Description : Get the shortest period of the periodic tasks that is longer than uwLast
+ Input       : uwLast   --- period found last, 0 to start
+ Output      : puwNext  --- shortest longer period
+ Return      : TRUE if a longer period is found
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_MINOR static BOOL osTaskPeriodNextGet(UINT32 uwLast, UINT32 *puwNext)
+{
+    LOS_TASK_CB *pstTaskCB;
+    UINT32 uwIndex;
+    UINT32 uwPeriod;
+    BOOL bFound = FALSE;
+
+    for (uwIndex = 0; uwIndex < g_uwTskMaxNum; uwIndex++)
+    {
+        pstTaskCB = OS_TCB_FROM_TID(uwIndex);
+        uwPeriod = pstTaskCB->stPeriod.stInfo.uwPeriod;
+        if ((OS_TASK_STATUS_UNUSED & pstTaskCB->usTaskStatus) || (uwPeriod <= uwLast))
+        {
+            continue;
+        }
+
+        if ((!bFound) || (uwPeriod < *puwNext))
+        {
+            *puwNext = uwPeriod;
+            bFound = TRUE;
+        }
+    }
+
+    return bFound;
+}
+
+/*****************************************************************************
+ Function : LOS_TaskPeriodPriAssign
+ Description : Give the periodic tasks rate monotonic priorities
+ Input       : usHighestPrio --- priority of the shortest period
+ Output      : None
+ Return      : LOS_OK on success or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_MINOR UINT32 LOS_TaskPeriodPriAssign(UINT16 usHighestPrio)
+{
+    LOS_TASK_CB *pstTaskCB;
+    UINT32 uwIndex;
+    UINT32 uwPeriod = 0;
+    UINT16 usPrio = usHighestPrio;
+
+    if (usHighestPrio >= OS_TASK_PRIORITY_LOWEST)
+    {
+        return LOS_ERRNO_TSK_PRIOR_ERROR;
+    }
+
+    /* no task runs before all the priorities are changed */
+    LOS_TaskLock();
+    while (osTaskPeriodNextGet(uwPeriod, &uwPeriod))
+    {
+        if (usPrio >= OS_TASK_PRIORITY_LOWEST)
+        {
+            LOS_TaskUnlock();
+            return LOS_ERRNO_TSK_PRIOR_ERROR;
+        }
+        usPrio++;
+    }
+
+    uwPeriod = 0;
+    usPrio = usHighestPrio;
+    while (osTaskPeriodNextGet(uwPeriod, &uwPeriod))
+    {
+        for (uwIndex = 0; uwIndex < g_uwTskMaxNum; uwIndex++)
+        {
+            pstTaskCB = OS_TCB_FROM_TID(uwIndex);
+            if (!(OS_TASK_STATUS_UNUSED & pstTaskCB->usTaskStatus) && (pstTaskCB->stPeriod.stInfo.uwPeriod == uwPeriod))
+            {
+                (VOID)LOS_TaskPriSet(uwIndex, usPrio);
+            }
+        }
+        usPrio++;
+    }
+    LOS_TaskUnlock();
+
+    return LOS_OK;
+}
+#endif
+
+/*****************************************************************************
+ Function : LOS_TaskYield
+ Description : Adjust the procedure order of specified task
+ Input       : usTaskPrio
+               uwNextTask
+ Output      : None
+ Return      : LOS_OK on success or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_MINOR UINT32 LOS_TaskYield(VOID)
+{
+    UINT32 uwTskCount = 0;
+    UINTPTR uvIntSave;
+
+    if(g_stLosTask.pstRunTask->uwTaskID >= g_uwTskMaxNum)
+    {
+        return LOS_ERRNO_TSK_ID_INVALID;
+    }
+    if(!(g_stLosTask.pstRunTask->usTaskStatus & OS_TASK_STATUS_READY))
     {
         return LOS_OK;
     }
@@ -1298,7 +2360,7 @@ LITE_OS_SEC_TEXT_MINOR UINT32 LOS_TaskYield(VOID)
     uwTskCount = osPriqueueSize(g_stLosTask.pstRunTask->usPriority);
     if (uwTskCount > 1)
     {
-        LOS_ListDelete(&(g_stLosTask.pstRunTask->stPendList));
+        osPriqueueDequeue(&(g_stLosTask.pstRunTask->stPendList));
         g_stLosTask.pstRunTask->usTaskStatus |= OS_TASK_STATUS_READY;
         osPriqueueEnqueue(&(g_stLosTask.pstRunTask->stPendList), g_stLosTask.pstRunTask->usPriority);
     }
@@ -1394,8 +2456,8 @@ LITE_OS_SEC_TEXT_MINOR UINT32 LOS_TaskInfoGet(UINT32 uwTaskID, TSK_INFO_S *pstTa
     pstTaskInfo->uwTopOfStack = pstTaskCB->uwTopOfStack;
     pstTaskInfo->uwEvent = pstTaskCB->uwEvent;
     pstTaskInfo->uwEventMask = pstTaskCB->uwEventMask;
-    pstTaskInfo->pTaskSem = (VOID*)(pstTaskCB->pTaskSem != NULL ? ((SEM_CB_S *)(pstTaskCB->pTaskSem))->usSemID : LOSCFG_BASE_IPC_SEM_LIMIT);
-    pstTaskInfo->pTaskMux = (VOID*)(pstTaskCB->pTaskMux != NULL ? ((MUX_CB_S *)(pstTaskCB->pTaskMux))->ucMuxID : LOSCFG_BASE_IPC_MUX_LIMIT);
+    pstTaskInfo->pTaskSem = (VOID*)(pstTaskCB->pTaskSem != NULL ? ((SEM_CB_S *)(pstTaskCB->pTaskSem))->uwSemID : OS_NULL_INT);
+    pstTaskInfo->pTaskMux = (VOID*)(pstTaskCB->pTaskMux != NULL ? ((MUX_CB_S *)(pstTaskCB->pTaskMux))->uwMuxID : OS_NULL_INT);
     pstTaskInfo->uwTaskID = uwTaskID;
 
     (VOID)strncpy(pstTaskInfo->acName, pstTaskCB->pcTaskName, LOS_TASK_NAMELEN - 1);
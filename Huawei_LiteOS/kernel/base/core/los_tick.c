@@ -37,6 +37,12 @@
 #include "los_swtmr.ph"
 #include "los_task.ph"
 #include "los_timeslice.ph"
+#if (LOSCFG_BASE_CORE_CPUP == YES)
+#include "los_cpup.ph"
+#endif
+#if (LOSCFG_KERNEL_TICKLESS == YES)
+#include "los_tickless.ph"
+#endif
 
 #ifdef __cplusplus
 #if __cplusplus
@@ -62,6 +68,10 @@ LITE_OS_SEC_TEXT VOID osTickHandler(VOID)
     platform_tick_handler();
 #endif
 
+#if (LOSCFG_KERNEL_TICKLESS == YES)
+    osSysTickReload();
+#endif
+
     g_ullTickCount ++;
 
 #if(LOSCFG_BASE_CORE_TIMESLICE == YES)
@@ -73,6 +83,10 @@ LITE_OS_SEC_TEXT VOID osTickHandler(VOID)
 #if (LOSCFG_BASE_CORE_SWTMR == YES)
     (VOID)osSwtmrScan();
 #endif
+
+#if (LOSCFG_BASE_CORE_CPUP == YES)
+    osCpupGuard();
+#endif
 }
 
 
@@ -35,6 +35,10 @@
 #include "los_event.inc"
 #include "los_priqueue.ph"
 #include "los_task.ph"
+#include "los_trace.ph"
+#if (LOSCFG_BASE_IPC_MULTIWAIT == YES)
+#include "los_multiwait.ph"
+#endif
 #include "los_hw.h"
 #include "los_hwi.h"
 
@@ -52,7 +56,11 @@ LITE_OS_SEC_TEXT_INIT UINT32 LOS_EventInit(PEVENT_CB_S pstEventCB)
         return LOS_ERRNO_EVENT_PTR_NULL;
     }
     pstEventCB->uwEventID = 0;
+    pstEventCB->uwPendOrder = LOS_PEND_FIFO;
     LOS_ListInit(&pstEventCB->stEventList);
+#if (LOSCFG_BASE_IPC_MULTIWAIT == YES)
+    LOS_ListInit(&pstEventCB->stMultiWaitList);
+#endif
     return LOS_OK;
 }
 
@@ -92,6 +100,8 @@ LITE_OS_SEC_TEXT UINT32 LOS_EventRead(PEVENT_CB_S pstEventCB, UINT32 uwEventMask
     UINTPTR     uvIntSave;
     LOS_TASK_CB *pstRunTsk;
 
+    OS_INT_PRIO_CHECK();
+
     if (pstEventCB == NULL)
     {
         return LOS_ERRNO_EVENT_PTR_NULL;
@@ -139,7 +149,8 @@ LITE_OS_SEC_TEXT UINT32 LOS_EventRead(PEVENT_CB_S pstEventCB, UINT32 uwEventMask
         pstRunTsk = g_stLosTask.pstRunTask;
         pstRunTsk->uwEventMask = uwEventMask;
         pstRunTsk->uwEventMode = uwMode;
-        osTaskWait(&pstEventCB->stEventList, OS_TASK_STATUS_PEND, uwTimeOut);
+        OS_TRACE(LOS_TRACE_EVENT_READ, pstEventCB, uwEventMask);
+        osTaskWait(&pstEventCB->stEventList, OS_TASK_STATUS_PEND, uwTimeOut, pstEventCB->uwPendOrder);
         (VOID)LOS_IntRestore(uvIntSave);
         LOS_Schedule();
 
@@ -170,6 +181,8 @@ LITE_OS_SEC_TEXT UINT32 LOS_EventWrite(PEVENT_CB_S pstEventCB, UINT32 uwEvents)
     UINTPTR     uvIntSave;
     UINT8       ucExitFlag = 0;
 
+    OS_INT_PRIO_CHECK();
+
     if (pstEventCB == NULL)
     {
         return LOS_ERRNO_EVENT_PTR_NULL;
@@ -183,6 +196,13 @@ LITE_OS_SEC_TEXT UINT32 LOS_EventWrite(PEVENT_CB_S pstEventCB, UINT32 uwEvents)
     uvIntSave = LOS_IntLock();
 
     pstEventCB->uwEventID |= uwEvents;
+    OS_TRACE(LOS_TRACE_EVENT_WRITE, pstEventCB, uwEvents);
+#if (LOSCFG_BASE_IPC_MULTIWAIT == YES)
+    if (osMultiWaitSignal(&pstEventCB->stMultiWaitList))
+    {
+        ucExitFlag = 1;
+    }
+#endif
     if (!LOS_ListEmpty(&pstEventCB->stEventList))
     {
         for (pstResumedTask = LOS_DL_LIST_ENTRY((&pstEventCB->stEventList)->pstNext, LOS_TASK_CB, stPendList);/*lint !e413*/
@@ -199,13 +219,13 @@ LITE_OS_SEC_TEXT UINT32 LOS_EventWrite(PEVENT_CB_S pstEventCB, UINT32 uwEvents)
             }
             pstResumedTask = pstNextTask;
         }
+    }
 
-        if (ucExitFlag == 1)
-        {
-            (VOID)LOS_IntRestore(uvIntSave);
-            LOS_Schedule();
-            return LOS_OK;
-        }
+    if (ucExitFlag == 1)
+    {
+        (VOID)LOS_IntRestore(uvIntSave);
+        LOS_Schedule();
+        return LOS_OK;
     }
 
     (VOID)LOS_IntRestore(uvIntSave);
@@ -219,6 +239,13 @@ LITE_OS_SEC_TEXT_INIT UINT32 LOS_EventDestory(PEVENT_CB_S pstEventCB)
         return LOS_ERRNO_EVENT_PTR_NULL;
     }
 
+#if (LOSCFG_BASE_IPC_MULTIWAIT == YES)
+    if (!LOS_ListEmpty(&pstEventCB->stMultiWaitList))
+    {
+        return LOS_ERRNO_EVENT_SHOULD_NOT_DESTORY;
+    }
+#endif
+
     pstEventCB->stEventList.pstNext = (LOS_DL_LIST *)NULL;
     pstEventCB->stEventList.pstPrev = (LOS_DL_LIST *)NULL;
     return LOS_OK;
@@ -227,6 +254,8 @@ LITE_OS_SEC_TEXT_MINOR UINT32 LOS_EventClear(PEVENT_CB_S pstEventCB, UINT32 uwEv
 {
     UINTPTR uvIntSave;
 
+    OS_INT_PRIO_CHECK();
+
     if (pstEventCB == NULL)
     {
         return LOS_ERRNO_EVENT_PTR_NULL;
@@ -238,6 +267,28 @@ LITE_OS_SEC_TEXT_MINOR UINT32 LOS_EventClear(PEVENT_CB_S pstEventCB, UINT32 uwEv
     return LOS_OK;
 }
 
+LITE_OS_SEC_TEXT_MINOR UINT32 LOS_EventPendOrderSet(PEVENT_CB_S pstEventCB, UINT32 uwPendOrder)
+{
+    UINTPTR uvIntSave;
+
+    if (pstEventCB == NULL)
+    {
+        return LOS_ERRNO_EVENT_PTR_NULL;
+    }
+
+    if (uwPendOrder > LOS_PEND_PRIO)
+    {
+        return LOS_ERRNO_EVENT_PEND_ORDER_INVALID;
+    }
+
+    uvIntSave = LOS_IntLock();
+    pstEventCB->uwPendOrder = uwPendOrder;
+    osTaskPendOrderSet(&pstEventCB->stEventList, uwPendOrder);
+    (VOID)LOS_IntRestore(uvIntSave);
+
+    return LOS_OK;
+}
+
 
 #ifdef __cplusplus
 #if __cplusplus
@@ -0,0 +1,295 @@
+/*----------------------------------------------------------------------------
+ * Copyright (c) <2013-2015>, <Huawei Technologies Co., Ltd>
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *---------------------------------------------------------------------------*/
+/*----------------------------------------------------------------------------
+ * Notice of Export Control Law
+ * ===============================================
+ * Huawei LiteOS may be subject to applicable export control laws and regulations, which might
+ * include those applicable to Huawei LiteOS of U.S. and the country in which you are located.
+ * Import, export and usage of Huawei LiteOS in any manner by you shall be in compliance with such
+ * applicable export control laws and regulations.
+ *---------------------------------------------------------------------------*/
+
+#include "los_multiwait.ph"
+#include "los_base.ph"
+#include "los_priqueue.ph"
+#include "los_task.ph"
+#if (LOSCFG_BASE_IPC_SEM == YES)
+#include "los_sem.ph"
+#endif
+#if (LOSCFG_BASE_IPC_QUEUE == YES)
+#include "los_queue.ph"
+#endif
+#include "los_hwi.h"
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+#endif /* __cplusplus */
+
+#if (LOSCFG_BASE_IPC_MULTIWAIT == YES)
+
+/*****************************************************************************
+ Function    : osMultiWaitListGet
+ Description : Get the multi-wait list of the object of an item
+ Input       : pstItem --- multi-wait item
+ Output      : None
+ Return      : multi-wait list, NULL if the item is invalid or its object is not created
+ *****************************************************************************/
+LITE_OS_SEC_TEXT static LOS_DL_LIST *osMultiWaitListGet(MULTIWAIT_ITEM_S *pstItem)
+{
+#if (LOSCFG_BASE_IPC_SEM == YES)
+    SEM_CB_S *pstSem;
+#endif
+#if (LOSCFG_BASE_IPC_QUEUE == YES)
+    QUEUE_CB_S *pstQueueCB;
+#endif
+
+    switch (pstItem->uwType)
+    {
+#if (LOSCFG_BASE_IPC_SEM == YES)
+        case LOS_MULTIWAIT_SEM:
+            pstSem = GET_SEM(pstItem->uwHandle);
+            return OS_SEM_VALID(pstSem, pstItem->uwHandle) ? &pstSem->stMultiWaitList : (LOS_DL_LIST *)NULL;
+#endif
+#if (LOSCFG_BASE_IPC_QUEUE == YES)
+        case LOS_MULTIWAIT_QUEUE_READ:
+        case LOS_MULTIWAIT_QUEUE_WRITE:
+            pstQueueCB = GET_QUEUE_HANDLE(pstItem->uwHandle);
+            if ((NULL == pstQueueCB) || OS_QUEUE_NOT_CREATED(pstQueueCB, pstItem->uwHandle))
+            {
+                return (LOS_DL_LIST *)NULL;
+            }
+            return &pstQueueCB->stMultiWaitList[(pstItem->uwType == LOS_MULTIWAIT_QUEUE_READ) ? OS_QUEUE_READ : OS_QUEUE_WRITE];
+#endif
+        case LOS_MULTIWAIT_EVENT:
+            if ((pstItem->pstEventCB == NULL) || (pstItem->uwEventMask == 0) ||
+                ((pstItem->uwEventMode != LOS_WAITMODE_AND) && (pstItem->uwEventMode != LOS_WAITMODE_OR)))
+            {
+                return (LOS_DL_LIST *)NULL;
+            }
+            return &pstItem->pstEventCB->stMultiWaitList;
+
+        default:
+            return (LOS_DL_LIST *)NULL;
+    }
+}
+
+/*****************************************************************************
+ Function    : osMultiWaitItemReady
+ Description : Check whether the object of a valid item is ready
+ Input       : pstItem --- multi-wait item
+ Output      : None
+ Return      : TRUE if the object is ready
+ *****************************************************************************/
+LITE_OS_SEC_TEXT static BOOL osMultiWaitItemReady(MULTIWAIT_ITEM_S *pstItem)
+{
+    UINT32 uwEvents;
+
+    switch (pstItem->uwType)
+    {
+#if (LOSCFG_BASE_IPC_SEM == YES)
+        case LOS_MULTIWAIT_SEM:
+            return (BOOL)(GET_SEM(pstItem->uwHandle)->usSemCount > 0);
+#endif
+#if (LOSCFG_BASE_IPC_QUEUE == YES)
+        case LOS_MULTIWAIT_QUEUE_READ:
+            return (BOOL)(GET_QUEUE_HANDLE(pstItem->uwHandle)->usReadWriteableCnt[OS_QUEUE_READ] > 0);
+
+        case LOS_MULTIWAIT_QUEUE_WRITE:
+            return (BOOL)(GET_QUEUE_HANDLE(pstItem->uwHandle)->usReadWriteableCnt[OS_QUEUE_WRITE] > 0);
+#endif
+        default:
+            uwEvents = pstItem->pstEventCB->uwEventID & pstItem->uwEventMask;
+            if (pstItem->uwEventMode == LOS_WAITMODE_AND)
+            {
+                return (BOOL)(uwEvents == pstItem->uwEventMask);
+            }
+            return (BOOL)(uwEvents != 0);
+    }
+}
+
+/*****************************************************************************
+ Function    : osMultiWaitSignal
+ Description : Mark the ready items of an object and wake their tasks
+ Input       : pstList --- multi-wait list of the object
+ Output      : None
+ Return      : TRUE if a task is woken
+ *****************************************************************************/
+LITE_OS_SEC_TEXT BOOL osMultiWaitSignal(LOS_DL_LIST *pstList)
+{
+    MULTIWAIT_ITEM_S *pstItem;
+    LOS_TASK_CB *pstTaskCB;
+    BOOL bWoken = FALSE;
+
+    LOS_DL_LIST_FOR_EACH_ENTRY(pstItem, pstList, MULTIWAIT_ITEM_S, stList) /*lint !e413*/
+    {
+        if (!osMultiWaitItemReady(pstItem))
+        {
+            continue;
+        }
+
+        pstItem->uwReady = 1;
+        pstTaskCB = (LOS_TASK_CB *)pstItem->pTask;
+        if (pstTaskCB->usTaskStatus & OS_TASK_STATUS_PEND_MULTI)
+        {
+            /* the task unlinks all its items when it runs */
+            osTaskUnblock(pstTaskCB, OS_TASK_STATUS_PEND_MULTI);
+            bWoken = TRUE;
+        }
+    }
+
+    return bWoken;
+}
+
+/*****************************************************************************
+ Function    : osMultiWaitUnlink
+ Description : Take the items of a task off their objects
+ Input       : pstTaskCB --- task control block
+ Output      : None
+ Return      : None
+ *****************************************************************************/
+LITE_OS_SEC_TEXT VOID osMultiWaitUnlink(LOS_TASK_CB *pstTaskCB)
+{
+    MULTIWAIT_ITEM_S *pstItems = (MULTIWAIT_ITEM_S *)pstTaskCB->pMultiWait;
+    UINT32 uwIndex;
+
+    for (uwIndex = 0; uwIndex < pstTaskCB->uwMultiWaitCount; uwIndex++)
+    {
+        LOS_ListDelete(&pstItems[uwIndex].stList);
+        pstItems[uwIndex].pTask = NULL;
+    }
+
+    pstTaskCB->pMultiWait = NULL;
+    pstTaskCB->uwMultiWaitCount = 0;
+}
+
+/*****************************************************************************
+ Function    : LOS_MultiWait
+ Description : Wait until one of several IPC objects is ready
+ Input       : pstItems  --- items, one per object
+               uwCount   --- number of items
+               uwTimeOut --- timeout in ticks
+ Output      : pstItems  --- uwReady of the ready items is set
+ Return      : LOS_OK on success or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT UINT32 LOS_MultiWait(MULTIWAIT_ITEM_S *pstItems, UINT32 uwCount, UINT32 uwTimeOut)
+{
+    UINTPTR uvIntSave;
+    LOS_TASK_CB *pstRunTsk;
+    UINT32 uwIndex;
+    UINT32 uwReady = 0;
+    UINT32 uwRet = LOS_OK;
+
+    OS_INT_PRIO_CHECK();
+
+    if (pstItems == NULL)
+    {
+        return LOS_ERRNO_MULTIWAIT_PTR_NULL;
+    }
+
+    if (uwCount == 0)
+    {
+        return LOS_ERRNO_MULTIWAIT_COUNT_INVALID;
+    }
+
+    if (OS_INT_ACTIVE)
+    {
+        return LOS_ERRNO_MULTIWAIT_IN_INT;
+    }
+
+    uvIntSave = LOS_IntLock();
+    for (uwIndex = 0; uwIndex < uwCount; uwIndex++)
+    {
+        if (osMultiWaitListGet(&pstItems[uwIndex]) == NULL)
+        {
+            (VOID)LOS_IntRestore(uvIntSave);
+            return LOS_ERRNO_MULTIWAIT_ITEM_INVALID;
+        }
+
+        pstItems[uwIndex].uwReady = (UINT32)osMultiWaitItemReady(&pstItems[uwIndex]);
+        uwReady += pstItems[uwIndex].uwReady;
+    }
+
+    if (uwReady != 0)
+    {
+        (VOID)LOS_IntRestore(uvIntSave);
+        return LOS_OK;
+    }
+
+    if (uwTimeOut == 0)
+    {
+        (VOID)LOS_IntRestore(uvIntSave);
+        return LOS_ERRNO_MULTIWAIT_UNAVAILABLE;
+    }
+
+    if (g_usLosTaskLock)
+    {
+        (VOID)LOS_IntRestore(uvIntSave);
+        return LOS_ERRNO_MULTIWAIT_IN_LOCK;
+    }
+
+    pstRunTsk = g_stLosTask.pstRunTask;
+    for (uwIndex = 0; uwIndex < uwCount; uwIndex++)
+    {
+        pstItems[uwIndex].pTask = (VOID *)pstRunTsk;
+        LOS_ListTailInsert(osMultiWaitListGet(&pstItems[uwIndex]), &pstItems[uwIndex].stList);
+    }
+    pstRunTsk->pMultiWait = (VOID *)pstItems;
+    pstRunTsk->uwMultiWaitCount = uwCount;
+
+    osTaskBlock(OS_TASK_STATUS_PEND_MULTI, uwTimeOut);
+    (VOID)LOS_IntRestore(uvIntSave);
+    LOS_Schedule();
+
+    uvIntSave = LOS_IntLock();
+    osMultiWaitUnlink(pstRunTsk);
+    if (pstRunTsk->usTaskStatus & OS_TASK_STATUS_TIMEOUT)
+    {
+        pstRunTsk->usTaskStatus &= (~OS_TASK_STATUS_TIMEOUT);
+        uwRet = LOS_ERRNO_MULTIWAIT_TIMEOUT;
+
+        /* an object may have become ready between the timeout and now */
+        for (uwIndex = 0; uwIndex < uwCount; uwIndex++)
+        {
+            if (pstItems[uwIndex].uwReady)
+            {
+                uwRet = LOS_OK;
+            }
+        }
+    }
+    (VOID)LOS_IntRestore(uvIntSave);
+
+    return uwRet;
+}
+
+#endif /* (LOSCFG_BASE_IPC_MULTIWAIT == YES) */
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* __cplusplus */
@@ -37,6 +37,7 @@
 #include "los_memory.ph"
 #include "los_priqueue.ph"
 #include "los_task.ph"
+#include "los_trace.ph"
 #if (LOSCFG_PLATFORM_EXC == YES)
 #include "los_exc.h"
 #endif
@@ -51,10 +52,28 @@ extern "C"{
 
 #if (LOSCFG_BASE_IPC_MUX == YES)
 
-LITE_OS_SEC_BSS MUX_CB_S             *g_pstAllMux;
+LITE_OS_SEC_BSS OS_OBJ_TABLE_S       g_stMuxTable;
 LITE_OS_SEC_DATA_INIT LOS_DL_LIST    g_stUnusedMuxList;
+LITE_OS_SEC_BSS UINT32               g_uwMuxLimit;
 
 
+/*****************************************************************************
+ Function     : osMuxNodeInit,
+ Description  : Put a mutex of a new block on the unused list,
+ Input        : pObj ------ Mutex object
+                uwIndex --- Index of the mutex
+ Output       : None
+ Return       : None
+ *****************************************************************************/
+LITE_OS_SEC_TEXT static VOID osMuxNodeInit(VOID *pObj, UINT32 uwIndex)
+{
+    MUX_CB_S *pstMuxNode = (MUX_CB_S *)pObj;
+
+    pstMuxNode->uwMuxID     = uwIndex;
+    pstMuxNode->ucMuxStat   = OS_MUX_UNUSED;
+    LOS_ListTailInsert(&g_stUnusedMuxList, &pstMuxNode->stMuxList);
+}
+
 /*****************************************************************************
  Funtion	     : osMuxInit,
  Description  : Initializes the mutex,
@@ -64,29 +83,88 @@ LITE_OS_SEC_DATA_INIT LOS_DL_LIST    g_stUnusedMuxList;
  *****************************************************************************/
 LITE_OS_SEC_TEXT_INIT UINT32 osMuxInit(VOID)
 {
-    MUX_CB_S *pstMuxNode;
-    UINT32   uwIndex;
-
     LOS_ListInit(&g_stUnusedMuxList);
-    if (LOSCFG_BASE_IPC_MUX_LIMIT > 0)   /*lint !e506*/
+    if (g_uwMuxLimit > 0)
     {
-        g_pstAllMux = (MUX_CB_S *)LOS_MemAlloc(m_aucSysMem0, (LOSCFG_BASE_IPC_MUX_LIMIT * sizeof(MUX_CB_S)));
-        if (NULL == g_pstAllMux)
+        /* the mutexes are allocated a block at a time when all are in use */
+        if (LOS_OK != osObjTableInit(&g_stMuxTable, sizeof(MUX_CB_S), g_uwMuxLimit, LOSCFG_BASE_IPC_ALLOC_STEP, 32))
         {
             return LOS_ERRNO_MUX_NO_MEMORY;
         }
 
-        for (uwIndex = 0; uwIndex < LOSCFG_BASE_IPC_MUX_LIMIT; uwIndex++)
+        if (LOS_OK != osObjTableExtend(&g_stMuxTable, osMuxNodeInit))
         {
-            pstMuxNode              = ((MUX_CB_S *)g_pstAllMux) + uwIndex;
-            pstMuxNode->ucMuxID     = uwIndex;
-            pstMuxNode->ucMuxStat   = OS_MUX_UNUSED;
-            LOS_ListTailInsert(&g_stUnusedMuxList, &pstMuxNode->stMuxList);
+            return LOS_ERRNO_MUX_NO_MEMORY;
         }
     }
     return LOS_OK;
 }
 
+/*****************************************************************************
+ Function     : osMuxPriGet
+ Description  : Get the priority a task inherits from the mutexes it owns,
+ Input        : pstTaskCB ------ Task control block
+ Output       : None
+ Return       : The highest of the base priority and the waiter priorities
+ *****************************************************************************/
+LITE_OS_SEC_TEXT static UINT16 osMuxPriGet(LOS_TASK_CB *pstTaskCB)
+{
+    UINT16      usPriority = pstTaskCB->usBasePriority;
+    MUX_CB_S    *pstMux;
+    LOS_TASK_CB *pstWaiter;
+
+    LOS_DL_LIST_FOR_EACH_ENTRY(pstMux, &pstTaskCB->stHeldMuxList, MUX_CB_S, stHeldList) /*lint !e413*/
+    {
+        LOS_DL_LIST_FOR_EACH_ENTRY(pstWaiter, &pstMux->stMuxList, LOS_TASK_CB, stPendList) /*lint !e413*/
+        {
+            if (pstWaiter->usPriority < usPriority)
+            {
+                usPriority = pstWaiter->usPriority;
+            }
+
+            if (LOS_PEND_PRIO == pstMux->ucPendOrder)
+            {
+                /* the first waiter has the highest priority */
+                break;
+            }
+        }
+    }
+
+    return usPriority;
+}
+
+/*****************************************************************************
+ Function     : osMuxPriUpdate
+ Description  : Recompute the priority of a task and of the chain of mutex owners it waits for,
+ Input        : pstTaskCB ------ Task control block
+ Output       : None
+ Return       : None
+ *****************************************************************************/
+LITE_OS_SEC_TEXT VOID osMuxPriUpdate(LOS_TASK_CB *pstTaskCB)
+{
+    UINT16   usPriority;
+    UINT32   uwDepth;
+
+    /* the depth bound only matters for a deadlocked cycle of owners */
+    for (uwDepth = 0; (pstTaskCB != NULL) && (uwDepth <= LOSCFG_BASE_CORE_TSK_LIMIT); uwDepth++)
+    {
+        usPriority = osMuxPriGet(pstTaskCB);
+        if (usPriority == pstTaskCB->usPriority)
+        {
+            return;
+        }
+
+        osTaskPriModify(pstTaskCB, usPriority);
+
+        if (!(pstTaskCB->usTaskStatus & OS_TASK_STATUS_PEND) || (NULL == pstTaskCB->pTaskMux))
+        {
+            return;
+        }
+
+        pstTaskCB = ((MUX_CB_S *)pstTaskCB->pTaskMux)->pstOwner;
+    }
+}
+
 /*****************************************************************************
  Function     : LOS_MuxCreate
  Description  : Create a mutex,
@@ -108,10 +186,20 @@ LITE_OS_SEC_TEXT_INIT  UINT32  LOS_MuxCreate (UINT32 *puwMuxHandle)
     }
 
     uwIntSave = LOS_IntLock();
-    if (LOS_ListEmpty(&g_stUnusedMuxList))
+    while (LOS_ListEmpty(&g_stUnusedMuxList))
     {
+        if ((0 == g_uwMuxLimit) || OS_OBJ_TABLE_FULL(&g_stMuxTable))
+        {
+            LOS_IntRestore(uwIntSave);
+            OS_GOTO_ERR_HANDLER(LOS_ERRNO_MUX_ALL_BUSY);
+        }
+
         LOS_IntRestore(uwIntSave);
-        OS_GOTO_ERR_HANDLER(LOS_ERRNO_MUX_ALL_BUSY);
+        if (LOS_OK != osObjTableExtend(&g_stMuxTable, osMuxNodeInit))
+        {
+            OS_GOTO_ERR_HANDLER(LOS_ERRNO_MUX_NO_MEMORY);
+        }
+        uwIntSave = LOS_IntLock();
     }
 
     pstUnusedMux                = LOS_DL_LIST_FIRST(&(g_stUnusedMuxList));
@@ -119,10 +207,10 @@ LITE_OS_SEC_TEXT_INIT  UINT32  LOS_MuxCreate (UINT32 *puwMuxHandle)
     pstMuxCreated               = (GET_MUX_LIST(pstUnusedMux)); /*lint !e413*/
     pstMuxCreated->usMuxCount   = 0;
     pstMuxCreated->ucMuxStat    = OS_MUX_USED;
-    pstMuxCreated->usPriority   = 0;
+    pstMuxCreated->ucPendOrder  = LOS_PEND_FIFO;
     pstMuxCreated->pstOwner     = (LOS_TASK_CB *)NULL;
     LOS_ListInit(&pstMuxCreated->stMuxList);
-    *puwMuxHandle               = (UINT32)pstMuxCreated->ucMuxID;
+    *puwMuxHandle               = pstMuxCreated->uwMuxID;
     LOS_IntRestore(uwIntSave);
     return LOS_OK;
 ErrHandler:
@@ -143,14 +231,9 @@ LITE_OS_SEC_TEXT_INIT UINT32 LOS_MuxDelete(UINT32 uwMuxHandle)
     UINT32   uwErrNo;
     UINT32   uwErrLine;
 
-    if (uwMuxHandle >= (UINT32)LOSCFG_BASE_IPC_MUX_LIMIT)
-    {
-        OS_GOTO_ERR_HANDLER(LOS_ERRNO_MUX_INVALID);
-    }
-
     pstMuxDeleted = GET_MUX(uwMuxHandle);
     uwIntSave = LOS_IntLock();
-    if (OS_MUX_UNUSED == pstMuxDeleted->ucMuxStat)
+    if (!OS_MUX_VALID(pstMuxDeleted, uwMuxHandle))
     {
         LOS_IntRestore(uwIntSave);
         OS_GOTO_ERR_HANDLER(LOS_ERRNO_MUX_INVALID);
@@ -164,6 +247,7 @@ LITE_OS_SEC_TEXT_INIT UINT32 LOS_MuxDelete(UINT32 uwMuxHandle)
 
     LOS_ListAdd(&g_stUnusedMuxList, &pstMuxDeleted->stMuxList);
     pstMuxDeleted->ucMuxStat = OS_MUX_UNUSED;
+    pstMuxDeleted->uwMuxID = OS_OBJ_NEXT_HANDLE(&g_stMuxTable, uwMuxHandle);
 
     LOS_IntRestore(uwIntSave);
 
@@ -187,14 +271,11 @@ LITE_OS_SEC_TEXT UINT32 LOS_MuxPend(UINT32 uwMuxHandle, UINT32 uwTimeout)
     UINT32     uwRetErr;
     LOS_TASK_CB  *pstRunTsk;
 
-    if (uwMuxHandle >= (UINT32)LOSCFG_BASE_IPC_MUX_LIMIT)
-    {
-        OS_RETURN_ERROR(LOS_ERRNO_MUX_INVALID);
-    }
+    OS_INT_PRIO_CHECK();
 
     pstMuxPended = GET_MUX(uwMuxHandle);
     uwIntSave = LOS_IntLock();
-    if (OS_MUX_UNUSED == pstMuxPended->ucMuxStat)
+    if (!OS_MUX_VALID(pstMuxPended, uwMuxHandle))
     {
         LOS_IntRestore(uwIntSave);
         OS_RETURN_ERROR(LOS_ERRNO_MUX_INVALID);
@@ -211,7 +292,7 @@ LITE_OS_SEC_TEXT UINT32 LOS_MuxPend(UINT32 uwMuxHandle, UINT32 uwTimeout)
     {
         pstMuxPended->usMuxCount++;
         pstMuxPended->pstOwner = pstRunTsk;
-        pstMuxPended->usPriority = pstRunTsk->usPriority;
+        LOS_ListTailInsert(&pstRunTsk->stHeldMuxList, &pstMuxPended->stHeldList);
         LOS_IntRestore(uwIntSave);
         return LOS_OK;
     }
@@ -240,13 +321,11 @@ LITE_OS_SEC_TEXT UINT32 LOS_MuxPend(UINT32 uwMuxHandle, UINT32 uwTimeout)
     }
 
     pstRunTsk->pTaskMux = (VOID *)pstMuxPended;
+    OS_TRACE(LOS_TRACE_MUX_PEND, uwMuxHandle, uwTimeout);
+    osTaskWait(&pstMuxPended->stMuxList, OS_TASK_STATUS_PEND, uwTimeout, pstMuxPended->ucPendOrder);
 
-    if (pstMuxPended->pstOwner->usPriority > pstRunTsk->usPriority)
-    {
-        osTaskPriModify(pstMuxPended->pstOwner, pstRunTsk->usPriority);
-    }
-
-    osTaskWait(&pstMuxPended->stMuxList, OS_TASK_STATUS_PEND, uwTimeout);
+    /* boost the owner, and whoever that owner is blocked on */
+    osMuxPriUpdate(pstMuxPended->pstOwner);
 
     (VOID)LOS_IntRestore(uwIntSave);
     LOS_Schedule();
@@ -282,10 +361,11 @@ LITE_OS_SEC_TEXT UINT32 LOS_MuxPost(UINT32 uwMuxHandle)
     LOS_TASK_CB *pstResumedTask;
     LOS_TASK_CB *pstRunTsk;
 
+    OS_INT_PRIO_CHECK();
+
     uwIntSave = LOS_IntLock();
 
-    if ((uwMuxHandle >= (UINT32)LOSCFG_BASE_IPC_MUX_LIMIT) ||
-        (OS_MUX_UNUSED == pstMuxPosted->ucMuxStat))
+    if (!OS_MUX_VALID(pstMuxPosted, uwMuxHandle))
     {
         LOS_IntRestore(uwIntSave);
         OS_RETURN_ERROR(LOS_ERRNO_MUX_INVALID);
@@ -304,10 +384,9 @@ LITE_OS_SEC_TEXT UINT32 LOS_MuxPost(UINT32 uwMuxHandle)
         return LOS_OK;
     }
 
-    if ((pstMuxPosted->pstOwner->usPriority) != pstMuxPosted->usPriority)
-    {
-        osTaskPriModify(pstMuxPosted->pstOwner, pstMuxPosted->usPriority);
-    }
+    /* drop what was inherited through this mutex, keep what the others still give */
+    LOS_ListDelete(&pstMuxPosted->stHeldList);
+    osMuxPriUpdate(pstRunTsk);
 
     if (!LOS_ListEmpty(&pstMuxPosted->stMuxList))
     {
@@ -315,21 +394,55 @@ LITE_OS_SEC_TEXT UINT32 LOS_MuxPost(UINT32 uwMuxHandle)
 
         pstMuxPosted->usMuxCount    = 1;
         pstMuxPosted->pstOwner      = pstResumedTask;
-        pstMuxPosted->usPriority    = pstResumedTask->usPriority;
         pstResumedTask->pTaskMux    = NULL;
 
         osTaskWake(pstResumedTask, OS_TASK_STATUS_PEND);
+        OS_TRACE(LOS_TRACE_MUX_POST, uwMuxHandle, pstResumedTask->uwTaskID);
+        LOS_ListTailInsert(&pstResumedTask->stHeldMuxList, &pstMuxPosted->stHeldList);
+        osMuxPriUpdate(pstResumedTask);
 
         (VOID)LOS_IntRestore(uwIntSave);
         LOS_Schedule();
     }
     else
     {
+        OS_TRACE(LOS_TRACE_MUX_POST, uwMuxHandle, LOS_TRACE_NONE);
         (VOID)LOS_IntRestore(uwIntSave);
     }
 
     return LOS_OK;
 }
+
+/*****************************************************************************
+ Function     : LOS_MuxPendOrderSet
+ Description  : Set the order of the tasks pending on a mutex,
+ Input        : uwMuxHandle ------ Mutex operation handle,
+                uwPendOrder ------ LOS_PEND_FIFO or LOS_PEND_PRIO
+ Output       : None
+ Return       : LOS_OK on success ,or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_MINOR UINT32 LOS_MuxPendOrderSet(UINT32 uwMuxHandle, UINT32 uwPendOrder)
+{
+    UINT32      uwIntSave;
+    MUX_CB_S    *pstMux = GET_MUX(uwMuxHandle);
+
+    if (uwPendOrder > LOS_PEND_PRIO)
+    {
+        OS_RETURN_ERROR(LOS_ERRNO_MUX_PEND_ORDER_INVALID);
+    }
+
+    uwIntSave = LOS_IntLock();
+    if (!OS_MUX_VALID(pstMux, uwMuxHandle))
+    {
+        LOS_IntRestore(uwIntSave);
+        OS_RETURN_ERROR(LOS_ERRNO_MUX_INVALID);
+    }
+
+    pstMux->ucPendOrder = (UINT8)uwPendOrder;
+    osTaskPendOrderSet(&pstMux->stMuxList, uwPendOrder);
+    (VOID)LOS_IntRestore(uwIntSave);
+    return LOS_OK;
+}
 #endif /*(LOSCFG_BASE_IPC_MUX == YES)*/
 
 
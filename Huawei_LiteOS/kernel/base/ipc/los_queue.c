@@ -37,6 +37,10 @@
 #include "los_memory.ph"
 #include "los_priqueue.ph"
 #include "los_task.ph"
+#include "los_trace.ph"
+#if (LOSCFG_BASE_IPC_MULTIWAIT == YES)
+#include "los_multiwait.ph"
+#endif
 #if (LOSCFG_PLATFORM_EXC == YES)
 #include "los_exc.ph"
 #endif
@@ -50,12 +54,29 @@ extern "C"{
 #if (LOSCFG_BASE_IPC_QUEUE == YES)
 
 /*lint -save -e64*/
-LITE_OS_SEC_BSS      QUEUE_CB_S       *g_pstAllQueue;
+LITE_OS_SEC_BSS      OS_OBJ_TABLE_S   g_stQueueTable;
 LITE_OS_SEC_BSS      LOS_DL_LIST      g_stFreeQueueList;
+LITE_OS_SEC_BSS      UINT32           g_uwQueueLimit;
 #if (LOSCFG_PLATFORM_EXC == YES)
 LITE_OS_SEC_BSS      UINT32           g_uwExcQueueMaxNum;
 #endif
 
+/**************************************************************************
+ Function    : osQueueNodeInit
+ Description : Put a queue of a new block on the free list
+ Input       : pObj    --- Queue control block
+               uwIndex --- Index of the queue
+ Output      : None
+ Return      : None
+**************************************************************************/
+LITE_OS_SEC_TEXT static VOID osQueueNodeInit(VOID *pObj, UINT32 uwIndex)
+{
+    QUEUE_CB_S *pstQueueNode = (QUEUE_CB_S *)pObj;
+
+    pstQueueNode->uwQueueID = uwIndex;
+    LOS_ListTailInsert(&g_stFreeQueueList, &pstQueueNode->stReadWriteList[OS_QUEUE_WRITE]);
+}
+
 /**************************************************************************
  Function    : osQueueInit
  Description : queue initial
@@ -65,32 +86,26 @@ LITE_OS_SEC_BSS      UINT32           g_uwExcQueueMaxNum;
 **************************************************************************/
 LITE_OS_SEC_TEXT_INIT UINT32 osQueueInit(VOID)
 {
-    QUEUE_CB_S *pstQueueNode;
-    UINT16   usIndex;
-
-    if (0 == LOSCFG_BASE_IPC_QUEUE_LIMIT)   /*lint !e506*/
+    if (0 == g_uwQueueLimit)
     {
         return LOS_ERRNO_QUEUE_MAXNUM_ZERO;
     }
 
-    g_pstAllQueue = (QUEUE_CB_S *)LOS_MemAlloc(m_aucSysMem0, LOSCFG_BASE_IPC_QUEUE_LIMIT * sizeof(QUEUE_CB_S));
-    if (NULL == g_pstAllQueue)
+    LOS_ListInit(&g_stFreeQueueList);
+
+    /* the control blocks are allocated a block at a time when all are in use */
+    if (LOS_OK != osObjTableInit(&g_stQueueTable, sizeof(QUEUE_CB_S), g_uwQueueLimit, LOSCFG_BASE_IPC_ALLOC_STEP, 32))
     {
         return LOS_ERRNO_QUEUE_NO_MEMORY;
     }
 
-    (VOID)memset(g_pstAllQueue, 0, LOSCFG_BASE_IPC_QUEUE_LIMIT * sizeof(QUEUE_CB_S));
-
-    LOS_ListInit(&g_stFreeQueueList);
-    for (usIndex = 0; usIndex < LOSCFG_BASE_IPC_QUEUE_LIMIT; usIndex++)
+    if (LOS_OK != osObjTableExtend(&g_stQueueTable, osQueueNodeInit))
     {
-        pstQueueNode = ((QUEUE_CB_S *)g_pstAllQueue) + usIndex;
-        pstQueueNode->usQueueID = usIndex;
-        LOS_ListTailInsert(&g_stFreeQueueList, &pstQueueNode->stReadWriteList[OS_QUEUE_WRITE]);
+        return LOS_ERRNO_QUEUE_NO_MEMORY;
     }
 
 #if (LOSCFG_PLATFORM_EXC == YES)
-    g_uwExcQueueMaxNum = LOSCFG_BASE_IPC_QUEUE_LIMIT;
+    g_uwExcQueueMaxNum = g_uwQueueLimit;
     osExcRegister(OS_EXC_TYPE_QUE, (EXC_INFO_SAVE_CALLBACK)LOS_QueueInfoGet, &g_uwExcQueueMaxNum);
 #endif
 
@@ -98,30 +113,26 @@ LITE_OS_SEC_TEXT_INIT UINT32 osQueueInit(VOID)
 }
 
 /*****************************************************************************
- Function    : LOS_QueueCreate
+ Function    : osQueueCreate
  Description : Create a queue
- Input       : pcQueueName  --- Queue name, less than 4 characters
-               usLen        --- Queue lenth
-               uwFlags      --- Queue type, FIFO or PRIO
+ Input       : usLen        --- Queue lenth
                usMaxMsgSize --- Maximum message size in byte
+               pucBuf       --- Storage provided by the caller, NULL to allocate it from the system heap
  Output      : puwQueueID   --- Queue ID
  Return      : LOS_OK on success or error code on failure
  *****************************************************************************/
-LITE_OS_SEC_TEXT_INIT UINT32 LOS_QueueCreate(CHAR *pcQueueName,
-                                          UINT16 usLen,
-                                          UINT32 *puwQueueID,
-                                          UINT32 uwFlags,
-                                          UINT16 usMaxMsgSize )
+LITE_OS_SEC_TEXT_INIT static UINT32 osQueueCreate(UINT16 usLen,
+                                                  UINT32 *puwQueueID,
+                                                  UINT16 usMaxMsgSize,
+                                                  UINT8 *pucBuf)
 {
     QUEUE_CB_S      *pstQueueCB;
     UINTPTR         uvIntSave;
     LOS_DL_LIST     *pstUnusedQueue;
     UINT8           *pucQueue;
+    UINT32          uwRet;
     UINT16          usMsgSize = usMaxMsgSize + sizeof(UINT32);
 
-    (VOID)pcQueueName;
-    (VOID)uwFlags;
-
     if (NULL == puwQueueID)
     {
         return LOS_ERRNO_QUEUE_CREAT_PTR_NULL;
@@ -139,18 +150,35 @@ LITE_OS_SEC_TEXT_INIT UINT32 LOS_QueueCreate(CHAR *pcQueueName,
 
     /* Memory allocation is time-consuming, to shorten the time of disable interrupt,
        move the memory allocation to here. */
-    pucQueue = (UINT8 *)LOS_MemAlloc(m_aucSysMem0, usLen * usMsgSize);
+    pucQueue = pucBuf;
     if (NULL == pucQueue)
     {
-        return LOS_ERRNO_QUEUE_CREATE_NO_MEMORY;
+        pucQueue = (UINT8 *)LOS_MemAlloc(m_aucSysMem0, usLen * usMsgSize);
+        if (NULL == pucQueue)
+        {
+            return LOS_ERRNO_QUEUE_CREATE_NO_MEMORY;
+        }
     }
 
     uvIntSave = LOS_IntLock();
-    if (LOS_ListEmpty(&g_stFreeQueueList))
+    while (LOS_ListEmpty(&g_stFreeQueueList))
     {
         LOS_IntRestore(uvIntSave);
-        (VOID)LOS_MemFree(m_aucSysMem0, pucQueue);
-        return LOS_ERRNO_QUEUE_CB_UNAVAILABLE;
+        uwRet = OS_OBJ_TABLE_FULL(&g_stQueueTable) ? LOS_ERRNO_QUEUE_CB_UNAVAILABLE : LOS_OK;
+        if ((LOS_OK == uwRet) && (LOS_OK != osObjTableExtend(&g_stQueueTable, osQueueNodeInit)))
+        {
+            uwRet = LOS_ERRNO_QUEUE_CREATE_NO_MEMORY;
+        }
+
+        if (LOS_OK != uwRet)
+        {
+            if (NULL == pucBuf)
+            {
+                (VOID)LOS_MemFree(m_aucSysMem0, pucQueue);
+            }
+            return uwRet;
+        }
+        uvIntSave = LOS_IntLock();
     }
 
     pstUnusedQueue = LOS_DL_LIST_FIRST(&(g_stFreeQueueList));
@@ -159,24 +187,86 @@ LITE_OS_SEC_TEXT_INIT UINT32 LOS_QueueCreate(CHAR *pcQueueName,
     pstQueueCB->usQueueLen = usLen;
     pstQueueCB->usQueueSize = usMsgSize;
     pstQueueCB->pucQueue = pucQueue;
+    pstQueueCB->usStaticBuf = (pucBuf != NULL);
     pstQueueCB->usQueueState = OS_QUEUE_INUSED;
     pstQueueCB->usReadWriteableCnt[OS_QUEUE_READ]  = 0;
     pstQueueCB->usReadWriteableCnt[OS_QUEUE_WRITE] = usLen;
     pstQueueCB->usQueueHead = 0;
     pstQueueCB->usQueueTail = 0;
+    pstQueueCB->usInFlightCnt[OS_QUEUE_READ]  = 0;
+    pstQueueCB->usInFlightCnt[OS_QUEUE_WRITE] = 0;
+    pstQueueCB->usPendOrder = LOS_PEND_FIFO;
     LOS_ListInit(&pstQueueCB->stReadWriteList[OS_QUEUE_READ]);
     LOS_ListInit(&pstQueueCB->stReadWriteList[OS_QUEUE_WRITE]);
     LOS_ListInit(&pstQueueCB->stMemList);
+#if (LOSCFG_BASE_IPC_MULTIWAIT == YES)
+    LOS_ListInit(&pstQueueCB->stMultiWaitList[OS_QUEUE_READ]);
+    LOS_ListInit(&pstQueueCB->stMultiWaitList[OS_QUEUE_WRITE]);
+#endif
     LOS_IntRestore(uvIntSave);
 
-    *puwQueueID = pstQueueCB->usQueueID;
+    *puwQueueID = pstQueueCB->uwQueueID;
 
     return LOS_OK;
 }
 
+/*****************************************************************************
+ Function    : LOS_QueueCreate
+ Description : Create a queue
+ Input       : pcQueueName  --- Queue name, less than 4 characters
+               usLen        --- Queue lenth
+               uwFlags      --- Queue type, FIFO or PRIO
+               usMaxMsgSize --- Maximum message size in byte
+ Output      : puwQueueID   --- Queue ID
+ Return      : LOS_OK on success or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_INIT UINT32 LOS_QueueCreate(CHAR *pcQueueName,
+                                          UINT16 usLen,
+                                          UINT32 *puwQueueID,
+                                          UINT32 uwFlags,
+                                          UINT16 usMaxMsgSize )
+{
+    (VOID)pcQueueName;
+    (VOID)uwFlags;
+
+    return osQueueCreate(usLen, puwQueueID, usMaxMsgSize, NULL);
+}
+
+/*****************************************************************************
+ Function    : LOS_QueueCreateStatic
+ Description : Create a queue in storage provided by the caller
+ Input       : pcQueueName  --- Queue name, less than 4 characters
+               usLen        --- Queue lenth
+               uwFlags      --- Queue type, FIFO or PRIO
+               usMaxMsgSize --- Maximum message size in byte
+               pBuf         --- Message storage
+               uwBufSize    --- Size of pBuf in byte
+ Output      : puwQueueID   --- Queue ID
+ Return      : LOS_OK on success or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_INIT UINT32 LOS_QueueCreateStatic(CHAR *pcQueueName,
+                                                   UINT16 usLen,
+                                                   UINT32 *puwQueueID,
+                                                   UINT32 uwFlags,
+                                                   UINT16 usMaxMsgSize,
+                                                   VOID *pBuf,
+                                                   UINT32 uwBufSize)
+{
+    (VOID)pcQueueName;
+    (VOID)uwFlags;
+
+    if ((NULL == pBuf) || ((UINT32)pBuf & (sizeof(UINT32) - 1)) ||
+        (uwBufSize < LOS_QUEUE_STATIC_SIZE(usLen, usMaxMsgSize)))
+    {
+        return LOS_ERRNO_QUEUE_STATIC_BUF_INVALID;
+    }
+
+    return osQueueCreate(usLen, puwQueueID, usMaxMsgSize, (UINT8 *)pBuf);
+}
+
 static LITE_OS_SEC_TEXT UINT32 osQueueReadParameterCheck(UINT32 uwQueueID, VOID *pBufferAddr, UINT32 *puwBufferSize, UINT32 uwTimeOut)
 {
-    if (uwQueueID >= LOSCFG_BASE_IPC_QUEUE_LIMIT)
+    if (NULL == GET_QUEUE_HANDLE(uwQueueID))
     {
         return LOS_ERRNO_QUEUE_INVALID;
     }
@@ -203,7 +293,7 @@ static LITE_OS_SEC_TEXT UINT32 osQueueReadParameterCheck(UINT32 uwQueueID, VOID
 
 static LITE_OS_SEC_TEXT UINT32 osQueueWriteParameterCheck(UINT32 uwQueueID, VOID *pBufferAddr, UINT32 *puwBufferSize, UINT32 uwTimeOut)
 {
-    if (uwQueueID >= LOSCFG_BASE_IPC_QUEUE_LIMIT)
+    if (NULL == GET_QUEUE_HANDLE(uwQueueID))
     {
         return LOS_ERRNO_QUEUE_INVALID;
     }
@@ -228,7 +318,195 @@ static LITE_OS_SEC_TEXT UINT32 osQueueWriteParameterCheck(UINT32 uwQueueID, VOID
     return LOS_OK;
 }
 
-static VOID osQueueBufferOperate(QUEUE_CB_S *pstQueueCB, UINT32 uwOperateType, VOID *pBufferAddr, UINT32 *puwBufferSize)
+/*****************************************************************************
+ Function    : osQueueNodeSizeGet
+ Description : Get the message size stored behind a node
+ Input       : pstQueueCB --- queue control block
+               usPos      --- node position
+ Output      : None
+ Return      : message size, 0 if the node is reserved or released
+ *****************************************************************************/
+static UINT32 osQueueNodeSizeGet(QUEUE_CB_S *pstQueueCB, UINT16 usPos)
+{
+    UINT32 uwMsgDataSize;
+
+    memcpy((VOID *)&uwMsgDataSize, (VOID *)(OS_QUEUE_NODE(pstQueueCB, usPos) + pstQueueCB->usQueueSize - sizeof(UINT32)), sizeof(UINT32));
+    return uwMsgDataSize;
+}
+
+/*****************************************************************************
+ Function    : osQueueNodeSizeSet
+ Description : Set the message size stored behind a node
+ Input       : pstQueueCB    --- queue control block
+               usPos         --- node position
+               uwMsgDataSize --- message size
+ Output      : None
+ Return      : None
+ *****************************************************************************/
+static VOID osQueueNodeSizeSet(QUEUE_CB_S *pstQueueCB, UINT16 usPos, UINT32 uwMsgDataSize)
+{
+    memcpy((VOID *)(OS_QUEUE_NODE(pstQueueCB, usPos) + pstQueueCB->usQueueSize - sizeof(UINT32)), (VOID *)&uwMsgDataSize, sizeof(UINT32));
+}
+
+/*****************************************************************************
+ Function    : osQueueInFlightScan
+ Description : Hand back the finished nodes at the front of the reserved or peeked ones.
+               Reserved nodes are finished once committed (size set), peeked nodes once
+               released (size cleared), and they are handed back in ring order.
+ Input       : pstQueueCB  --- queue control block
+               uwReadWrite --- OS_QUEUE_WRITE for reserved nodes, OS_QUEUE_READ for peeked nodes
+ Output      : None
+ Return      : number of nodes handed back
+ *****************************************************************************/
+static UINT32 osQueueInFlightScan(QUEUE_CB_S *pstQueueCB, UINT32 uwReadWrite)
+{
+    UINT32 uwEnd = (uwReadWrite == OS_QUEUE_WRITE) ? pstQueueCB->usQueueTail : pstQueueCB->usQueueHead;
+    UINT16 usPos = (UINT16)((uwEnd + pstQueueCB->usQueueLen - pstQueueCB->usInFlightCnt[uwReadWrite]) % pstQueueCB->usQueueLen);
+    UINT32 uwCount = 0;
+
+    while ((pstQueueCB->usInFlightCnt[uwReadWrite] != 0) &&
+           ((osQueueNodeSizeGet(pstQueueCB, usPos) != 0) == (uwReadWrite == OS_QUEUE_WRITE)))
+    {
+        pstQueueCB->usInFlightCnt[uwReadWrite]--;
+        (usPos + 1 == pstQueueCB->usQueueLen) ? (usPos = 0) : (usPos++);
+        uwCount++;
+    }
+
+    return uwCount;
+}
+
+/*****************************************************************************
+ Function    : osQueueInFlightPosGet
+ Description : Find the node of a buffer handed out by LOS_QueueReserve or LOS_QueuePeek
+ Input       : pstQueueCB  --- queue control block
+               pBuffer     --- buffer handed out
+               uwReadWrite --- OS_QUEUE_WRITE for a reserved node, OS_QUEUE_READ for a peeked node
+ Output      : pusPos      --- node position
+ Return      : LOS_OK on success or error code on failure
+ *****************************************************************************/
+static UINT32 osQueueInFlightPosGet(QUEUE_CB_S *pstQueueCB, VOID *pBuffer, UINT32 uwReadWrite, UINT16 *pusPos)
+{
+    UINT32 uwEnd = (uwReadWrite == OS_QUEUE_WRITE) ? pstQueueCB->usQueueTail : pstQueueCB->usQueueHead;
+    UINT32 uwFirst = (uwEnd + pstQueueCB->usQueueLen - pstQueueCB->usInFlightCnt[uwReadWrite]) % pstQueueCB->usQueueLen;
+    UINT32 uwOffset;
+    UINT32 uwPos;
+
+    if ((UINT8 *)pBuffer < pstQueueCB->pucQueue)
+    {
+        return LOS_ERRNO_QUEUE_BUF_INVALID;
+    }
+
+    uwOffset = (UINT32)((UINT8 *)pBuffer - pstQueueCB->pucQueue);
+    uwPos = uwOffset / pstQueueCB->usQueueSize;
+    if ((uwOffset % pstQueueCB->usQueueSize != 0) || (uwPos >= pstQueueCB->usQueueLen))
+    {
+        return LOS_ERRNO_QUEUE_BUF_INVALID;
+    }
+
+    /* the node must be in flight and not finished yet */
+    if (((uwPos + pstQueueCB->usQueueLen - uwFirst) % pstQueueCB->usQueueLen >= pstQueueCB->usInFlightCnt[uwReadWrite]) ||
+        ((osQueueNodeSizeGet(pstQueueCB, (UINT16)uwPos) == 0) != (uwReadWrite == OS_QUEUE_WRITE)))
+    {
+        return LOS_ERRNO_QUEUE_BUF_INVALID;
+    }
+
+    *pusPos = (UINT16)uwPos;
+    return LOS_OK;
+}
+
+/*****************************************************************************
+ Function    : osQueueUnitTake
+ Description : Take a readable or writable node, wait for one if there is none
+ Input       : pstQueueCB  --- queue control block
+               uwReadWrite --- OS_QUEUE_READ or OS_QUEUE_WRITE
+               uwTimeOut   --- timeout in ticks
+               puvIntSave  --- interrupt state saved by the caller, interrupts are locked
+ Output      : None
+ Return      : LOS_OK on success or error code on failure
+ *****************************************************************************/
+static UINT32 osQueueUnitTake(QUEUE_CB_S *pstQueueCB, UINT32 uwReadWrite, UINT32 uwTimeOut, UINTPTR *puvIntSave)
+{
+    LOS_TASK_CB *pstRunTsk;
+
+    if (0 != pstQueueCB->usReadWriteableCnt[uwReadWrite])
+    {
+        pstQueueCB->usReadWriteableCnt[uwReadWrite]--;
+        return LOS_OK;
+    }
+
+    if (LOS_NO_WAIT == uwTimeOut)
+    {
+        return (uwReadWrite == OS_QUEUE_READ) ? LOS_ERRNO_QUEUE_ISEMPTY : LOS_ERRNO_QUEUE_ISFULL;
+    }
+
+    if (g_usLosTaskLock)
+    {
+        return LOS_ERRNO_QUEUE_PEND_IN_LOCK;
+    }
+
+    /* the waker hands the node over without counting it */
+    pstRunTsk = (LOS_TASK_CB *)g_stLosTask.pstRunTask;
+    osTaskWait(&pstQueueCB->stReadWriteList[uwReadWrite], OS_TASK_STATUS_PEND_QUEUE, uwTimeOut, pstQueueCB->usPendOrder);
+    LOS_IntRestore(*puvIntSave);
+    LOS_Schedule();
+
+    *puvIntSave = LOS_IntLock();
+    if (pstRunTsk->usTaskStatus & OS_TASK_STATUS_TIMEOUT)
+    {
+        pstRunTsk->usTaskStatus &= (~OS_TASK_STATUS_TIMEOUT);
+        return LOS_ERRNO_QUEUE_TIMEOUT;
+    }
+
+    return LOS_OK;
+}
+
+/*****************************************************************************
+ Function    : osQueueUnitGive
+ Description : Give readable or writable nodes, handing them to waiting tasks first
+ Input       : pstQueueCB  --- queue control block
+               uwReadWrite --- OS_QUEUE_READ or OS_QUEUE_WRITE
+               uwCount     --- number of nodes
+ Output      : None
+ Return      : TRUE if a task is woken
+ *****************************************************************************/
+static BOOL osQueueUnitGive(QUEUE_CB_S *pstQueueCB, UINT32 uwReadWrite, UINT32 uwCount)
+{
+    LOS_TASK_CB *pstResumedTask;
+    BOOL bWoken = FALSE;
+
+    for (; uwCount != 0; uwCount--)
+    {
+        if (LOS_ListEmpty(&pstQueueCB->stReadWriteList[uwReadWrite]))
+        {
+            pstQueueCB->usReadWriteableCnt[uwReadWrite] += (UINT16)uwCount;
+#if (LOSCFG_BASE_IPC_MULTIWAIT == YES)
+            if (osMultiWaitSignal(&pstQueueCB->stMultiWaitList[uwReadWrite]))
+            {
+                bWoken = TRUE;
+            }
+#endif
+            break;
+        }
+
+        pstResumedTask = OS_TCB_FROM_PENDLIST(LOS_DL_LIST_FIRST(&pstQueueCB->stReadWriteList[uwReadWrite])); /*lint !e413*/
+        osTaskWake(pstResumedTask, OS_TASK_STATUS_PEND_QUEUE);
+        bWoken = TRUE;
+    }
+
+    return bWoken;
+}
+
+/*****************************************************************************
+ Function    : osQueueBufferOperate
+ Description : Copy a message into or out of the node taken by the caller
+ Input       : pstQueueCB    --- queue control block
+               uwOperateType --- operate type
+               pBufferAddr   --- message buffer
+               puwBufferSize --- message size for write
+ Output      : puwBufferSize --- message size for read
+ Return      : number of nodes to give to the other side
+ *****************************************************************************/
+static UINT32 osQueueBufferOperate(QUEUE_CB_S *pstQueueCB, UINT32 uwOperateType, VOID *pBufferAddr, UINT32 *puwBufferSize)
 {
     UINT8        *pucQueueNode;
     UINT32       uwMsgDataSize = 0;
@@ -254,38 +532,56 @@ static VOID osQueueBufferOperate(QUEUE_CB_S *pstQueueCB, UINT32 uwOperateType, V
 
         default: //read tail , reserved.
             PRINT_ERR("invalid queue operate type!\n");
-            return;
+            return 0;
     }
 
-    pucQueueNode = &(pstQueueCB->pucQueue[(usQueuePosion * (pstQueueCB->usQueueSize))]);
+    pucQueueNode = OS_QUEUE_NODE(pstQueueCB, usQueuePosion);
 
     if(OS_QUEUE_IS_READ(uwOperateType))
     {
-        memcpy((VOID *)&uwMsgDataSize, (VOID *)(pucQueueNode + pstQueueCB->usQueueSize - sizeof(UINT32)), sizeof(UINT32));
+        uwMsgDataSize = osQueueNodeSizeGet(pstQueueCB, usQueuePosion);
         memcpy((VOID *)pBufferAddr, (VOID *)pucQueueNode, uwMsgDataSize);
         *puwBufferSize = uwMsgDataSize;
+
+        if (0 == pstQueueCB->usInFlightCnt[OS_QUEUE_READ])
+        {
+            return 1;
+        }
+
+        /* peeked nodes in front of this one are not released yet */
+        osQueueNodeSizeSet(pstQueueCB, usQueuePosion, 0);
+        pstQueueCB->usInFlightCnt[OS_QUEUE_READ]++;
+        return osQueueInFlightScan(pstQueueCB, OS_QUEUE_READ);
     }
-    else
+
+    memcpy((VOID *)pucQueueNode, (VOID *)pBufferAddr, *puwBufferSize);
+    osQueueNodeSizeSet(pstQueueCB, usQueuePosion, *puwBufferSize);
+
+    if ((OS_QUEUE_WRITE_HEAD == OS_QUEUE_OPERATE_GET(uwOperateType)) || (0 == pstQueueCB->usInFlightCnt[OS_QUEUE_WRITE]))
     {
-        memcpy((VOID *)pucQueueNode, (VOID *)pBufferAddr, *puwBufferSize);
-        memcpy((VOID *)(pucQueueNode + pstQueueCB->usQueueSize - sizeof(UINT32)), puwBufferSize, sizeof(UINT32));
+        return 1;
     }
+
+    /* reserved nodes in front of this one are not committed yet */
+    pstQueueCB->usInFlightCnt[OS_QUEUE_WRITE]++;
+    return osQueueInFlightScan(pstQueueCB, OS_QUEUE_WRITE);
 }
 
 
 UINT32 osQueueOperate(UINT32 uwQueueID, UINT32 uwOperateType, VOID *pBufferAddr, UINT32 *puwBufferSize, UINT32 uwTimeOut)
 {
     QUEUE_CB_S *pstQueueCB;
-    LOS_TASK_CB  *pstRunTsk;
     UINTPTR      uvIntSave;
-    LOS_TASK_CB  *pstResumedTask;
     UINT32       uwRet = LOS_OK;
+    UINT32       uwCount;
     UINT32       uwReadWrite = OS_QUEUE_READ_WRITE_GET(uwOperateType);
 
+    OS_INT_PRIO_CHECK();
+
     uvIntSave = LOS_IntLock();
 
     pstQueueCB = (QUEUE_CB_S *)GET_QUEUE_HANDLE(uwQueueID);
-    if (OS_QUEUE_UNUSED == pstQueueCB->usQueueState)
+    if (OS_QUEUE_NOT_CREATED(pstQueueCB, uwQueueID))
     {
         uwRet = LOS_ERRNO_QUEUE_NOT_CREATE;
         goto QUEUE_END;
@@ -303,55 +599,121 @@ UINT32 osQueueOperate(UINT32 uwQueueID, UINT32 uwOperateType, VOID *pBufferAddr,
         goto QUEUE_END;
     }
 
-    if (0 == pstQueueCB->usReadWriteableCnt[uwReadWrite])
+    uwRet = osQueueUnitTake(pstQueueCB, uwReadWrite, uwTimeOut, &uvIntSave);
+    if (uwRet != LOS_OK)
     {
-        if (LOS_NO_WAIT == uwTimeOut)
-        {
-            uwRet = OS_QUEUE_IS_READ(uwOperateType) ? LOS_ERRNO_QUEUE_ISEMPTY : LOS_ERRNO_QUEUE_ISFULL;
-            goto QUEUE_END;
-        }
+        goto QUEUE_END;
+    }
 
-        if (g_usLosTaskLock)
+    /* the node in front of the head is free only when no peeked node is outstanding */
+    if ((OS_QUEUE_WRITE_HEAD == OS_QUEUE_OPERATE_GET(uwOperateType)) && (0 != pstQueueCB->usInFlightCnt[OS_QUEUE_READ]))
+    {
+        uwRet = LOS_ERRNO_QUEUE_PEEK_BUSY;
+        if (osQueueUnitGive(pstQueueCB, OS_QUEUE_WRITE, 1))
         {
-            uwRet = LOS_ERRNO_QUEUE_PEND_IN_LOCK;
-            goto QUEUE_END;
+            LOS_IntRestore(uvIntSave);
+            LOS_Schedule();
+            return uwRet;
         }
+        goto QUEUE_END;
+    }
 
-        pstRunTsk = (LOS_TASK_CB *)g_stLosTask.pstRunTask;
-        osTaskWait(&pstQueueCB->stReadWriteList[uwReadWrite], OS_TASK_STATUS_PEND_QUEUE, uwTimeOut);
+    uwCount = osQueueBufferOperate(pstQueueCB, uwOperateType, pBufferAddr, puwBufferSize);
+    OS_TRACE(OS_QUEUE_IS_READ(uwOperateType) ? LOS_TRACE_QUEUE_READ : LOS_TRACE_QUEUE_WRITE, uwQueueID, uwTimeOut);
+
+    if (osQueueUnitGive(pstQueueCB, !uwReadWrite, uwCount)) /*lint !e514*/
+    {
         LOS_IntRestore(uvIntSave);
         LOS_Schedule();
+        return LOS_OK;
+    }
 
-        uvIntSave = LOS_IntLock();
+QUEUE_END:
+    LOS_IntRestore(uvIntSave);
+    return uwRet;
+}
 
-        if (pstRunTsk->usTaskStatus & OS_TASK_STATUS_TIMEOUT)
-        {
-            pstRunTsk->usTaskStatus &= (~OS_TASK_STATUS_TIMEOUT);
-            uwRet = LOS_ERRNO_QUEUE_TIMEOUT;
-            goto QUEUE_END;
-        }
+/*****************************************************************************
+ Function    : osQueueBatchOperate
+ Description : Read or write several messages under one interrupt lock
+ Input       : uwQueueID     --- QueueID
+               uwOperateType --- operate type
+               pucBufferAddr --- messages, one every uwBufferSize bytes
+               uwBufferSize  --- size of each message buffer
+               puwCount      --- number of messages wanted
+               uwTimeOut     --- timeout in ticks
+ Output      : puwSizes      --- size of each message read, may be NULL
+               puwCount      --- number of messages read or written
+ Return      : LOS_OK on success or error code on failure
+ *****************************************************************************/
+static UINT32 osQueueBatchOperate(UINT32 uwQueueID, UINT32 uwOperateType, UINT8 *pucBufferAddr, UINT32 uwBufferSize,
+                                  UINT32 *puwSizes, UINT32 *puwCount, UINT32 uwTimeOut)
+{
+    QUEUE_CB_S *pstQueueCB;
+    UINTPTR     uvIntSave;
+    UINT32      uwRet;
+    UINT32      uwMore;
+    UINT32      uwIndex;
+    UINT32      uwMsgSize;
+    UINT32      uwCount = 0;
+    UINT32      uwReadWrite = OS_QUEUE_READ_WRITE_GET(uwOperateType);
+
+    uvIntSave = LOS_IntLock();
+    pstQueueCB = (QUEUE_CB_S *)GET_QUEUE_HANDLE(uwQueueID);
+    if (OS_QUEUE_NOT_CREATED(pstQueueCB, uwQueueID))
+    {
+        uwRet = LOS_ERRNO_QUEUE_NOT_CREATE;
+        goto QUEUE_END;
     }
-    else
+
+    if (OS_QUEUE_IS_READ(uwOperateType) && (uwBufferSize < pstQueueCB->usQueueSize - sizeof(UINT32)))
     {
-        pstQueueCB->usReadWriteableCnt[uwReadWrite]--;
+        uwRet = LOS_ERRNO_QUEUE_READ_SIZE_TOO_SMALL;
+        goto QUEUE_END;
+    }
+    else if (OS_QUEUE_IS_WRITE(uwOperateType) && (uwBufferSize > pstQueueCB->usQueueSize - sizeof(UINT32)))
+    {
+        uwRet = LOS_ERRNO_QUEUE_WRITE_SIZE_TOO_BIG;
+        goto QUEUE_END;
     }
 
-    osQueueBufferOperate(pstQueueCB, uwOperateType, pBufferAddr, puwBufferSize);
+    /* wait for the first node only, then take what is there */
+    uwRet = osQueueUnitTake(pstQueueCB, uwReadWrite, uwTimeOut, &uvIntSave);
+    if (uwRet != LOS_OK)
+    {
+        goto QUEUE_END;
+    }
 
-    if (!LOS_ListEmpty(&pstQueueCB->stReadWriteList[!uwReadWrite])) /*lint !e514*/
+    uwMore = *puwCount - 1;
+    if (uwMore > pstQueueCB->usReadWriteableCnt[uwReadWrite])
+    {
+        uwMore = pstQueueCB->usReadWriteableCnt[uwReadWrite];
+    }
+    pstQueueCB->usReadWriteableCnt[uwReadWrite] -= (UINT16)uwMore;
+
+    for (uwIndex = 0; uwIndex <= uwMore; uwIndex++)
+    {
+        uwMsgSize = uwBufferSize;
+        uwCount += osQueueBufferOperate(pstQueueCB, uwOperateType, pucBufferAddr + uwIndex * uwBufferSize, &uwMsgSize);
+        if (puwSizes != NULL)
+        {
+            puwSizes[uwIndex] = uwMsgSize;
+        }
+    }
+    *puwCount = uwMore + 1;
+    OS_TRACE(OS_QUEUE_IS_READ(uwOperateType) ? LOS_TRACE_QUEUE_READ : LOS_TRACE_QUEUE_WRITE, uwQueueID, uwTimeOut);
+
+    if (osQueueUnitGive(pstQueueCB, !uwReadWrite, uwCount)) /*lint !e514*/
     {
-        pstResumedTask = OS_TCB_FROM_PENDLIST(LOS_DL_LIST_FIRST(&pstQueueCB->stReadWriteList[!uwReadWrite])); /*lint !e413 !e514*/
-        osTaskWake(pstResumedTask, OS_TASK_STATUS_PEND_QUEUE);
         LOS_IntRestore(uvIntSave);
         LOS_Schedule();
         return LOS_OK;
     }
-    else
-    {
-        pstQueueCB->usReadWriteableCnt[!uwReadWrite]++; /*lint !e514*/
-    }
+    LOS_IntRestore(uvIntSave);
+    return LOS_OK;
 
 QUEUE_END:
+    *puwCount = 0;
     LOS_IntRestore(uvIntSave);
     return uwRet;
 }
@@ -497,6 +859,319 @@ LITE_OS_SEC_TEXT UINT32 LOS_QueueWriteHead( UINT32 uwQueueID,
     return LOS_QueueWriteHeadCopy(uwQueueID, &pBufferAddr, uwBufferSize, uwTimeOut);
 }
 
+/*****************************************************************************
+ Function    : LOS_QueueReserve
+ Description : Reserve the tail node of a queue to fill in place
+ Input       : uwQueueID   --- QueueID
+               uwTimeOut   --- TimeOut
+ Output      : ppBuffer    --- node to fill, at most usMaxMsgSize bytes
+ Return      : LOS_OK on success or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT UINT32 LOS_QueueReserve(UINT32 uwQueueID, VOID **ppBuffer, UINT32 uwTimeOut)
+{
+    QUEUE_CB_S *pstQueueCB;
+    UINTPTR     uvIntSave;
+    UINT32      uwRet;
+    UINT16      usPos;
+
+    OS_INT_PRIO_CHECK();
+
+    if (NULL == GET_QUEUE_HANDLE(uwQueueID))
+    {
+        return LOS_ERRNO_QUEUE_INVALID;
+    }
+
+    if (NULL == ppBuffer)
+    {
+        return LOS_ERRNO_QUEUE_WRITE_PTR_NULL;
+    }
+
+    if ((LOS_NO_WAIT != uwTimeOut) && OS_INT_ACTIVE)
+    {
+        return LOS_ERRNO_QUEUE_WRITE_IN_INTERRUPT;
+    }
+
+    uvIntSave = LOS_IntLock();
+    pstQueueCB = (QUEUE_CB_S *)GET_QUEUE_HANDLE(uwQueueID);
+    if (OS_QUEUE_NOT_CREATED(pstQueueCB, uwQueueID))
+    {
+        LOS_IntRestore(uvIntSave);
+        return LOS_ERRNO_QUEUE_NOT_CREATE;
+    }
+
+    uwRet = osQueueUnitTake(pstQueueCB, OS_QUEUE_WRITE, uwTimeOut, &uvIntSave);
+    if (uwRet != LOS_OK)
+    {
+        LOS_IntRestore(uvIntSave);
+        return uwRet;
+    }
+
+    /* a zero size marks the node as not committed */
+    usPos = pstQueueCB->usQueueTail;
+    (pstQueueCB->usQueueTail + 1 == pstQueueCB->usQueueLen) ? (pstQueueCB->usQueueTail = 0) : (pstQueueCB->usQueueTail++);
+    osQueueNodeSizeSet(pstQueueCB, usPos, 0);
+    pstQueueCB->usInFlightCnt[OS_QUEUE_WRITE]++;
+    *ppBuffer = (VOID *)OS_QUEUE_NODE(pstQueueCB, usPos);
+    LOS_IntRestore(uvIntSave);
+
+    return LOS_OK;
+}
+
+/*****************************************************************************
+ Function    : LOS_QueueCommit
+ Description : Commit a node reserved by LOS_QueueReserve
+ Input       : uwQueueID    --- QueueID
+               pBuffer      --- node returned by LOS_QueueReserve
+               uwBufferSize --- size of the message in the node
+ Output      : None
+ Return      : LOS_OK on success or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT UINT32 LOS_QueueCommit(UINT32 uwQueueID, VOID *pBuffer, UINT32 uwBufferSize)
+{
+    QUEUE_CB_S *pstQueueCB;
+    UINTPTR     uvIntSave;
+    UINT32      uwRet;
+    UINT16      usPos;
+
+    OS_INT_PRIO_CHECK();
+
+    if (NULL == GET_QUEUE_HANDLE(uwQueueID))
+    {
+        return LOS_ERRNO_QUEUE_INVALID;
+    }
+
+    if (NULL == pBuffer)
+    {
+        return LOS_ERRNO_QUEUE_WRITE_PTR_NULL;
+    }
+
+    if (0 == uwBufferSize)
+    {
+        return LOS_ERRNO_QUEUE_WRITESIZE_ISZERO;
+    }
+
+    uvIntSave = LOS_IntLock();
+    pstQueueCB = (QUEUE_CB_S *)GET_QUEUE_HANDLE(uwQueueID);
+    if (OS_QUEUE_NOT_CREATED(pstQueueCB, uwQueueID))
+    {
+        uwRet = LOS_ERRNO_QUEUE_NOT_CREATE;
+        goto QUEUE_END;
+    }
+
+    if (uwBufferSize > pstQueueCB->usQueueSize - sizeof(UINT32))
+    {
+        uwRet = LOS_ERRNO_QUEUE_WRITE_SIZE_TOO_BIG;
+        goto QUEUE_END;
+    }
+
+    uwRet = osQueueInFlightPosGet(pstQueueCB, pBuffer, OS_QUEUE_WRITE, &usPos);
+    if (uwRet != LOS_OK)
+    {
+        goto QUEUE_END;
+    }
+
+    osQueueNodeSizeSet(pstQueueCB, usPos, uwBufferSize);
+    OS_TRACE(LOS_TRACE_QUEUE_WRITE, uwQueueID, LOS_NO_WAIT);
+    if (osQueueUnitGive(pstQueueCB, OS_QUEUE_READ, osQueueInFlightScan(pstQueueCB, OS_QUEUE_WRITE)))
+    {
+        LOS_IntRestore(uvIntSave);
+        LOS_Schedule();
+        return LOS_OK;
+    }
+
+QUEUE_END:
+    LOS_IntRestore(uvIntSave);
+    return uwRet;
+}
+
+/*****************************************************************************
+ Function    : LOS_QueuePeek
+ Description : Take the head node of a queue to read in place
+ Input       : uwQueueID     --- QueueID
+               uwTimeOut     --- TimeOut
+ Output      : ppBuffer      --- node holding the message
+               puwBufferSize --- size of the message
+ Return      : LOS_OK on success or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT UINT32 LOS_QueuePeek(UINT32 uwQueueID, VOID **ppBuffer, UINT32 *puwBufferSize, UINT32 uwTimeOut)
+{
+    QUEUE_CB_S *pstQueueCB;
+    UINTPTR     uvIntSave;
+    UINT32      uwRet;
+    UINT16      usPos;
+
+    OS_INT_PRIO_CHECK();
+
+    if (NULL == GET_QUEUE_HANDLE(uwQueueID))
+    {
+        return LOS_ERRNO_QUEUE_INVALID;
+    }
+
+    if ((NULL == ppBuffer) || (NULL == puwBufferSize))
+    {
+        return LOS_ERRNO_QUEUE_READ_PTR_NULL;
+    }
+
+    if ((LOS_NO_WAIT != uwTimeOut) && OS_INT_ACTIVE)
+    {
+        return LOS_ERRNO_QUEUE_READ_IN_INTERRUPT;
+    }
+
+    uvIntSave = LOS_IntLock();
+    pstQueueCB = (QUEUE_CB_S *)GET_QUEUE_HANDLE(uwQueueID);
+    if (OS_QUEUE_NOT_CREATED(pstQueueCB, uwQueueID))
+    {
+        LOS_IntRestore(uvIntSave);
+        return LOS_ERRNO_QUEUE_NOT_CREATE;
+    }
+
+    uwRet = osQueueUnitTake(pstQueueCB, OS_QUEUE_READ, uwTimeOut, &uvIntSave);
+    if (uwRet != LOS_OK)
+    {
+        LOS_IntRestore(uvIntSave);
+        return uwRet;
+    }
+
+    usPos = pstQueueCB->usQueueHead;
+    (pstQueueCB->usQueueHead + 1 == pstQueueCB->usQueueLen) ? (pstQueueCB->usQueueHead = 0) : (pstQueueCB->usQueueHead++);
+    pstQueueCB->usInFlightCnt[OS_QUEUE_READ]++;
+    *ppBuffer = (VOID *)OS_QUEUE_NODE(pstQueueCB, usPos);
+    *puwBufferSize = osQueueNodeSizeGet(pstQueueCB, usPos);
+    OS_TRACE(LOS_TRACE_QUEUE_READ, uwQueueID, uwTimeOut);
+    LOS_IntRestore(uvIntSave);
+
+    return LOS_OK;
+}
+
+/*****************************************************************************
+ Function    : LOS_QueueRelease
+ Description : Release a node taken by LOS_QueuePeek
+ Input       : uwQueueID --- QueueID
+               pBuffer   --- node returned by LOS_QueuePeek
+ Output      : None
+ Return      : LOS_OK on success or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT UINT32 LOS_QueueRelease(UINT32 uwQueueID, VOID *pBuffer)
+{
+    QUEUE_CB_S *pstQueueCB;
+    UINTPTR     uvIntSave;
+    UINT32      uwRet;
+    UINT16      usPos;
+
+    OS_INT_PRIO_CHECK();
+
+    if (NULL == GET_QUEUE_HANDLE(uwQueueID))
+    {
+        return LOS_ERRNO_QUEUE_INVALID;
+    }
+
+    if (NULL == pBuffer)
+    {
+        return LOS_ERRNO_QUEUE_READ_PTR_NULL;
+    }
+
+    uvIntSave = LOS_IntLock();
+    pstQueueCB = (QUEUE_CB_S *)GET_QUEUE_HANDLE(uwQueueID);
+    if (OS_QUEUE_NOT_CREATED(pstQueueCB, uwQueueID))
+    {
+        uwRet = LOS_ERRNO_QUEUE_NOT_CREATE;
+        goto QUEUE_END;
+    }
+
+    uwRet = osQueueInFlightPosGet(pstQueueCB, pBuffer, OS_QUEUE_READ, &usPos);
+    if (uwRet != LOS_OK)
+    {
+        goto QUEUE_END;
+    }
+
+    /* a zero size marks the node as released */
+    osQueueNodeSizeSet(pstQueueCB, usPos, 0);
+    if (osQueueUnitGive(pstQueueCB, OS_QUEUE_WRITE, osQueueInFlightScan(pstQueueCB, OS_QUEUE_READ)))
+    {
+        LOS_IntRestore(uvIntSave);
+        LOS_Schedule();
+        return LOS_OK;
+    }
+
+QUEUE_END:
+    LOS_IntRestore(uvIntSave);
+    return uwRet;
+}
+
+/*****************************************************************************
+ Function    : LOS_QueueReadBatch
+ Description : Read several messages from a queue
+ Input       : uwQueueID    --- QueueID
+               uwBufferSize --- size of each message buffer
+               puwCount     --- number of messages wanted
+               uwTimeOut    --- TimeOut
+ Output      : pBufferAddr  --- messages, one every uwBufferSize bytes
+               puwSizes     --- size of each message, may be NULL
+               puwCount     --- number of messages read
+ Return      : LOS_OK on success or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT UINT32 LOS_QueueReadBatch(UINT32 uwQueueID,
+                                           VOID *pBufferAddr,
+                                           UINT32 uwBufferSize,
+                                           UINT32 *puwSizes,
+                                           UINT32 *puwCount,
+                                           UINT32 uwTimeOut)
+{
+    UINT32 uwRet;
+
+    OS_INT_PRIO_CHECK();
+
+    uwRet = osQueueReadParameterCheck(uwQueueID, pBufferAddr, &uwBufferSize, uwTimeOut);
+    if (uwRet != LOS_OK)
+    {
+        return uwRet;
+    }
+
+    if ((NULL == puwCount) || (0 == *puwCount))
+    {
+        return LOS_ERRNO_QUEUE_BATCH_COUNT_INVALID;
+    }
+
+    return osQueueBatchOperate(uwQueueID, OS_QUEUE_OPERATE_TYPE(OS_QUEUE_READ, OS_QUEUE_HEAD),
+                               (UINT8 *)pBufferAddr, uwBufferSize, puwSizes, puwCount, uwTimeOut);
+}
+
+/*****************************************************************************
+ Function    : LOS_QueueWriteBatch
+ Description : Write several messages to the tail of a queue
+ Input       : uwQueueID    --- QueueID
+               pBufferAddr  --- messages, one every uwBufferSize bytes
+               uwBufferSize --- size of each message
+               puwCount     --- number of messages to write
+               uwTimeOut    --- TimeOut
+ Output      : puwCount     --- number of messages written
+ Return      : LOS_OK on success or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT UINT32 LOS_QueueWriteBatch(UINT32 uwQueueID,
+                                            VOID *pBufferAddr,
+                                            UINT32 uwBufferSize,
+                                            UINT32 *puwCount,
+                                            UINT32 uwTimeOut)
+{
+    UINT32 uwRet;
+
+    OS_INT_PRIO_CHECK();
+
+    uwRet = osQueueWriteParameterCheck(uwQueueID, pBufferAddr, &uwBufferSize, uwTimeOut);
+    if (uwRet != LOS_OK)
+    {
+        return uwRet;
+    }
+
+    if ((NULL == puwCount) || (0 == *puwCount))
+    {
+        return LOS_ERRNO_QUEUE_BATCH_COUNT_INVALID;
+    }
+
+    return osQueueBatchOperate(uwQueueID, OS_QUEUE_OPERATE_TYPE(OS_QUEUE_WRITE, OS_QUEUE_TAIL),
+                               (UINT8 *)pBufferAddr, uwBufferSize, NULL, puwCount, uwTimeOut);
+}
+
 /*****************************************************************************
  Function    : osQueueMailAlloc
  Description : Mail allocate memory
@@ -513,7 +1188,7 @@ LITE_OS_SEC_TEXT VOID *osQueueMailAlloc(UINT32  uwQueueID, VOID* pMailPool, UINT
     QUEUE_CB_S *pstQueueCB = (QUEUE_CB_S *)NULL;
     LOS_TASK_CB *pstRunTsk = (LOS_TASK_CB *)NULL;
 
-    if (uwQueueID >= LOSCFG_BASE_IPC_QUEUE_LIMIT)
+    if (NULL == GET_QUEUE_HANDLE(uwQueueID))
     {
         return NULL;
     }
@@ -533,7 +1208,7 @@ LITE_OS_SEC_TEXT VOID *osQueueMailAlloc(UINT32  uwQueueID, VOID* pMailPool, UINT
 
     uvIntSave = LOS_IntLock();
     pstQueueCB = GET_QUEUE_HANDLE(uwQueueID);
-    if (OS_QUEUE_UNUSED == pstQueueCB->usQueueState)
+    if (OS_QUEUE_NOT_CREATED(pstQueueCB, uwQueueID))
     {
         goto END;
     }
@@ -547,7 +1222,7 @@ LITE_OS_SEC_TEXT VOID *osQueueMailAlloc(UINT32  uwQueueID, VOID* pMailPool, UINT
         }
 
         pstRunTsk = (LOS_TASK_CB *)g_stLosTask.pstRunTask;
-        osTaskWait(&pstQueueCB->stMemList, OS_TASK_STATUS_PEND_QUEUE, uwTimeOut);
+        osTaskWait(&pstQueueCB->stMemList, OS_TASK_STATUS_PEND_QUEUE, uwTimeOut, pstQueueCB->usPendOrder);
         LOS_IntRestore(uvIntSave);
         LOS_Schedule();
 
@@ -587,7 +1262,7 @@ LITE_OS_SEC_TEXT UINT32 osQueueMailFree(UINT32  uwQueueID, VOID* pMailPool, VOID
     QUEUE_CB_S *pstQueueCB = (QUEUE_CB_S *)NULL;
     LOS_TASK_CB *pstResumedTask = (LOS_TASK_CB *)NULL;
 
-    if (uwQueueID >= LOSCFG_BASE_IPC_QUEUE_LIMIT)
+    if (NULL == GET_QUEUE_HANDLE(uwQueueID))
     {
         return LOS_ERRNO_QUEUE_MAIL_HANDLE_INVALID;
     }
@@ -606,7 +1281,7 @@ LITE_OS_SEC_TEXT UINT32 osQueueMailFree(UINT32  uwQueueID, VOID* pMailPool, VOID
     }
 
     pstQueueCB = GET_QUEUE_HANDLE(uwQueueID);
-    if (OS_QUEUE_UNUSED == pstQueueCB->usQueueState)
+    if (OS_QUEUE_NOT_CREATED(pstQueueCB, uwQueueID))
     {
         LOS_IntRestore(uvIntSave);
         return LOS_ERRNO_QUEUE_NOT_CREATE;
@@ -644,14 +1319,14 @@ LITE_OS_SEC_TEXT_INIT UINT32 LOS_QueueDelete(UINT32 uwQueueID)
     UINTPTR  uvIntSave;
     UINT32 uwRet;
 
-    if (uwQueueID >= LOSCFG_BASE_IPC_QUEUE_LIMIT)
+    if (NULL == GET_QUEUE_HANDLE(uwQueueID))
     {
         return LOS_ERRNO_QUEUE_NOT_FOUND;
     }
 
     uvIntSave = LOS_IntLock();
     pstQueueCB = (QUEUE_CB_S *)GET_QUEUE_HANDLE(uwQueueID);
-    if (OS_QUEUE_UNUSED == pstQueueCB->usQueueState)
+    if (OS_QUEUE_NOT_CREATED(pstQueueCB, uwQueueID))
     {
         uwRet = LOS_ERRNO_QUEUE_NOT_CREATE;
         goto QUEUE_END;
@@ -675,18 +1350,34 @@ LITE_OS_SEC_TEXT_INIT UINT32 LOS_QueueDelete(UINT32 uwQueueID)
         goto QUEUE_END;
     }
 
+#if (LOSCFG_BASE_IPC_MULTIWAIT == YES)
+    if (!LOS_ListEmpty(&pstQueueCB->stMultiWaitList[OS_QUEUE_READ]) ||
+        !LOS_ListEmpty(&pstQueueCB->stMultiWaitList[OS_QUEUE_WRITE]))
+    {
+        uwRet = LOS_ERRNO_QUEUE_IN_TSKUSE;
+        goto QUEUE_END;
+    }
+#endif
+
     if ((pstQueueCB->usReadWriteableCnt[OS_QUEUE_WRITE] + pstQueueCB->usReadWriteableCnt[OS_QUEUE_READ]) != pstQueueCB->usQueueLen)
     {
         uwRet = LOS_ERRNO_QUEUE_IN_TSKWRITE;
         goto QUEUE_END;
     }
 
-    pucQueue = pstQueueCB->pucQueue;
+    /* the storage of a static queue belongs to its creator */
+    pucQueue = pstQueueCB->usStaticBuf ? (UINT8 *)NULL : pstQueueCB->pucQueue;
     pstQueueCB->pucQueue = (UINT8 *)NULL;
     pstQueueCB->usQueueState = OS_QUEUE_UNUSED;
+    pstQueueCB->uwQueueID = OS_OBJ_NEXT_HANDLE(&g_stQueueTable, uwQueueID);
     LOS_ListAdd(&g_stFreeQueueList, &pstQueueCB->stReadWriteList[OS_QUEUE_WRITE]);
     LOS_IntRestore(uvIntSave);
 
+    if (NULL == pucQueue)
+    {
+        return LOS_OK;
+    }
+
     uwRet = LOS_MemFree(m_aucSysMem0, (VOID *)pucQueue);
     return uwRet;
 
@@ -714,7 +1405,7 @@ LITE_OS_SEC_TEXT_MINOR UINT32 LOS_QueueInfoGet(UINT32 uwQueueID, QUEUE_INFO_S *p
         return LOS_ERRNO_QUEUE_PTR_NULL;
     }
 
-    if (uwQueueID >= LOSCFG_BASE_IPC_QUEUE_LIMIT)
+    if (NULL == GET_QUEUE_HANDLE(uwQueueID))
     {
         return LOS_ERRNO_QUEUE_INVALID;
     }
@@ -724,7 +1415,7 @@ LITE_OS_SEC_TEXT_MINOR UINT32 LOS_QueueInfoGet(UINT32 uwQueueID, QUEUE_INFO_S *p
 
     pstQueueCB = (QUEUE_CB_S *)GET_QUEUE_HANDLE(uwQueueID);
 
-    if (OS_QUEUE_UNUSED == pstQueueCB->usQueueState)
+    if (OS_QUEUE_NOT_CREATED(pstQueueCB, uwQueueID))
     {
         uwRet = LOS_ERRNO_QUEUE_NOT_CREATE;
         goto QUEUE_END;
@@ -758,6 +1449,45 @@ QUEUE_END:
     return uwRet;
 }
 
+/*****************************************************************************
+ Function    : LOS_QueuePendOrderSet
+ Description : Set the order of the tasks pending on a queue
+ Input       : uwQueueID   --- QueueID
+               uwPendOrder --- LOS_PEND_FIFO or LOS_PEND_PRIO
+ Output      : None
+ Return      : LOS_OK on success or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_MINOR UINT32 LOS_QueuePendOrderSet(UINT32 uwQueueID, UINT32 uwPendOrder)
+{
+    UINTPTR uvIntSave;
+    QUEUE_CB_S *pstQueueCB;
+
+    if (NULL == GET_QUEUE_HANDLE(uwQueueID))
+    {
+        return LOS_ERRNO_QUEUE_INVALID;
+    }
+
+    if (uwPendOrder > LOS_PEND_PRIO)
+    {
+        return LOS_ERRNO_QUEUE_PEND_ORDER_INVALID;
+    }
+
+    uvIntSave = LOS_IntLock();
+    pstQueueCB = (QUEUE_CB_S *)GET_QUEUE_HANDLE(uwQueueID);
+    if (OS_QUEUE_NOT_CREATED(pstQueueCB, uwQueueID))
+    {
+        LOS_IntRestore(uvIntSave);
+        return LOS_ERRNO_QUEUE_NOT_CREATE;
+    }
+
+    pstQueueCB->usPendOrder = (UINT16)uwPendOrder;
+    osTaskPendOrderSet(&pstQueueCB->stReadWriteList[OS_QUEUE_READ], uwPendOrder);
+    osTaskPendOrderSet(&pstQueueCB->stReadWriteList[OS_QUEUE_WRITE], uwPendOrder);
+    osTaskPendOrderSet(&pstQueueCB->stMemList, uwPendOrder);
+    LOS_IntRestore(uvIntSave);
+    return LOS_OK;
+}
+
 #endif /*(LOSCFG_BASE_IPC_QUEUE == YES)*/
 
 #ifdef __cplusplus
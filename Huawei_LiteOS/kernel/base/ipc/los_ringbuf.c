@@ -0,0 +1,446 @@
+/*----------------------------------------------------------------------------
+ * Copyright (c) <2013-2015>, <Huawei Technologies Co., Ltd>
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *---------------------------------------------------------------------------*/
+/*----------------------------------------------------------------------------
+ * Notice of Export Control Law
+ * ===============================================
+ * Huawei LiteOS may be subject to applicable export control laws and regulations, which might
+ * include those applicable to Huawei LiteOS of U.S. and the country in which you are located.
+ * Import, export and usage of Huawei LiteOS in any manner by you shall be in compliance with such
+ * applicable export control laws and regulations.
+ *---------------------------------------------------------------------------*/
+
+#include "los_ringbuf.h"
+#include "los_base.ph"
+#include "los_task.ph"
+#include "los_hwi.h"
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+#endif /* __cplusplus */
+
+#if (LOSCFG_BASE_IPC_RINGBUF == YES)
+
+/* indexes run free in the low 24 bits, the top byte of uwClaim counts the producers writing */
+#define OS_RINGBUF_IDX_MASK         0x00FFFFFF
+#define OS_RINGBUF_WRITER           0x01000000
+
+/*****************************************************************************
+ Function    : osRingBufUsed
+ Description : Get the number of published bytes not popped yet
+ Input       : pstRing --- ring buffer
+ Output      : None
+ Return      : number of bytes
+ *****************************************************************************/
+LITE_OS_SEC_TEXT static inline UINT32 osRingBufUsed(RINGBUF_S *pstRing)
+{
+    return (pstRing->uwHead - pstRing->uwTail) & OS_RINGBUF_IDX_MASK;
+}
+
+/*****************************************************************************
+ Function    : osRingBufCopyIn
+ Description : Copy bytes into the storage, wrapping at its end
+ Input       : pstRing --- ring buffer
+               uwIdx   --- write index
+               pucData --- bytes to copy
+               uwLen   --- number of bytes
+ Output      : None
+ Return      : None
+ *****************************************************************************/
+LITE_OS_SEC_TEXT static VOID osRingBufCopyIn(RINGBUF_S *pstRing, UINT32 uwIdx, const UINT8 *pucData, UINT32 uwLen)
+{
+    UINT32 uwOffset = uwIdx & pstRing->uwMask;
+    UINT32 uwFirst = pstRing->uwMask + 1 - uwOffset;
+
+    if (uwFirst > uwLen)
+    {
+        uwFirst = uwLen;
+    }
+
+    (VOID)memcpy(pstRing->pucBuf + uwOffset, pucData, uwFirst);
+    (VOID)memcpy(pstRing->pucBuf, pucData + uwFirst, uwLen - uwFirst);
+}
+
+/*****************************************************************************
+ Function    : osRingBufClaim
+ Description : Claim room for a push in LOS_RINGBUF_MPSC mode
+ Input       : pstRing --- ring buffer
+               uwLen   --- number of bytes wanted
+ Output      : puwIdx  --- write index of the claimed room
+ Return      : number of bytes claimed
+ *****************************************************************************/
+LITE_OS_SEC_TEXT static UINT32 osRingBufClaim(RINGBUF_S *pstRing, UINT32 uwLen, UINT32 *puwIdx)
+{
+    UINT32 uwClaim;
+    UINT32 uwIdx;
+    UINT32 uwCnt;
+#if (__CORTEX_M >= 0x03)
+    do
+    {
+        uwClaim = __LDREXW((volatile uint32_t *)&pstRing->uwClaim);
+        uwIdx = uwClaim & OS_RINGBUF_IDX_MASK;
+        uwCnt = pstRing->uwMask + 1 - ((uwIdx - pstRing->uwTail) & OS_RINGBUF_IDX_MASK);
+        if (uwCnt > uwLen)
+        {
+            uwCnt = uwLen;
+        }
+
+        if (uwCnt == 0)
+        {
+            __CLREX();
+            return 0;
+        }
+    } while (__STREXW(((uwClaim & ~OS_RINGBUF_IDX_MASK) + OS_RINGBUF_WRITER) | ((uwIdx + uwCnt) & OS_RINGBUF_IDX_MASK),
+                      (volatile uint32_t *)&pstRing->uwClaim) != 0);
+#else
+    /* no exclusive access on ARMv6-M */
+    UINTPTR uvIntSave;
+
+    uvIntSave = LOS_IntLock();
+    uwClaim = pstRing->uwClaim;
+    uwIdx = uwClaim & OS_RINGBUF_IDX_MASK;
+    uwCnt = pstRing->uwMask + 1 - ((uwIdx - pstRing->uwTail) & OS_RINGBUF_IDX_MASK);
+    if (uwCnt > uwLen)
+    {
+        uwCnt = uwLen;
+    }
+    pstRing->uwClaim = ((uwClaim & ~OS_RINGBUF_IDX_MASK) + ((uwCnt != 0) ? OS_RINGBUF_WRITER : 0)) |
+                       ((uwIdx + uwCnt) & OS_RINGBUF_IDX_MASK);
+    LOS_IntRestore(uvIntSave);
+#endif
+
+    *puwIdx = uwIdx;
+    return uwCnt;
+}
+
+/*****************************************************************************
+ Function    : osRingBufFinish
+ Description : End a push in LOS_RINGBUF_MPSC mode. The last producer out publishes
+               everything claimed so far, which is all written by then.
+ Input       : pstRing --- ring buffer
+ Output      : None
+ Return      : None
+ *****************************************************************************/
+LITE_OS_SEC_TEXT static VOID osRingBufFinish(RINGBUF_S *pstRing)
+{
+    UINT32 uwClaim;
+    UINT32 uwHead;
+    UINT32 uwAhead;
+#if (__CORTEX_M >= 0x03)
+    do
+    {
+        uwClaim = __LDREXW((volatile uint32_t *)&pstRing->uwClaim) - OS_RINGBUF_WRITER;
+    } while (__STREXW(uwClaim, (volatile uint32_t *)&pstRing->uwClaim) != 0);
+
+    if ((uwClaim & ~OS_RINGBUF_IDX_MASK) != 0)
+    {
+        return;
+    }
+
+    /* a later last producer may have published further already, never move the head back */
+    do
+    {
+        uwHead = __LDREXW((volatile uint32_t *)&pstRing->uwHead);
+        uwAhead = (uwClaim - uwHead) & OS_RINGBUF_IDX_MASK;
+        if ((uwAhead == 0) || (uwAhead > pstRing->uwMask + 1))
+        {
+            __CLREX();
+            return;
+        }
+    } while (__STREXW(uwClaim, (volatile uint32_t *)&pstRing->uwHead) != 0);
+#else
+    UINTPTR uvIntSave;
+
+    uvIntSave = LOS_IntLock();
+    pstRing->uwClaim -= OS_RINGBUF_WRITER;
+    uwClaim = pstRing->uwClaim;
+    uwHead = pstRing->uwHead;
+    uwAhead = (uwClaim - uwHead) & OS_RINGBUF_IDX_MASK;
+    if (((uwClaim & ~OS_RINGBUF_IDX_MASK) == 0) && (uwAhead != 0) && (uwAhead <= pstRing->uwMask + 1))
+    {
+        pstRing->uwHead = uwClaim;
+    }
+    LOS_IntRestore(uvIntSave);
+#endif
+}
+
+/*****************************************************************************
+ Function    : osRingBufWake
+ Description : Wake the waiting consumer if enough bytes are there
+ Input       : pstRing --- ring buffer
+ Output      : None
+ Return      : None
+ *****************************************************************************/
+LITE_OS_SEC_TEXT static VOID osRingBufWake(RINGBUF_S *pstRing)
+{
+    LOS_TASK_CB *pstResumedTask;
+    UINTPTR uvIntSave;
+
+    uvIntSave = LOS_IntLock();
+    if (!LOS_ListEmpty(&pstRing->stWaitList) && (osRingBufUsed(pstRing) >= pstRing->uwWaitLen))
+    {
+        pstResumedTask = OS_TCB_FROM_PENDLIST(LOS_DL_LIST_FIRST(&pstRing->stWaitList)); /*lint !e413*/
+        osTaskWake(pstResumedTask, OS_TASK_STATUS_PEND);
+        LOS_IntRestore(uvIntSave);
+        LOS_Schedule();
+        return;
+    }
+    LOS_IntRestore(uvIntSave);
+}
+
+/*****************************************************************************
+ Function    : LOS_RingBufInit
+ Description : Initialize a ring buffer
+ Input       : pBuf    --- storage
+               uwSize  --- size of pBuf, a power of 2
+               uwMode  --- LOS_RINGBUF_SPSC or LOS_RINGBUF_MPSC
+ Output      : pstRing --- ring buffer
+ Return      : LOS_OK on success or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_INIT UINT32 LOS_RingBufInit(RINGBUF_S *pstRing, VOID *pBuf, UINT32 uwSize, UINT32 uwMode)
+{
+    if ((NULL == pstRing) || (NULL == pBuf))
+    {
+        return LOS_ERRNO_RINGBUF_PTR_NULL;
+    }
+
+    if ((0 == uwSize) || (uwSize & (uwSize - 1)) || (uwSize > LOS_RINGBUF_SIZE_MAX))
+    {
+        return LOS_ERRNO_RINGBUF_SIZE_INVALID;
+    }
+
+    if (uwMode > LOS_RINGBUF_MPSC)
+    {
+        return LOS_ERRNO_RINGBUF_MODE_INVALID;
+    }
+
+    (VOID)memset(pstRing, 0, sizeof(RINGBUF_S));
+    pstRing->pucBuf = (UINT8 *)pBuf;
+    pstRing->uwMask = uwSize - 1;
+    pstRing->uwMode = uwMode;
+    LOS_ListInit(&pstRing->stWaitList);
+
+    return LOS_OK;
+}
+
+/*****************************************************************************
+ Function    : LOS_RingBufPush
+ Description : Push bytes into a ring buffer
+ Input       : pstRing --- ring buffer
+               pData   --- bytes to push
+               uwLen   --- number of bytes
+ Output      : None
+ Return      : number of bytes pushed
+ *****************************************************************************/
+LITE_OS_SEC_TEXT UINT32 LOS_RingBufPush(RINGBUF_S *pstRing, const VOID *pData, UINT32 uwLen)
+{
+    UINT32 uwIdx;
+    UINT32 uwCnt;
+
+    if ((NULL == pstRing) || (NULL == pData))
+    {
+        return 0;
+    }
+
+    if (LOS_RINGBUF_MPSC == pstRing->uwMode)
+    {
+        uwCnt = osRingBufClaim(pstRing, uwLen, &uwIdx);
+        if (0 == uwCnt)
+        {
+            return 0;
+        }
+
+        osRingBufCopyIn(pstRing, uwIdx, (const UINT8 *)pData, uwCnt);
+        __DMB();
+        osRingBufFinish(pstRing);
+    }
+    else
+    {
+        uwIdx = pstRing->uwHead;
+        uwCnt = pstRing->uwMask + 1 - ((uwIdx - pstRing->uwTail) & OS_RINGBUF_IDX_MASK);
+        if (uwCnt > uwLen)
+        {
+            uwCnt = uwLen;
+        }
+
+        if (0 == uwCnt)
+        {
+            return 0;
+        }
+
+        osRingBufCopyIn(pstRing, uwIdx, (const UINT8 *)pData, uwCnt);
+        __DMB();
+        pstRing->uwHead = (uwIdx + uwCnt) & OS_RINGBUF_IDX_MASK;
+    }
+
+    /* the consumer queues itself with interrupts locked, an unlocked look is enough here */
+    if (!LOS_ListEmpty(&pstRing->stWaitList))
+    {
+        osRingBufWake(pstRing);
+    }
+
+    return uwCnt;
+}
+
+/*****************************************************************************
+ Function    : LOS_RingBufPop
+ Description : Pop bytes from a ring buffer
+ Input       : pstRing --- ring buffer
+               uwLen   --- size of pData
+ Output      : pData   --- bytes popped
+ Return      : number of bytes popped
+ *****************************************************************************/
+LITE_OS_SEC_TEXT UINT32 LOS_RingBufPop(RINGBUF_S *pstRing, VOID *pData, UINT32 uwLen)
+{
+    UINT32 uwTail;
+    UINT32 uwOffset;
+    UINT32 uwFirst;
+    UINT32 uwCnt;
+
+    if ((NULL == pstRing) || (NULL == pData))
+    {
+        return 0;
+    }
+
+    uwTail = pstRing->uwTail;
+    uwCnt = osRingBufUsed(pstRing);
+    __DMB();
+    if (uwCnt > uwLen)
+    {
+        uwCnt = uwLen;
+    }
+
+    uwOffset = uwTail & pstRing->uwMask;
+    uwFirst = pstRing->uwMask + 1 - uwOffset;
+    if (uwFirst > uwCnt)
+    {
+        uwFirst = uwCnt;
+    }
+
+    (VOID)memcpy(pData, pstRing->pucBuf + uwOffset, uwFirst);
+    (VOID)memcpy((UINT8 *)pData + uwFirst, pstRing->pucBuf, uwCnt - uwFirst);
+    __DMB();
+    pstRing->uwTail = (uwTail + uwCnt) & OS_RINGBUF_IDX_MASK;
+
+    return uwCnt;
+}
+
+/*****************************************************************************
+ Function    : LOS_RingBufUsed
+ Description : Get the number of bytes in a ring buffer
+ Input       : pstRing --- ring buffer
+ Output      : None
+ Return      : number of bytes
+ *****************************************************************************/
+LITE_OS_SEC_TEXT UINT32 LOS_RingBufUsed(RINGBUF_S *pstRing)
+{
+    if (NULL == pstRing)
+    {
+        return 0;
+    }
+
+    return osRingBufUsed(pstRing);
+}
+
+/*****************************************************************************
+ Function    : LOS_RingBufWait
+ Description : Wait for bytes in a ring buffer
+ Input       : pstRing   --- ring buffer
+               uwLen     --- number of bytes
+               uwTimeOut --- timeout in ticks
+ Output      : None
+ Return      : LOS_OK on success or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT UINT32 LOS_RingBufWait(RINGBUF_S *pstRing, UINT32 uwLen, UINT32 uwTimeOut)
+{
+    LOS_TASK_CB *pstRunTsk;
+    UINTPTR uvIntSave;
+
+    if (NULL == pstRing)
+    {
+        return LOS_ERRNO_RINGBUF_PTR_NULL;
+    }
+
+    if ((0 == uwLen) || (uwLen > pstRing->uwMask + 1))
+    {
+        return LOS_ERRNO_RINGBUF_LEN_INVALID;
+    }
+
+    if (OS_INT_ACTIVE)
+    {
+        return LOS_ERRNO_RINGBUF_IN_INT;
+    }
+
+    uvIntSave = LOS_IntLock();
+    if (osRingBufUsed(pstRing) >= uwLen)
+    {
+        LOS_IntRestore(uvIntSave);
+        return LOS_OK;
+    }
+
+    if (LOS_NO_WAIT == uwTimeOut)
+    {
+        LOS_IntRestore(uvIntSave);
+        return LOS_ERRNO_RINGBUF_TIMEOUT;
+    }
+
+    if (g_usLosTaskLock)
+    {
+        LOS_IntRestore(uvIntSave);
+        return LOS_ERRNO_RINGBUF_IN_LOCK;
+    }
+
+    if (!LOS_ListEmpty(&pstRing->stWaitList))
+    {
+        LOS_IntRestore(uvIntSave);
+        return LOS_ERRNO_RINGBUF_BUSY;
+    }
+
+    pstRing->uwWaitLen = uwLen;
+    pstRunTsk = g_stLosTask.pstRunTask;
+    osTaskWait(&pstRing->stWaitList, OS_TASK_STATUS_PEND, uwTimeOut, LOS_PEND_FIFO);
+    LOS_IntRestore(uvIntSave);
+    LOS_Schedule();
+
+    if (pstRunTsk->usTaskStatus & OS_TASK_STATUS_TIMEOUT)
+    {
+        uvIntSave = LOS_IntLock();
+        pstRunTsk->usTaskStatus &= (~OS_TASK_STATUS_TIMEOUT);
+        LOS_IntRestore(uvIntSave);
+        return LOS_ERRNO_RINGBUF_TIMEOUT;
+    }
+
+    return LOS_OK;
+}
+
+#endif /* (LOSCFG_BASE_IPC_RINGBUF == YES) */
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* __cplusplus */
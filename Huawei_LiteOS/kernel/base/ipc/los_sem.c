@@ -39,6 +39,10 @@
 #include "los_priqueue.ph"
 #include "los_sys.ph"
 #include "los_task.ph"
+#include "los_trace.ph"
+#if (LOSCFG_BASE_IPC_MULTIWAIT == YES)
+#include "los_multiwait.ph"
+#endif
 #if (LOSCFG_PLATFORM_EXC == YES)
 #include "los_exc.h"
 #endif
@@ -53,7 +57,25 @@ extern "C"{
 #if (LOSCFG_BASE_IPC_SEM == YES)
 
 LITE_OS_SEC_DATA_INIT LOS_DL_LIST  g_stUnusedSemList;
-LITE_OS_SEC_BSS SEM_CB_S    *g_pstAllSem;
+LITE_OS_SEC_BSS OS_OBJ_TABLE_S  g_stSemTable;
+LITE_OS_SEC_BSS UINT32          g_uwSemLimit;
+
+/*****************************************************************************
+ Function     : osSemNodeInit
+ Description  : Put a semaphore of a new block on the unused list
+ Input        : pObj------- semaphore control block,
+                uwIndex---- index of the semaphore
+ Output       : None
+ Return       : None
+ *****************************************************************************/
+LITE_OS_SEC_TEXT static VOID osSemNodeInit(VOID *pObj, UINT32 uwIndex)
+{
+    SEM_CB_S *pstSemNode = (SEM_CB_S *)pObj;
+
+    pstSemNode->uwSemID = uwIndex;
+    pstSemNode->usSemStat = OS_SEM_UNUSED;
+    LOS_ListTailInsert(&g_stUnusedSemList, &pstSemNode->stSemList);
+}
 
 /*****************************************************************************
  Function     : osSemInit
@@ -64,25 +86,18 @@ LITE_OS_SEC_BSS SEM_CB_S    *g_pstAllSem;
  *****************************************************************************/
 LITE_OS_SEC_TEXT_INIT UINT32 osSemInit(VOID)
 {
-    SEM_CB_S    *pstSemNode;
-    UINT16      uwIndex;
-
     LOS_ListInit(&g_stUnusedSemList);
-    if (LOSCFG_BASE_IPC_SEM_LIMIT > 0)  /*lint !e506*/
+    if (g_uwSemLimit > 0)
     {
-        g_pstAllSem = (SEM_CB_S *)LOS_MemAlloc(m_aucSysMem0, (LOSCFG_BASE_IPC_SEM_LIMIT * sizeof(SEM_CB_S)));
-        if (NULL == g_pstAllSem)
+        /* the semaphores are allocated a block at a time when all are in use */
+        if (LOS_OK != osObjTableInit(&g_stSemTable, sizeof(SEM_CB_S), g_uwSemLimit, LOSCFG_BASE_IPC_ALLOC_STEP, 32))
         {
             return LOS_ERRNO_SEM_NO_MEMORY;
         }
 
-        /* Connect all the ECBs in a doubly linked list. */
-        for (uwIndex = 0; uwIndex < LOSCFG_BASE_IPC_SEM_LIMIT; uwIndex++)
+        if (LOS_OK != osObjTableExtend(&g_stSemTable, osSemNodeInit))
         {
-            pstSemNode = ((SEM_CB_S *)g_pstAllSem) + uwIndex;
-            pstSemNode->usSemID = uwIndex;
-            pstSemNode->usSemStat = OS_SEM_UNUSED;
-            LOS_ListTailInsert(&g_stUnusedSemList, &pstSemNode->stSemList);
+            return LOS_ERRNO_SEM_NO_MEMORY;
         }
     }
 
@@ -117,10 +132,20 @@ LITE_OS_SEC_TEXT_INIT UINT32 osSemCreate (UINT16 usCount, UINT16 usMaxCount, UIN
 
     uwIntSave = LOS_IntLock();
 
-    if (LOS_ListEmpty(&g_stUnusedSemList))
+    while (LOS_ListEmpty(&g_stUnusedSemList))
     {
+        if ((0 == g_uwSemLimit) || OS_OBJ_TABLE_FULL(&g_stSemTable))
+        {
+            LOS_IntRestore(uwIntSave);
+            OS_GOTO_ERR_HANDLER(LOS_ERRNO_SEM_ALL_BUSY);
+        }
+
         LOS_IntRestore(uwIntSave);
-        OS_GOTO_ERR_HANDLER(LOS_ERRNO_SEM_ALL_BUSY);
+        if (LOS_OK != osObjTableExtend(&g_stSemTable, osSemNodeInit))
+        {
+            OS_GOTO_ERR_HANDLER(LOS_ERRNO_SEM_NO_MEMORY);
+        }
+        uwIntSave = LOS_IntLock();
     }
 
     pstUnusedSem = LOS_DL_LIST_FIRST(&(g_stUnusedSemList));
@@ -129,8 +154,12 @@ LITE_OS_SEC_TEXT_INIT UINT32 osSemCreate (UINT16 usCount, UINT16 usMaxCount, UIN
     pstSemCreated->usSemCount = usCount;
     pstSemCreated->usSemStat = OS_SEM_USED;
     pstSemCreated->usMaxSemCount = usMaxCount;
+    pstSemCreated->usPendOrder = LOS_PEND_FIFO;
     LOS_ListInit(&pstSemCreated->stSemList);
-    *puwSemHandle = (UINT32)pstSemCreated->usSemID;
+#if (LOSCFG_BASE_IPC_MULTIWAIT == YES)
+    LOS_ListInit(&pstSemCreated->stMultiWaitList);
+#endif
+    *puwSemHandle = pstSemCreated->uwSemID;
     LOS_IntRestore(uwIntSave);
     return LOS_OK;
 
@@ -176,14 +205,9 @@ LITE_OS_SEC_TEXT_INIT UINT32 LOS_SemDelete(UINT32 uwSemHandle)
     UINT32      uwErrNo;
     UINT32      uwErrLine;
 
-    if (uwSemHandle >= (UINT32)LOSCFG_BASE_IPC_SEM_LIMIT)
-    {
-        OS_GOTO_ERR_HANDLER(LOS_ERRNO_SEM_INVALID);
-    }
-
     pstSemDeleted = GET_SEM(uwSemHandle);
     uwIntSave = LOS_IntLock();
-    if (OS_SEM_UNUSED == pstSemDeleted->usSemStat)
+    if (!OS_SEM_VALID(pstSemDeleted, uwSemHandle))
     {
         LOS_IntRestore(uwIntSave);
         OS_GOTO_ERR_HANDLER(LOS_ERRNO_SEM_INVALID);
@@ -195,8 +219,17 @@ LITE_OS_SEC_TEXT_INIT UINT32 LOS_SemDelete(UINT32 uwSemHandle)
         OS_GOTO_ERR_HANDLER(LOS_ERRNO_SEM_PENDED);
     }
 
+#if (LOSCFG_BASE_IPC_MULTIWAIT == YES)
+    if (!LOS_ListEmpty(&pstSemDeleted->stMultiWaitList))
+    {
+        LOS_IntRestore(uwIntSave);
+        OS_GOTO_ERR_HANDLER(LOS_ERRNO_SEM_PENDED);
+    }
+#endif
+
     LOS_ListAdd(&g_stUnusedSemList, &pstSemDeleted->stSemList);
     pstSemDeleted->usSemStat = OS_SEM_UNUSED;
+    pstSemDeleted->uwSemID = OS_OBJ_NEXT_HANDLE(&g_stSemTable, uwSemHandle);
     LOS_IntRestore(uwIntSave);
     return LOS_OK;
 ErrHandler:
@@ -218,14 +251,11 @@ LITE_OS_SEC_TEXT UINT32 LOS_SemPend(UINT32 uwSemHandle, UINT32 uwTimeout)
     UINT32      uwRetErr;
     LOS_TASK_CB *pstRunTsk;
 
-    if (uwSemHandle >= (UINT32)LOSCFG_BASE_IPC_SEM_LIMIT)
-    {
-        OS_RETURN_ERROR(LOS_ERRNO_SEM_INVALID);
-    }
+    OS_INT_PRIO_CHECK();
 
     pstSemPended = GET_SEM(uwSemHandle);
     uwIntSave = LOS_IntLock();
-    if (OS_SEM_UNUSED == pstSemPended->usSemStat)
+    if (!OS_SEM_VALID(pstSemPended, uwSemHandle))
     {
         LOS_IntRestore(uwIntSave);
         OS_RETURN_ERROR(LOS_ERRNO_SEM_INVALID);
@@ -266,7 +296,8 @@ LITE_OS_SEC_TEXT UINT32 LOS_SemPend(UINT32 uwSemHandle, UINT32 uwTimeout)
 
     pstRunTsk = (LOS_TASK_CB *)g_stLosTask.pstRunTask;
     pstRunTsk->pTaskSem = (VOID *)pstSemPended;
-    osTaskWait(&pstSemPended->stSemList, OS_TASK_STATUS_PEND, uwTimeout);
+    OS_TRACE(LOS_TRACE_SEM_PEND, uwSemHandle, uwTimeout);
+    osTaskWait(&pstSemPended->stSemList, OS_TASK_STATUS_PEND, uwTimeout, pstSemPended->usPendOrder);
     (VOID)LOS_IntRestore(uwIntSave);
     LOS_Schedule();
 
@@ -298,14 +329,11 @@ LITE_OS_SEC_TEXT UINT32 LOS_SemPost(UINT32 uwSemHandle)
     SEM_CB_S    *pstSemPosted = GET_SEM(uwSemHandle);
     LOS_TASK_CB *pstResumedTask;
 
-    if (uwSemHandle >= LOSCFG_BASE_IPC_SEM_LIMIT)
-    {
-        return LOS_ERRNO_SEM_INVALID;
-    }
+    OS_INT_PRIO_CHECK();
 
     uwIntSave = LOS_IntLock();
 
-    if (OS_SEM_UNUSED == pstSemPosted->usSemStat)
+    if (!OS_SEM_VALID(pstSemPosted, uwSemHandle))
     {
         LOS_IntRestore(uwIntSave);
         OS_RETURN_ERROR(LOS_ERRNO_SEM_INVALID);
@@ -321,6 +349,7 @@ LITE_OS_SEC_TEXT UINT32 LOS_SemPost(UINT32 uwSemHandle)
         pstResumedTask = OS_TCB_FROM_PENDLIST(LOS_DL_LIST_FIRST(&(pstSemPosted->stSemList))); /*lint !e413*/
         pstResumedTask->pTaskSem = NULL;
         osTaskWake(pstResumedTask, OS_TASK_STATUS_PEND);
+        OS_TRACE(LOS_TRACE_SEM_POST, uwSemHandle, pstResumedTask->uwTaskID);
 
         (VOID)LOS_IntRestore(uwIntSave);
         LOS_Schedule();
@@ -328,12 +357,52 @@ LITE_OS_SEC_TEXT UINT32 LOS_SemPost(UINT32 uwSemHandle)
     else
     {
         pstSemPosted->usSemCount++;
+        OS_TRACE(LOS_TRACE_SEM_POST, uwSemHandle, LOS_TRACE_NONE);
+#if (LOSCFG_BASE_IPC_MULTIWAIT == YES)
+        if (osMultiWaitSignal(&pstSemPosted->stMultiWaitList))
+        {
+            (VOID)LOS_IntRestore(uwIntSave);
+            LOS_Schedule();
+            return LOS_OK;
+        }
+#endif
         (VOID)LOS_IntRestore(uwIntSave);
     }
 
     return LOS_OK;
 }
 
+/*****************************************************************************
+ Function     : LOS_SemPendOrderSet
+ Description  : Set the order of the tasks pending on a semaphore
+ Input        : uwSemHandle--------- semaphore operation handle,
+                uwPendOrder--------- LOS_PEND_FIFO or LOS_PEND_PRIO
+ Output       : None
+ Return       : LOS_OK on success or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_MINOR UINT32 LOS_SemPendOrderSet(UINT32 uwSemHandle, UINT32 uwPendOrder)
+{
+    UINT32      uwIntSave;
+    SEM_CB_S    *pstSem = GET_SEM(uwSemHandle);
+
+    if (uwPendOrder > LOS_PEND_PRIO)
+    {
+        OS_RETURN_ERROR(LOS_ERRNO_SEM_PEND_ORDER_INVALID);
+    }
+
+    uwIntSave = LOS_IntLock();
+    if (!OS_SEM_VALID(pstSem, uwSemHandle))
+    {
+        LOS_IntRestore(uwIntSave);
+        OS_RETURN_ERROR(LOS_ERRNO_SEM_INVALID);
+    }
+
+    pstSem->usPendOrder = (UINT16)uwPendOrder;
+    osTaskPendOrderSet(&pstSem->stSemList, uwPendOrder);
+    (VOID)LOS_IntRestore(uwIntSave);
+    return LOS_OK;
+}
+
 #endif /*(LOSCFG_BASE_IPC_SEM == YES)*/
 
 #ifdef __cplusplus
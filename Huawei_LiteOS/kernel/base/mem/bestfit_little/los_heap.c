@@ -39,6 +39,7 @@
 #include <los_hwi.h>
 #include <los_config.h>
 #include <los_heap.ph>
+#include <los_heapcheck.ph>
 #include <los_typedef.h>
 
 #ifdef CONFIG_DDR_HEAP
@@ -87,6 +88,14 @@ BOOL LOS_HeapInit(VOID *pPool, UINT32 uwSz)
     if (!pstHeapMan || (uwSz <= (sizeof(struct LOS_HEAP_NODE) +  sizeof(struct LOS_HEAP_MANAGER))))
         return FALSE;
 
+    /* the size of the first block has to fit in its bit field */
+    if (uwSz - sizeof(struct LOS_HEAP_NODE) - sizeof(struct LOS_HEAP_MANAGER) > OS_HEAP_NODE_SIZE_MAX)
+    {
+        PRINT_ERR("heap 0x%x is too large, at most 0x%x Bytes are supported!\n", (UINT32)pPool,
+                  OS_HEAP_NODE_SIZE_MAX + sizeof(struct LOS_HEAP_NODE) + sizeof(struct LOS_HEAP_MANAGER));
+        return FALSE;
+    }
+
     memset(pPool, 0, uwSz);
 
     pstHeapMan->uwSize = uwSz;
@@ -253,6 +262,7 @@ BOOL LOS_HeapFree(VOID *pPool, VOID* pPtr)
     while (((pstT = osHeapPrvGetNext(pstHeapMan, pstNode))!= NULL) && !pstT->uwUsed)
     {
         pstNode->uwSize += sizeof(struct LOS_HEAP_NODE) + pstT->uwSize;
+        OS_HEAP_CHECK_MERGED(pstHeapMan, pstNode, pstT);
         if (pstHeapMan->pstTail == pstT)
             pstHeapMan->pstTail = pstNode;
     }
@@ -67,7 +67,6 @@ LITE_OS_SEC_TEXT_MINOR UINT32 LOS_MemExcInfoGet(UINT32 uwMemNum, MEM_INFO_S *pst
     UINT32 uwBlkSize = 0;
     LOS_MEM_STATUS stStatus;
     MEM_INFO *pstMemInfo = NULL;
-    OS_SLAB_MEM *pstSlabAlloc;
 
     if(uwMemNum >= *(UINT32 *)g_aucMemMang || pstMemExcInfo == NULL)
     {
@@ -94,24 +93,13 @@ LITE_OS_SEC_TEXT_MINOR UINT32 LOS_MemExcInfoGet(UINT32 uwMemNum, MEM_INFO_S *pst
     {
 
 #ifdef LOSCFG_KERNEL_MEM_SLAB
-        struct LOS_SLAB_CONTROL_HEADER *pstSlabMem = osSlabCtrlHdrGet((VOID *)pstMemExcInfo->uwStartAddr);
         for (uwIdx = 0; uwIdx < SLAB_MEM_COUNT; uwIdx++)
         {
-            pstSlabAlloc = &(pstSlabMem->stSlabClass[uwIdx]);
-            if(pstSlabAlloc->alloc)
-            {
-                osSlabAllocatorGetSlabInfo(pstSlabAlloc->alloc, &uwItemSz, &uwItemCnt, &uwCurUsage);
+            osSlabClassInfoGet((VOID *)pstMemExcInfo->uwStartAddr, uwIdx, &uwItemSz, &uwItemCnt, &uwCurUsage);
 
-                pstMemExcInfo->stSlabInfo[uwIdx].cur_usage = uwCurUsage;
-                pstMemExcInfo->stSlabInfo[uwIdx].item_cnt = uwItemCnt;
-                pstMemExcInfo->stSlabInfo[uwIdx].item_sz = uwItemSz;
-            }
-            else
-            {
-                pstMemExcInfo->stSlabInfo[uwIdx].cur_usage = 0;
-                pstMemExcInfo->stSlabInfo[uwIdx].item_cnt = 0;
-                pstMemExcInfo->stSlabInfo[uwIdx].item_sz = 0;
-            }
+            pstMemExcInfo->stSlabInfo[uwIdx].cur_usage = uwCurUsage;
+            pstMemExcInfo->stSlabInfo[uwIdx].item_cnt = uwItemCnt;
+            pstMemExcInfo->stSlabInfo[uwIdx].item_sz = uwItemSz;
         }
 #endif
         (VOID)LOS_MemStatisticsGet((VOID *)(pstMemInfo->uwStartAddr), &stStatus);
@@ -39,6 +39,8 @@
 #endif
 #include "los_heap.ph"
 #include "los_hwi.h"
+#include "los_trace.ph"
+#include "los_memstat.ph"
 #if (LOSCFG_PLATFORM_EXC == YES)
 #include "los_exc.ph"
 #endif
@@ -208,14 +210,15 @@ LITE_OS_SEC_TEXT_INIT UINT32 LOS_MemPoolList(VOID)
 #endif
 
 /*****************************************************************************
- Function : LOS_MemAlloc
+ Function : osMemAlloc
  Description : Allocate Memory from Memory pool
  Input       : pPool    --- Pointer to memory pool
                size -- Size of memory in bytes to allocate
+               uvCaller -- call site charged with the memory
  Output      : None
  Return      : Pointer to allocated memory
 *****************************************************************************/
-LITE_OS_SEC_TEXT VOID *LOS_MemAlloc (VOID *pPool, UINT32 uwSize)
+LITE_OS_SEC_TEXT static VOID *osMemAlloc(VOID *pPool, UINT32 uwSize, UINTPTR uvCaller)
 {
     VOID *pRet = NULL;
 
@@ -230,8 +233,31 @@ LITE_OS_SEC_TEXT VOID *LOS_MemAlloc (VOID *pPool, UINT32 uwSize)
 #endif
         pRet = LOS_HeapAlloc(pPool, uwSize);
 
+#if (LOSCFG_MEM_TASK_STAT == YES)
+    if (pRet != NULL)
+    {
+        osMemStatAlloc(pPool, pRet, uvCaller);
+    }
+#else
+    (VOID)uvCaller;
+#endif
+
+    OS_TRACE(LOS_TRACE_MEM_ALLOC, pRet, uwSize);
     return pRet;
 }
+
+/*****************************************************************************
+ Function : LOS_MemAlloc
+ Description : Allocate Memory from Memory pool
+ Input       : pPool    --- Pointer to memory pool
+               size -- Size of memory in bytes to allocate
+ Output      : None
+ Return      : Pointer to allocated memory
+*****************************************************************************/
+LITE_OS_SEC_TEXT VOID *LOS_MemAlloc (VOID *pPool, UINT32 uwSize)
+{
+    return osMemAlloc(pPool, uwSize, OS_MEM_CALLER());
+}
 /*****************************************************************************
  Function : LOS_MemAllocAlign
  Description : align size then allocate node from Memory pool
@@ -244,7 +270,7 @@ LITE_OS_SEC_TEXT VOID *LOS_MemAlloc (VOID *pPool, UINT32 uwSize)
 LITE_OS_SEC_TEXT VOID *LOS_MemAllocAlign(VOID *pPool, UINT32 uwSize, UINT32 uwBoundary)
 {
     (VOID)uwBoundary;
-    return LOS_MemAlloc(pPool, uwSize);
+    return osMemAlloc(pPool, uwSize, OS_MEM_CALLER());
 }
 
 /*****************************************************************************
@@ -278,7 +304,7 @@ VOID *LOS_MemRealloc(VOID *pPool, VOID *pPtr, UINT32 uwSize)
     /* Requests with NULL pointers are treated as malloc. */
     else if (NULL == pPtr)
     {
-        p = LOS_MemAlloc(pPool, uwSize);
+        p = osMemAlloc(pPool, uwSize, OS_MEM_CALLER());
     }
     else
     {
@@ -294,7 +320,7 @@ VOID *LOS_MemRealloc(VOID *pPool, VOID *pPtr, UINT32 uwSize)
         {
             uwCpySize = uwSize > uwOldSize ? uwOldSize : uwSize;
         }
-        p = LOS_MemAlloc(pPool, uwSize);
+        p = osMemAlloc(pPool, uwSize, OS_MEM_CALLER());
 
         if (p != NULL)
         {
@@ -318,17 +344,35 @@ VOID *LOS_MemRealloc(VOID *pPool, VOID *pPtr, UINT32 uwSize)
 LITE_OS_SEC_TEXT UINT32 LOS_MemFree (VOID *pPool, VOID *pMem)
 {
     BOOL bRet = FALSE;
+#if (LOSCFG_MEM_TASK_STAT == YES)
+    UINT32 uwTaskID;
+    UINT32 uwSize;
+#endif
+
     if ((NULL == pPool) || (NULL == pMem))
     {
         return LOS_NOK;
     }
 
+#if (LOSCFG_MEM_TASK_STAT == YES)
+    /* read before the block is gone, used only if the free proves it is a block */
+    uwTaskID = osMemStatOwnerGet(pPool, pMem, &uwSize);
+#endif
+
 #ifdef LOSCFG_KERNEL_MEM_SLAB
     bRet = osSlabMemFree(pPool, pMem);
     if(bRet != TRUE)
 #endif
         bRet = LOS_HeapFree(pPool, pMem);
 
+#if (LOSCFG_MEM_TASK_STAT == YES)
+    if (bRet == TRUE)
+    {
+        osMemStatFree(uwTaskID, pMem, uwSize);
+    }
+#endif
+
+    OS_TRACE(LOS_TRACE_MEM_FREE, pMem, pPool);
     return (bRet == TRUE ? LOS_OK : LOS_NOK);
 }
 
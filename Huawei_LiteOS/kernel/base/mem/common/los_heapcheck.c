@@ -0,0 +1,240 @@
+/*----------------------------------------------------------------------------
+ * Copyright (c) <2013-2015>, <Huawei Technologies Co., Ltd>
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *---------------------------------------------------------------------------*/
+/*----------------------------------------------------------------------------
+ * Notice of Export Control Law
+ * ===============================================
+ * Huawei LiteOS may be subject to applicable export control laws and regulations, which might
+ * include those applicable to Huawei LiteOS of U.S. and the country in which you are located.
+ * Import, export and usage of Huawei LiteOS in any manner by you shall be in compliance with such
+ * applicable export control laws and regulations.
+ *---------------------------------------------------------------------------*/
+
+#include "los_heapcheck.ph"
+#include "los_heap.ph"
+#include "los_hwi.h"
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+#endif /* __cplusplus */
+
+#if (LOSCFG_MEM_BGCHECK == YES)
+
+#ifndef LOSCFG_MEM_BGCHECK_STEP
+#define LOSCFG_MEM_BGCHECK_STEP                     16
+#endif
+
+/* both heaps keep their blocks a multiple of 8 bytes apart */
+#define OS_HEAP_CHECK_ALIGN                         8
+
+LITE_OS_SEC_BSS_MINOR static BOOL g_bHeapCheckStop;
+
+/*****************************************************************************
+ Function    : osHeapCheckOwner
+ Description : Get the task a block is charged to
+ Input       : pstNode --- block, may be NULL
+ Output      : None
+ Return      : task ID, LOS_HEAP_CHECK_NO_OWNER for a free block or when owners are not recorded
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_MINOR static UINT32 osHeapCheckOwner(struct LOS_HEAP_NODE *pstNode)
+{
+#if (LOSCFG_MEM_TASK_STAT == YES)
+    if ((pstNode != NULL) && pstNode->uwUsed)
+    {
+        return pstNode->uwTaskID;
+    }
+#else
+    (VOID)pstNode;
+#endif
+    return LOS_HEAP_CHECK_NO_OWNER;
+}
+
+/*****************************************************************************
+ Function    : osHeapCheckNode
+ Description : Check a block header against the block before it, the interrupts must be locked
+ Input       : pstHeapMan --- heap
+               pstNode    --- block to check
+               pstPrev    --- block before it, found intact, NULL for the first block
+ Output      : None
+ Return      : TRUE if the header is intact
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_MINOR static BOOL osHeapCheckNode(struct LOS_HEAP_MANAGER *pstHeapMan,
+                                                   struct LOS_HEAP_NODE *pstNode, struct LOS_HEAP_NODE *pstPrev)
+{
+    UINTPTR uvEnd;
+
+    /* the header is only read once it is known to be in the pool */
+    if (((UINTPTR)pstNode < (UINTPTR)pstHeapMan->pstHead) || ((UINTPTR)pstNode > (UINTPTR)pstHeapMan->pstTail)
+        || (((UINTPTR)pstNode - (UINTPTR)pstHeapMan->pstHead) & (OS_HEAP_CHECK_ALIGN - 1)))
+    {
+        return FALSE;
+    }
+
+    if (pstNode->pstPrev != pstPrev)
+    {
+        return FALSE;
+    }
+
+    /* the last block runs to the end of the pool, whose size need not be aligned */
+    if (pstNode == pstHeapMan->pstTail)
+    {
+        uvEnd = (UINTPTR)pstHeapMan + pstHeapMan->uwSize;
+    }
+    else
+    {
+        uvEnd = (UINTPTR)pstHeapMan->pstTail;
+        if (pstNode->uwSize & (OS_HEAP_CHECK_ALIGN - 1))
+        {
+            return FALSE;
+        }
+    }
+
+    if ((UINTPTR)pstNode->ucData + pstNode->uwSize > uvEnd)
+    {
+        return FALSE;
+    }
+
+    /* a freed block is always merged with the free blocks around it */
+    if (!pstNode->uwUsed && (pstPrev != NULL) && !pstPrev->uwUsed)
+    {
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+/*****************************************************************************
+ Function    : LOS_HeapCheckStep
+ Description : Check the next blocks of a heap, going on after the last block found intact
+ Input       : pPool     --- memory pool
+               uwNodeNum --- maximum number of blocks to check
+ Output      : pstInfo   --- damaged block
+ Return      : LOS_OK if the blocks are intact or error code
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_MINOR UINT32 LOS_HeapCheckStep(VOID *pPool, UINT32 uwNodeNum, LOS_HEAP_CHECK_INFO *pstInfo)
+{
+    struct LOS_HEAP_MANAGER *pstHeapMan = (struct LOS_HEAP_MANAGER *)pPool;
+    struct LOS_HEAP_NODE *pstPrev;
+    struct LOS_HEAP_NODE *pstNode;
+    UINTPTR uvIntSave;
+
+    if (pstHeapMan == NULL)
+    {
+        return LOS_ERRNO_HEAPCHECK_PTR_NULL;
+    }
+
+    uvIntSave = LOS_IntLock();
+
+    pstPrev = pstHeapMan->pstCheckLast;
+    for (; uwNodeNum != 0; uwNodeNum--)
+    {
+        if (pstPrev == pstHeapMan->pstTail)
+        {
+            pstHeapMan->uwCheckPass++;
+            pstPrev = NULL;
+            break;
+        }
+
+        pstNode = (pstPrev == NULL) ? pstHeapMan->pstHead : (struct LOS_HEAP_NODE *)(pstPrev->ucData + pstPrev->uwSize);
+        if (!osHeapCheckNode(pstHeapMan, pstNode, pstPrev))
+        {
+            pstHeapMan->pstCheckLast = pstPrev;
+            if (pstInfo != NULL)
+            {
+                pstInfo->pNode = pstNode;
+                pstInfo->pPrevNode = pstPrev;
+                pstInfo->uwOwner = LOS_HEAP_CHECK_NO_OWNER;
+                if (((UINTPTR)pstNode >= (UINTPTR)pstHeapMan->pstHead) && ((UINTPTR)pstNode <= (UINTPTR)pstHeapMan->pstTail))
+                {
+                    pstInfo->uwOwner = osHeapCheckOwner(pstNode);
+                }
+                pstInfo->uwPrevOwner = osHeapCheckOwner(pstPrev);
+            }
+            LOS_IntRestore(uvIntSave);
+            return LOS_ERRNO_HEAPCHECK_NODE_DAMAGED;
+        }
+        pstPrev = pstNode;
+    }
+
+    pstHeapMan->pstCheckLast = pstPrev;
+    LOS_IntRestore(uvIntSave);
+
+    return LOS_OK;
+}
+
+/*****************************************************************************
+ Function    : LOS_HeapCheckPassGet
+ Description : Get the number of complete checks of a heap
+ Input       : pPool --- memory pool
+ Output      : None
+ Return      : number of complete checks
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_MINOR UINT32 LOS_HeapCheckPassGet(VOID *pPool)
+{
+    if (pPool == NULL)
+    {
+        return 0;
+    }
+
+    return ((struct LOS_HEAP_MANAGER *)pPool)->uwCheckPass;
+}
+
+/*****************************************************************************
+ Function    : osHeapCheckIdle
+ Description : Check the next blocks of the system memory pool from the idle task, and report the first
+               damaged block
+ Input       : None
+ Output      : None
+ Return      : None
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_MINOR VOID osHeapCheckIdle(VOID)
+{
+    LOS_HEAP_CHECK_INFO stInfo;
+    UINT32 uwRet;
+
+    if (g_bHeapCheckStop)
+    {
+        return;
+    }
+
+    uwRet = LOS_HeapCheckStep(OS_SYS_MEM_ADDR, LOSCFG_MEM_BGCHECK_STEP, &stInfo);
+    if (uwRet != LOS_OK)
+    {
+        g_bHeapCheckStop = TRUE;
+        PRINT_ERR("heap block 0x%x of task %d is damaged, the block before it is 0x%x of task %d\n",
+                  (UINT32)stInfo.pNode, stInfo.uwOwner, (UINT32)stInfo.pPrevNode, stInfo.uwPrevOwner);
+        (VOID)LOS_ErrHandle("los_heapcheck.c", __LINE__, uwRet, sizeof(stInfo), &stInfo);
+    }
+}
+
+#endif /* (LOSCFG_MEM_BGCHECK == YES) */
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* __cplusplus */
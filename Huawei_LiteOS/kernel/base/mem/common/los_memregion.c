@@ -0,0 +1,410 @@
+/*----------------------------------------------------------------------------
+ * Copyright (c) <2013-2015>, <Huawei Technologies Co., Ltd>
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *---------------------------------------------------------------------------*/
+/*----------------------------------------------------------------------------
+ * Notice of Export Control Law
+ * ===============================================
+ * Huawei LiteOS may be subject to applicable export control laws and regulations, which might
+ * include those applicable to Huawei LiteOS of U.S. and the country in which you are located.
+ * Import, export and usage of Huawei LiteOS in any manner by you shall be in compliance with such
+ * applicable export control laws and regulations.
+ *---------------------------------------------------------------------------*/
+
+#include "los_memregion.ph"
+#include "los_memory.ph"
+#include "los_hwi.h"
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+#endif /* __cplusplus */
+
+#if (LOSCFG_MEM_REGION == YES)
+
+#ifndef LOSCFG_MEM_REGION_LIMIT
+#define LOSCFG_MEM_REGION_LIMIT                     4
+#endif
+
+#ifndef OS_MEM_REGION_FAST_SIZE
+#define OS_MEM_REGION_FAST_SIZE                     0
+#endif
+
+typedef struct tagMemRegion
+{
+    UINT8   *pucPool;
+    UINT32  uwSize;
+    UINT32  uwAttr;
+    UINT32  uwHitCnt;
+    UINT32  uwFallbackCnt;
+    UINT32  uwMissCnt;
+} OS_MEM_REGION_S;
+
+LITE_OS_SEC_BSS OS_MEM_REGION_S g_astMemRegion[LOSCFG_MEM_REGION_LIMIT];
+/* regions are never removed, an entry is filled before the count covers it so lookups need no lock */
+LITE_OS_SEC_BSS volatile UINT32 g_uwMemRegionCnt;
+
+/*****************************************************************************
+ Function    : osMemRegionFind
+ Description : Find the region that holds an address
+ Input       : pMem --- address
+ Output      : None
+ Return      : region, NULL if the address belongs to none
+ *****************************************************************************/
+LITE_OS_SEC_TEXT static OS_MEM_REGION_S *osMemRegionFind(VOID *pMem)
+{
+    OS_MEM_REGION_S *pstRegion;
+    UINT32 uwCnt = g_uwMemRegionCnt;
+    UINT32 uwIdx;
+
+    for (uwIdx = 0; uwIdx < uwCnt; uwIdx++)
+    {
+        pstRegion = &g_astMemRegion[uwIdx];
+        if (((UINT8 *)pMem >= pstRegion->pucPool) && ((UINT8 *)pMem < pstRegion->pucPool + pstRegion->uwSize))
+        {
+            return pstRegion;
+        }
+    }
+
+    return (OS_MEM_REGION_S *)NULL;
+}
+
+/*****************************************************************************
+ Function    : osMemRegionTry
+ Description : Allocate memory from one region and count the result
+ Input       : pstRegion  --- region
+               uwSize     --- number of bytes
+               uwBoundary --- alignment, 0 for none
+               bHit       --- whether the region has every hinted attribute
+ Output      : None
+ Return      : memory, NULL if the region cannot serve it
+ *****************************************************************************/
+LITE_OS_SEC_TEXT static VOID *osMemRegionTry(OS_MEM_REGION_S *pstRegion, UINT32 uwSize, UINT32 uwBoundary, BOOL bHit)
+{
+    VOID *pMem;
+    UINTPTR uvIntSave;
+
+    if (uwBoundary == 0)
+    {
+        pMem = LOS_MemAlloc((VOID *)pstRegion->pucPool, uwSize);
+    }
+    else
+    {
+        pMem = LOS_MemAllocAlign((VOID *)pstRegion->pucPool, uwSize, uwBoundary);
+    }
+
+    uvIntSave = LOS_IntLock();
+    if (pMem == NULL)
+    {
+        pstRegion->uwMissCnt++;
+    }
+    else if (bHit)
+    {
+        pstRegion->uwHitCnt++;
+    }
+    else
+    {
+        pstRegion->uwFallbackCnt++;
+    }
+    LOS_IntRestore(uvIntSave);
+
+    return pMem;
+}
+
+/*****************************************************************************
+ Function    : osMemRegionAlloc
+ Description : Allocate memory from the regions that match the hint, then from the fallbacks
+ Input       : uwSize     --- number of bytes
+               uwBoundary --- alignment, 0 for none
+               uwHint     --- placement hint
+ Output      : None
+ Return      : memory, NULL if no region can serve it
+ *****************************************************************************/
+LITE_OS_SEC_TEXT static VOID *osMemRegionAlloc(UINT32 uwSize, UINT32 uwBoundary, UINT32 uwHint)
+{
+    OS_MEM_REGION_S *pstRegion;
+    UINT32 uwWant = uwHint & LOS_MEM_REGION_ATTR_MASK;
+    UINT32 uwNeed = uwWant & LOS_MEM_REGION_DMA;
+    UINT32 uwCnt = g_uwMemRegionCnt;
+    UINT32 uwIdx;
+    VOID *pMem;
+
+    if ((uwSize == 0) || (uwHint & ~(LOS_MEM_REGION_ATTR_MASK | LOS_MEM_REGION_STRICT)))
+    {
+        return NULL;
+    }
+
+    for (uwIdx = 0; uwIdx < uwCnt; uwIdx++)
+    {
+        pstRegion = &g_astMemRegion[uwIdx];
+        if ((pstRegion->uwAttr & uwWant) == uwWant)
+        {
+            pMem = osMemRegionTry(pstRegion, uwSize, uwBoundary, TRUE);
+            if (pMem != NULL)
+            {
+                return pMem;
+            }
+        }
+    }
+
+    if (uwHint & LOS_MEM_REGION_STRICT)
+    {
+        return NULL;
+    }
+
+    /* the regions with every wanted attribute are tried already, fall back to the rest, keeping DMA a requirement */
+    for (uwIdx = 0; uwIdx < uwCnt; uwIdx++)
+    {
+        pstRegion = &g_astMemRegion[uwIdx];
+        if (((pstRegion->uwAttr & uwWant) != uwWant) && ((pstRegion->uwAttr & uwNeed) == uwNeed))
+        {
+            pMem = osMemRegionTry(pstRegion, uwSize, uwBoundary, FALSE);
+            if (pMem != NULL)
+            {
+                return pMem;
+            }
+        }
+    }
+
+    return NULL;
+}
+
+/*****************************************************************************
+ Function    : osMemRegionRegister
+ Description : Register a memory pool as a region
+ Input       : pPool  --- start address of the region
+               uwSize --- size of the region
+               uwAttr --- region attributes
+               bInit  --- whether the pool has to be initialized
+ Output      : puwRegionID --- region ID
+ Return      : LOS_OK on success or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_INIT static UINT32 osMemRegionRegister(VOID *pPool, UINT32 uwSize, UINT32 uwAttr, BOOL bInit,
+                                                        UINT32 *puwRegionID)
+{
+    OS_MEM_REGION_S *pstRegion;
+    UINTPTR uvIntSave;
+    UINT32 uwIdx;
+
+    if ((pPool == NULL) || (puwRegionID == NULL))
+    {
+        return LOS_ERRNO_MEMREGION_PTR_NULL;
+    }
+
+    if (uwAttr & ~LOS_MEM_REGION_ATTR_MASK)
+    {
+        return LOS_ERRNO_MEMREGION_ATTR_INVALID;
+    }
+
+    if ((uwSize == 0) || ((UINT32)pPool & 0x3) || ((UINT32)pPool + uwSize < (UINT32)pPool))
+    {
+        return LOS_ERRNO_MEMREGION_POOL_INVALID;
+    }
+
+    /* registering is rare and pool initialization is O(1), keep it all under the lock */
+    uvIntSave = LOS_IntLock();
+    if (g_uwMemRegionCnt >= LOSCFG_MEM_REGION_LIMIT)
+    {
+        LOS_IntRestore(uvIntSave);
+        return LOS_ERRNO_MEMREGION_ALL_BUSY;
+    }
+
+    for (uwIdx = 0; uwIdx < g_uwMemRegionCnt; uwIdx++)
+    {
+        pstRegion = &g_astMemRegion[uwIdx];
+        if (((UINT8 *)pPool < pstRegion->pucPool + pstRegion->uwSize) &&
+            (pstRegion->pucPool < (UINT8 *)pPool + uwSize))
+        {
+            LOS_IntRestore(uvIntSave);
+            return LOS_ERRNO_MEMREGION_POOL_INVALID;
+        }
+    }
+
+    if (bInit && (LOS_MemInit(pPool, uwSize) != LOS_OK))
+    {
+        LOS_IntRestore(uvIntSave);
+        return LOS_ERRNO_MEMREGION_POOL_INVALID;
+    }
+
+    pstRegion = &g_astMemRegion[uwIdx];
+    pstRegion->pucPool = (UINT8 *)pPool;
+    pstRegion->uwSize = uwSize;
+    pstRegion->uwAttr = uwAttr;
+    pstRegion->uwHitCnt = 0;
+    pstRegion->uwFallbackCnt = 0;
+    pstRegion->uwMissCnt = 0;
+    g_uwMemRegionCnt = uwIdx + 1;
+    LOS_IntRestore(uvIntSave);
+
+    *puwRegionID = uwIdx;
+    return LOS_OK;
+}
+
+/*****************************************************************************
+ Function    : osMemRegionInit
+ Description : Register the system memory pool and the fast region
+ Input       : None
+ Output      : None
+ Return      : LOS_OK on success or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_INIT UINT32 osMemRegionInit(VOID)
+{
+    UINT32 uwRegionID;
+    UINT32 uwRet;
+
+    /* already initialized by osMemSystemInit and in use */
+    uwRet = osMemRegionRegister((VOID *)OS_SYS_MEM_ADDR, OS_SYS_MEM_SIZE, LOS_MEM_REGION_DMA, FALSE, &uwRegionID);
+    if (uwRet != LOS_OK)
+    {
+        return uwRet;
+    }
+
+#if (OS_MEM_REGION_FAST_SIZE != 0)
+    uwRet = osMemRegionRegister((VOID *)OS_MEM_REGION_FAST_ADDR, OS_MEM_REGION_FAST_SIZE, LOS_MEM_REGION_FAST, TRUE,
+                                &uwRegionID);
+#endif
+    return uwRet;
+}
+
+/*****************************************************************************
+ Function    : LOS_MemRegionAdd
+ Description : Register a memory region
+ Input       : pPool  --- start address of the region
+               uwSize --- size of the region
+               uwAttr --- region attributes
+ Output      : puwRegionID --- region ID
+ Return      : LOS_OK on success or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_INIT UINT32 LOS_MemRegionAdd(VOID *pPool, UINT32 uwSize, UINT32 uwAttr, UINT32 *puwRegionID)
+{
+    return osMemRegionRegister(pPool, uwSize, uwAttr, TRUE, puwRegionID);
+}
+
+/*****************************************************************************
+ Function    : LOS_MemRegionAlloc
+ Description : Allocate memory with a placement hint
+ Input       : uwSize --- number of bytes
+               uwHint --- placement hint
+ Output      : None
+ Return      : memory, NULL if no region can serve it
+ *****************************************************************************/
+LITE_OS_SEC_TEXT VOID *LOS_MemRegionAlloc(UINT32 uwSize, UINT32 uwHint)
+{
+    return osMemRegionAlloc(uwSize, 0, uwHint);
+}
+
+/*****************************************************************************
+ Function    : LOS_MemRegionAllocAlign
+ Description : Allocate aligned memory with a placement hint
+ Input       : uwSize     --- number of bytes
+               uwBoundary --- alignment
+               uwHint     --- placement hint
+ Output      : None
+ Return      : memory, NULL if no region can serve it
+ *****************************************************************************/
+LITE_OS_SEC_TEXT VOID *LOS_MemRegionAllocAlign(UINT32 uwSize, UINT32 uwBoundary, UINT32 uwHint)
+{
+    if ((uwBoundary < sizeof(UINT32)) || (uwBoundary & (uwBoundary - 1)))
+    {
+        return NULL;
+    }
+
+    return osMemRegionAlloc(uwSize, uwBoundary, uwHint);
+}
+
+/*****************************************************************************
+ Function    : LOS_MemRegionFree
+ Description : Free memory to the region that holds it
+ Input       : pMem --- memory
+ Output      : None
+ Return      : LOS_OK on success or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT UINT32 LOS_MemRegionFree(VOID *pMem)
+{
+    OS_MEM_REGION_S *pstRegion;
+
+    if (pMem == NULL)
+    {
+        return LOS_ERRNO_MEMREGION_PTR_NULL;
+    }
+
+    pstRegion = osMemRegionFind(pMem);
+    if ((pstRegion == NULL) || (LOS_MemFree((VOID *)pstRegion->pucPool, pMem) != LOS_OK))
+    {
+        return LOS_ERRNO_MEMREGION_MEM_INVALID;
+    }
+
+    return LOS_OK;
+}
+
+/*****************************************************************************
+ Function    : LOS_MemRegionStatusGet
+ Description : Get the status of a region
+ Input       : uwRegionID --- region ID
+ Output      : pstStatus  --- status of the region
+ Return      : LOS_OK on success or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_MINOR UINT32 LOS_MemRegionStatusGet(UINT32 uwRegionID, LOS_MEM_REGION_STATUS *pstStatus)
+{
+    OS_MEM_REGION_S *pstRegion;
+    UINTPTR uvIntSave;
+
+    if (pstStatus == NULL)
+    {
+        return LOS_ERRNO_MEMREGION_PTR_NULL;
+    }
+
+    if (uwRegionID >= g_uwMemRegionCnt)
+    {
+        return LOS_ERRNO_MEMREGION_ID_INVALID;
+    }
+
+    pstRegion = &g_astMemRegion[uwRegionID];
+    pstStatus->pPool = (VOID *)pstRegion->pucPool;
+    pstStatus->uwPoolSize = pstRegion->uwSize;
+    pstStatus->uwAttr = pstRegion->uwAttr;
+
+    uvIntSave = LOS_IntLock();
+    pstStatus->uwHitCnt = pstRegion->uwHitCnt;
+    pstStatus->uwFallbackCnt = pstRegion->uwFallbackCnt;
+    pstStatus->uwMissCnt = pstRegion->uwMissCnt;
+    LOS_IntRestore(uvIntSave);
+
+    if (LOS_MemStatisticsGet(pstStatus->pPool, &pstStatus->stMemStatus) != LOS_OK)
+    {
+        (VOID)memset(&pstStatus->stMemStatus, 0, sizeof(LOS_MEM_STATUS));
+    }
+    pstStatus->uwMaxFreeSize = LOS_MemGetMaxFreeBlkSize(pstStatus->pPool);
+
+    return LOS_OK;
+}
+
+#endif /* (LOSCFG_MEM_REGION == YES) */
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* __cplusplus */
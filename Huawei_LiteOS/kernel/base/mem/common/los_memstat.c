@@ -0,0 +1,429 @@
+/*----------------------------------------------------------------------------
+ * Copyright (c) <2013-2015>, <Huawei Technologies Co., Ltd>
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *---------------------------------------------------------------------------*/
+/*----------------------------------------------------------------------------
+ * Notice of Export Control Law
+ * ===============================================
+ * Huawei LiteOS may be subject to applicable export control laws and regulations, which might
+ * include those applicable to Huawei LiteOS of U.S. and the country in which you are located.
+ * Import, export and usage of Huawei LiteOS in any manner by you shall be in compliance with such
+ * applicable export control laws and regulations.
+ *---------------------------------------------------------------------------*/
+
+#include "los_memstat.ph"
+#include "los_task.ph"
+#include "los_heap.ph"
+#ifdef LOSCFG_KERNEL_MEM_SLAB
+#include "los_slab.ph"
+#endif
+#include "los_hwi.h"
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+#endif /* __cplusplus */
+
+#if (LOSCFG_MEM_TASK_STAT == YES)
+
+LITE_OS_SEC_BSS_MINOR LOS_MEM_TASK_STAT g_astMemTaskStat[LOS_MEM_STAT_NO_TASK + 1];
+
+#if (LOSCFG_MEM_LEAKCHECK == YES)
+
+#ifndef LOSCFG_MEM_LEAKCHECK_SIZE
+#define LOSCFG_MEM_LEAKCHECK_SIZE                   128
+#endif
+
+#if (LOSCFG_MEM_LEAKCHECK_SIZE & (LOSCFG_MEM_LEAKCHECK_SIZE - 1))
+#error "LOSCFG_MEM_LEAKCHECK_SIZE must be a power of 2"
+#endif
+
+#define OS_MEM_LEAK_MASK                            (LOSCFG_MEM_LEAKCHECK_SIZE - 1)
+/* Fibonacci hashing of the block address, blocks are at least 4-byte aligned */
+#define OS_MEM_LEAK_HASH(uvPtr)                     ((((UINT32)(uvPtr) >> 2) * 0x9E3779B1U) >> 16 & OS_MEM_LEAK_MASK)
+
+typedef struct tagMemLeakNode
+{
+    UINTPTR uvPtr;          /* block, 0 for an empty entry */
+    UINTPTR uvCaller;
+    UINT32  uwSize;
+    UINT32  uwSeq;          /* number of allocations before this one */
+} OS_MEM_LEAK_NODE;
+
+/* open addressing with linear probing, one entry is always left empty so that probes end */
+LITE_OS_SEC_BSS_MINOR OS_MEM_LEAK_NODE g_astMemLeakTab[LOSCFG_MEM_LEAKCHECK_SIZE];
+LITE_OS_SEC_BSS_MINOR UINT32 g_uwMemLeakCnt;
+LITE_OS_SEC_BSS_MINOR UINT32 g_uwMemLeakSeq;
+LITE_OS_SEC_BSS_MINOR UINT32 g_uwMemLeakLost;
+
+/*****************************************************************************
+ Function    : osMemLeakAdd
+ Description : Track an allocation, the interrupts must be locked
+ Input       : uvPtr    --- block
+               uvCaller --- call site
+               uwSize   --- size of the block
+ Output      : None
+ Return      : None
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_MINOR static VOID osMemLeakAdd(UINTPTR uvPtr, UINTPTR uvCaller, UINT32 uwSize)
+{
+    OS_MEM_LEAK_NODE *pstNode;
+    UINT32 uwIdx;
+
+    if (g_uwMemLeakCnt >= OS_MEM_LEAK_MASK)
+    {
+        g_uwMemLeakLost++;
+        return;
+    }
+
+    uwIdx = OS_MEM_LEAK_HASH(uvPtr);
+    while (g_astMemLeakTab[uwIdx].uvPtr != 0)
+    {
+        uwIdx = (uwIdx + 1) & OS_MEM_LEAK_MASK;
+    }
+
+    pstNode = &g_astMemLeakTab[uwIdx];
+    pstNode->uvPtr = uvPtr;
+    pstNode->uvCaller = uvCaller;
+    pstNode->uwSize = uwSize;
+    pstNode->uwSeq = g_uwMemLeakSeq++;
+    g_uwMemLeakCnt++;
+}
+
+/*****************************************************************************
+ Function    : osMemLeakDel
+ Description : Stop tracking a freed block, the interrupts must be locked
+ Input       : uvPtr --- block
+ Output      : None
+ Return      : None
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_MINOR static VOID osMemLeakDel(UINTPTR uvPtr)
+{
+    UINT32 uwIdx = OS_MEM_LEAK_HASH(uvPtr);
+    UINT32 uwNext;
+    UINT32 uwHome;
+
+    while (g_astMemLeakTab[uwIdx].uvPtr != uvPtr)
+    {
+        if (g_astMemLeakTab[uwIdx].uvPtr == 0)
+        {
+            /* allocated when the table was full */
+            return;
+        }
+        uwIdx = (uwIdx + 1) & OS_MEM_LEAK_MASK;
+    }
+
+    /* pull back the entries after the hole that would no longer be found past it */
+    uwNext = uwIdx;
+    for (;;)
+    {
+        uwNext = (uwNext + 1) & OS_MEM_LEAK_MASK;
+        if (g_astMemLeakTab[uwNext].uvPtr == 0)
+        {
+            break;
+        }
+
+        uwHome = OS_MEM_LEAK_HASH(g_astMemLeakTab[uwNext].uvPtr);
+        if (((uwNext - uwHome) & OS_MEM_LEAK_MASK) >= ((uwNext - uwIdx) & OS_MEM_LEAK_MASK))
+        {
+            g_astMemLeakTab[uwIdx] = g_astMemLeakTab[uwNext];
+            uwIdx = uwNext;
+        }
+    }
+
+    g_astMemLeakTab[uwIdx].uvPtr = 0;
+    g_uwMemLeakCnt--;
+}
+#endif /* (LOSCFG_MEM_LEAKCHECK == YES) */
+
+/*****************************************************************************
+ Function    : osMemStatTaskGet
+ Description : Get the ID the running code is charged as
+ Input       : None
+ Output      : None
+ Return      : task ID, LOS_MEM_STAT_NO_TASK in interrupts and before the first task runs
+ *****************************************************************************/
+LITE_OS_SEC_TEXT static inline UINT32 osMemStatTaskGet(VOID)
+{
+    UINT32 uwTaskID;
+
+    if (OS_INT_ACTIVE || (g_stLosTask.pstRunTask == NULL))
+    {
+        return LOS_MEM_STAT_NO_TASK;
+    }
+
+    uwTaskID = g_stLosTask.pstRunTask->uwTaskID;
+    return (uwTaskID > LOSCFG_BASE_CORE_TSK_LIMIT) ? LOS_MEM_STAT_NO_TASK : uwTaskID;
+}
+
+/*****************************************************************************
+ Function    : osMemStatAlloc
+ Description : Charge a new block to the running task
+ Input       : pPool    --- memory pool
+               pMem     --- block
+               uvCaller --- call site of the allocation
+ Output      : None
+ Return      : None
+ *****************************************************************************/
+LITE_OS_SEC_TEXT VOID osMemStatAlloc(VOID *pPool, VOID *pMem, UINTPTR uvCaller)
+{
+    LOS_MEM_TASK_STAT *pstStat;
+    struct LOS_HEAP_NODE *pstNode;
+    UINT32 uwTaskID = osMemStatTaskGet();
+    UINT32 uwSize = (UINT32)-1;
+    UINTPTR uvIntSave;
+
+#ifdef LOSCFG_KERNEL_MEM_SLAB
+    uwSize = osSlabMemCheck(pPool, pMem);
+    if (uwSize != (UINT32)-1)
+    {
+        OS_SLAB_BLOCK_TASK_SET(OS_SLAB_BLOCK_HEAD_GET(pMem), uwTaskID);
+    }
+#endif
+    if (uwSize == (UINT32)-1)
+    {
+        pstNode = ((struct LOS_HEAP_NODE *)pMem) - 1;
+        pstNode->uwTaskID = uwTaskID;
+        uwSize = pstNode->uwSize;
+    }
+
+    uvIntSave = LOS_IntLock();
+    pstStat = &g_astMemTaskStat[uwTaskID];
+    pstStat->uwCurSize += uwSize;
+    pstStat->uwAllocCnt++;
+    if (pstStat->uwCurSize > pstStat->uwPeakSize)
+    {
+        pstStat->uwPeakSize = pstStat->uwCurSize;
+    }
+#if (LOSCFG_MEM_LEAKCHECK == YES)
+    osMemLeakAdd((UINTPTR)pMem, uvCaller, uwSize);
+#else
+    (VOID)uvCaller;
+#endif
+    LOS_IntRestore(uvIntSave);
+}
+
+/*****************************************************************************
+ Function    : osMemStatOwnerGet
+ Description : Get the task a block is charged to
+ Input       : pPool --- memory pool
+               pMem  --- block
+ Output      : puwSize --- size of the block
+ Return      : task ID
+ *****************************************************************************/
+LITE_OS_SEC_TEXT UINT32 osMemStatOwnerGet(VOID *pPool, VOID *pMem, UINT32 *puwSize)
+{
+    struct LOS_HEAP_NODE *pstNode;
+
+#ifdef LOSCFG_KERNEL_MEM_SLAB
+    *puwSize = osSlabMemCheck(pPool, pMem);
+    if (*puwSize != (UINT32)-1)
+    {
+        return OS_SLAB_BLOCK_TASK_GET(OS_SLAB_BLOCK_HEAD_GET(pMem));
+    }
+#endif
+
+    pstNode = ((struct LOS_HEAP_NODE *)pMem) - 1;
+    *puwSize = pstNode->uwSize;
+    return pstNode->uwTaskID;
+}
+
+/*****************************************************************************
+ Function    : osMemStatFree
+ Description : Give a freed block back to its task
+ Input       : uwTaskID --- task the block is charged to
+               pMem     --- block
+               uwSize   --- size of the block
+ Output      : None
+ Return      : None
+ *****************************************************************************/
+LITE_OS_SEC_TEXT VOID osMemStatFree(UINT32 uwTaskID, VOID *pMem, UINT32 uwSize)
+{
+    LOS_MEM_TASK_STAT *pstStat;
+    UINTPTR uvIntSave;
+
+    if (uwTaskID > LOS_MEM_STAT_NO_TASK)
+    {
+        return;
+    }
+
+    uvIntSave = LOS_IntLock();
+    pstStat = &g_astMemTaskStat[uwTaskID];
+    pstStat->uwCurSize -= uwSize;
+    pstStat->uwFreeCnt++;
+#if (LOSCFG_MEM_LEAKCHECK == YES)
+    osMemLeakDel((UINTPTR)pMem);
+#else
+    (VOID)pMem;
+#endif
+    LOS_IntRestore(uvIntSave);
+}
+
+/*****************************************************************************
+ Function    : LOS_MemTaskStatGet
+ Description : Get the memory usage of a task
+ Input       : uwTaskID --- task ID
+ Output      : pstStat  --- memory usage of the task
+ Return      : LOS_OK on success or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_MINOR UINT32 LOS_MemTaskStatGet(UINT32 uwTaskID, LOS_MEM_TASK_STAT *pstStat)
+{
+    UINTPTR uvIntSave;
+
+    if (pstStat == NULL)
+    {
+        return LOS_ERRNO_MEMSTAT_PTR_NULL;
+    }
+
+    if (uwTaskID > LOS_MEM_STAT_NO_TASK)
+    {
+        return LOS_ERRNO_MEMSTAT_TSKID_INVALID;
+    }
+
+    uvIntSave = LOS_IntLock();
+    *pstStat = g_astMemTaskStat[uwTaskID];
+    LOS_IntRestore(uvIntSave);
+
+    return LOS_OK;
+}
+
+/*****************************************************************************
+ Function    : LOS_MemTaskPeakReset
+ Description : Set the peak memory usage of a task to its current usage
+ Input       : uwTaskID --- task ID
+ Output      : None
+ Return      : LOS_OK on success or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_MINOR UINT32 LOS_MemTaskPeakReset(UINT32 uwTaskID)
+{
+    UINTPTR uvIntSave;
+
+    if (uwTaskID > LOS_MEM_STAT_NO_TASK)
+    {
+        return LOS_ERRNO_MEMSTAT_TSKID_INVALID;
+    }
+
+    uvIntSave = LOS_IntLock();
+    g_astMemTaskStat[uwTaskID].uwPeakSize = g_astMemTaskStat[uwTaskID].uwCurSize;
+    LOS_IntRestore(uvIntSave);
+
+    return LOS_OK;
+}
+
+#if (LOSCFG_MEM_LEAKCHECK == YES)
+/*****************************************************************************
+ Function    : LOS_MemLeakMark
+ Description : Mark a point in time to compare the allocations with
+ Input       : None
+ Output      : None
+ Return      : the mark
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_MINOR UINT32 LOS_MemLeakMark(VOID)
+{
+    return g_uwMemLeakSeq;
+}
+
+/*****************************************************************************
+ Function    : LOS_MemLeakDiff
+ Description : Sum up per call site the blocks allocated after a mark and not freed yet
+ Input       : uwMark     --- mark returned by LOS_MemLeakMark
+               puwSiteNum --- number of entries of pstSites
+ Output      : pstSites   --- call sites
+               puwSiteNum --- number of sites reported
+ Return      : LOS_OK on success or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_MINOR UINT32 LOS_MemLeakDiff(UINT32 uwMark, LOS_MEM_LEAK_SITE *pstSites, UINT32 *puwSiteNum)
+{
+    OS_MEM_LEAK_NODE *pstNode;
+    UINTPTR uvIntSave;
+    UINT32 uwRet = LOS_OK;
+    UINT32 uwSiteCnt = 0;
+    UINT32 uwIdx;
+    UINT32 uwSite;
+
+    if ((pstSites == NULL) || (puwSiteNum == NULL))
+    {
+        return LOS_ERRNO_MEMSTAT_PTR_NULL;
+    }
+
+    uvIntSave = LOS_IntLock();
+    for (uwIdx = 0; uwIdx < LOSCFG_MEM_LEAKCHECK_SIZE; uwIdx++)
+    {
+        pstNode = &g_astMemLeakTab[uwIdx];
+        if ((pstNode->uvPtr == 0) || ((INT32)(pstNode->uwSeq - uwMark) < 0))
+        {
+            continue;
+        }
+
+        for (uwSite = 0; uwSite < uwSiteCnt; uwSite++)
+        {
+            if (pstSites[uwSite].uvCaller == pstNode->uvCaller)
+            {
+                break;
+            }
+        }
+
+        if (uwSite == uwSiteCnt)
+        {
+            if (uwSiteCnt == *puwSiteNum)
+            {
+                uwRet = LOS_ERRNO_MEMSTAT_SITE_FULL;
+                continue;
+            }
+            pstSites[uwSite].uvCaller = pstNode->uvCaller;
+            pstSites[uwSite].uwCount = 0;
+            pstSites[uwSite].uwSize = 0;
+            uwSiteCnt++;
+        }
+
+        pstSites[uwSite].uwCount++;
+        pstSites[uwSite].uwSize += pstNode->uwSize;
+    }
+    LOS_IntRestore(uvIntSave);
+
+    *puwSiteNum = uwSiteCnt;
+    return uwRet;
+}
+
+/*****************************************************************************
+ Function    : LOS_MemLeakLostGet
+ Description : Get the number of allocations that found the table full
+ Input       : None
+ Output      : None
+ Return      : number of allocations not tracked
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_MINOR UINT32 LOS_MemLeakLostGet(VOID)
+{
+    return g_uwMemLeakLost;
+}
+#endif /* (LOSCFG_MEM_LEAKCHECK == YES) */
+
+#endif /* (LOSCFG_MEM_TASK_STAT == YES) */
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* __cplusplus */
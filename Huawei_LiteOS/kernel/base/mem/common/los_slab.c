@@ -33,12 +33,14 @@
  *---------------------------------------------------------------------------*/
 #include <string.h>
 #include <stdint.h>
+#include <los_hw.h>
 #include <los_heap.ph>
 #include <los_slab.ph>
 
 VOID osAtomicBitsetInit(struct AtomicBitset *pstSet, UINT32 uwNumBits)
 {
     pstSet->numBits = uwNumBits;
+    pstSet->hint = 0;
     memset(pstSet->words, 0, (uwNumBits + 31) / 8);
     if (uwNumBits & 31) //mark all high bits so that osAtomicBitsetFindClearAndSet() is simpler
     {
@@ -69,34 +71,32 @@ VOID osAtomicBitsetClearBit(struct AtomicBitset *pstSet, UINT32 uwNum)
         return;
     }
     (*puwWordPtr) &= ~(1UL << (uwNum & 31));
+    pstSet->hint = uwNum / 32;
 }
 
 /* find from the high bit to high bitreturn the address of the first available bit */
 INT32 osAtomicBitsetFindClearAndSet(struct AtomicBitset *pstSet)
 {
-    UINT32 uwIdx, uwNumWords = (pstSet->numBits + 31) / 32;
-    UINT32 *puwWordPtr = pstSet->words;
-    UINT32 uwTmpWord;
-    INT32 swCnt = 0;
+    UINT32 uwNumWords = (pstSet->numBits + 31) / 32;
+    UINT32 uwIdx = pstSet->hint;
+    UINT32 uwCnt;
+    UINT32 uwBit;
 
-    for (uwIdx = 0; uwIdx < uwNumWords; uwIdx++, puwWordPtr++)
+    /* start from the word of the last alloc or free, it is the most likely one to have a clear bit */
+    for (uwCnt = 0; uwCnt < uwNumWords; uwCnt++)
     {
-        if (*puwWordPtr == 0xFFFFFFFF)
+        if (pstSet->words[uwIdx] != 0xFFFFFFFF)
         {
-            continue;
+            uwBit = 31 - OS_CLZ(~pstSet->words[uwIdx]);
+            pstSet->words[uwIdx] |= (1UL << uwBit);
+            pstSet->hint = uwIdx;
+            return (INT32)(uwIdx * 32 + uwBit);
         }
 
-        uwTmpWord = ~(*puwWordPtr);
-
-        while(uwTmpWord)
+        if (++uwIdx == uwNumWords)
         {
-            uwTmpWord = uwTmpWord >> 1UL;
-            swCnt++;
+            uwIdx = 0;
         }
-
-        *puwWordPtr |= (1UL << (swCnt - 1));
-
-        return (INT32)(uwIdx * 32 + swCnt - 1);
     }
 
     return -1;
@@ -157,6 +157,7 @@ OS_SLAB_ALLOCATOR* osSlabAllocatorNew(VOID *pPool, UINT32 uwItemSz, UINT32 uwIte
     if (pstAllocator)
     {
         pstAllocator->uwItemSz = uwItemSz;
+        pstAllocator->uwUsedCnt = 0;
         pstAllocator->ucDataChunks = ((UINT8*)pstAllocator->bitset) + uwBitsetSz;
         osAtomicBitsetInit(pstAllocator->bitset, uwNumItems);
     }
@@ -176,6 +177,7 @@ VOID* osSlabAllocatorAlloc(OS_SLAB_ALLOCATOR *pstAllocator)
     if (swItemIdx < 0)
         return NULL;
 
+    pstAllocator->uwUsedCnt++;
     return pstAllocator->ucDataChunks + pstAllocator->uwItemSz * swItemIdx;
 }
 
@@ -190,6 +192,7 @@ BOOL osSlabAllocatorFree(OS_SLAB_ALLOCATOR *pstAllocator, VOID* ptrP)
         return FALSE;
 
     osAtomicBitsetClearBit(pstAllocator->bitset, uwItemIdx);
+    pstAllocator->uwUsedCnt--;
     return TRUE;
 }
 
@@ -225,21 +228,12 @@ UINT32 osSlabAllocatorGetNumItems(OS_SLAB_ALLOCATOR *pstAllocator)
 
 BOOL osSlabAllocatorEmpty(OS_SLAB_ALLOCATOR *pstAllocator)
 {
-    return osBitsetEmpty(pstAllocator->bitset);
+    return (pstAllocator->uwUsedCnt == 0) ? TRUE : FALSE;
 }
 
 UINT32 osSlabAllocatorGetUsedItemCnt(OS_SLAB_ALLOCATOR *pstAllocator)
 {
-    UINT32 uwUsed, uwIdx;
-    struct AtomicBitset *p_bitset = pstAllocator->bitset;
-    for (uwUsed = 0, uwIdx = 0; uwIdx < p_bitset->numBits; uwIdx++)
-    {
-        if (osAtomicBitsetGetBit(p_bitset, uwIdx))
-        {
-            uwUsed ++;
-        }
-    }
-    return uwUsed;
+    return pstAllocator->uwUsedCnt;
 }
 
 VOID osSlabAllocatorGetSlabInfo(OS_SLAB_ALLOCATOR *pstAllocator, UINT32 *puwItemSz, UINT32 *puwItemCnt, UINT32 *puwCurUsage)
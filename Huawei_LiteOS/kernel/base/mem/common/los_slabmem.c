@@ -40,6 +40,8 @@
 
 #define OS_SLAB_CAST(_t, _exp) ((_t)(_exp))
 
+static const OS_SLAB_CLASS_CFG g_astSlabClassCfg[SLAB_MEM_COUNT] = SLAB_CLASS_TABLE;
+
 VOID *osSlabCtrlHdrGet(VOID *pPool)
 {
 #ifdef LOSCFG_KERNEL_MEM_SLAB
@@ -49,14 +51,90 @@ VOID *osSlabCtrlHdrGet(VOID *pPool)
 #endif
 }
 
-VOID *osSlabBlockHeadFill(OS_SLAB_BLOCK_NODE *pstSlabNode, UINT32 uwBlkSz)
+VOID *osSlabBlockHeadFill(OS_SLAB_BLOCK_NODE *pstSlabNode, UINT32 uwClassIdx, UINT32 uwPageIdx)
 {
     OS_SLAB_BLOCK_MAGIC_SET(pstSlabNode);
-    OS_SLAB_BLOCK_SIZE_SET(pstSlabNode, uwBlkSz);
-    OS_SLAB_BLOCK_ID_SET(pstSlabNode, 0);//now undefine how to use ID
+    OS_SLAB_BLOCK_CLASS_SET(pstSlabNode, uwClassIdx);
+    OS_SLAB_BLOCK_PAGE_SET(pstSlabNode, uwPageIdx);
     return (VOID *)(pstSlabNode + 1);
 }
 
+/*****************************************************************************
+ Function : osSlabPageNew
+ Description : To add a slab page to a class
+ Input       : pPool --- memory pool
+               pstSlabClass --- slab class
+ Output      : None
+ Return      : index of the new page, or SLAB_PAGE_MAX if no page can be added
+*****************************************************************************/
+static UINT32 osSlabPageNew(VOID *pPool, OS_SLAB_MEM *pstSlabClass)
+{
+    UINT32 uwPageIdx;
+
+    for (uwPageIdx = 0; uwPageIdx < SLAB_PAGE_MAX; uwPageIdx++)
+    {
+        if (NULL == pstSlabClass->alloc[uwPageIdx])
+        {
+            pstSlabClass->alloc[uwPageIdx] = osSlabAllocatorNew(pPool, pstSlabClass->blkSz + sizeof(OS_SLAB_BLOCK_NODE),
+                                                                sizeof(VOID *), pstSlabClass->blkCnt);
+            if (NULL == pstSlabClass->alloc[uwPageIdx])
+            {
+                break;
+            }
+            pstSlabClass->pageCnt++;
+            return uwPageIdx;
+        }
+    }
+
+    return SLAB_PAGE_MAX;
+}
+
+/*****************************************************************************
+ Function : osSlabClassAlloc
+ Description : To alloc a block from the pages of a class
+ Input       : pPool --- memory pool
+               pstSlabMem --- slab control header
+               uwIdx --- class index
+               bGrow --- whether a page may be added when all pages are full
+ Output      : None
+ Return      : pointer to the block, or NULL if the class is full
+*****************************************************************************/
+static VOID *osSlabClassAlloc(VOID *pPool, struct LOS_SLAB_CONTROL_HEADER *pstSlabMem, UINT32 uwIdx, BOOL bGrow)
+{
+    OS_SLAB_MEM *pstSlabClass = &(pstSlabMem->stSlabClass[uwIdx]);
+    VOID *pRet = NULL;
+    UINT32 uwPageIdx = SLAB_PAGE_MAX;
+
+    if (pstSlabClass->blkUsedCnt < pstSlabClass->blkCnt * pstSlabClass->pageCnt)
+    {
+        for (uwPageIdx = 0; uwPageIdx < SLAB_PAGE_MAX; uwPageIdx++)
+        {
+            if ((NULL != pstSlabClass->alloc[uwPageIdx]) &&
+                (osSlabAllocatorGetUsedItemCnt(pstSlabClass->alloc[uwPageIdx]) < pstSlabClass->blkCnt))
+            {
+                break;
+            }
+        }
+    }
+    else if (bGrow)
+    {
+        uwPageIdx = osSlabPageNew(pPool, pstSlabClass);
+    }
+
+    if (uwPageIdx >= SLAB_PAGE_MAX)
+    {
+        return NULL;
+    }
+
+    pRet = osSlabAllocatorAlloc(pstSlabClass->alloc[uwPageIdx]);
+    if (NULL != pRet)
+    {
+        pRet = osSlabBlockHeadFill((OS_SLAB_BLOCK_NODE *)pRet, uwIdx, uwPageIdx);
+        pstSlabClass->blkUsedCnt++;
+    }
+    return pRet;
+}
+
 /*****************************************************************************
  Function : osSlabMemInit
  Description : To initialize the slab memory management
@@ -69,24 +147,30 @@ BOOL osSlabMemInit(VOID *pPool)
     struct LOS_SLAB_CONTROL_HEADER *pstSlabMemHead = osSlabCtrlHdrGet(pPool);
     UINT32 uwIdx = 0;
     UINT32 uwTmp = 0;
-    UINT32 uwBlkSz = 0;
-    UINT32 uwBlkCnt = 0;
 
     for (uwIdx = 0; uwIdx < SLAB_MEM_COUNT; uwIdx++)
     {
-        uwBlkSz = (0x10 << uwIdx);
-        uwBlkCnt = SLAB_MEM_ALLOCATOR_SIZE / uwBlkSz;
-        pstSlabMemHead->stSlabClass[uwIdx].blkSz = uwBlkSz;
-        pstSlabMemHead->stSlabClass[uwIdx].blkCnt = uwBlkCnt;
+        if ((0 == g_astSlabClassCfg[uwIdx].blkSz) || (0 == g_astSlabClassCfg[uwIdx].blkCnt) ||
+            ((uwIdx > 0) && (g_astSlabClassCfg[uwIdx].blkSz <= g_astSlabClassCfg[uwIdx - 1].blkSz)))
+        {
+            PRINT_ERR("SlabMemAllocator[%d] class config invalid\n", uwIdx);
+            return FALSE;
+        }
+
+        pstSlabMemHead->stSlabClass[uwIdx].blkSz = g_astSlabClassCfg[uwIdx].blkSz;
+        pstSlabMemHead->stSlabClass[uwIdx].blkCnt = g_astSlabClassCfg[uwIdx].blkCnt;
         pstSlabMemHead->stSlabClass[uwIdx].blkUsedCnt = 0;
-        if (NULL != pstSlabMemHead->stSlabClass[uwIdx].alloc)
+        pstSlabMemHead->stSlabClass[uwIdx].hitCnt = 0;
+        pstSlabMemHead->stSlabClass[uwIdx].missCnt = 0;
+        pstSlabMemHead->stSlabClass[uwIdx].fallbackCnt = 0;
+        if (0 != pstSlabMemHead->stSlabClass[uwIdx].pageCnt)
         {
             PRINT_WARN("SlabMemAllocator[%d] inited before\n", uwIdx);
             uwTmp++;
         }
         else
         {
-            pstSlabMemHead->stSlabClass[uwIdx].alloc = osSlabAllocatorNew(pPool, uwBlkSz + sizeof(OS_SLAB_BLOCK_NODE), sizeof(VOID *), uwBlkCnt);
+            (VOID)osSlabPageNew(pPool, &(pstSlabMemHead->stSlabClass[uwIdx]));
         }
     }
 
@@ -95,22 +179,23 @@ BOOL osSlabMemInit(VOID *pPool)
 
 /*****************************************************************************
  Function : osSlabMemAlloc
- Description : To alloc memory block
+ Description : To alloc memory block from the smallest class that fits, adding a page to it when it is full,
+               then from the larger classes
  Input       :  UITN32 sz --- size of the  memory we want to alloc
  Output      : None
- Return      : pointer :the address of the memory we alloced
+ Return      : pointer :the address of the memory we alloced, NULL to fall back to the heap
 *****************************************************************************/
 VOID *osSlabMemAlloc(VOID *pPool, UINT32 uwSz)
 {
     VOID *pRet = NULL;
     UINTPTR uvIntSave;
     struct LOS_SLAB_CONTROL_HEADER *pstSlabMem = osSlabCtrlHdrGet(pPool);
-    OS_SLAB_MEM *pstSlabAlloc = NULL;
     UINT32 uwIdx = 0;
+    UINT32 uwTry;
 
     for (uwIdx = 0; uwIdx < SLAB_MEM_COUNT; uwIdx++)
     {
-        if (uwSz<= pstSlabMem->stSlabClass[uwIdx].blkSz)
+        if (uwSz <= pstSlabMem->stSlabClass[uwIdx].blkSz)
         {
             goto FOUND;
         }
@@ -119,31 +204,72 @@ VOID *osSlabMemAlloc(VOID *pPool, UINT32 uwSz)
 FOUND:
     uvIntSave = LOS_IntLock();
 
-    if (pstSlabMem->stSlabClass[uwIdx].blkUsedCnt >= pstSlabMem->stSlabClass[uwIdx].blkCnt)
+    for (uwTry = uwIdx; uwTry < SLAB_MEM_COUNT; uwTry++)
     {
-        PRINT_INFO("slab used = 0x%d, cnt = 0x%d\n",pstSlabMem->stSlabClass[uwIdx].blkUsedCnt,pstSlabMem->stSlabClass[uwIdx].blkCnt);
-        (VOID)LOS_IntRestore(uvIntSave);
-        return NULL;
-    }
-
-    if (NULL != pstSlabMem->stSlabClass[uwIdx].alloc)
-    {
-        pstSlabAlloc = &(pstSlabMem->stSlabClass[uwIdx]);
-        pRet = osSlabAllocatorAlloc(pstSlabAlloc->alloc);
+        pRet = osSlabClassAlloc(pPool, pstSlabMem, uwTry, (uwTry == uwIdx) ? TRUE : FALSE);
         if (NULL != pRet)
         {
-            /* alloc success */
-            pRet = osSlabBlockHeadFill((OS_SLAB_BLOCK_NODE *)pRet, pstSlabMem->stSlabClass[uwIdx].blkSz);
-            pstSlabMem->stSlabClass[uwIdx].blkUsedCnt++;
+            break;
         }
     }
+
+    if (NULL == pRet)
+    {
+        pstSlabMem->stSlabClass[uwIdx].fallbackCnt++;
+    }
+    else if (uwTry == uwIdx)
+    {
+        pstSlabMem->stSlabClass[uwIdx].hitCnt++;
+    }
+    else
+    {
+        pstSlabMem->stSlabClass[uwIdx].missCnt++;
+    }
     (VOID)LOS_IntRestore(uvIntSave);
     return pRet;
 }
 
+/*****************************************************************************
+ Function : osSlabMemBlockGet
+ Description : To get the class and page of a slab memory block
+ Input       : pstSlabMem --- slab control header
+               pPtr --- pointer to the memory block
+ Output      : puwIdx --- class index
+ Return      : the page the block was carved from, or NULL if the block is not a slab block
+*****************************************************************************/
+static OS_SLAB_ALLOCATOR *osSlabMemBlockGet(struct LOS_SLAB_CONTROL_HEADER *pstSlabMem, VOID *pPtr, UINT32 *puwIdx)
+{
+    OS_SLAB_BLOCK_NODE *pstSlabNode = OS_SLAB_BLOCK_HEAD_GET(pPtr);
+    OS_SLAB_ALLOCATOR *pstAllocator;
+    UINT32 uwIdx;
+    UINT32 uwPageIdx;
+
+    if (!OS_ALLOC_FROM_SLAB_CHECK(pstSlabNode))
+    {
+        return NULL;
+    }
+
+    uwIdx = OS_SLAB_BLOCK_CLASS_GET(pstSlabNode);
+    uwPageIdx = OS_SLAB_BLOCK_PAGE_GET(pstSlabNode);
+    if ((uwIdx >= SLAB_MEM_COUNT) || (uwPageIdx >= SLAB_PAGE_MAX))
+    {
+        return NULL;
+    }
+
+    pstAllocator = pstSlabMem->stSlabClass[uwIdx].alloc[uwPageIdx];
+    if ((NULL == pstAllocator) || (osSlabAllocatorCheck(pstAllocator, pstSlabNode) != TRUE))
+    {
+        return NULL;
+    }
+
+    *puwIdx = uwIdx;
+    return pstAllocator;
+}
+
 /*****************************************************************************
  Function : osSlabMemFree
- Description : To free the  memory block
+ Description : To free the  memory block, the pages added on demand are given back once they are empty
+               and the other pages have half a page free
  Input       : VOID* pPtr: the pointer of heap memory we want to free
  Output      : None
  Return      : 1:success 0:error
@@ -152,35 +278,38 @@ BOOL osSlabMemFree(VOID *pPool, VOID* pPtr)
 {
     UINTPTR uvIntSave;
     struct LOS_SLAB_CONTROL_HEADER *pstSlabMem = osSlabCtrlHdrGet(pPool);
-    BOOL bRet = FALSE;
-    OS_SLAB_MEM *pstSlabAlloc;
+    OS_SLAB_MEM *pstSlabClass;
+    OS_SLAB_ALLOCATOR *pstAllocator;
     UINT32 uwIdx = 0;
-    OS_SLAB_BLOCK_NODE *pstSlabNode = OS_SLAB_BLOCK_HEAD_GET(pPtr);
+    UINT32 uwPageIdx;
 
-    if (!OS_ALLOC_FROM_SLAB_CHECK(pstSlabNode))
+    uvIntSave = LOS_IntLock();
+
+    pstAllocator = osSlabMemBlockGet(pstSlabMem, pPtr, &uwIdx);
+    if ((NULL == pstAllocator) || (osSlabAllocatorFree(pstAllocator, OS_SLAB_BLOCK_HEAD_GET(pPtr)) != TRUE))
     {
+        (VOID)LOS_IntRestore(uvIntSave);
         return FALSE;
     }
-    for (uwIdx = 0; uwIdx < SLAB_MEM_COUNT; uwIdx++)
+
+    pstSlabClass = &(pstSlabMem->stSlabClass[uwIdx]);
+    pstSlabClass->blkUsedCnt--;
+
+    /* a page may have emptied while the others were full, so look at all of them */
+    for (uwPageIdx = 1; uwPageIdx < SLAB_PAGE_MAX; uwPageIdx++)
     {
-        if (OS_SLAB_BLOCK_SIZE_GET(pstSlabNode) <= pstSlabMem->stSlabClass[uwIdx].blkSz)
+        pstAllocator = pstSlabClass->alloc[uwPageIdx];
+        if ((NULL != pstAllocator) && (osSlabAllocatorEmpty(pstAllocator) == TRUE) &&
+            ((pstSlabClass->pageCnt - 1) * pstSlabClass->blkCnt - pstSlabClass->blkUsedCnt >= pstSlabClass->blkCnt / 2))
         {
-            goto FOUND;
+            osSlabAllocatorDestroy(pPool, pstAllocator);
+            pstSlabClass->alloc[uwPageIdx] = NULL;
+            pstSlabClass->pageCnt--;
         }
     }
-    return FALSE;
-FOUND:
-    uvIntSave = LOS_IntLock();
-
-    pstSlabAlloc = &(pstSlabMem->stSlabClass[uwIdx]);
 
-    if (osSlabAllocatorFree(pstSlabAlloc->alloc, pstSlabNode) == TRUE)
-    {
-        bRet = TRUE;
-        pstSlabMem->stSlabClass[uwIdx].blkUsedCnt--;
-    }
     (VOID)LOS_IntRestore(uvIntSave);
-    return bRet;
+    return TRUE;
 }
 
 /*****************************************************************************
@@ -193,10 +322,9 @@ FOUND:
 VOID osSlabMemDeinit(VOID *pPool)
 {
     UINT32 uwIdx;
+    UINT32 uwPageIdx;
     struct LOS_SLAB_CONTROL_HEADER *pstSlabMem = osSlabCtrlHdrGet(pPool);
-    OS_SLAB_MEM *pstSlabAlloc;
-    UINT32 uwBlkSz;
-    UINT32 uwBlkCnt;
+    OS_SLAB_MEM *pstSlabClass;
 
     if (NULL == pPool)
     {
@@ -204,16 +332,17 @@ VOID osSlabMemDeinit(VOID *pPool)
     }
     for (uwIdx = 0; uwIdx < SLAB_MEM_COUNT; uwIdx++)
     {
-        uwBlkSz = (0x10 << uwIdx);
-        uwBlkCnt = SLAB_MEM_ALLOCATOR_SIZE / uwBlkSz;
-        pstSlabMem->stSlabClass[uwIdx].blkSz = uwBlkSz;
-        pstSlabMem->stSlabClass[uwIdx].blkCnt = uwBlkCnt;
-        if (NULL != pstSlabMem->stSlabClass[uwIdx].alloc)
+        pstSlabClass = &(pstSlabMem->stSlabClass[uwIdx]);
+        for (uwPageIdx = 0; uwPageIdx < SLAB_PAGE_MAX; uwPageIdx++)
         {
-            pstSlabAlloc = &(pstSlabMem->stSlabClass[uwIdx]);
-            osSlabAllocatorDestroy(pPool, pstSlabAlloc->alloc);
-            pstSlabMem->stSlabClass[uwIdx].alloc = NULL;
+            if (NULL != pstSlabClass->alloc[uwPageIdx])
+            {
+                osSlabAllocatorDestroy(pPool, pstSlabClass->alloc[uwPageIdx]);
+                pstSlabClass->alloc[uwPageIdx] = NULL;
+            }
         }
+        pstSlabClass->pageCnt = 0;
+        pstSlabClass->blkUsedCnt = 0;
     }
     return ;
 }
@@ -223,37 +352,44 @@ UINT32 osSlabMemCheck(VOID *pPool, VOID* pPtr)
     UINTPTR uvIntSave;
     struct LOS_SLAB_CONTROL_HEADER *pstSlabMem = osSlabCtrlHdrGet(pPool);
     UINT32 uwRetBlkSz = (UINT32)-1;
-    OS_SLAB_MEM *pstSlabAlloc;
     UINT32 uwIdx = 0;
-    OS_SLAB_BLOCK_NODE *pstSlabNode = OS_SLAB_BLOCK_HEAD_GET(pPtr);
 
-    for (uwIdx = 0; uwIdx < SLAB_MEM_COUNT; uwIdx++)
+    uvIntSave = LOS_IntLock();
+    if (NULL != osSlabMemBlockGet(pstSlabMem, pPtr, &uwIdx))
     {
-        if (OS_SLAB_BLOCK_SIZE_GET(pstSlabNode) <= pstSlabMem->stSlabClass[uwIdx].blkSz)
-        {
-            goto FOUND;
-        }
+        uwRetBlkSz = pstSlabMem->stSlabClass[uwIdx].blkSz;
     }
+    (VOID)LOS_IntRestore(uvIntSave);
     return uwRetBlkSz;
+}
 
-FOUND:
-    uvIntSave = LOS_IntLock();
-    for (uwIdx = 0; uwIdx < SLAB_MEM_COUNT; uwIdx++)
+VOID osSlabClassInfoGet(VOID *pPool, UINT32 uwIdx, UINT32 *puwItemSz, UINT32 *puwItemCnt, UINT32 *puwCurUsage)
+{
+    struct LOS_SLAB_CONTROL_HEADER *pstSlabMem = osSlabCtrlHdrGet(pPool);
+    OS_SLAB_MEM *pstSlabClass = &(pstSlabMem->stSlabClass[uwIdx]);
+    UINT32 uwItemSz = 0;
+    UINT32 uwItemCnt = 0;
+    UINT32 uwCurUsage = 0;
+    UINT32 uwPageIdx;
+
+    *puwItemSz = 0;
+    *puwItemCnt = 0;
+    *puwCurUsage = 0;
+    for (uwPageIdx = 0; uwPageIdx < SLAB_PAGE_MAX; uwPageIdx++)
     {
-        pstSlabAlloc = &(pstSlabMem->stSlabClass[uwIdx]);
-        if (osSlabAllocatorCheck(pstSlabAlloc->alloc, pstSlabNode) == TRUE)
+        if (NULL != pstSlabClass->alloc[uwPageIdx])
         {
-            uwRetBlkSz = pstSlabMem->stSlabClass[uwIdx].blkSz;
+            osSlabAllocatorGetSlabInfo(pstSlabClass->alloc[uwPageIdx], &uwItemSz, &uwItemCnt, &uwCurUsage);
+            *puwItemSz = uwItemSz;
+            *puwItemCnt += uwItemCnt;
+            *puwCurUsage += uwCurUsage;
         }
     }
-    (VOID)LOS_IntRestore(uvIntSave);
-    return uwRetBlkSz;
 }
 
 UINT32 osSlabStatisticsGet(VOID *pPool, LOS_SLAB_STATUS *pstStatus)
 {
     struct LOS_SLAB_CONTROL_HEADER *pstSlabMem = osSlabCtrlHdrGet(pPool);
-    OS_SLAB_MEM *pstSlabAlloc;
     UINT32 uwItemSz = 0;
     UINT32 uwItemCnt = 0;
     UINT32 uwCurUsage = 0;
@@ -270,13 +406,11 @@ UINT32 osSlabStatisticsGet(VOID *pPool, LOS_SLAB_STATUS *pstStatus)
 
     for (uwIdx = 0; uwIdx < SLAB_MEM_COUNT; uwIdx++)
     {
-        pstSlabAlloc = &(pstSlabMem->stSlabClass[uwIdx]);
-
-        osSlabAllocatorGetSlabInfo(pstSlabAlloc->alloc, &uwItemSz, &uwItemCnt, &uwCurUsage);
+        osSlabClassInfoGet(pPool, uwIdx, &uwItemSz, &uwItemCnt, &uwCurUsage);
         uwTotalUsage += (uwCurUsage * uwItemSz);
         uwTotalMem += (uwItemCnt * uwItemSz);
         uwTotalallocCount += pstSlabMem->stSlabClass[uwIdx].blkUsedCnt;
-        uwTotalfreeCount  += pstSlabMem->stSlabClass[uwIdx].blkCnt - pstSlabMem->stSlabClass[uwIdx].blkUsedCnt;
+        uwTotalfreeCount  += uwItemCnt - pstSlabMem->stSlabClass[uwIdx].blkUsedCnt;
     }
 
     if (uwTotalMem < uwTotalUsage)
@@ -294,8 +428,6 @@ UINT32 osSlabStatisticsGet(VOID *pPool, LOS_SLAB_STATUS *pstStatus)
 
 UINT32 osSlabGetMaxFreeBlkSize(VOID *pPool)
 {
-    struct LOS_SLAB_CONTROL_HEADER *pstSlabMem = osSlabCtrlHdrGet(pPool);
-    OS_SLAB_MEM *pstSlabAlloc;
     UINT32 uwItemSz = 0;
     UINT32 uwItemCnt = 0;
     UINT32 uwCurUsage = 0;
@@ -303,16 +435,41 @@ UINT32 osSlabGetMaxFreeBlkSize(VOID *pPool)
 
     for (uwIdx = SLAB_MEM_COUNT - 1; uwIdx >= 0; uwIdx--)
     {
-        pstSlabAlloc = &(pstSlabMem->stSlabClass[uwIdx]);
-        if (pstSlabAlloc->alloc)
+        osSlabClassInfoGet(pPool, (UINT32)uwIdx, &uwItemSz, &uwItemCnt, &uwCurUsage);
+        if (uwCurUsage != uwItemCnt)
         {
-            osSlabAllocatorGetSlabInfo(pstSlabAlloc->alloc, &uwItemSz, &uwItemCnt, &uwCurUsage);
-            if (uwCurUsage != uwItemCnt)
-            {
-                return uwItemSz;
-            }
+            return uwItemSz;
         }
     }
 
     return 0;
 }
+
+UINT32 LOS_SlabClassStatusGet(VOID *pPool, UINT32 uwClassIdx, LOS_SLAB_CLASS_STATUS *pstStatus)
+{
+    UINTPTR uvIntSave;
+    OS_SLAB_MEM *pstSlabClass;
+
+    if ((NULL == pPool) || (NULL == pstStatus) || (uwClassIdx >= SLAB_MEM_COUNT))
+    {
+        return LOS_NOK;
+    }
+
+    pstSlabClass = &(OS_SLAB_CAST(struct LOS_SLAB_CONTROL_HEADER *, osSlabCtrlHdrGet(pPool))->stSlabClass[uwClassIdx]);
+    if (0 == pstSlabClass->pageCnt)
+    {
+        return LOS_NOK;
+    }
+
+    uvIntSave = LOS_IntLock();
+    pstStatus->uwBlkSize     = pstSlabClass->blkSz;
+    pstStatus->uwBlkCnt      = pstSlabClass->blkCnt * pstSlabClass->pageCnt;
+    pstStatus->uwBlkUsedCnt  = pstSlabClass->blkUsedCnt;
+    pstStatus->uwPageCnt     = pstSlabClass->pageCnt;
+    pstStatus->uwHitCnt      = pstSlabClass->hitCnt;
+    pstStatus->uwMissCnt     = pstSlabClass->missCnt;
+    pstStatus->uwFallbackCnt = pstSlabClass->fallbackCnt;
+    (VOID)LOS_IntRestore(uvIntSave);
+
+    return LOS_OK;
+}
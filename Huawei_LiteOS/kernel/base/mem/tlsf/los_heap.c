@@ -0,0 +1,875 @@
+/*----------------------------------------------------------------------------
+ * Copyright (c) <2013-2015>, <Huawei Technologies Co., Ltd>
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *---------------------------------------------------------------------------*/
+/*----------------------------------------------------------------------------
+ * Notice of Export Control Law
+ * ===============================================
+ * Huawei LiteOS may be subject to applicable export control laws and regulations, which might
+ * include those applicable to Huawei LiteOS of U.S. and the country in which you are located.
+ * Import, export and usage of Huawei LiteOS in any manner by you shall be in compliance with such
+ * applicable export control laws and regulations.
+ *---------------------------------------------------------------------------*/
+
+/**@defgroup los_heap Heap
+ * @ingroup kernel
+ */
+#include <string.h>
+#include <los_hwi.h>
+#include <los_hw.h>
+#include <los_config.h>
+#include <los_heap.ph>
+#include <los_heapcheck.ph>
+#include <los_typedef.h>
+
+#if (LOSCFG_MEMORY_TLSF == NO)
+#error "kernel/base/mem/tlsf is built, should make LOSCFG_MEMORY_TLSF = YES"
+#endif
+
+#ifdef CONFIG_DDR_HEAP
+struct LOS_HEAP_MANAGER g_stDdrHeap;
+#endif
+
+static UINT32 g_uwAllocCount = 0;
+static UINT32 g_uwFreeCount = 0;
+
+#if (LOSCFG_HEAP_MEMORY_PEAK_STATISTICS == YES)
+static UINT32 g_uwCurHeapUsed = 0;
+static UINT32 g_uwMaxHeapUsed = 0;
+#endif
+
+#define HEAP_CAST(t, exp) ((t)(exp))
+#define HEAP_ALIGN 8
+#define ALIGNE(sz) (((sz) + HEAP_ALIGN - 1) & ~(HEAP_ALIGN - 1))
+
+/* A free block keeps its free list links in the first bytes of its data. */
+typedef struct tagHeapFreeLink {
+    struct LOS_HEAP_NODE *pstNext;
+    struct LOS_HEAP_NODE *pstPrev;
+} OS_HEAP_FREE_LINK;
+
+#define OS_HEAP_LINK(pstNode)       HEAP_CAST(OS_HEAP_FREE_LINK *, (pstNode)->ucData)
+#define OS_HEAP_NODE_HEAD_SIZE      (sizeof(struct LOS_HEAP_NODE))
+#define OS_HEAP_NODE_MIN_SIZE       ALIGNE(sizeof(OS_HEAP_FREE_LINK))
+#define OS_HEAP_SMALL_SIZE          (1U << OS_HEAP_TLSF_FL_SHIFT)
+/* bounded by the first level classes and by the size field of the node */
+#if (OS_HEAP_NODE_SIZE_BITS < OS_HEAP_TLSF_FL_MAX)
+#define OS_HEAP_NODE_MAX_SIZE       ((1U << OS_HEAP_NODE_SIZE_BITS) - HEAP_ALIGN)
+#else
+#define OS_HEAP_NODE_MAX_SIZE       ((1U << OS_HEAP_TLSF_FL_MAX) - HEAP_ALIGN)
+#endif
+
+/* index of the most and the least significant set bit, uwValue must not be 0 */
+#define OS_HEAP_FLS(uwValue)        (31 - OS_CLZ(uwValue))
+#define OS_HEAP_FFS(uwValue)        OS_HEAP_FLS((uwValue) & (~(uwValue) + 1))
+
+/*****************************************************************************
+ Function : osHeapPrvGetNext
+ Description : look up the next memory node according to one memory node in the memory block list.
+ Input       : struct LOS_HEAP_MANAGER *pHeapMan    --- Pointer to the manager,to distinguish heap
+               struct LOS_HEAP_NODE* node  --- Size of memory in bytes to allocate
+ Output      : None
+ Return      : Pointer to next memory node
+*****************************************************************************/
+struct LOS_HEAP_NODE* osHeapPrvGetNext(struct LOS_HEAP_MANAGER *pstHeapMan, struct LOS_HEAP_NODE* pstNode)
+{
+    return (pstHeapMan->pstTail == pstNode) ? NULL : (struct LOS_HEAP_NODE*)(pstNode->ucData + pstNode->uwSize);
+}
+
+/*****************************************************************************
+ Function : osHeapMapping
+ Description : Map a block size to its first and second level free list
+ Input       : uwSize  --- block size, a multiple of HEAP_ALIGN
+ Output      : puwFl   --- first level index
+               puwSl   --- second level index
+ Return      : None
+*****************************************************************************/
+INLINE VOID osHeapMapping(UINT32 uwSize, UINT32 *puwFl, UINT32 *puwSl)
+{
+    UINT32 uwFls;
+
+    if (uwSize < OS_HEAP_SMALL_SIZE)
+    {
+        *puwFl = 0;
+        *puwSl = uwSize / HEAP_ALIGN;
+    }
+    else
+    {
+        uwFls = OS_HEAP_FLS(uwSize);
+        *puwSl = (uwSize >> (uwFls - OS_HEAP_TLSF_SL_SHIFT)) ^ OS_HEAP_TLSF_SL_COUNT;
+        *puwFl = uwFls - (OS_HEAP_TLSF_FL_SHIFT - 1);
+    }
+}
+
+/*****************************************************************************
+ Function : osHeapFreeInsert
+ Description : Put a free block at the head of its free list
+ Input       : pstHeapMan --- Pointer to the manager
+               pstNode    --- free block
+ Output      : None
+ Return      : None
+*****************************************************************************/
+INLINE VOID osHeapFreeInsert(struct LOS_HEAP_MANAGER *pstHeapMan, struct LOS_HEAP_NODE *pstNode)
+{
+    struct LOS_HEAP_NODE *pstFirst;
+    UINT32 uwFl, uwSl;
+
+    osHeapMapping(pstNode->uwSize, &uwFl, &uwSl);
+    pstFirst = pstHeapMan->apstFreeList[uwFl][uwSl];
+
+    OS_HEAP_LINK(pstNode)->pstNext = pstFirst;
+    OS_HEAP_LINK(pstNode)->pstPrev = NULL;
+    if (pstFirst != NULL)
+    {
+        OS_HEAP_LINK(pstFirst)->pstPrev = pstNode;
+    }
+
+    pstHeapMan->apstFreeList[uwFl][uwSl] = pstNode;
+    pstHeapMan->uwFlBitmap |= (1U << uwFl);
+    pstHeapMan->auwSlBitmap[uwFl] |= (1U << uwSl);
+}
+
+/*****************************************************************************
+ Function : osHeapFreeRemove
+ Description : Take a free block off its free list
+ Input       : pstHeapMan --- Pointer to the manager
+               pstNode    --- free block
+ Output      : None
+ Return      : None
+*****************************************************************************/
+INLINE VOID osHeapFreeRemove(struct LOS_HEAP_MANAGER *pstHeapMan, struct LOS_HEAP_NODE *pstNode)
+{
+    struct LOS_HEAP_NODE *pstNext = OS_HEAP_LINK(pstNode)->pstNext;
+    struct LOS_HEAP_NODE *pstPrev = OS_HEAP_LINK(pstNode)->pstPrev;
+    UINT32 uwFl, uwSl;
+
+    if (pstNext != NULL)
+    {
+        OS_HEAP_LINK(pstNext)->pstPrev = pstPrev;
+    }
+
+    if (pstPrev != NULL)
+    {
+        OS_HEAP_LINK(pstPrev)->pstNext = pstNext;
+        return;
+    }
+
+    osHeapMapping(pstNode->uwSize, &uwFl, &uwSl);
+    pstHeapMan->apstFreeList[uwFl][uwSl] = pstNext;
+    if (pstNext == NULL)
+    {
+        pstHeapMan->auwSlBitmap[uwFl] &= ~(1U << uwSl);
+        if (pstHeapMan->auwSlBitmap[uwFl] == 0)
+        {
+            pstHeapMan->uwFlBitmap &= ~(1U << uwFl);
+        }
+    }
+}
+
+/*****************************************************************************
+ Function : osHeapFindSuitable
+ Description : Find a free block of at least uwSize bytes with two bitmap searches,
+               rounding the size up to the next list so that any block found fits
+ Input       : pstHeapMan --- Pointer to the manager
+               uwSize     --- size wanted, not above OS_HEAP_NODE_MAX_SIZE
+ Output      : None
+ Return      : the first block of the list found, NULL if there is none
+*****************************************************************************/
+INLINE struct LOS_HEAP_NODE *osHeapFindSuitable(struct LOS_HEAP_MANAGER *pstHeapMan, UINT32 uwSize)
+{
+    UINT32 uwFl, uwSl, uwMap;
+
+    if (uwSize >= OS_HEAP_SMALL_SIZE)
+    {
+        uwSize += (1U << (OS_HEAP_FLS(uwSize) - OS_HEAP_TLSF_SL_SHIFT)) - 1;
+    }
+    osHeapMapping(uwSize, &uwFl, &uwSl);
+    if (uwFl >= OS_HEAP_TLSF_FL_COUNT)
+    {
+        return NULL;
+    }
+
+    uwMap = pstHeapMan->auwSlBitmap[uwFl] & (~0U << uwSl);
+    if (uwMap == 0)
+    {
+        uwMap = pstHeapMan->uwFlBitmap & (~0U << (uwFl + 1));
+        if (uwMap == 0)
+        {
+            return NULL;
+        }
+        uwFl = OS_HEAP_FFS(uwMap);
+        uwMap = pstHeapMan->auwSlBitmap[uwFl];
+    }
+    uwSl = OS_HEAP_FFS(uwMap);
+
+    return pstHeapMan->apstFreeList[uwFl][uwSl];
+}
+
+/*****************************************************************************
+ Function : osHeapAbsorbNext
+ Description : Merge the block after pstNode into pstNode, pstNext must be off the free lists
+ Input       : pstHeapMan --- Pointer to the manager
+               pstNode    --- block to grow
+               pstNext    --- the block right after it
+ Output      : None
+ Return      : None
+*****************************************************************************/
+INLINE VOID osHeapAbsorbNext(struct LOS_HEAP_MANAGER *pstHeapMan, struct LOS_HEAP_NODE *pstNode,
+                                    struct LOS_HEAP_NODE *pstNext)
+{
+    struct LOS_HEAP_NODE *pstT;
+
+    pstNode->uwSize += OS_HEAP_NODE_HEAD_SIZE + pstNext->uwSize;
+    OS_HEAP_CHECK_MERGED(pstHeapMan, pstNode, pstNext);
+    if (pstHeapMan->pstTail == pstNext)
+    {
+        pstHeapMan->pstTail = pstNode;
+    }
+    else if ((pstT = osHeapPrvGetNext(pstHeapMan, pstNode)) != NULL)
+    {
+        pstT->pstPrev = pstNode;
+    }
+}
+
+/*****************************************************************************
+ Function : osHeapSplit
+ Description : Cut pstNode down to uwSize bytes and give the rest back as a free block,
+               merged with the block after it when that one is free too
+ Input       : pstHeapMan --- Pointer to the manager
+               pstNode    --- block in use, off the free lists
+               uwSize     --- size to keep
+ Output      : None
+ Return      : None
+*****************************************************************************/
+static VOID osHeapSplit(struct LOS_HEAP_MANAGER *pstHeapMan, struct LOS_HEAP_NODE *pstNode, UINT32 uwSize)
+{
+    struct LOS_HEAP_NODE *pstRest;
+    struct LOS_HEAP_NODE *pstNext;
+
+    if (pstNode->uwSize < uwSize + OS_HEAP_NODE_HEAD_SIZE + OS_HEAP_NODE_MIN_SIZE)
+    {
+        return;
+    }
+
+    pstRest = (struct LOS_HEAP_NODE *)(pstNode->ucData + uwSize);
+    pstRest->pstPrev = pstNode;
+    pstRest->uwUsed = 0;
+    pstRest->uwSize = pstNode->uwSize - uwSize - OS_HEAP_NODE_HEAD_SIZE;
+    pstNode->uwSize = uwSize;
+
+    if (pstHeapMan->pstTail == pstNode)
+    {
+        pstHeapMan->pstTail = pstRest;
+    }
+    else
+    {
+        pstNext = osHeapPrvGetNext(pstHeapMan, pstRest);
+        pstNext->pstPrev = pstRest;
+        if (!pstNext->uwUsed)
+        {
+            osHeapFreeRemove(pstHeapMan, pstNext);
+            osHeapAbsorbNext(pstHeapMan, pstRest, pstNext);
+        }
+    }
+
+    osHeapFreeInsert(pstHeapMan, pstRest);
+}
+
+/*****************************************************************************
+ Function : osHeapUsedAdd
+ Description : Account bytes taken from or given back to the heap
+ Input       : pstHeapMan --- Pointer to the manager
+               uwAdd      --- bytes taken
+               uwSub      --- bytes given back
+ Output      : None
+ Return      : None
+*****************************************************************************/
+INLINE VOID osHeapUsedAdd(struct LOS_HEAP_MANAGER *pstHeapMan, UINT32 uwAdd, UINT32 uwSub)
+{
+    pstHeapMan->uwUsedSize = pstHeapMan->uwUsedSize + uwAdd - uwSub;
+
+#if (LOSCFG_HEAP_MEMORY_PEAK_STATISTICS == YES)
+    g_uwCurHeapUsed = g_uwCurHeapUsed + uwAdd - uwSub;
+    if (g_uwCurHeapUsed > g_uwMaxHeapUsed)
+    {
+        g_uwMaxHeapUsed = g_uwCurHeapUsed;
+    }
+#endif
+}
+
+/*****************************************************************************
+ Function : osHeapNodeGet
+ Description : Get the block of a pointer handed out by the heap, checking that it is one
+ Input       : pstHeapMan --- Pointer to the manager
+               pPtr       --- pointer to check
+ Output      : None
+ Return      : the block, NULL if pPtr is not a block in use
+*****************************************************************************/
+static struct LOS_HEAP_NODE *osHeapNodeGet(struct LOS_HEAP_MANAGER *pstHeapMan, VOID *pPtr)
+{
+    struct LOS_HEAP_NODE *pstNode;
+
+    if ((UINTPTR)pPtr < (UINTPTR)pstHeapMan->pstHead->ucData
+        || (UINTPTR)pPtr > (UINTPTR)pstHeapMan->pstTail->ucData
+        || ((UINTPTR)pPtr & (HEAP_ALIGN - 1)))
+    {
+        return NULL;
+    }
+
+    pstNode = ((struct LOS_HEAP_NODE *)pPtr) - 1;
+
+    /* check if the address is a node of the heap memory list*/
+    if ((pstNode->uwUsed == 0) || ((pstNode != pstHeapMan->pstHead)
+        && ((UINTPTR)pstNode->pstPrev < (UINTPTR)pstHeapMan->pstHead
+            || (UINTPTR)pstNode->pstPrev > (UINTPTR)pstHeapMan->pstTail
+            || (osHeapPrvGetNext(pstHeapMan, pstNode->pstPrev) != pstNode))))
+    {
+        return NULL;
+    }
+
+    return pstNode;
+}
+
+/*****************************************************************************
+ Function : LOS_HeapInit
+ Description : To initialize the heap memory and get the begin address and size of heap memory,then initialize LOS_HEAP_MANAGER .
+ Input       : struct LOS_HEAP_MANAGER *pHeapMan    --- Pointer to the manager,to distinguish heap
+               VOID *p  --- begin address of the heap memory pool
+               UITN32 sz --- size of the heap memory pool
+ Output      : None
+ Return      : 1:success 0:error
+*****************************************************************************/
+BOOL LOS_HeapInit(VOID *pPool, UINT32 uwSz)
+{
+    struct LOS_HEAP_NODE* pstNode;
+    struct LOS_HEAP_MANAGER *pstHeapMan = HEAP_CAST(struct LOS_HEAP_MANAGER *, pPool);
+    UINTPTR uvStart, uvEnd;
+
+    if (!pstHeapMan || (uwSz <= (sizeof(struct LOS_HEAP_NODE) +  sizeof(struct LOS_HEAP_MANAGER))))
+        return FALSE;
+
+    uvStart = ALIGNE((UINTPTR)pPool + sizeof(struct LOS_HEAP_MANAGER));
+    uvEnd = ((UINTPTR)pPool + uwSz) & ~(HEAP_ALIGN - 1);
+    if (uvEnd < uvStart + OS_HEAP_NODE_HEAD_SIZE + OS_HEAP_NODE_MIN_SIZE)
+        return FALSE;
+
+    /* the size of the first block has to fit in its bit field and in the free lists */
+    if (uvEnd - uvStart - OS_HEAP_NODE_HEAD_SIZE > OS_HEAP_NODE_MAX_SIZE)
+    {
+        PRINT_ERR("heap 0x%x is too large, at most 0x%x Bytes are used by blocks!\n", (UINT32)pPool, OS_HEAP_NODE_MAX_SIZE);
+        return FALSE;
+    }
+
+    /* the free lists make the pool self describing, its data needs no clearing */
+    memset(pPool, 0, sizeof(struct LOS_HEAP_MANAGER));
+
+    pstHeapMan->uwSize = uwSz;
+
+    pstNode = pstHeapMan->pstHead = (struct LOS_HEAP_NODE*)uvStart;
+    pstHeapMan->pstTail = pstNode;
+
+    pstNode->uwUsed = 0;
+    pstNode->pstPrev = NULL;
+    pstNode->uwSize = uvEnd - uvStart - OS_HEAP_NODE_HEAD_SIZE;
+
+    osHeapFreeInsert(pstHeapMan, pstNode);
+
+    return TRUE;
+}
+
+/*****************************************************************************
+ Function : LOS_HeapAlloc
+ Description : To alloc memory block from the heap memory poll
+ Input       : struct LOS_HEAP_MANAGER *pHeapMan    --- Pointer to the manager,to distinguish heap
+               UITN32 sz --- size of the heap memory pool
+ Output      : None
+ Return      : NULL:error    other value:the address of the memory we alloced
+*****************************************************************************/
+VOID* LOS_HeapAlloc(VOID *pPool, UINT32 uwSz)
+{
+    struct LOS_HEAP_NODE *pstNode;
+    VOID* pRet = NULL;
+    UINTPTR uvIntSave;
+
+    struct LOS_HEAP_MANAGER *pstHeapMan = HEAP_CAST(struct LOS_HEAP_MANAGER *, pPool);
+    if (!pstHeapMan || (uwSz > OS_HEAP_NODE_MAX_SIZE))
+    {
+        return NULL;
+    }
+
+    uwSz = (uwSz < OS_HEAP_NODE_MIN_SIZE) ? OS_HEAP_NODE_MIN_SIZE : ALIGNE(uwSz);
+
+    uvIntSave = LOS_IntLock();
+
+    pstNode = osHeapFindSuitable(pstHeapMan, uwSz);
+    if (!pstNode) /*alloc failed*/
+    {
+        PRINT_ERR("there's not enough whole to alloc %x Bytes!\n",uwSz);
+        osAlarmHeapInfo(pstHeapMan);
+        goto out;
+    }
+
+    osHeapFreeRemove(pstHeapMan, pstNode);
+    osHeapSplit(pstHeapMan, pstNode, uwSz);
+    pstNode->uwUsed = 1;
+    osHeapUsedAdd(pstHeapMan, pstNode->uwSize + OS_HEAP_NODE_HEAD_SIZE, 0);
+    pRet = pstNode->ucData;
+
+out:
+    LOS_IntRestore(uvIntSave);
+
+    if (NULL != pRet)
+    {
+        g_uwAllocCount++;
+    }
+
+    return pRet;
+}
+
+/*****************************************************************************
+ Function : LOS_HeapAllocAlign
+ Description : To alloc memory block aligned to uwBoundary from the heap memory poll,
+               the space before the aligned address goes back to the free lists
+ Input       : pPool      --- Pointer to the heap
+               uwSz       --- size to alloc
+               uwBoundary --- alignment, a power of 2
+ Output      : None
+ Return      : NULL:error    other value:the address of the memory we alloced
+*****************************************************************************/
+VOID* LOS_HeapAllocAlign(VOID *pPool, UINT32 uwSz, UINT32 uwBoundary)
+{
+    struct LOS_HEAP_NODE *pstNode, *pstAligned, *pstT;
+    UINTPTR uvData, uvAligned;
+    VOID* pRet = NULL;
+    UINTPTR uvIntSave;
+
+    struct LOS_HEAP_MANAGER *pstHeapMan = HEAP_CAST(struct LOS_HEAP_MANAGER *, pPool);
+    if (!pstHeapMan || (uwBoundary & (uwBoundary - 1)))
+    {
+        return NULL;
+    }
+
+    if (uwBoundary <= HEAP_ALIGN)
+    {
+        return LOS_HeapAlloc(pPool, uwSz);
+    }
+
+    /* worst case gap in front of the aligned address, large enough to be a free block */
+    if (uwSz > OS_HEAP_NODE_MAX_SIZE - (uwBoundary + OS_HEAP_NODE_HEAD_SIZE + OS_HEAP_NODE_MIN_SIZE))
+    {
+        return NULL;
+    }
+    uwSz = (uwSz < OS_HEAP_NODE_MIN_SIZE) ? OS_HEAP_NODE_MIN_SIZE : ALIGNE(uwSz);
+
+    uvIntSave = LOS_IntLock();
+
+    pstNode = osHeapFindSuitable(pstHeapMan, uwSz + uwBoundary + OS_HEAP_NODE_HEAD_SIZE + OS_HEAP_NODE_MIN_SIZE);
+    if (!pstNode)
+    {
+        PRINT_ERR("there's not enough whole to alloc %x Bytes aligned to %x!\n", uwSz, uwBoundary);
+        osAlarmHeapInfo(pstHeapMan);
+        goto out;
+    }
+    osHeapFreeRemove(pstHeapMan, pstNode);
+
+    uvData = (UINTPTR)pstNode->ucData;
+    uvAligned = (uvData + uwBoundary - 1) & ~(uwBoundary - 1);
+    if (uvAligned != uvData)
+    {
+        while (uvAligned - uvData < OS_HEAP_NODE_HEAD_SIZE + OS_HEAP_NODE_MIN_SIZE)
+        {
+            uvAligned += uwBoundary;
+        }
+
+        /* the block was free, so the one before it is in use and the gap stays a block of its own */
+        pstAligned = ((struct LOS_HEAP_NODE *)uvAligned) - 1;
+        pstAligned->pstPrev = pstNode;
+        pstAligned->uwUsed = 0;
+        pstAligned->uwSize = pstNode->uwSize - (uvAligned - uvData);
+        pstNode->uwSize = (UINTPTR)pstAligned - uvData;
+
+        if (pstHeapMan->pstTail == pstNode)
+        {
+            pstHeapMan->pstTail = pstAligned;
+        }
+        else if ((pstT = osHeapPrvGetNext(pstHeapMan, pstAligned)) != NULL)
+        {
+            pstT->pstPrev = pstAligned;
+        }
+
+        osHeapFreeInsert(pstHeapMan, pstNode);
+        pstNode = pstAligned;
+    }
+
+    osHeapSplit(pstHeapMan, pstNode, uwSz);
+    pstNode->uwUsed = 1;
+    osHeapUsedAdd(pstHeapMan, pstNode->uwSize + OS_HEAP_NODE_HEAD_SIZE, 0);
+    pRet = pstNode->ucData;
+
+out:
+    LOS_IntRestore(uvIntSave);
+
+    if (NULL != pRet)
+    {
+        g_uwAllocCount++;
+    }
+
+    return pRet;
+}
+
+/*****************************************************************************
+ Function : LOS_HeapRealloc
+ Description : Resize a block in place when it shrinks or the block after it is free,
+               otherwise move it
+ Input       : pPool  --- Pointer to the heap
+               pPtr   --- block to resize
+               uwSz   --- new size
+ Output      : None
+ Return      : NULL:error    other value:the address of the resized block
+*****************************************************************************/
+VOID* LOS_HeapRealloc(VOID *pPool, VOID *pPtr, UINT32 uwSz)
+{
+    struct LOS_HEAP_NODE *pstNode, *pstNext;
+    UINT32 uwOldSize;
+    VOID* pRet = NULL;
+    UINTPTR uvIntSave;
+
+    struct LOS_HEAP_MANAGER *pstHeapMan = HEAP_CAST(struct LOS_HEAP_MANAGER *, pPool);
+    if (!pstHeapMan || !pPtr || (uwSz > OS_HEAP_NODE_MAX_SIZE))
+    {
+        return NULL;
+    }
+
+    uwSz = (uwSz < OS_HEAP_NODE_MIN_SIZE) ? OS_HEAP_NODE_MIN_SIZE : ALIGNE(uwSz);
+
+    uvIntSave = LOS_IntLock();
+
+    pstNode = osHeapNodeGet(pstHeapMan, pPtr);
+    if (pstNode == NULL)
+    {
+        LOS_IntRestore(uvIntSave);
+        PRINT_ERR("0x%x is not a heap block!\n", (UINT32)pPtr);
+        return NULL;
+    }
+
+    uwOldSize = pstNode->uwSize;
+    pstNext = osHeapPrvGetNext(pstHeapMan, pstNode);
+    if ((uwSz > uwOldSize) && (pstNext != NULL) && !pstNext->uwUsed
+        && (uwOldSize + OS_HEAP_NODE_HEAD_SIZE + pstNext->uwSize >= uwSz))
+    {
+        osHeapFreeRemove(pstHeapMan, pstNext);
+        osHeapAbsorbNext(pstHeapMan, pstNode, pstNext);
+    }
+
+    if (uwSz <= pstNode->uwSize)
+    {
+        osHeapSplit(pstHeapMan, pstNode, uwSz);
+        osHeapUsedAdd(pstHeapMan, pstNode->uwSize, uwOldSize);
+        LOS_IntRestore(uvIntSave);
+        return pPtr;
+    }
+
+    LOS_IntRestore(uvIntSave);
+
+    pRet = LOS_HeapAlloc(pPool, uwSz);
+    if (pRet != NULL)
+    {
+        (VOID)memcpy(pRet, pPtr, uwOldSize);
+        (VOID)LOS_HeapFree(pPool, pPtr);
+    }
+
+    return pRet;
+}
+
+/*****************************************************************************
+ Function : LOS_HeapFree
+ Description : To free the  memory block from  heap memory poll
+ Input       : struct LOS_HEAP_MANAGER *pHeapMan    --- Pointer to the manager,to distinguish heap
+               VOID* ptr: the pointer of heap memory we want to free
+ Output      : None
+ Return      : 1:success 0:error
+*****************************************************************************/
+BOOL LOS_HeapFree(VOID *pPool, VOID* pPtr)
+{
+    struct LOS_HEAP_NODE *pstNode, *pstT;
+    UINTPTR uvIntSave;
+
+    struct LOS_HEAP_MANAGER *pstHeapMan = HEAP_CAST(struct LOS_HEAP_MANAGER *, pPool);
+
+    if (!pstHeapMan || !pPtr)
+    {
+        return FALSE;
+    }
+
+    uvIntSave = LOS_IntLock();
+
+    pstNode = osHeapNodeGet(pstHeapMan, pPtr);
+    if (pstNode == NULL)
+    {
+        LOS_IntRestore(uvIntSave);
+        PRINT_ERR("0x%x is not a heap block!\n", (UINT32)pPtr);
+        return FALSE;
+    }
+
+    /* set to unused status */
+    pstNode->uwUsed = 0;
+    osHeapUsedAdd(pstHeapMan, 0, pstNode->uwSize + OS_HEAP_NODE_HEAD_SIZE);
+
+    /* unused region before and after combination */
+    pstT = pstNode->pstPrev;
+    if ((pstT != NULL) && !pstT->uwUsed)
+    {
+        osHeapFreeRemove(pstHeapMan, pstT);
+        osHeapAbsorbNext(pstHeapMan, pstT, pstNode);
+        pstNode = pstT;
+    }
+
+    pstT = osHeapPrvGetNext(pstHeapMan, pstNode);
+    if ((pstT != NULL) && !pstT->uwUsed)
+    {
+        osHeapFreeRemove(pstHeapMan, pstT);
+        osHeapAbsorbNext(pstHeapMan, pstNode, pstT);
+    }
+
+    osHeapFreeInsert(pstHeapMan, pstNode);
+
+    LOS_IntRestore(uvIntSave);
+
+    g_uwFreeCount++;
+
+    return TRUE;
+}
+
+VOID osAlarmHeapInfo(VOID *pPool)
+{
+    struct LOS_HEAP_MANAGER *pstHeapMan = HEAP_CAST(struct LOS_HEAP_MANAGER *, pPool);
+    LOS_HEAP_STATUS stStatus = {0};
+    if (LOS_NOK == osHeapStatisticsGet(pPool, &stStatus))
+        return;
+
+    PRINT_INFO("pool addr    pool size    total size     used size    free size   alloc Count    free Count\n0x%-8x   0x%-8x   0x%-8x    0x%-8x   0x%-16x   0x%-13x    0x%-13x\n",
+                        pPool, pstHeapMan->uwSize, stStatus.totalSize, stStatus.usedSize, stStatus.freeSize, stStatus.allocCount, stStatus.freeCount);
+}
+
+UINT32 osHeapStatisticsGet(VOID *pPool, LOS_HEAP_STATUS *pstStatus)
+{
+    struct LOS_HEAP_MANAGER *pstRamHeap = HEAP_CAST(struct LOS_HEAP_MANAGER *, pPool);
+
+    if (!pstRamHeap)
+    {
+        return LOS_NOK;
+    }
+
+    if (NULL == pstStatus)
+    {
+        return LOS_NOK;
+    }
+
+    if (pstRamHeap->uwSize < pstRamHeap->uwUsedSize)
+    {
+        return LOS_NOK;
+    }
+
+    pstStatus->usedSize    = pstRamHeap->uwUsedSize;
+    pstStatus->totalSize   = pstRamHeap->uwSize;
+    pstStatus->freeSize    = pstStatus->totalSize - pstStatus->usedSize;
+    pstStatus->allocCount  = g_uwAllocCount;
+    pstStatus->freeCount   = g_uwFreeCount;
+
+    return LOS_OK;
+}
+
+#if (LOSCFG_HEAP_MEMORY_PEAK_STATISTICS == YES)
+UINT32 LOS_HeapGetHeapMemoryPeak(VOID)
+{
+    return g_uwMaxHeapUsed;
+}
+#endif
+
+UINT32 osHeapGetMaxFreeBlkSize(VOID *pPool)
+{
+    UINT32 uwSize = 0;
+    UINT32 uwFl, uwSl;
+    struct LOS_HEAP_NODE *pstNode = NULL;
+    UINTPTR uvIntSave;
+
+    struct LOS_HEAP_MANAGER *pstRamHeap = HEAP_CAST(struct LOS_HEAP_MANAGER *, pPool);
+
+    if (!pstRamHeap)
+    {
+        return LOS_NOK;
+    }
+
+    uvIntSave = LOS_IntLock();
+
+    /* the largest free block is on the highest non-empty list */
+    if (pstRamHeap->uwFlBitmap != 0)
+    {
+        uwFl = OS_HEAP_FLS(pstRamHeap->uwFlBitmap);
+        uwSl = OS_HEAP_FLS(pstRamHeap->auwSlBitmap[uwFl]);
+        for (pstNode = pstRamHeap->apstFreeList[uwFl][uwSl]; pstNode != NULL; pstNode = OS_HEAP_LINK(pstNode)->pstNext)
+        {
+            if (pstNode->uwSize > uwSize)
+            {
+                uwSize = pstNode->uwSize;
+            }
+        }
+    }
+
+    LOS_IntRestore(uvIntSave);
+    return uwSize;
+}
+
+/*****************************************************************************
+ Function : osHeapIntegrityCheck
+ Description : Walk the blocks in address order and then the free lists, and check that
+               the links, the merge rule, the bitmaps and the used size all agree
+ Input       : pPool --- Pointer to the heap
+ Output      : None
+ Return      : LOS_OK --heap integrate  or LOS_NOK--heap impaired
+*****************************************************************************/
+UINT32 osHeapIntegrityCheck(VOID *pPool)
+{
+    struct LOS_HEAP_MANAGER *pstHeapMan = HEAP_CAST(struct LOS_HEAP_MANAGER *, pPool);
+    struct LOS_HEAP_NODE *pstNode, *pstPrev = NULL;
+    UINTPTR uvEnd;
+    UINT32 uwFreeCnt = 0;
+    UINT32 uwUsedSize = 0;
+    UINT32 uwFl, uwSl, uwNodeFl, uwNodeSl;
+    UINTPTR uvIntSave;
+
+    if (!pstHeapMan)
+    {
+        return LOS_NOK;
+    }
+
+    uvEnd = (UINTPTR)pPool + pstHeapMan->uwSize;
+
+    uvIntSave = LOS_IntLock();
+
+    for (pstNode = pstHeapMan->pstHead; pstNode != NULL; pstNode = osHeapPrvGetNext(pstHeapMan, pstNode))
+    {
+        if (((UINTPTR)pstNode < (UINTPTR)pstHeapMan->pstHead) || ((UINTPTR)pstNode->ucData > uvEnd)
+            || ((UINTPTR)pstNode->ucData + pstNode->uwSize > uvEnd))
+        {
+            PRINT_ERR("[%s], %d, heap check error!\nnode 0x%x is out of heap [0x%x, 0x%x)\n",
+                      __FUNCTION__, __LINE__, (UINT32)pstNode, (UINT32)pPool, (UINT32)uvEnd);
+            goto errout;
+        }
+
+        if (pstNode->pstPrev != pstPrev)
+        {
+            PRINT_ERR("[%s], %d, heap check error!\nnode 0x%x prev is 0x%x, should be 0x%x\n",
+                      __FUNCTION__, __LINE__, (UINT32)pstNode, (UINT32)pstNode->pstPrev, (UINT32)pstPrev);
+            goto errout;
+        }
+
+        if (pstNode->uwUsed)
+        {
+            uwUsedSize += pstNode->uwSize + OS_HEAP_NODE_HEAD_SIZE;
+        }
+        else
+        {
+            if ((pstPrev != NULL) && !pstPrev->uwUsed)
+            {
+                PRINT_ERR("[%s], %d, heap check error!\nfree nodes 0x%x and 0x%x are not merged\n",
+                          __FUNCTION__, __LINE__, (UINT32)pstPrev, (UINT32)pstNode);
+                goto errout;
+            }
+            uwFreeCnt++;
+        }
+        pstPrev = pstNode;
+    }
+
+    if (pstPrev != pstHeapMan->pstTail)
+    {
+        PRINT_ERR("[%s], %d, heap check error!\nlast node 0x%x is not tail 0x%x\n",
+                  __FUNCTION__, __LINE__, (UINT32)pstPrev, (UINT32)pstHeapMan->pstTail);
+        goto errout;
+    }
+
+    if (uwUsedSize != pstHeapMan->uwUsedSize)
+    {
+        PRINT_ERR("[%s], %d, heap check error!\nused size 0x%x, recorded 0x%x\n",
+                  __FUNCTION__, __LINE__, uwUsedSize, pstHeapMan->uwUsedSize);
+        goto errout;
+    }
+
+    for (uwFl = 0; uwFl < OS_HEAP_TLSF_FL_COUNT; uwFl++)
+    {
+        if (((pstHeapMan->uwFlBitmap >> uwFl) & 1) != (pstHeapMan->auwSlBitmap[uwFl] != 0))
+        {
+            PRINT_ERR("[%s], %d, heap check error!\nfirst level bitmap 0x%x, second level bitmap %d is 0x%x\n",
+                      __FUNCTION__, __LINE__, pstHeapMan->uwFlBitmap, uwFl, pstHeapMan->auwSlBitmap[uwFl]);
+            goto errout;
+        }
+
+        for (uwSl = 0; uwSl < OS_HEAP_TLSF_SL_COUNT; uwSl++)
+        {
+            pstNode = pstHeapMan->apstFreeList[uwFl][uwSl];
+            if (((pstHeapMan->auwSlBitmap[uwFl] >> uwSl) & 1) != (pstNode != NULL))
+            {
+                PRINT_ERR("[%s], %d, heap check error!\nfree list [%d][%d] does not match its bitmap\n",
+                          __FUNCTION__, __LINE__, uwFl, uwSl);
+                goto errout;
+            }
+
+            pstPrev = NULL;
+            for (; pstNode != NULL; pstNode = OS_HEAP_LINK(pstNode)->pstNext)
+            {
+                if (((UINTPTR)pstNode < (UINTPTR)pstHeapMan->pstHead) || ((UINTPTR)pstNode > (UINTPTR)pstHeapMan->pstTail)
+                    || pstNode->uwUsed || (OS_HEAP_LINK(pstNode)->pstPrev != pstPrev) || (uwFreeCnt == 0))
+                {
+                    PRINT_ERR("[%s], %d, heap check error!\nfree list [%d][%d] node 0x%x is broken\n",
+                              __FUNCTION__, __LINE__, uwFl, uwSl, (UINT32)pstNode);
+                    goto errout;
+                }
+
+                osHeapMapping(pstNode->uwSize, &uwNodeFl, &uwNodeSl);
+                if ((uwNodeFl != uwFl) || (uwNodeSl != uwSl))
+                {
+                    PRINT_ERR("[%s], %d, heap check error!\nnode 0x%x of size 0x%x is on free list [%d][%d]\n",
+                              __FUNCTION__, __LINE__, (UINT32)pstNode, pstNode->uwSize, uwFl, uwSl);
+                    goto errout;
+                }
+                uwFreeCnt--;
+                pstPrev = pstNode;
+            }
+        }
+    }
+
+    if (uwFreeCnt != 0)
+    {
+        PRINT_ERR("[%s], %d, heap check error!\n%d free nodes are on no free list\n",
+                  __FUNCTION__, __LINE__, uwFreeCnt);
+        goto errout;
+    }
+
+    LOS_IntRestore(uvIntSave);
+    return LOS_OK;
+
+errout:
+    LOS_IntRestore(uvIntSave);
+    return LOS_NOK;
+}
@@ -0,0 +1,331 @@
+/*----------------------------------------------------------------------------
+ * Copyright (c) <2013-2015>, <Huawei Technologies Co., Ltd>
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *---------------------------------------------------------------------------*/
+/*----------------------------------------------------------------------------
+ * Notice of Export Control Law
+ * ===============================================
+ * Huawei LiteOS may be subject to applicable export control laws and regulations, which might
+ * include those applicable to Huawei LiteOS of U.S. and the country in which you are located.
+ * Import, export and usage of Huawei LiteOS in any manner by you shall be in compliance with such
+ * applicable export control laws and regulations.
+ *---------------------------------------------------------------------------*/
+#ifdef LOSCFG_LIB_LIBC
+#include <string.h>
+#endif
+#include "los_hwi.h"
+#include "los_typedef.h"
+#include "los_memory.ph"
+#include "los_membox.ph"
+#include "los_memcheck.ph"
+
+#if ((LOSCFG_MEMBOX_LOCKFREE == YES) && (__CORTEX_M >= 0x03))
+#define OS_MEMBOX_LOCKFREE
+#endif
+
+/*****************************************************************************
+ Function    : osMemboxCntAdd
+ Description : Add to the allocated block count and raise the high-water mark
+ Input       : pstBoxInfo --- memory pool
+               swDelta    --- 1 on alloc, -1 on free
+ Output      : None
+ Return      : None
+ *****************************************************************************/
+LITE_OS_SEC_TEXT static VOID osMemboxCntAdd(OS_MEMBOX_S *pstBoxInfo, INT32 swDelta)
+{
+    UINT32 uwCnt;
+#ifdef OS_MEMBOX_LOCKFREE
+    UINT32 uwPeak;
+
+    do
+    {
+        uwCnt = __LDREXW((volatile uint32_t *)&pstBoxInfo->uwBlkCnt) + (UINT32)swDelta;
+    } while (__STREXW(uwCnt, (volatile uint32_t *)&pstBoxInfo->uwBlkCnt) != 0);
+
+    do
+    {
+        uwPeak = __LDREXW((volatile uint32_t *)&pstBoxInfo->uwBlkPeak);
+        if (uwCnt <= uwPeak)
+        {
+            __CLREX();
+            break;
+        }
+    } while (__STREXW(uwCnt, (volatile uint32_t *)&pstBoxInfo->uwBlkPeak) != 0);
+#else
+    /* called with interrupts locked */
+    uwCnt = pstBoxInfo->uwBlkCnt + (UINT32)swDelta;
+    pstBoxInfo->uwBlkCnt = uwCnt;
+    if (uwCnt > pstBoxInfo->uwBlkPeak)
+    {
+        pstBoxInfo->uwBlkPeak = uwCnt;
+    }
+#endif
+}
+
+/*****************************************************************************
+ Function    : LOS_MemboxInit
+ Description : Carve a memory pool into fixed size blocks and link them on the free list
+ Input       : pBoxMem   --- memory pool address
+               uwBoxSize --- memory pool size
+               uwBlkSize --- block size, may be ORed with BOX_ALIGN_8
+ Output      : None
+ Return      : LOS_OK on success or OS_ERROR on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_INIT UINT32 LOS_MemboxInit(VOID *pBoxMem, UINT32 uwBoxSize, UINT32 uwBlkSize)
+{
+    OS_MEMBOX_S *pstBoxInfo = (OS_MEMBOX_S *)pBoxMem;
+    LOS_MEMBOX_NODE *pstNode;
+    UINT32 uwAlign = sizeof(UINT32);
+    UINT32 uwOffset;
+    UINT32 uwIndex;
+    UINTPTR uvIntSave;
+
+    if ((pBoxMem == NULL) || ((UINT32)(UINTPTR)pBoxMem & (sizeof(UINT32) - 1)))
+    {
+        return OS_ERROR;
+    }
+
+    if (uwBlkSize & BOX_ALIGN_8)
+    {
+        uwBlkSize &= ~BOX_ALIGN_8;
+        uwAlign = 8;
+    }
+
+    /* Initialize memory block system, returns 0 if OK, 1 if fails. */
+    if (uwBlkSize == 0)
+    {
+        return OS_ERROR;
+    }
+
+    uwBlkSize = (uwBlkSize + LOS_MEMBOX_MAGIC_SIZE + uwAlign - 1) & ~(uwAlign - 1);
+    uwOffset = (((UINT32)(UINTPTR)pBoxMem + sizeof(OS_MEMBOX_S) + uwAlign - 1) & ~(uwAlign - 1)) -
+               (UINT32)(UINTPTR)pBoxMem;
+    if (uwBoxSize < uwOffset + uwBlkSize)
+    {
+        return OS_ERROR;
+    }
+
+    /* Create a Memory structure. */
+    uvIntSave = LOS_IntLock();
+
+#if (LOSCFG_PLATFORM_EXC == YES)
+    osMemInfoUpdate(pBoxMem, uwBoxSize, MEM_MANG_MEMBOX);
+#endif
+
+    pstBoxInfo->uwMaxBlk = (uwBoxSize - uwOffset) / uwBlkSize;
+    pstBoxInfo->uwBlkSize = uwBlkSize;
+    pstBoxInfo->uwBlkCnt = 0;
+    pstBoxInfo->uwBlkPeak = 0;
+    pstBoxInfo->pucBlkStart = (UINT8 *)pBoxMem + uwOffset;
+
+    pstNode = (LOS_MEMBOX_NODE *)pstBoxInfo->pucBlkStart;
+    pstBoxInfo->stFreeList.pstNext = pstNode;
+    for (uwIndex = 1; uwIndex < pstBoxInfo->uwMaxBlk; uwIndex++)
+    {
+        pstNode->pstNext = OS_MEMBOX_NEXT(pstNode, uwBlkSize);
+        pstNode = pstNode->pstNext;
+    }
+    pstNode->pstNext = (LOS_MEMBOX_NODE *)NULL;
+
+    (VOID)LOS_IntRestore(uvIntSave);
+
+    return LOS_OK;
+}
+
+/*****************************************************************************
+ Function    : LOS_MemboxAlloc
+ Description : Take a block off the head of the free list
+ Input       : pBoxMem --- memory pool address
+ Output      : None
+ Return      : block address or NULL when the memory pool is exhausted
+ *****************************************************************************/
+LITE_OS_SEC_TEXT VOID *LOS_MemboxAlloc(VOID *pBoxMem)
+{
+    OS_MEMBOX_S *pstBoxInfo = (OS_MEMBOX_S *)pBoxMem;
+    LOS_MEMBOX_NODE *pstNode;
+#ifndef OS_MEMBOX_LOCKFREE
+    UINTPTR uvIntSave;
+#endif
+
+    if (pBoxMem == NULL)
+    {
+        return NULL;
+    }
+
+#ifdef OS_MEMBOX_LOCKFREE
+    /* A block popped and pushed back by an interrupt between the load and the store leaves pstNext stale,
+       but exception entry clears the exclusive monitor, so the store fails and the pop is retried. */
+    do
+    {
+        pstNode = (LOS_MEMBOX_NODE *)__LDREXW((volatile uint32_t *)&pstBoxInfo->stFreeList.pstNext);
+        if (pstNode == NULL)
+        {
+            __CLREX();
+            return NULL;
+        }
+    } while (__STREXW((uint32_t)pstNode->pstNext, (volatile uint32_t *)&pstBoxInfo->stFreeList.pstNext) != 0);
+
+    OS_MEMBOX_SET_MAGIC(pstNode);
+    osMemboxCntAdd(pstBoxInfo, 1);
+#else
+    uvIntSave = LOS_IntLock();
+    pstNode = pstBoxInfo->stFreeList.pstNext;
+    if (pstNode == NULL)
+    {
+        (VOID)LOS_IntRestore(uvIntSave);
+        return NULL;
+    }
+    pstBoxInfo->stFreeList.pstNext = pstNode->pstNext;
+    OS_MEMBOX_SET_MAGIC(pstNode);
+    osMemboxCntAdd(pstBoxInfo, 1);
+    (VOID)LOS_IntRestore(uvIntSave);
+#endif
+
+    return OS_MEMBOX_USER_ADDR(pstNode);
+}
+
+/*****************************************************************************
+ Function    : LOS_MemboxFree
+ Description : Check a block and push it back on the free list
+ Input       : pBoxMem --- memory pool address
+               pBox    --- block address
+ Output      : None
+ Return      : LOS_OK on success or LOS_NOK when the block is not an allocated block of this pool
+ *****************************************************************************/
+LITE_OS_SEC_TEXT UINT32 LOS_MemboxFree(VOID *pBoxMem, VOID *pBox)
+{
+    OS_MEMBOX_S *pstBoxInfo = (OS_MEMBOX_S *)pBoxMem;
+    LOS_MEMBOX_NODE *pstNode;
+    UINT32 uwOffset;
+#ifdef OS_MEMBOX_LOCKFREE
+    LOS_MEMBOX_NODE *pstHead;
+#else
+    UINTPTR uvIntSave;
+#endif
+
+    if ((pBoxMem == NULL) || (pBox == NULL))
+    {
+        return LOS_NOK;
+    }
+
+    pstNode = OS_MEMBOX_NODE_ADDR(pBox);
+    if ((UINT8 *)pstNode < pstBoxInfo->pucBlkStart)
+    {
+        return LOS_NOK;
+    }
+
+    uwOffset = (UINT32)((UINT8 *)pstNode - pstBoxInfo->pucBlkStart);
+    if (((uwOffset % pstBoxInfo->uwBlkSize) != 0) || ((uwOffset / pstBoxInfo->uwBlkSize) >= pstBoxInfo->uwMaxBlk))
+    {
+        return LOS_NOK;
+    }
+
+    /* the magic word is overwritten by the free list link, a second free finds it gone */
+    if (OS_MEMBOX_CHECK_MAGIC(pstNode) != LOS_OK)
+    {
+        return LOS_NOK;
+    }
+
+#ifdef OS_MEMBOX_LOCKFREE
+    do
+    {
+        pstHead = (LOS_MEMBOX_NODE *)__LDREXW((volatile uint32_t *)&pstBoxInfo->stFreeList.pstNext);
+        pstNode->pstNext = pstHead;
+    } while (__STREXW((uint32_t)pstNode, (volatile uint32_t *)&pstBoxInfo->stFreeList.pstNext) != 0);
+
+    osMemboxCntAdd(pstBoxInfo, -1);
+#else
+    uvIntSave = LOS_IntLock();
+    pstNode->pstNext = pstBoxInfo->stFreeList.pstNext;
+    pstBoxInfo->stFreeList.pstNext = pstNode;
+    osMemboxCntAdd(pstBoxInfo, -1);
+    (VOID)LOS_IntRestore(uvIntSave);
+#endif
+
+    return LOS_OK;
+}
+
+/*****************************************************************************
+ Function    : LOS_MemboxClr
+ Description : Clear the user part of a block
+ Input       : pBoxMem --- memory pool address
+               pBox    --- block address
+ Output      : None
+ Return      : None
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_MINOR VOID LOS_MemboxClr(VOID *pBoxMem, VOID *pBox)
+{
+    if ((pBoxMem == NULL) || (pBox == NULL))
+    {
+        return;
+    }
+
+    (VOID)memset(pBox, 0, ((OS_MEMBOX_S_P)pBoxMem)->uwBlkSize - LOS_MEMBOX_MAGIC_SIZE);
+}
+
+/*****************************************************************************
+ Function    : LOS_MemboxStatisticsGet
+ Description : Get the block number, allocated block count and usable block size
+ Input       : pBoxMem    --- memory pool address
+ Output      : puwMaxBlk  --- block number
+               puwBlkCnt  --- allocated block count
+               puwBlkSize --- usable block size
+ Return      : LOS_OK on success or LOS_NOK on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_MINOR UINT32 LOS_MemboxStatisticsGet(VOID *pBoxMem, UINT32 *puwMaxBlk, UINT32 *puwBlkCnt, UINT32 *puwBlkSize)
+{
+    if ((NULL == pBoxMem) || (NULL == puwMaxBlk) || (NULL == puwBlkCnt) || (NULL == puwBlkSize))
+    {
+        return LOS_NOK;
+    }
+
+    *puwMaxBlk = ((OS_MEMBOX_S_P)pBoxMem)->uwMaxBlk;
+    *puwBlkCnt = ((OS_MEMBOX_S_P)pBoxMem)->uwBlkCnt;
+    *puwBlkSize = ((OS_MEMBOX_S_P)pBoxMem)->uwBlkSize - LOS_MEMBOX_MAGIC_SIZE;
+
+    return LOS_OK;
+}
+
+/*****************************************************************************
+ Function    : LOS_MemboxPeakGet
+ Description : Get the high-water mark of the allocated block count
+ Input       : pBoxMem    --- memory pool address
+ Output      : puwBlkPeak --- high-water mark
+ Return      : LOS_OK on success or LOS_NOK on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_MINOR UINT32 LOS_MemboxPeakGet(VOID *pBoxMem, UINT32 *puwBlkPeak)
+{
+    if ((NULL == pBoxMem) || (NULL == puwBlkPeak))
+    {
+        return LOS_NOK;
+    }
+
+    *puwBlkPeak = ((OS_MEMBOX_S_P)pBoxMem)->uwBlkPeak;
+
+    return LOS_OK;
+}
+
+/*----------------------------------------------------------------------------
+ * end of file
+ *---------------------------------------------------------------------------*/
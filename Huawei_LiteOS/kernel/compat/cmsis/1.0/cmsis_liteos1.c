@@ -303,7 +303,7 @@ INT32 osSemaphoreWait(osSemaphoreId semaphore_id, UINT32 millisec)
         return -1;
     }
 
-    SemID = ((SEM_CB_S *)semaphore_id)->usSemID;
+    SemID = ((SEM_CB_S *)semaphore_id)->uwSemID;
 
     uwRet = LOS_SemPend(SemID, LOS_MS2Tick(millisec));
 
@@ -335,7 +335,7 @@ osStatus osSemaphoreRelease(osSemaphoreId semaphore_id)
         return osErrorParameter;
     }
 
-    SemID = ((SEM_CB_S *)semaphore_id)->usSemID;
+    SemID = ((SEM_CB_S *)semaphore_id)->uwSemID;
     uwRet = LOS_SemPost(SemID);
 
     if (uwRet == LOS_OK)
@@ -375,7 +375,7 @@ osStatus osSemaphoreDelete (osSemaphoreId semaphore_id)
         return osErrorISR;
     }
 
-    SemID = ((SEM_CB_S *)semaphore_id)->usSemID;
+    SemID = ((SEM_CB_S *)semaphore_id)->uwSemID;
     uwRet = LOS_SemDelete(SemID);
 
     if (uwRet == LOS_OK)
@@ -452,7 +452,7 @@ osStatus osMutexWait (osMutexId mutex_id, UINT32 millisec)
         return osErrorISR;
     }
 
-    MutID = ((MUX_CB_S*)mutex_id)->ucMuxID;
+    MutID = ((MUX_CB_S*)mutex_id)->uwMuxID;
 
     uwRet = LOS_MuxPend(MutID, LOS_MS2Tick(millisec));
 
@@ -506,7 +506,7 @@ osStatus osMutexRelease (osMutexId mutex_id)
         return osErrorISR;
     }
 
-    MutID = ((MUX_CB_S*)mutex_id)->ucMuxID;
+    MutID = ((MUX_CB_S*)mutex_id)->uwMuxID;
     uwRet = LOS_MuxPost(MutID);
 
     if(uwRet == LOS_OK)
@@ -546,7 +546,7 @@ osStatus osMutexDelete (osMutexId mutex_id)
         return osErrorISR;
     }
 
-    MutID = ((MUX_CB_S*)mutex_id)->ucMuxID;
+    MutID = ((MUX_CB_S*)mutex_id)->uwMuxID;
     uwRet = LOS_MuxDelete(MutID);
 
     if(uwRet == LOS_OK)
@@ -576,8 +576,8 @@ osPoolId osPoolCreate (const osPoolDef_t *pool_def)
         return (osPoolId)NULL;
     }
 
-    uwBlkSize = (pool_def->item_sz + 3) & ~3;
-    uwBoxSize = /*sizeof(OS_MEMBOX_S) + */pool_def->pool_sz * uwBlkSize; /* delete sizeof(OS_MEMBOX_S) after membox management change */
+    uwBlkSize = pool_def->item_sz;
+    uwBoxSize = LOS_MEMBOX_SIZE(uwBlkSize, pool_def->pool_sz);
 
     uwRet = LOS_MemboxInit(pool_def->pool, uwBoxSize, uwBlkSize);
     if(uwRet != LOS_OK)
@@ -730,8 +730,8 @@ osMailQId osMailCreate(osMailQDef_t *queue_def, osThreadId thread_id)
     if (uwRet == LOS_OK)
     {
         *(UINT32*)(((void **)queue_def->pool) + 0) = (UINT32)(GET_QUEUE_HANDLE(uwQueueID));
-        uwBlkSize = (queue_def->item_sz + 3) & (~3);
-        uwBoxSize = /* sizeof(OS_MEMBOX_S) + */queue_def->queue_sz * uwBlkSize; /* delete sizeof(OS_MEMBOX_S) after membox management change */
+        uwBlkSize = queue_def->item_sz;
+        uwBoxSize = LOS_MEMBOX_SIZE(uwBlkSize, queue_def->queue_sz);
 
         (void)LOS_MemboxInit(*(((void **)queue_def->pool) + 1), uwBoxSize, uwBlkSize);
         return (osMailQId)queue_def->pool;
@@ -764,13 +764,11 @@ void *osMailCAlloc(osMailQId queue_id, UINT32 millisec)
 {
 #if (LOSCFG_BASE_IPC_QUEUE == YES)
     void *mem = NULL;
-    OS_MEMBOX_S *pool = (OS_MEMBOX_S *)NULL;
     mem = osMailAlloc(queue_id, millisec);
 
     if (mem != NULL)
     {
-        pool = (OS_MEMBOX_S*)(*(((void **)queue_id) + 1));
-        (VOID)memset(mem, 0, pool->uwBlkSize);
+        LOS_MemboxClr(*(((void **)queue_id) + 1), mem);
     }
 
     return mem;
@@ -151,6 +151,7 @@ used throughout the whole project.
 
 #include "los_typedef.h"
 #include "los_config.h"
+#include "los_membox.h"
 #include "string.h"
 
 #ifdef __cplusplus
@@ -643,7 +644,7 @@ osStatus osSemaphoreDelete (osSemaphoreId semaphore_id);
 extern const osPoolDef_t os_pool_def_##name
 #else                            // define the object
 #define osPoolDef(name, no, type)   \
-UINT32 os_pool_m_##name[3]; \
+UINT32 os_pool_m_##name[LOS_MEMBOX_SIZE(sizeof(type), (no)) / sizeof(UINT32)]; \
 const osPoolDef_t os_pool_def_##name = \
 { (no), sizeof(type), (os_pool_m_##name) }
 #endif
@@ -749,7 +750,7 @@ osEvent osMessageGet (osMessageQId queue_id, UINT32 millisec);
 extern const osMailQDef_t os_mailQ_def_##name
 #else                            // define the object
 #define osMailQDef(name, queue_sz, type) \
-UINT32 os_mailQ_m_##name[3]; \
+UINT32 os_mailQ_m_##name[LOS_MEMBOX_SIZE(sizeof(type), (queue_sz)) / sizeof(UINT32)]; \
 UINT32 os_mailQ_p_##name[2] = {(0), (UINT32)(os_mailQ_m_##name)}; \
 osMailQDef_t os_mailQ_def_##name =  \
 { (queue_sz), sizeof(type), (os_mailQ_p_##name) }
@@ -866,7 +867,7 @@ extern UINT32    g_maxEventTime; /* Default maximum time for processing a single
 #define GET_EVENT_MAXTIME(event)
 #endif
 
-#define MESSAGEQID_TO_QUEUEID(_messageqid)  (((QUEUE_CB_S *)(_messageqid))->usQueueID)
+#define MESSAGEQID_TO_QUEUEID(_messageqid)  (((QUEUE_CB_S *)(_messageqid))->uwQueueID)
 
 fwMailQId fwMailCreate (fwMailQDef_t *queue_def, osThreadId thread_id);
 void *fwMailAlloc (fwMailQId queue_id, UINT32 millisec, UINT8 tag, UINT8 cmd);
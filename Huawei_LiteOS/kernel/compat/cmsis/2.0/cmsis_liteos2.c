@@ -84,6 +84,10 @@ const osVersion_t g_stLosVersion = {001,001};
 #define KERNEL_ID   "HUAWEI-LiteOS"
 #define UNUSED(var) do { (void)var; } while(0)
 
+/* Thread, timer, mutex, semaphore and queue control blocks come from the kernel tables, so their cb_mem is
+   ignored. Creating a timer, mutex, semaphore or queue may grow its table from the system heap when all its
+   control blocks are in use. */
+
 //  ==== Kernel Management Functions ====
 uint32_t osTaskStackWaterMarkGet(UINT32 uwTaskID);
 
@@ -381,12 +385,19 @@ osThreadId_t osThreadNew (osThreadFunc_t func, void *argument, const osThreadAtt
 
     memset(&stTskInitParam, 0, sizeof(TSK_INIT_PARAM_S));
     stTskInitParam.pfnTaskEntry = (TSK_ENTRY_FUNC)func;
-    stTskInitParam.uwStackSize  = attr->stack_size*4;
+    stTskInitParam.uwStackSize  = attr->stack_size; /* bytes as the CMSIS-RTOS2 API defines, 0 for the default */
     stTskInitParam.pcName       = (CHAR *)attr->name;
     stTskInitParam.usTaskPrio   = OS_TASK_PRIORITY_LOWEST - ((UINT16)(attr->priority) - LOS_PRIORITY_WIN); /*0~31*/
     stTskInitParam.uwResved     = LOS_TASK_STATUS_DETACHED; /*the cmsis task is detached,the task can deleteself*/
 
-    uwRet = LOS_TaskCreate(&uwTid, &stTskInitParam);
+    if (attr->stack_mem != NULL)
+    {
+        uwRet = LOS_TaskCreateStatic(&uwTid, &stTskInitParam, attr->stack_mem);
+    }
+    else
+    {
+        uwRet = LOS_TaskCreate(&uwTid, &stTskInitParam);
+    }
 
     if (LOS_OK != uwRet)
     {
@@ -448,8 +459,8 @@ osThreadState_t osThreadGetState (osThreadId_t thread_id)
         stState = osThreadReady;
     }
     else if (usTaskStatus &
-        (OS_TASK_STATUS_DELAY | OS_TASK_STATUS_PEND |
-         OS_TASK_STATUS_SUSPEND | OS_TASK_STATUS_PEND_QUEUE))
+        (OS_TASK_STATUS_DELAY | OS_TASK_STATUS_PEND | OS_TASK_STATUS_EVENT |
+         OS_TASK_STATUS_SUSPEND | OS_TASK_STATUS_PEND_QUEUE | OS_TASK_STATUS_PEND_MULTI))
     {
         stState = osThreadBlocked;
     }
@@ -488,7 +499,7 @@ uint32_t osTaskStackWaterMarkGet(UINT32 uwTaskID)
     UINTPTR uvIntSave;
     LOS_TASK_CB *pstTaskCB = NULL;
 
-    if (uwTaskID > LOSCFG_BASE_CORE_TSK_LIMIT)
+    if (uwTaskID >= g_uwTskMaxNum)
     {
         return 0;
     }
@@ -728,7 +739,7 @@ uint32_t osThreadGetCount (void)
         return 0U;
     }
 
-    for(int index = 0; index <= LOSCFG_BASE_CORE_TSK_LIMIT; index++)
+    for(int index = 0; index < g_uwTskMaxNum; index++)
     {
         if (!((g_pstTaskCBArray + index)->usTaskStatus & OS_TASK_STATUS_UNUSED))
         {
@@ -740,6 +751,104 @@ uint32_t osThreadGetCount (void)
 }
 
 
+//  ==== Thread Flags Functions ====
+
+uint32_t osThreadFlagsSet (osThreadId_t thread_id, uint32_t flags)
+{
+    LOS_TASK_CB *pstTaskCB = (LOS_TASK_CB *)thread_id;
+    UINT32 uwRet;
+    UINT32 uwPrevFlags;
+
+    if ((pstTaskCB == NULL) || (flags & osFlagsError))
+    {
+        return (uint32_t)osFlagsErrorParameter;
+    }
+
+    uwRet = LOS_TaskNotify(pstTaskCB->uwTaskID, (UINT32)flags, LOS_NOTIFY_SET_BITS, &uwPrevFlags);
+    if (uwRet != LOS_OK)
+    {
+        return (uint32_t)osFlagsErrorParameter;
+    }
+
+    return (uint32_t)(uwPrevFlags | flags);
+}
+
+
+uint32_t osThreadFlagsClear (uint32_t flags)
+{
+    UINT32 uwPrevFlags;
+
+    if (OS_INT_ACTIVE)
+    {
+        return (uint32_t)osFlagsErrorISR;
+    }
+
+    if (flags & osFlagsError)
+    {
+        return (uint32_t)osFlagsErrorParameter;
+    }
+
+    (VOID)LOS_TaskNotifyClear(g_stLosTask.pstRunTask->uwTaskID, (UINT32)flags, &uwPrevFlags);
+
+    return (uint32_t)uwPrevFlags;
+}
+
+
+uint32_t osThreadFlagsGet (void)
+{
+    UINT32 uwFlags;
+
+    if (OS_INT_ACTIVE)
+    {
+        return 0U;
+    }
+
+    (VOID)LOS_TaskNotifyClear(g_stLosTask.pstRunTask->uwTaskID, 0, &uwFlags);
+
+    return (uint32_t)uwFlags;
+}
+
+
+uint32_t osThreadFlagsWait (uint32_t flags, uint32_t options, uint32_t timeout)
+{
+    UINT32 uwMode;
+    UINT32 uwRet;
+    UINT32 uwFlags = 0;
+
+    if (OS_INT_ACTIVE)
+    {
+        return (uint32_t)osFlagsErrorISR;
+    }
+
+    if ((flags & osFlagsError) || (options > (osFlagsWaitAny | osFlagsWaitAll | osFlagsNoClear)))
+    {
+        return (uint32_t)osFlagsErrorParameter;
+    }
+
+    uwMode = ((options & osFlagsWaitAll) == osFlagsWaitAll) ? LOS_WAITMODE_AND : LOS_WAITMODE_OR;
+    if ((options & osFlagsNoClear) != osFlagsNoClear)
+    {
+        uwMode |= LOS_WAITMODE_CLR;
+    }
+
+    uwRet = LOS_TaskNotifyWait((UINT32)flags, uwMode, (UINT32)timeout, &uwFlags);
+    switch (uwRet)
+    {
+    case LOS_OK:
+        return (uint32_t)uwFlags;
+
+    case LOS_ERRNO_TSK_NOTIFY_MODE_INVALID:
+        return (uint32_t)osFlagsErrorParameter;
+
+    case LOS_ERRNO_TSK_NOTIFY_TIMEOUT:
+        return (uint32_t)osFlagsErrorTimeout;
+
+    default:
+        return (uint32_t)osFlagsErrorResource;
+    }
+}
+
+
 //  ==== Generic Wait Functions ====
 
 osStatus_t osDelay (uint32_t ticks)
@@ -761,7 +870,6 @@ osStatus_t osDelay (uint32_t ticks)
 osStatus_t osDelayUntil (uint64_t ticks)
 {
     UINT32 uwRet;
-    UINT32 uwTicks;
     UINT64 tickCount = osKernelGetTickCount();
 
     if(ticks < tickCount)
@@ -769,9 +877,8 @@ osStatus_t osDelayUntil (uint64_t ticks)
         return osError;
     }
 
-    uwTicks = (UINT32)(ticks - tickCount);
-
-    uwRet = LOS_TaskDelay(uwTicks);
+    /* the wake-up tick stays absolute, a preemption here does not delay it */
+    uwRet = LOS_TaskDelayUntil(ticks);
     if(uwRet == LOS_OK)
     {
         return osOK;
@@ -929,33 +1036,57 @@ osStatus_t osTimerDelete (osTimerId_t timer_id)
 }
 #endif
 
+/* Event flags control block. The event comes first, so the other event flags functions take the ID as a
+   PEVENT_CB_S; cb_mem must hold the whole structure. */
+typedef struct
+{
+    EVENT_CB_S  stEvent;
+    UINT32      uwFlags;
+} OS_CMSIS_EVENT_S;
+
+#define OS_CMSIS_EVENT_CB_ALLOC     0x01    /* control block allocated here rather than passed in as cb_mem */
+
 osEventFlagsId_t osEventFlagsNew (const osEventFlagsAttr_t *attr)
 {
-    PEVENT_CB_S pstEventCB = NULL;
+    OS_CMSIS_EVENT_S *pstEvent = (OS_CMSIS_EVENT_S *)NULL;
+    UINT32 uwFlags = 0;
     UINT32 uwRet;
 
-    UNUSED(attr);
-
     if (OS_INT_ACTIVE)
     {
         return (osEventFlagsId_t)NULL;
     }
 
-    pstEventCB = (PEVENT_CB_S)LOS_MemAlloc(m_aucSysMem0, sizeof(EVENT_CB_S));
-    if(pstEventCB == NULL )
+    if ((attr != NULL) && (attr->cb_mem != NULL))
     {
-        return (osEventFlagsId_t)NULL;
+        if (attr->cb_size < sizeof(OS_CMSIS_EVENT_S))
+        {
+            return (osEventFlagsId_t)NULL;
+        }
+        pstEvent = (OS_CMSIS_EVENT_S *)attr->cb_mem;
     }
-
-    uwRet = LOS_EventInit(pstEventCB);
-    if (uwRet == LOS_ERRNO_EVENT_PTR_NULL)
+    else
     {
-        return (osEventFlagsId_t)NULL;
+        pstEvent = (OS_CMSIS_EVENT_S *)LOS_MemAlloc(m_aucSysMem0, sizeof(OS_CMSIS_EVENT_S));
+        if (pstEvent == NULL)
+        {
+            return (osEventFlagsId_t)NULL;
+        }
+        uwFlags |= OS_CMSIS_EVENT_CB_ALLOC;
     }
-    else
+
+    uwRet = LOS_EventInit(&pstEvent->stEvent);
+    if (uwRet != LOS_OK)
     {
-        return (osEventFlagsId_t)pstEventCB;
+        if (uwFlags & OS_CMSIS_EVENT_CB_ALLOC)
+        {
+            (VOID)LOS_MemFree(m_aucSysMem0, (VOID *)pstEvent);
+        }
+        return (osEventFlagsId_t)NULL;
     }
+
+    pstEvent->uwFlags = uwFlags;
+    return (osEventFlagsId_t)pstEvent;
 }
 
 
@@ -1092,12 +1223,12 @@ uint32_t osEventFlagsWait (osEventFlagsId_t ef_id, uint32_t flags, uint32_t opti
 
 osStatus_t osEventFlagsDelete (osEventFlagsId_t ef_id)
 {
-    PEVENT_CB_S pstEventCB = (PEVENT_CB_S)ef_id;
+    OS_CMSIS_EVENT_S *pstEvent = (OS_CMSIS_EVENT_S *)ef_id;
     UINTPTR uwIntSave;
     osStatus_t uwRet;
 
     uwIntSave = LOS_IntLock();
-    if (LOS_EventDestory(pstEventCB) == LOS_OK)
+    if (LOS_EventDestory(&pstEvent->stEvent) == LOS_OK)
     {
         uwRet = osOK;
     }
@@ -1107,7 +1238,12 @@ osStatus_t osEventFlagsDelete (osEventFlagsId_t ef_id)
     }
     LOS_IntRestore(uwIntSave);
 
-    if (LOS_MemFree(m_aucSysMem0, (void *)pstEventCB) == LOS_OK)
+    if ((uwRet != osOK) || !(pstEvent->uwFlags & OS_CMSIS_EVENT_CB_ALLOC))
+    {
+        return uwRet;
+    }
+
+    if (LOS_MemFree(m_aucSysMem0, (void *)pstEvent) == LOS_OK)
     {
         uwRet = osOK;
     }
@@ -1161,7 +1297,7 @@ osStatus_t osMutexAcquire (osMutexId_t mutex_id, uint32_t timeout)
         timeout = 0;
     }
 
-    uwRet = LOS_MuxPend(((MUX_CB_S*)mutex_id)->ucMuxID, timeout);
+    uwRet = LOS_MuxPend(((MUX_CB_S*)mutex_id)->uwMuxID, timeout);
 
     if(uwRet == LOS_OK)
     {
@@ -1191,7 +1327,7 @@ osStatus_t osMutexRelease (osMutexId_t mutex_id)
         return osErrorParameter;
     }
 
-    uwRet = LOS_MuxPost(((MUX_CB_S*)mutex_id)->ucMuxID);
+    uwRet = LOS_MuxPost(((MUX_CB_S*)mutex_id)->uwMuxID);
 
     if (uwRet == LOS_OK)
     {
@@ -1241,7 +1377,7 @@ osStatus_t osMutexDelete (osMutexId_t mutex_id)
         return osErrorParameter;
     }
 
-    uwRet = LOS_MuxDelete(((MUX_CB_S*)mutex_id)->ucMuxID);
+    uwRet = LOS_MuxDelete(((MUX_CB_S*)mutex_id)->uwMuxID);
 
     if(uwRet == LOS_OK)
     {
@@ -1307,7 +1443,7 @@ osStatus_t osSemaphoreAcquire (osSemaphoreId_t semaphore_id, uint32_t timeout)
         return osErrorISR;
     }
 
-    uwRet = LOS_SemPend(((SEM_CB_S *)semaphore_id)->usSemID, timeout);
+    uwRet = LOS_SemPend(((SEM_CB_S *)semaphore_id)->uwSemID, timeout);
 
     if (uwRet == LOS_OK)
     {
@@ -1341,7 +1477,7 @@ osStatus_t osSemaphoreRelease (osSemaphoreId_t semaphore_id)
         return osErrorParameter;
     }
 
-    uwRet = LOS_SemPost(((SEM_CB_S *)semaphore_id)->usSemID);
+    uwRet = LOS_SemPost(((SEM_CB_S *)semaphore_id)->uwSemID);
 
     if (uwRet == LOS_OK)
     {
@@ -1395,7 +1531,7 @@ osStatus_t osSemaphoreDelete (osSemaphoreId_t semaphore_id)
         return osErrorParameter;
     }
 
-    uwRet = LOS_SemDelete(((SEM_CB_S *)semaphore_id)->usSemID);
+    uwRet = LOS_SemDelete(((SEM_CB_S *)semaphore_id)->uwSemID);
 
     if (uwRet == LOS_OK)
     {
@@ -1419,7 +1555,6 @@ osMessageQueueId_t osMessageQueueNew (uint32_t msg_count, uint32_t msg_size, con
 {
     UINT32 uwQueueID;
     UINT32 uwRet;
-    UNUSED(attr);
     osMessageQueueId_t handle;
 
     if(0 == msg_count || 0 == msg_size || OS_INT_ACTIVE)
@@ -1427,7 +1562,15 @@ osMessageQueueId_t osMessageQueueNew (uint32_t msg_count, uint32_t msg_size, con
         return (osMessageQueueId_t)NULL;
     }
 
-    uwRet = LOS_QueueCreate((char *)NULL, (UINT16)msg_count, &uwQueueID, 0,(UINT16)msg_size);
+    if ((attr != NULL) && (attr->mq_mem != NULL))
+    {
+        uwRet = LOS_QueueCreateStatic((char *)NULL, (UINT16)msg_count, &uwQueueID, 0, (UINT16)msg_size,
+                                      attr->mq_mem, attr->mq_size);
+    }
+    else
+    {
+        uwRet = LOS_QueueCreate((char *)NULL, (UINT16)msg_count, &uwQueueID, 0,(UINT16)msg_size);
+    }
     if (uwRet == LOS_OK)
     {
         handle = (osMessageQueueId_t)(GET_QUEUE_HANDLE(uwQueueID));
@@ -1454,7 +1597,7 @@ osStatus_t osMessageQueuePut (osMessageQueueId_t mq_id, const void *msg_ptr, uin
     }
 
     uwBufferSize = (UINT32)(pstQueue->usQueueSize - sizeof(UINT32));
-    uwRet = LOS_QueueWriteCopy((UINT32)pstQueue->usQueueID, (void*)msg_ptr, uwBufferSize, timeout);
+    uwRet = LOS_QueueWriteCopy(pstQueue->uwQueueID, (void*)msg_ptr, uwBufferSize, timeout);
     if (uwRet == LOS_OK)
     {
         return osOK;
@@ -1487,7 +1630,7 @@ osStatus_t osMessageQueueGet (osMessageQueueId_t mq_id, void *msg_ptr, uint8_t *
     }
 
     uwBufferSize = (UINT32)(pstQueue->usQueueSize - sizeof(UINT32));
-    uwRet = LOS_QueueReadCopy((UINT32)pstQueue->usQueueID, msg_ptr, &uwBufferSize, timeout);
+    uwRet = LOS_QueueReadCopy(pstQueue->uwQueueID, msg_ptr, &uwBufferSize, timeout);
     if (uwRet == LOS_OK)
     {
         return osOK;
@@ -1596,7 +1739,7 @@ osStatus_t osMessageQueueDelete (osMessageQueueId_t mq_id)
         return osErrorISR;
     }
 
-    uwRet = LOS_QueueDelete((UINT32)pstQueue->usQueueID);
+    uwRet = LOS_QueueDelete(pstQueue->uwQueueID);
     if (uwRet == LOS_OK)
     {
         return osOK;
@@ -1612,6 +1755,259 @@ osStatus_t osMessageQueueDelete (osMessageQueueId_t mq_id)
 }
 #endif
 
+
+//  ==== Memory Pool Management Functions ====
+#if (LOSCFG_BASE_IPC_SEM == YES)
+/* Memory pool control block. The semaphore counts the free blocks, so a blocking alloc pends on it and a free
+   posts it, while the blocks themselves come from a membox. mp_mem must hold LOS_MEMBOX_SIZE(block_size, block_count)
+   bytes, 4 byte aligned. */
+typedef struct
+{
+    const char  *pcName;
+    VOID        *pBoxMem;
+    UINT32      uwSemID;
+    UINT32      uwFlags;
+} OS_CMSIS_MEMPOOL_S;
+
+#define OS_CMSIS_MEMPOOL_CB_ALLOC   0x01    /* control block allocated here rather than passed in as cb_mem */
+#define OS_CMSIS_MEMPOOL_MP_ALLOC   0x02    /* membox allocated here rather than passed in as mp_mem */
+
+osMemoryPoolId_t osMemoryPoolNew (uint32_t block_count, uint32_t block_size, const osMemoryPoolAttr_t *attr)
+{
+    OS_CMSIS_MEMPOOL_S *pstPool = (OS_CMSIS_MEMPOOL_S *)NULL;
+    UINT32 uwBoxSize;
+    UINT32 uwFlags = 0;
+
+    if (OS_INT_ACTIVE)
+    {
+        return (osMemoryPoolId_t)NULL;
+    }
+
+    if ((block_count == 0) || (block_count > OS_SEM_COUNTING_MAX_COUNT) || (block_size == 0) ||
+        (LOS_MEMBOX_BLK_SIZE(block_size) < block_size) ||
+        (block_count > (0xFFFFFFFF - sizeof(OS_MEMBOX_S)) / LOS_MEMBOX_BLK_SIZE(block_size)))
+    {
+        return (osMemoryPoolId_t)NULL;
+    }
+    uwBoxSize = LOS_MEMBOX_SIZE(block_size, block_count);
+
+    if ((attr != NULL) && (attr->cb_mem != NULL))
+    {
+        if (attr->cb_size < sizeof(OS_CMSIS_MEMPOOL_S))
+        {
+            return (osMemoryPoolId_t)NULL;
+        }
+        pstPool = (OS_CMSIS_MEMPOOL_S *)attr->cb_mem;
+    }
+    else
+    {
+        pstPool = (OS_CMSIS_MEMPOOL_S *)LOS_MemAlloc(m_aucSysMem0, sizeof(OS_CMSIS_MEMPOOL_S));
+        if (pstPool == NULL)
+        {
+            return (osMemoryPoolId_t)NULL;
+        }
+        uwFlags |= OS_CMSIS_MEMPOOL_CB_ALLOC;
+    }
+
+    if ((attr != NULL) && (attr->mp_mem != NULL))
+    {
+        if ((attr->mp_size < uwBoxSize) || ((UINT32)attr->mp_mem & (sizeof(UINT32) - 1)))
+        {
+            goto ERROR_CB;
+        }
+        pstPool->pBoxMem = attr->mp_mem;
+    }
+    else
+    {
+        pstPool->pBoxMem = LOS_MemAlloc(m_aucSysMem0, uwBoxSize);
+        if (pstPool->pBoxMem == NULL)
+        {
+            goto ERROR_CB;
+        }
+        uwFlags |= OS_CMSIS_MEMPOOL_MP_ALLOC;
+    }
+
+    if ((LOS_MemboxInit(pstPool->pBoxMem, uwBoxSize, block_size) != LOS_OK) ||
+        (LOS_SemCreate((UINT16)block_count, &pstPool->uwSemID) != LOS_OK))
+    {
+        goto ERROR_MP;
+    }
+
+    pstPool->pcName = (attr != NULL) ? attr->name : (const char *)NULL;
+    pstPool->uwFlags = uwFlags;
+    return (osMemoryPoolId_t)pstPool;
+
+ERROR_MP:
+    if (uwFlags & OS_CMSIS_MEMPOOL_MP_ALLOC)
+    {
+        (VOID)LOS_MemFree(m_aucSysMem0, pstPool->pBoxMem);
+    }
+ERROR_CB:
+    if (uwFlags & OS_CMSIS_MEMPOOL_CB_ALLOC)
+    {
+        (VOID)LOS_MemFree(m_aucSysMem0, pstPool);
+    }
+    return (osMemoryPoolId_t)NULL;
+}
+
+
+const char *osMemoryPoolGetName (osMemoryPoolId_t mp_id)
+{
+    if ((mp_id == NULL) || OS_INT_ACTIVE)
+    {
+        return (const char *)NULL;
+    }
+
+    return ((OS_CMSIS_MEMPOOL_S *)mp_id)->pcName;
+}
+
+
+void *osMemoryPoolAlloc (osMemoryPoolId_t mp_id, uint32_t timeout)
+{
+    OS_CMSIS_MEMPOOL_S *pstPool = (OS_CMSIS_MEMPOOL_S *)mp_id;
+
+    if ((pstPool == NULL) || (pstPool->pBoxMem == NULL) || (OS_INT_ACTIVE && (timeout != 0)))
+    {
+        return NULL;
+    }
+
+    if (LOS_SemPend(pstPool->uwSemID, timeout) != LOS_OK)
+    {
+        return NULL;
+    }
+
+    /* the semaphore count taken guarantees a free block */
+    return LOS_MemboxAlloc(pstPool->pBoxMem);
+}
+
+
+osStatus_t osMemoryPoolFree (osMemoryPoolId_t mp_id, void *block)
+{
+    OS_CMSIS_MEMPOOL_S *pstPool = (OS_CMSIS_MEMPOOL_S *)mp_id;
+
+    if ((pstPool == NULL) || (pstPool->pBoxMem == NULL) || (block == NULL))
+    {
+        return osErrorParameter;
+    }
+
+    if (LOS_MemboxFree(pstPool->pBoxMem, block) != LOS_OK)
+    {
+        return osErrorParameter;
+    }
+
+    if (LOS_SemPost(pstPool->uwSemID) != LOS_OK)
+    {
+        return osErrorResource;
+    }
+
+    return osOK;
+}
+
+
+uint32_t osMemoryPoolGetCapacity (osMemoryPoolId_t mp_id)
+{
+    UINT32 uwMaxBlk = 0;
+    UINT32 uwBlkCnt;
+    UINT32 uwBlkSize;
+
+    if ((mp_id == NULL) || (((OS_CMSIS_MEMPOOL_S *)mp_id)->pBoxMem == NULL))
+    {
+        return 0;
+    }
+
+    (VOID)LOS_MemboxStatisticsGet(((OS_CMSIS_MEMPOOL_S *)mp_id)->pBoxMem, &uwMaxBlk, &uwBlkCnt, &uwBlkSize);
+    return uwMaxBlk;
+}
+
+
+uint32_t osMemoryPoolGetBlockSize (osMemoryPoolId_t mp_id)
+{
+    UINT32 uwMaxBlk;
+    UINT32 uwBlkCnt;
+    UINT32 uwBlkSize = 0;
+
+    if ((mp_id == NULL) || (((OS_CMSIS_MEMPOOL_S *)mp_id)->pBoxMem == NULL))
+    {
+        return 0;
+    }
+
+    (VOID)LOS_MemboxStatisticsGet(((OS_CMSIS_MEMPOOL_S *)mp_id)->pBoxMem, &uwMaxBlk, &uwBlkCnt, &uwBlkSize);
+    return uwBlkSize;
+}
+
+
+uint32_t osMemoryPoolGetCount (osMemoryPoolId_t mp_id)
+{
+    UINT32 uwMaxBlk;
+    UINT32 uwBlkCnt = 0;
+    UINT32 uwBlkSize;
+
+    if ((mp_id == NULL) || (((OS_CMSIS_MEMPOOL_S *)mp_id)->pBoxMem == NULL))
+    {
+        return 0;
+    }
+
+    (VOID)LOS_MemboxStatisticsGet(((OS_CMSIS_MEMPOOL_S *)mp_id)->pBoxMem, &uwMaxBlk, &uwBlkCnt, &uwBlkSize);
+    return uwBlkCnt;
+}
+
+
+uint32_t osMemoryPoolGetSpace (osMemoryPoolId_t mp_id)
+{
+    UINT32 uwMaxBlk = 0;
+    UINT32 uwBlkCnt = 0;
+    UINT32 uwBlkSize;
+
+    if ((mp_id == NULL) || (((OS_CMSIS_MEMPOOL_S *)mp_id)->pBoxMem == NULL))
+    {
+        return 0;
+    }
+
+    (VOID)LOS_MemboxStatisticsGet(((OS_CMSIS_MEMPOOL_S *)mp_id)->pBoxMem, &uwMaxBlk, &uwBlkCnt, &uwBlkSize);
+    return uwMaxBlk - uwBlkCnt;
+}
+
+
+osStatus_t osMemoryPoolDelete (osMemoryPoolId_t mp_id)
+{
+    OS_CMSIS_MEMPOOL_S *pstPool = (OS_CMSIS_MEMPOOL_S *)mp_id;
+    UINT32 uwRet;
+
+    if (OS_INT_ACTIVE)
+    {
+        return osErrorISR;
+    }
+
+    if ((pstPool == NULL) || (pstPool->pBoxMem == NULL))
+    {
+        return osErrorParameter;
+    }
+
+    uwRet = LOS_SemDelete(pstPool->uwSemID);
+    if (uwRet == LOS_ERRNO_SEM_INVALID)
+    {
+        return osErrorParameter;
+    }
+    else if (uwRet != LOS_OK)
+    {
+        return osErrorResource;
+    }
+
+    if (pstPool->uwFlags & OS_CMSIS_MEMPOOL_MP_ALLOC)
+    {
+        (VOID)LOS_MemFree(m_aucSysMem0, pstPool->pBoxMem);
+    }
+    pstPool->pBoxMem = NULL;
+
+    if (pstPool->uwFlags & OS_CMSIS_MEMPOOL_CB_ALLOC)
+    {
+        (VOID)LOS_MemFree(m_aucSysMem0, pstPool);
+    }
+
+    return osOK;
+}
+#endif
+
 #ifdef LOS_RUNSTOP
 void osUartVetoCallbackRegister(cb_uart_is_need_awake_fn cb)
 {
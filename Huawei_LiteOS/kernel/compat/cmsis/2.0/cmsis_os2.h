@@ -232,7 +232,7 @@ typedef struct {
   void                      *cb_mem;    ///< memory for control block
   uint32_t                   cb_size;   ///< size of provided memory for control block
   void                   *stack_mem;    ///< memory for stack
-  uint32_t                stack_size;   ///< size of stack
+  uint32_t                stack_size;   ///< size of stack in bytes
   osPriority_t              priority;   ///< initial thread priority (default: osPriorityNormal)
   TZ_ModuleId_t            tz_module;   ///< TrustZone module identifier
   uint32_t                  reserved;   ///< reserved (must be 0)
@@ -0,0 +1,190 @@
+/*----------------------------------------------------------------------------
+ * Copyright (c) <2013-2015>, <Huawei Technologies Co., Ltd>
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *---------------------------------------------------------------------------*/
+/*----------------------------------------------------------------------------
+ * Notice of Export Control Law
+ * ===============================================
+ * Huawei LiteOS may be subject to applicable export control laws and regulations, which might
+ * include those applicable to Huawei LiteOS of U.S. and the country in which you are located.
+ * Import, export and usage of Huawei LiteOS in any manner by you shall be in compliance with such
+ * applicable export control laws and regulations.
+ *---------------------------------------------------------------------------*/
+
+#include "los_tickless.ph"
+#include "los_base.ph"
+#include "los_task.ph"
+#include "los_tick.ph"
+#include "los_swtmr.ph"
+#include "los_hwi.h"
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+#endif /* __cplusplus */
+
+#if (LOSCFG_KERNEL_TICKLESS == YES)
+
+#if (LOSCFG_BASE_CORE_TICK_HW_TIME == YES)
+#error "LOSCFG_KERNEL_TICKLESS is not supported with LOSCFG_BASE_CORE_TICK_HW_TIME"
+#endif
+
+LITE_OS_SEC_DATA_INIT BOOL              g_bTicklessFlag = TRUE;
+LITE_OS_SEC_DATA_INIT TICKLESS_TIMER_S  g_stTicklessTimer = {osSysTickSleepStart, osSysTickSleepEnd};
+
+/*****************************************************************************
+ Function    : LOS_TicklessEnable
+ Description : Enable the tickless mode
+ Input       : None
+ Output      : None
+ Return      : None
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_MINOR VOID LOS_TicklessEnable(VOID)
+{
+    g_bTicklessFlag = TRUE;
+}
+
+/*****************************************************************************
+ Function    : LOS_TicklessDisable
+ Description : Disable the tickless mode
+ Input       : None
+ Output      : None
+ Return      : None
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_MINOR VOID LOS_TicklessDisable(VOID)
+{
+    g_bTicklessFlag = FALSE;
+}
+
+/*****************************************************************************
+ Function    : LOS_TicklessTimerReg
+ Description : Register the wakeup timer used in tickless mode
+ Input       : pstTimer --- wakeup timer hooks, NULL for SysTick
+ Output      : None
+ Return      : None
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_MINOR VOID LOS_TicklessTimerReg(TICKLESS_TIMER_S *pstTimer)
+{
+    UINTPTR uvIntSave;
+
+    uvIntSave = LOS_IntLock();
+    if (pstTimer == NULL)
+    {
+        g_stTicklessTimer.pfnSleepStart = osSysTickSleepStart;
+        g_stTicklessTimer.pfnSleepEnd = osSysTickSleepEnd;
+    }
+    else
+    {
+        g_stTicklessTimer = *pstTimer;
+    }
+    LOS_IntRestore(uvIntSave);
+}
+
+/*****************************************************************************
+ Function    : osTicklessHandler
+ Description : Sleep until the nearest task or software timer timeout
+ Input       : None
+ Output      : None
+ Return      : None
+ *****************************************************************************/
+LITE_OS_SEC_TEXT VOID osTicklessHandler(VOID)
+{
+    UINTPTR uvIntSave;
+    UINT32 uwSleepTicks;
+    UINT32 uwElapsedTicks = 0;
+#if (LOSCFG_BASE_CORE_SWTMR == YES)
+    UINT32 uwSwtmrTicks;
+#endif
+
+    if (!g_bTicklessFlag)
+    {
+        return;
+    }
+
+    uvIntSave = LOS_IntLock();
+
+    uwSleepTicks = osTaskNextSwitchTimeGet();
+#if (LOSCFG_BASE_CORE_SWTMR == YES)
+    uwSwtmrTicks = osSwTmrGetNextTimeout();
+    if (uwSwtmrTicks < uwSleepTicks)
+    {
+        uwSleepTicks = uwSwtmrTicks;
+    }
+#endif
+
+    /* nothing to gain when the next tick is due anyway */
+    if (uwSleepTicks > 1)
+    {
+        uwSleepTicks = g_stTicklessTimer.pfnSleepStart(uwSleepTicks);
+    }
+    else
+    {
+        uwSleepTicks = 0;
+    }
+
+    /*
+     * WFI returns on any pending interrupt even though PRIMASK is set, so the ticks
+     * are caught up before the interrupt handler sees the kernel time.
+     */
+#if (LOSCFG_ARCH_INT_LOCK_BASEPRI == YES)
+    /* an interrupt masked by BASEPRI does not wake WFI, hold them off with PRIMASK instead */
+    __disable_irq();
+    __set_BASEPRI(0);
+    __ISB();
+    __WFI();
+    __set_BASEPRI(g_uwOsIntLockBasepri);
+    __enable_irq();
+#else
+    __WFI();
+#endif
+
+    if (uwSleepTicks > 0)
+    {
+        uwElapsedTicks = g_stTicklessTimer.pfnSleepEnd(uwSleepTicks);
+        if (uwElapsedTicks >= uwSleepTicks)
+        {
+            uwElapsedTicks = uwSleepTicks - 1;
+        }
+    }
+
+    if (uwElapsedTicks > 0)
+    {
+        g_ullTickCount += uwElapsedTicks;
+        osTaskSortLinkAdjust(uwElapsedTicks);
+#if (LOSCFG_BASE_CORE_SWTMR == YES)
+        osSwTmrAdjust(uwElapsedTicks);
+#endif
+    }
+
+    LOS_IntRestore(uvIntSave);
+}
+
+#endif /* LOSCFG_KERNEL_TICKLESS == YES */
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* __cplusplus */
@@ -0,0 +1,235 @@
+/*----------------------------------------------------------------------------
+ * Copyright (c) <2013-2015>, <Huawei Technologies Co., Ltd>
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *---------------------------------------------------------------------------*/
+/*----------------------------------------------------------------------------
+ * Notice of Export Control Law
+ * ===============================================
+ * Huawei LiteOS may be subject to applicable export control laws and regulations, which might
+ * include those applicable to Huawei LiteOS of U.S. and the country in which you are located.
+ * Import, export and usage of Huawei LiteOS in any manner by you shall be in compliance with such
+ * applicable export control laws and regulations.
+ *---------------------------------------------------------------------------*/
+
+#include "los_trace.ph"
+#include "los_base.ph"
+#include "los_task.ph"
+#include "los_sys.h"
+#include "los_hwi.h"
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+#endif /* __cplusplus */
+
+#if (LOSCFG_KERNEL_TRACE == YES)
+
+#define OS_TRACE_RECORD_MASK        (LOSCFG_KERNEL_TRACE_RECORD_NUM - 1)
+
+LITE_OS_SEC_BSS TRACE_BUFFER_S g_stTraceBuf;
+
+/*****************************************************************************
+ Function    : osTraceIdxGet
+ Description : Claim the next write index
+ Input       : None
+ Output      : None
+ Return      : The claimed index
+ *****************************************************************************/
+LITE_OS_SEC_TEXT static inline UINT32 osTraceIdxGet(VOID)
+{
+    UINT32 uwIdx;
+#if (__CORTEX_M >= 0x03)
+    do
+    {
+        uwIdx = __LDREXW((volatile uint32_t *)&g_stTraceBuf.uwWriteIdx);
+    } while (__STREXW(uwIdx + 1, (volatile uint32_t *)&g_stTraceBuf.uwWriteIdx) != 0);
+#else
+    /* no exclusive access on ARMv6-M */
+    UINTPTR uvIntSave;
+
+    uvIntSave = LOS_IntLock();
+    uwIdx = g_stTraceBuf.uwWriteIdx++;
+    LOS_IntRestore(uvIntSave);
+#endif
+    return uwIdx;
+}
+
+/*****************************************************************************
+ Function    : osTraceRecord
+ Description : Append a record to the trace buffer
+ Input       : ucType --- event type
+               uwArg0 --- first argument
+               uwArg1 --- second argument
+ Output      : None
+ Return      : None
+ *****************************************************************************/
+LITE_OS_SEC_TEXT VOID osTraceRecord(UINT8 ucType, UINT32 uwArg0, UINT32 uwArg1)
+{
+    TRACE_RECORD_S *pstRecord;
+    UINT32 uwCntHi;
+    UINT32 uwCntLo;
+
+    LOS_GetCpuCycle(&uwCntHi, &uwCntLo);
+    pstRecord = &g_stTraceBuf.astRecord[osTraceIdxGet() & OS_TRACE_RECORD_MASK];
+
+    pstRecord->uwTimeLo   = uwCntLo;
+    pstRecord->usTimeHi   = (UINT16)uwCntHi;
+    pstRecord->ucType     = ucType;
+    pstRecord->ucReserved = 0;
+    pstRecord->uwArg0     = uwArg0;
+    pstRecord->uwArg1     = uwArg1;
+}
+
+/*****************************************************************************
+ Function    : osTraceInit
+ Description : Initialize the trace buffer
+ Input       : None
+ Output      : None
+ Return      : None
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_INIT VOID osTraceInit(VOID)
+{
+    g_stTraceBuf.uwMagic      = LOS_TRACE_MAGIC;
+    g_stTraceBuf.usVersion    = LOS_TRACE_VERSION;
+    g_stTraceBuf.usRecordSize = (UINT16)sizeof(TRACE_RECORD_S);
+    g_stTraceBuf.uwRecordNum  = LOSCFG_KERNEL_TRACE_RECORD_NUM;
+    g_stTraceBuf.uwClock      = OS_SYS_CLOCK;
+    g_stTraceBuf.uwWriteIdx   = 0;
+    g_stTraceBuf.uwMask       = LOSCFG_KERNEL_TRACE_MASK;
+}
+
+/*****************************************************************************
+ Function    : LOS_TraceStart
+ Description : Start tracing
+ Input       : uwMask --- event classes to record
+ Output      : None
+ Return      : None
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_MINOR VOID LOS_TraceStart(UINT32 uwMask)
+{
+    g_stTraceBuf.uwMask = uwMask & LOS_TRACE_MASK_ALL;
+}
+
+/*****************************************************************************
+ Function    : LOS_TraceStop
+ Description : Stop tracing
+ Input       : None
+ Output      : None
+ Return      : The mask that was active
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_MINOR UINT32 LOS_TraceStop(VOID)
+{
+    UINT32 uwMask;
+    UINTPTR uvIntSave;
+
+    uvIntSave = LOS_IntLock();
+    uwMask = g_stTraceBuf.uwMask;
+    g_stTraceBuf.uwMask = 0;
+    LOS_IntRestore(uvIntSave);
+
+    return uwMask;
+}
+
+/*****************************************************************************
+ Function    : LOS_TraceReset
+ Description : Drop all the records
+ Input       : None
+ Output      : None
+ Return      : None
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_MINOR VOID LOS_TraceReset(VOID)
+{
+    UINTPTR uvIntSave;
+
+    uvIntSave = LOS_IntLock();
+    g_stTraceBuf.uwWriteIdx = 0;
+    LOS_IntRestore(uvIntSave);
+}
+
+/*****************************************************************************
+ Function    : LOS_TraceBufGet
+ Description : Get the trace buffer
+ Input       : None
+ Output      : puwSize --- size of the trace buffer in bytes
+ Return      : The trace buffer
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_MINOR TRACE_BUFFER_S *LOS_TraceBufGet(UINT32 *puwSize)
+{
+    if (puwSize != NULL)
+    {
+        *puwSize = sizeof(TRACE_BUFFER_S);
+    }
+
+    return &g_stTraceBuf;
+}
+
+/*****************************************************************************
+ Function    : LOS_TraceDump
+ Description : Print the trace buffer for the host decoder
+ Input       : None
+ Output      : None
+ Return      : None
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_MINOR VOID LOS_TraceDump(VOID)
+{
+    TRACE_RECORD_S *pstRecord;
+    LOS_TASK_CB *pstTaskCB;
+    UINT32 uwMask;
+    UINT32 uwEnd;
+    UINT32 uwIdx;
+
+    uwMask = LOS_TraceStop();
+    uwEnd = g_stTraceBuf.uwWriteIdx;
+    uwIdx = (uwEnd > LOSCFG_KERNEL_TRACE_RECORD_NUM) ? (uwEnd - LOSCFG_KERNEL_TRACE_RECORD_NUM) : 0;
+
+    PRINTK("LOSTRACE BEGIN %u %u %u %u\n", LOS_TRACE_VERSION, g_stTraceBuf.uwClock,
+           (UINT32)sizeof(TRACE_RECORD_S), uwEnd - uwIdx);
+
+    for (pstTaskCB = g_pstTaskCBArray; pstTaskCB < g_pstTaskCBArray + g_uwTskMaxNum; pstTaskCB++)
+    {
+        if (!(pstTaskCB->usTaskStatus & OS_TASK_STATUS_UNUSED))
+        {
+            PRINTK("T %u %s\n", pstTaskCB->uwTaskID, pstTaskCB->pcTaskName);
+        }
+    }
+
+    for (; uwIdx != uwEnd; uwIdx++)
+    {
+        pstRecord = &g_stTraceBuf.astRecord[uwIdx & OS_TRACE_RECORD_MASK];
+        PRINTK("R %08x%04x%02x%02x%08x%08x\n", pstRecord->uwTimeLo, pstRecord->usTimeHi, pstRecord->ucType,
+               pstRecord->ucReserved, pstRecord->uwArg0, pstRecord->uwArg1);
+    }
+
+    PRINTK("LOSTRACE END\n");
+    LOS_TraceStart(uwMask);
+}
+
+#endif /* (LOSCFG_KERNEL_TRACE == YES) */
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* __cplusplus */
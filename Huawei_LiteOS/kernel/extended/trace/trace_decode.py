@@ -0,0 +1,292 @@
+#!/usr/bin/env python3
+# ----------------------------------------------------------------------------
+# Copyright (c) <2013-2015>, <Huawei Technologies Co., Ltd>
+# All rights reserved.
+# Redistribution and use in source and binary forms, with or without modification,
+# are permitted provided that the following conditions are met:
+# 1. Redistributions of source code must retain the above copyright notice, this list of
+# conditions and the following disclaimer.
+# 2. Redistributions in binary form must reproduce the above copyright notice, this list
+# of conditions and the following disclaimer in the documentation and/or other materials
+# provided with the distribution.
+# 3. Neither the name of the copyright holder nor the names of its contributors may be used
+# to endorse or promote products derived from this software without specific prior written
+# permission.
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+# THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+# PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+# CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+# EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+# PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+# OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+# WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+# OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+# ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+# ----------------------------------------------------------------------------
+"""Convert a LiteOS kernel trace into Chrome trace JSON (chrome://tracing, Perfetto).
+
+The input is either the console output of LOS_TraceDump() or a raw memory
+snapshot of the buffer returned by LOS_TraceBufGet().
+
+    trace_decode.py uart.log -o trace.json
+    trace_decode.py tracebuf.bin -o trace.json
+
+With --mem-replay the LOS_MemAlloc/LOS_MemFree records are turned into the
+replay table of the memory benchmark in examples/api/los_api_mem_bench.c:
+
+    trace_decode.py uart.log --mem-replay -o examples/include/los_api_mem_replay.h
+"""
+
+import argparse
+import json
+import struct
+import sys
+
+TRACE_MAGIC = 0x4352544C
+TRACE_VERSION = 1
+RECORD_SIZE = 16
+HEADER_FMT = '<IHHIIII'
+HEADER_SIZE = struct.calcsize(HEADER_FMT)
+NONE = 0xFFFFFFFF
+
+TASK_SWITCH = 0x00
+TASK_TIMEOUT = 0x01
+IRQ_ENTER = 0x10
+IRQ_EXIT = 0x11
+MEM_ALLOC = 0x40
+MEM_FREE = 0x41
+
+INSTANT = {
+    0x01: ('timeout', 'task', ('task', 'status')),
+    0x20: ('sem pend', 'ipc', ('sem', 'timeout')),
+    0x21: ('sem post', 'ipc', ('sem', 'woken')),
+    0x22: ('mux pend', 'ipc', ('mux', 'timeout')),
+    0x23: ('mux post', 'ipc', ('mux', 'owner')),
+    0x24: ('queue read', 'ipc', ('queue', 'timeout')),
+    0x25: ('queue write', 'ipc', ('queue', 'timeout')),
+    0x26: ('event read', 'ipc', ('event', 'mask')),
+    0x27: ('event write', 'ipc', ('event', 'events')),
+    0x28: ('notify wait', 'ipc', ('task', 'mask')),
+    0x29: ('notify', 'ipc', ('task', 'value')),
+    0x30: ('swtmr expire', 'swtmr', ('timer', 'handler')),
+    0x31: ('swtmr drop', 'swtmr', ('timer', 'handler')),
+    0x40: ('mem alloc', 'mem', ('ptr', 'size')),
+    0x41: ('mem free', 'mem', ('ptr', 'pool')),
+}
+
+PID_TASK = 1
+PID_IRQ = 2
+
+
+class Trace(object):
+    def __init__(self):
+        self.clock = 0
+        self.tasks = {}
+        self.records = []   # (time48, type, arg0, arg1) in write order
+
+
+def parse_binary(data):
+    magic, version, recsize, num, clock, widx, _mask = struct.unpack_from(HEADER_FMT, data, 0)
+    if magic != TRACE_MAGIC:
+        raise ValueError('not a trace snapshot')
+    if version != TRACE_VERSION or recsize != RECORD_SIZE:
+        raise ValueError('unsupported trace version %d, record size %d' % (version, recsize))
+    if len(data) < HEADER_SIZE + num * recsize:
+        raise ValueError('snapshot truncated')
+
+    trace = Trace()
+    trace.clock = clock
+    first = widx - num if widx > num else 0
+    for idx in range(first, widx):
+        off = HEADER_SIZE + (idx & (num - 1)) * recsize
+        lo, hi, typ, _rsv, a0, a1 = struct.unpack_from('<IHBBII', data, off)
+        trace.records.append(((hi << 32) | lo, typ, a0, a1))
+    return trace
+
+
+def parse_text(text):
+    trace = None
+    for line in text.splitlines():
+        line = line.strip()
+        if line.startswith('LOSTRACE BEGIN'):
+            fields = line.split()
+            if int(fields[2]) != TRACE_VERSION or int(fields[4]) != RECORD_SIZE:
+                raise ValueError('unsupported trace version %s, record size %s' % (fields[2], fields[4]))
+            trace = Trace()
+            trace.clock = int(fields[3])
+        elif trace is None:
+            continue
+        elif line == 'LOSTRACE END':
+            return trace
+        elif line.startswith('T '):
+            fields = line.split(None, 2)
+            trace.tasks[int(fields[1])] = fields[2] if len(fields) > 2 else ''
+        elif line.startswith('R '):
+            raw = line[2:]
+            lo = int(raw[0:8], 16)
+            hi = int(raw[8:12], 16)
+            typ = int(raw[12:14], 16)
+            a0 = int(raw[16:24], 16)
+            a1 = int(raw[24:32], 16)
+            trace.records.append(((hi << 32) | lo, typ, a0, a1))
+    if trace is None:
+        raise ValueError('no LOSTRACE BEGIN found')
+    return trace
+
+
+def unwrap(records):
+    """Make the 48 bit cycle counts monotonic across counter wraps."""
+    out = []
+    base = 0
+    last = None
+    for t, typ, a0, a1 in records:
+        if last is not None and t + base < last - (1 << 47):
+            base += 1 << 48
+        last = t + base
+        out.append((last, typ, a0, a1))
+    # nested interrupts may claim a slot after taking a later timestamp
+    out.sort(key=lambda r: r[0])
+    return out
+
+
+def to_chrome(trace):
+    clock = float(trace.clock or 1)
+    records = unwrap(trace.records)
+    if not records:
+        return {'traceEvents': [], 'displayTimeUnit': 'ns'}
+    t0 = records[0][0]
+
+    def us(t):
+        return (t - t0) * 1e6 / clock
+
+    events = []
+    events.append({'ph': 'M', 'name': 'process_name', 'pid': PID_TASK, 'args': {'name': 'tasks'}})
+    events.append({'ph': 'M', 'name': 'process_name', 'pid': PID_IRQ, 'args': {'name': 'interrupts'}})
+    for tid, name in sorted(trace.tasks.items()):
+        events.append({'ph': 'M', 'name': 'thread_name', 'pid': PID_TASK, 'tid': tid, 'args': {'name': name}})
+
+    def task_name(tid):
+        return trace.tasks.get(tid, 'task %d' % tid)
+
+    running = None
+    since = None
+    irq_open = {}
+    for t, typ, a0, a1 in records:
+        if typ == TASK_SWITCH:
+            if running is None:
+                running, since = a0, t0
+            if t > since:
+                events.append({'ph': 'X', 'name': task_name(running), 'cat': 'task', 'pid': PID_TASK,
+                               'tid': running, 'ts': us(since), 'dur': us(t) - us(since)})
+            running, since = a1, t
+        elif typ == IRQ_ENTER:
+            irq_open.setdefault(a0, []).append(t)
+        elif typ == IRQ_EXIT:
+            start = irq_open.get(a0)
+            begin = start.pop() if start else t0
+            events.append({'ph': 'X', 'name': 'irq %d' % a0, 'cat': 'irq', 'pid': PID_IRQ,
+                           'tid': a0, 'ts': us(begin), 'dur': us(t) - us(begin)})
+        elif typ in INSTANT:
+            name, cat, keys = INSTANT[typ]
+            args = {}
+            for key, val in zip(keys, (a0, a1)):
+                if key in ('woken', 'owner'):
+                    args[key] = task_name(val) if val != NONE else None
+                elif key in ('event', 'handler', 'ptr', 'pool', 'mask', 'events', 'status'):
+                    args[key] = '0x%08x' % val
+                else:
+                    args[key] = val
+            tid = a0 if typ == TASK_TIMEOUT else (running if running is not None else 0)
+            events.append({'ph': 'i', 's': 't', 'name': name, 'cat': cat, 'pid': PID_TASK,
+                           'tid': tid, 'ts': us(t), 'args': args})
+        else:
+            events.append({'ph': 'i', 's': 'g', 'name': 'type 0x%02x' % typ, 'pid': PID_TASK,
+                           'ts': us(t), 'args': {'arg0': a0, 'arg1': a1}})
+
+    end = records[-1][0]
+    if running is not None:
+        events.append({'ph': 'X', 'name': task_name(running), 'cat': 'task', 'pid': PID_TASK,
+                       'tid': running, 'ts': us(since), 'dur': us(end) - us(since)})
+    for irq, starts in irq_open.items():
+        for begin in starts:
+            events.append({'ph': 'X', 'name': 'irq %d' % irq, 'cat': 'irq', 'pid': PID_IRQ,
+                           'tid': irq, 'ts': us(begin), 'dur': us(end) - us(begin)})
+
+    return {'traceEvents': events, 'displayTimeUnit': 'ns'}
+
+
+def to_mem_replay(trace):
+    """Number the live blocks by slot so a trace can be replayed on any pool."""
+    ops = []
+    slots = {}
+    spare = []
+    sizes = {}
+    live = peak = 0
+    for _t, typ, a0, a1 in unwrap(trace.records):
+        if typ == MEM_ALLOC and a0 != 0:
+            if a0 in slots:
+                # the free fell out of the trace window
+                ops.append((0, slots[a0]))
+                spare.append(slots.pop(a0))
+                live -= sizes.pop(a0)
+            spare.sort(reverse=True)
+            slot = spare.pop() if spare else len(slots)
+            slots[a0] = slot
+            sizes[a0] = a1
+            live += a1
+            peak = max(peak, live)
+            ops.append((a1, slot))
+        elif typ == MEM_FREE and a0 in slots:
+            ops.append((0, slots[a0]))
+            spare.append(slots.pop(a0))
+            live -= sizes.pop(a0)
+    if not ops:
+        raise ValueError('no memory records in the trace')
+
+    nslots = max(slot for _size, slot in ops) + 1
+    lines = [
+        '/* Generated by kernel/extended/trace/trace_decode.py --mem-replay, %d operations. */' % len(ops),
+        '',
+        '#ifndef _LOS_API_MEM_REPLAY_H',
+        '#define _LOS_API_MEM_REPLAY_H',
+        '',
+        '#define MEM_REPLAY_SLOT_NUM             %d' % nslots,
+        '#define MEM_REPLAY_PEAK_SIZE            0x%x' % peak,
+        '',
+        '/* {size, slot}: a size allocates the slot, 0 frees it */',
+        'static const MEM_REPLAY_OP g_astMemReplay[] = {',
+    ]
+    for idx in range(0, len(ops), 6):
+        lines.append('    ' + ' '.join('{%d, %d},' % op for op in ops[idx:idx + 6]))
+    lines += ['};', '', '#endif /* _LOS_API_MEM_REPLAY_H */', '']
+    return '\n'.join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('input', help='LOS_TraceDump console log or raw trace buffer snapshot')
+    parser.add_argument('-o', '--output', help='output file, default stdout')
+    parser.add_argument('--mem-replay', action='store_true',
+                        help='write the memory benchmark replay table instead of JSON')
+    opts = parser.parse_args()
+
+    with open(opts.input, 'rb') as f:
+        data = f.read()
+    if len(data) >= 4 and struct.unpack_from('<I', data, 0)[0] == TRACE_MAGIC:
+        trace = parse_binary(data)
+    else:
+        trace = parse_text(data.decode('ascii', 'replace'))
+
+    out = open(opts.output, 'w') if opts.output else sys.stdout
+    if opts.mem_replay:
+        out.write(to_mem_replay(trace))
+    else:
+        json.dump(to_chrome(trace), out)
+    if opts.output:
+        out.close()
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
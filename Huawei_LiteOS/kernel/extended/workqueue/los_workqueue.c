@@ -0,0 +1,670 @@
+/*----------------------------------------------------------------------------
+ * Copyright (c) <2013-2015>, <Huawei Technologies Co., Ltd>
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *---------------------------------------------------------------------------*/
+/*----------------------------------------------------------------------------
+ * Notice of Export Control Law
+ * ===============================================
+ * Huawei LiteOS may be subject to applicable export control laws and regulations, which might
+ * include those applicable to Huawei LiteOS of U.S. and the country in which you are located.
+ * Import, export and usage of Huawei LiteOS in any manner by you shall be in compliance with such
+ * applicable export control laws and regulations.
+ *---------------------------------------------------------------------------*/
+
+#include "los_workqueue.ph"
+#include "los_base.ph"
+#include "los_task.ph"
+#include "los_sem.h"
+#include "los_sys.h"
+#include "los_hwi.h"
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+#endif /* __cplusplus */
+
+#if (LOSCFG_KERNEL_WORKQUEUE == YES)
+
+#define OS_WORKQUEUE_ARG(uwWqID, uwIdx)     (((uwWqID) << 16) | (uwIdx))
+#define OS_WORKQUEUE_ARG_ID(uwArg)          ((uwArg) >> 16)
+#define OS_WORKQUEUE_ARG_IDX(uwArg)         ((uwArg) & 0xFFFF)
+
+typedef struct tagWorkHwi
+{
+    WORK_S          stWork;         /* runs osWorkHwiThread */
+    HWI_TOP_FUNC    pfnTop;
+    HWI_THREAD_FUNC pfnThread;
+    HWI_ARG_T       uwArg;
+    HWI_HANDLE_T    uwHwiNum;
+    UINT16          usWqID;
+    UINT16          usUsed;
+} WORK_HWI_S;
+
+LITE_OS_SEC_BSS WORKQUEUE_CB_S g_astWorkQueue[LOSCFG_KERNEL_WORKQUEUE_LIMIT];
+LITE_OS_SEC_BSS static WORK_HWI_S g_astWorkHwi[LOSCFG_KERNEL_WORKQUEUE_HWI_LIMIT];
+
+/*****************************************************************************
+ Function    : osWorkDelayExpire
+ Description : Move the delayed work that is due to the pending list, with interrupts locked
+ Input       : pstWq --- work queue
+ Output      : None
+ Return      : None
+ *****************************************************************************/
+LITE_OS_SEC_TEXT static VOID osWorkDelayExpire(WORKQUEUE_CB_S *pstWq)
+{
+    WORK_S *pstWork;
+    UINT32 uwNow = (UINT32)LOS_TickCountGet();
+
+    while (!LOS_ListEmpty(&pstWq->stDelayList))
+    {
+        pstWork = LOS_DL_LIST_ENTRY(pstWq->stDelayList.pstNext, WORK_S, stList); /*lint !e413*/
+        if ((INT32)(pstWork->uwExpire - uwNow) > 0)
+        {
+            break;
+        }
+        LOS_ListDelete(&pstWork->stList);
+        pstWork->usState = OS_WORK_PENDING;
+        LOS_ListTailInsert(&pstWq->stPendList, &pstWork->stList);
+    }
+}
+
+/*****************************************************************************
+ Function    : osWorkDelayTimeout
+ Description : Ticks until the first delayed work is due, with interrupts locked
+ Input       : pstWq --- work queue
+ Output      : None
+ Return      : Timeout for the worker to wait
+ *****************************************************************************/
+LITE_OS_SEC_TEXT static UINT32 osWorkDelayTimeout(WORKQUEUE_CB_S *pstWq)
+{
+    WORK_S *pstWork;
+    INT32 swLeft;
+
+    if (LOS_ListEmpty(&pstWq->stDelayList))
+    {
+        return LOS_WAIT_FOREVER;
+    }
+
+    pstWork = LOS_DL_LIST_ENTRY(pstWq->stDelayList.pstNext, WORK_S, stList); /*lint !e413*/
+    swLeft = (INT32)(pstWork->uwExpire - (UINT32)LOS_TickCountGet());
+    return (swLeft > 0) ? (UINT32)swLeft : 1;
+}
+
+/*****************************************************************************
+ Function    : osWorkQueueTask
+ Description : Worker task, runs the work of one work queue
+ Input       : uwArg --- work queue ID and worker index
+ Output      : None
+ Return      : Never returns
+ *****************************************************************************/
+LITE_OS_SEC_TEXT static VOID *osWorkQueueTask(UINT32 uwArg)
+{
+    WORKQUEUE_CB_S *pstWq = &g_astWorkQueue[OS_WORKQUEUE_ARG_ID(uwArg)];
+    UINT32 uwIdx = OS_WORKQUEUE_ARG_IDX(uwArg);
+    WORK_S *pstWork;
+    WORK_FUNC pfnFunc;
+    UINT32 uwWorkArg;
+    UINT32 uwTimeout;
+    UINTPTR uvIntSave;
+
+    for (;;)
+    {
+        uvIntSave = LOS_IntLock();
+        osWorkDelayExpire(pstWq);
+        if (LOS_ListEmpty(&pstWq->stPendList))
+        {
+            uwTimeout = osWorkDelayTimeout(pstWq);
+            LOS_IntRestore(uvIntSave);
+            (VOID)LOS_SemPend(pstWq->uwSemID, uwTimeout);
+            continue;
+        }
+
+        pstWork = LOS_DL_LIST_ENTRY(pstWq->stPendList.pstNext, WORK_S, stList); /*lint !e413*/
+        LOS_ListDelete(&pstWork->stList);
+        pstWork->usState = 0;
+        pfnFunc = pstWork->pfnFunc;
+        uwWorkArg = pstWork->uwArg;
+        pstWq->apstRunning[uwIdx] = pstWork;
+        LOS_IntRestore(uvIntSave);
+
+        /* the work may be freed or submitted again by its own function, do not touch it afterwards */
+        pfnFunc(uwWorkArg);
+
+        uvIntSave = LOS_IntLock();
+        pstWq->apstRunning[uwIdx] = (WORK_S *)NULL;
+        LOS_IntRestore(uvIntSave);
+    }
+
+    return NULL;
+}
+
+/*****************************************************************************
+ Function    : osWorkQueueIsUsed
+ Description : Check a work queue ID
+ Input       : uwWqID --- work queue ID
+ Output      : None
+ Return      : TRUE if the work queue exists
+ *****************************************************************************/
+LITE_OS_SEC_TEXT static inline BOOL osWorkQueueIsUsed(UINT32 uwWqID)
+{
+    return (BOOL)((uwWqID < LOSCFG_KERNEL_WORKQUEUE_LIMIT) && (g_astWorkQueue[uwWqID].usState == OS_WORKQUEUE_USED));
+}
+
+/*****************************************************************************
+ Function    : osWorkQueueWorkersDelete
+ Description : Delete the first usWorkers workers and the semaphore of a work queue
+ Input       : pstWq     --- work queue
+               usWorkers --- number of workers created
+ Output      : None
+ Return      : None
+ *****************************************************************************/
+LITE_OS_SEC_TEXT static VOID osWorkQueueWorkersDelete(WORKQUEUE_CB_S *pstWq, UINT16 usWorkers)
+{
+    UINT16 usIdx;
+
+    for (usIdx = 0; usIdx < usWorkers; usIdx++)
+    {
+        (VOID)LOS_TaskDelete(pstWq->auwWorkerID[usIdx]);
+    }
+    (VOID)LOS_SemDelete(pstWq->uwSemID);
+}
+
+/*****************************************************************************
+ Function    : LOS_WorkInit
+ Description : Initialize a work item
+ Input       : pfnFunc --- work function
+               uwArg   --- argument of the work function
+ Output      : pstWork --- work item
+ Return      : LOS_OK on success or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT UINT32 LOS_WorkInit(WORK_S *pstWork, WORK_FUNC pfnFunc, UINT32 uwArg)
+{
+    if ((NULL == pstWork) || (NULL == pfnFunc))
+    {
+        return LOS_ERRNO_WORKQUEUE_PTR_NULL;
+    }
+
+    LOS_ListInit(&pstWork->stList);
+    pstWork->pfnFunc  = pfnFunc;
+    pstWork->uwArg    = uwArg;
+    pstWork->uwExpire = 0;
+    pstWork->usWqID   = 0;
+    pstWork->usState  = 0;
+
+    return LOS_OK;
+}
+
+/*****************************************************************************
+ Function    : LOS_WorkQueueCreate
+ Description : Create a work queue
+ Input       : pcName      --- name of the worker tasks
+               usPriority  --- priority of the worker tasks
+               usWorkers   --- number of worker tasks
+               uwStackSize --- stack size of each worker task
+ Output      : puwWqID     --- work queue ID
+ Return      : LOS_OK on success or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_INIT UINT32 LOS_WorkQueueCreate(CHAR *pcName, UINT16 usPriority, UINT16 usWorkers,
+                                                 UINT32 uwStackSize, UINT32 *puwWqID)
+{
+    WORKQUEUE_CB_S *pstWq = (WORKQUEUE_CB_S *)NULL;
+    TSK_INIT_PARAM_S stTask;
+    UINTPTR uvIntSave;
+    UINT32 uwWqID;
+    UINT16 usIdx;
+
+    if ((NULL == pcName) || (NULL == puwWqID))
+    {
+        return LOS_ERRNO_WORKQUEUE_PTR_NULL;
+    }
+
+    if ((0 == usWorkers) || (usWorkers > LOSCFG_KERNEL_WORKQUEUE_WORKER_LIMIT))
+    {
+        return LOS_ERRNO_WORKQUEUE_WORKER_INVALID;
+    }
+
+    uvIntSave = LOS_IntLock();
+    for (uwWqID = 0; uwWqID < LOSCFG_KERNEL_WORKQUEUE_LIMIT; uwWqID++)
+    {
+        if (g_astWorkQueue[uwWqID].usState == OS_WORKQUEUE_UNUSED)
+        {
+            pstWq = &g_astWorkQueue[uwWqID];
+            pstWq->usState = OS_WORKQUEUE_RESERVED;
+            break;
+        }
+    }
+    LOS_IntRestore(uvIntSave);
+
+    if (NULL == pstWq)
+    {
+        return LOS_ERRNO_WORKQUEUE_ALL_BUSY;
+    }
+
+    LOS_ListInit(&pstWq->stPendList);
+    LOS_ListInit(&pstWq->stDelayList);
+    pstWq->usWorkers = usWorkers;
+    for (usIdx = 0; usIdx < usWorkers; usIdx++)
+    {
+        pstWq->apstRunning[usIdx] = (WORK_S *)NULL;
+    }
+
+    if (LOS_SemCreate(0, &pstWq->uwSemID) != LOS_OK)
+    {
+        pstWq->usState = OS_WORKQUEUE_UNUSED;
+        return LOS_ERRNO_WORKQUEUE_CREATE_FAILED;
+    }
+
+    (VOID)memset(&stTask, 0, sizeof(TSK_INIT_PARAM_S));
+    stTask.pfnTaskEntry = (TSK_ENTRY_FUNC)osWorkQueueTask;
+    stTask.uwStackSize  = uwStackSize;
+    stTask.pcName       = pcName;
+    stTask.usTaskPrio   = usPriority;
+    for (usIdx = 0; usIdx < usWorkers; usIdx++)
+    {
+        stTask.uwArg = OS_WORKQUEUE_ARG(uwWqID, usIdx);
+        if (LOS_TaskCreate(&pstWq->auwWorkerID[usIdx], &stTask) != LOS_OK)
+        {
+            osWorkQueueWorkersDelete(pstWq, usIdx);
+            pstWq->usState = OS_WORKQUEUE_UNUSED;
+            return LOS_ERRNO_WORKQUEUE_CREATE_FAILED;
+        }
+    }
+
+    pstWq->usState = OS_WORKQUEUE_USED;
+    *puwWqID = uwWqID;
+
+    return LOS_OK;
+}
+
+/*****************************************************************************
+ Function    : LOS_WorkQueueDelete
+ Description : Delete an idle work queue
+ Input       : uwWqID --- work queue ID
+ Output      : None
+ Return      : LOS_OK on success or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_INIT UINT32 LOS_WorkQueueDelete(UINT32 uwWqID)
+{
+    WORKQUEUE_CB_S *pstWq;
+    UINTPTR uvIntSave;
+    UINT32 uwCurTaskID;
+    UINT16 usIdx;
+
+    if ((LOS_WORKQUEUE_SYS == uwWqID) || (uwWqID >= LOSCFG_KERNEL_WORKQUEUE_LIMIT))
+    {
+        return LOS_ERRNO_WORKQUEUE_ID_INVALID;
+    }
+
+    if (OS_INT_ACTIVE)
+    {
+        return LOS_ERRNO_WORKQUEUE_CONTEXT_INVALID;
+    }
+
+    pstWq = &g_astWorkQueue[uwWqID];
+    uwCurTaskID = LOS_CurTaskIDGet();
+
+    uvIntSave = LOS_IntLock();
+    if (pstWq->usState != OS_WORKQUEUE_USED)
+    {
+        LOS_IntRestore(uvIntSave);
+        return LOS_ERRNO_WORKQUEUE_ID_INVALID;
+    }
+
+    for (usIdx = 0; usIdx < pstWq->usWorkers; usIdx++)
+    {
+        if (pstWq->auwWorkerID[usIdx] == uwCurTaskID)
+        {
+            LOS_IntRestore(uvIntSave);
+            return LOS_ERRNO_WORKQUEUE_CONTEXT_INVALID;
+        }
+        if (pstWq->apstRunning[usIdx] != NULL)
+        {
+            LOS_IntRestore(uvIntSave);
+            return LOS_ERRNO_WORKQUEUE_BUSY;
+        }
+    }
+
+    if (!LOS_ListEmpty(&pstWq->stPendList) || !LOS_ListEmpty(&pstWq->stDelayList))
+    {
+        LOS_IntRestore(uvIntSave);
+        return LOS_ERRNO_WORKQUEUE_BUSY;
+    }
+
+    /* refuse new work while the workers are deleted */
+    pstWq->usState = OS_WORKQUEUE_RESERVED;
+    LOS_IntRestore(uvIntSave);
+
+    osWorkQueueWorkersDelete(pstWq, pstWq->usWorkers);
+    pstWq->usState = OS_WORKQUEUE_UNUSED;
+
+    return LOS_OK;
+}
+
+/*****************************************************************************
+ Function    : LOS_WorkQueueSubmitDelayed
+ Description : Queue work after a delay
+ Input       : uwWqID  --- work queue ID
+               pstWork --- work item
+               uwDelay --- delay in ticks
+ Output      : None
+ Return      : LOS_OK on success or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT UINT32 LOS_WorkQueueSubmitDelayed(UINT32 uwWqID, WORK_S *pstWork, UINT32 uwDelay)
+{
+    WORKQUEUE_CB_S *pstWq;
+    WORK_S *pstNext;
+    LOS_DL_LIST *pstPos;
+    UINTPTR uvIntSave;
+    BOOL bWake = TRUE;
+
+    OS_INT_PRIO_CHECK();
+
+    if (NULL == pstWork)
+    {
+        return LOS_ERRNO_WORKQUEUE_PTR_NULL;
+    }
+
+    uvIntSave = LOS_IntLock();
+    if (!osWorkQueueIsUsed(uwWqID))
+    {
+        LOS_IntRestore(uvIntSave);
+        return LOS_ERRNO_WORKQUEUE_ID_INVALID;
+    }
+
+    if (pstWork->usState & (OS_WORK_PENDING | OS_WORK_DELAYED))
+    {
+        LOS_IntRestore(uvIntSave);
+        return LOS_ERRNO_WORKQUEUE_WORK_PENDING;
+    }
+
+    pstWq = &g_astWorkQueue[uwWqID];
+    pstWork->usWqID = (UINT16)uwWqID;
+    if (0 == uwDelay)
+    {
+        pstWork->usState = OS_WORK_PENDING;
+        LOS_ListTailInsert(&pstWq->stPendList, &pstWork->stList);
+    }
+    else
+    {
+        pstWork->usState = OS_WORK_DELAYED;
+        pstWork->uwExpire = (UINT32)LOS_TickCountGet() + uwDelay;
+
+        /* keep the list sorted, work with the same expiry runs in submission order */
+        for (pstPos = pstWq->stDelayList.pstNext; pstPos != &pstWq->stDelayList; pstPos = pstPos->pstNext)
+        {
+            pstNext = LOS_DL_LIST_ENTRY(pstPos, WORK_S, stList); /*lint !e413*/
+            if ((INT32)(pstNext->uwExpire - pstWork->uwExpire) > 0)
+            {
+                break;
+            }
+        }
+        LOS_ListTailInsert(pstPos, &pstWork->stList);
+
+        /* a worker only has to recompute its timeout when the first expiry changes */
+        bWake = (BOOL)(pstWq->stDelayList.pstNext == &pstWork->stList);
+    }
+    LOS_IntRestore(uvIntSave);
+
+    if (bWake)
+    {
+        (VOID)LOS_SemPost(pstWq->uwSemID);
+    }
+
+    return LOS_OK;
+}
+
+/*****************************************************************************
+ Function    : LOS_WorkQueueSubmit
+ Description : Queue work
+ Input       : uwWqID  --- work queue ID
+               pstWork --- work item
+ Output      : None
+ Return      : LOS_OK on success or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT UINT32 LOS_WorkQueueSubmit(UINT32 uwWqID, WORK_S *pstWork)
+{
+    return LOS_WorkQueueSubmitDelayed(uwWqID, pstWork, 0);
+}
+
+/*****************************************************************************
+ Function    : LOS_WorkCancel
+ Description : Remove work from its work queue
+ Input       : pstWork --- work item
+ Output      : None
+ Return      : LOS_OK if the work is neither queued nor running, or error code
+ *****************************************************************************/
+LITE_OS_SEC_TEXT UINT32 LOS_WorkCancel(WORK_S *pstWork)
+{
+    WORKQUEUE_CB_S *pstWq;
+    UINTPTR uvIntSave;
+    UINT32 uwRet = LOS_OK;
+    UINT16 usIdx;
+
+    OS_INT_PRIO_CHECK();
+
+    if (NULL == pstWork)
+    {
+        return LOS_ERRNO_WORKQUEUE_PTR_NULL;
+    }
+
+    uvIntSave = LOS_IntLock();
+    if (pstWork->usState & (OS_WORK_PENDING | OS_WORK_DELAYED))
+    {
+        LOS_ListDelete(&pstWork->stList);
+        pstWork->usState = 0;
+    }
+
+    pstWq = &g_astWorkQueue[pstWork->usWqID];
+    for (usIdx = 0; usIdx < pstWq->usWorkers; usIdx++)
+    {
+        if (pstWq->apstRunning[usIdx] == pstWork)
+        {
+            uwRet = LOS_ERRNO_WORKQUEUE_WORK_RUNNING;
+            break;
+        }
+    }
+    LOS_IntRestore(uvIntSave);
+
+    return uwRet;
+}
+
+/*****************************************************************************
+ Function    : osWorkHwiEntry
+ Description : Interrupt handler of the threaded interrupts, runs the top half
+ Input       : None
+ Output      : None
+ Return      : None
+ *****************************************************************************/
+LITE_OS_SEC_TEXT static VOID osWorkHwiEntry(VOID)
+{
+    HWI_HANDLE_T uwHwiNum = osIntNumGet() - OS_SYS_VECTOR_CNT;
+    WORK_HWI_S *pstHwi;
+    UINT32 uwIdx;
+
+    for (uwIdx = 0; uwIdx < LOSCFG_KERNEL_WORKQUEUE_HWI_LIMIT; uwIdx++)
+    {
+        pstHwi = &g_astWorkHwi[uwIdx];
+        if (pstHwi->usUsed && (pstHwi->uwHwiNum == uwHwiNum))
+        {
+            if ((NULL == pstHwi->pfnTop) || (LOS_HWI_WAKE_THREAD == pstHwi->pfnTop(pstHwi->uwArg)))
+            {
+                /* keep the source masked until the threaded handler has served it */
+                nvicClrIRQ(uwHwiNum);
+                (VOID)LOS_WorkQueueSubmit(pstHwi->usWqID, &pstHwi->stWork);
+            }
+            return;
+        }
+    }
+}
+
+/*****************************************************************************
+ Function    : osWorkHwiThread
+ Description : Work function of the threaded interrupts, runs the threaded handler
+ Input       : uwIdx --- threaded interrupt slot
+ Output      : None
+ Return      : None
+ *****************************************************************************/
+LITE_OS_SEC_TEXT static VOID osWorkHwiThread(UINT32 uwIdx)
+{
+    WORK_HWI_S *pstHwi = &g_astWorkHwi[uwIdx];
+    HWI_HANDLE_T uwHwiNum = pstHwi->uwHwiNum;
+
+    pstHwi->pfnThread(pstHwi->uwArg);
+    nvicSetIRQ(uwHwiNum);
+}
+
+/*****************************************************************************
+ Function    : LOS_HwiCreateThreaded
+ Description : Create a hardware interrupt with a threaded handler
+ Input       : uwHwiNum  --- hwi num to create
+               usHwiPrio --- priority of the hwi
+               pfnTop    --- top half, may be NULL
+               pfnThread --- threaded handler
+               uwArg     --- argument of both handlers
+               uwWqID    --- work queue running the threaded handler
+ Output      : None
+ Return      : LOS_OK on success or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_INIT UINT32 LOS_HwiCreateThreaded(HWI_HANDLE_T uwHwiNum, HWI_PRIOR_T usHwiPrio, HWI_TOP_FUNC pfnTop,
+                                                   HWI_THREAD_FUNC pfnThread, HWI_ARG_T uwArg, UINT32 uwWqID)
+{
+    WORK_HWI_S *pstHwi = (WORK_HWI_S *)NULL;
+    UINTPTR uvIntSave;
+    UINT32 uwIdx;
+    UINT32 uwRet;
+
+    if (NULL == pfnThread)
+    {
+        return LOS_ERRNO_WORKQUEUE_PTR_NULL;
+    }
+
+    if (!osWorkQueueIsUsed(uwWqID))
+    {
+        return LOS_ERRNO_WORKQUEUE_ID_INVALID;
+    }
+
+#if (LOSCFG_ARCH_INT_LOCK_BASEPRI == YES)
+    /* the top half calls the kernel, it cannot live above the kernel mask */
+    if (usHwiPrio < LOSCFG_ARCH_INT_LOCK_BASEPRI_PRIO)
+    {
+        return OS_ERRNO_HWI_PRIO_INVALID;
+    }
+#endif
+
+    uvIntSave = LOS_IntLock();
+    for (uwIdx = 0; uwIdx < LOSCFG_KERNEL_WORKQUEUE_HWI_LIMIT; uwIdx++)
+    {
+        if (!g_astWorkHwi[uwIdx].usUsed)
+        {
+            pstHwi = &g_astWorkHwi[uwIdx];
+            break;
+        }
+    }
+
+    if (NULL == pstHwi)
+    {
+        LOS_IntRestore(uvIntSave);
+        return LOS_ERRNO_WORKQUEUE_HWI_ALL_BUSY;
+    }
+
+    (VOID)LOS_WorkInit(&pstHwi->stWork, osWorkHwiThread, uwIdx);
+    pstHwi->pfnTop    = pfnTop;
+    pstHwi->pfnThread = pfnThread;
+    pstHwi->uwArg     = uwArg;
+    pstHwi->uwHwiNum  = uwHwiNum;
+    pstHwi->usWqID    = (UINT16)uwWqID;
+    pstHwi->usUsed    = TRUE;
+    LOS_IntRestore(uvIntSave);
+
+    uwRet = LOS_HwiCreate(uwHwiNum, usHwiPrio, 0, osWorkHwiEntry, uwArg);
+    if (uwRet != LOS_OK)
+    {
+        pstHwi->usUsed = FALSE;
+    }
+
+    return uwRet;
+}
+
+/*****************************************************************************
+ Function    : LOS_HwiDeleteThreaded
+ Description : Delete a hardware interrupt created with LOS_HwiCreateThreaded
+ Input       : uwHwiNum --- hwi num to delete
+ Output      : None
+ Return      : LOS_OK on success or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_INIT UINT32 LOS_HwiDeleteThreaded(HWI_HANDLE_T uwHwiNum)
+{
+    WORK_HWI_S *pstHwi = (WORK_HWI_S *)NULL;
+    UINT32 uwIdx;
+
+    for (uwIdx = 0; uwIdx < LOSCFG_KERNEL_WORKQUEUE_HWI_LIMIT; uwIdx++)
+    {
+        if (g_astWorkHwi[uwIdx].usUsed && (g_astWorkHwi[uwIdx].uwHwiNum == uwHwiNum))
+        {
+            pstHwi = &g_astWorkHwi[uwIdx];
+            break;
+        }
+    }
+
+    if (NULL == pstHwi)
+    {
+        return LOS_ERRNO_WORKQUEUE_HWI_NOT_CREATED;
+    }
+
+    /* a running threaded handler enables the interrupt again when it returns */
+    nvicClrIRQ(uwHwiNum);
+    if (LOS_WorkCancel(&pstHwi->stWork) != LOS_OK)
+    {
+        return LOS_ERRNO_WORKQUEUE_WORK_RUNNING;
+    }
+
+    (VOID)LOS_HwiDelete(uwHwiNum);
+    pstHwi->usUsed = FALSE;
+
+    return LOS_OK;
+}
+
+/*****************************************************************************
+ Function    : osWorkQueueInit
+ Description : Create the system work queue
+ Input       : None
+ Output      : None
+ Return      : LOS_OK on success or error code on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_INIT UINT32 osWorkQueueInit(VOID)
+{
+    UINT32 uwWqID;
+
+    return LOS_WorkQueueCreate("WorkQueue", LOSCFG_KERNEL_WORKQUEUE_SYS_PRIO, LOSCFG_KERNEL_WORKQUEUE_SYS_WORKERS,
+                               LOSCFG_KERNEL_WORKQUEUE_SYS_STACK_SIZE, &uwWqID);
+}
+
+#endif /* LOSCFG_KERNEL_WORKQUEUE == YES */
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* __cplusplus */
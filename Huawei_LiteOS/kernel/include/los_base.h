@@ -74,6 +74,19 @@ extern "C" {
  */
 #define LOS_WAIT_FOREVER                            0xFFFFFFFF
 
+/**
+ * @ingroup los_base
+ * Pend order of an IPC object: the tasks pending on it are woken up in the order they pended.
+ */
+#define LOS_PEND_FIFO                               0
+
+/**
+ * @ingroup los_base
+ * Pend order of an IPC object: the task with the highest priority is woken up first, tasks of equal
+ * priority are woken up in the order they pended.
+ */
+#define LOS_PEND_PRIO                               1
+
 /**
  * @ingroup los_base
  * Align the beginning of the object with the base address uwAddr, with uwBoundary bytes being the smallest unit of alignment.
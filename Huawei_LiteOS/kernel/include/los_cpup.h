@@ -0,0 +1,350 @@
+/*----------------------------------------------------------------------------
+ * Copyright (c) <2013-2015>, <Huawei Technologies Co., Ltd>
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *---------------------------------------------------------------------------*/
+/*----------------------------------------------------------------------------
+ * Notice of Export Control Law
+ * ===============================================
+ * Huawei LiteOS may be subject to applicable export control laws and regulations, which might
+ * include those applicable to Huawei LiteOS of U.S. and the country in which you are located.
+ * Import, export and usage of Huawei LiteOS in any manner by you shall be in compliance with such
+ * applicable export control laws and regulations.
+ *---------------------------------------------------------------------------*/
+
+/** @defgroup los_cpup CPU usage
+ * @ingroup kernel
+ */
+
+#ifndef _LOS_CPUP_H
+#define _LOS_CPUP_H
+
+#include "los_base.h"
+#include "los_sys.h"
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+#endif /* __cplusplus */
+
+
+/**
+ * @ingroup los_cpup
+ * CPU usage error code: The request for memory fails.
+ *
+ * Value: 0x02001e00
+ *
+ * Solution: Decrease the maximum number of tasks.
+ */
+#define LOS_ERRNO_CPUP_NO_MEMORY                LOS_ERRNO_OS_ERROR(LOS_MOD_CPUP, 0x00)
+
+/**
+ * @ingroup los_cpup
+ * CPU usage error code: The pointer to an input parameter is NULL.
+ *
+ * Value: 0x02001e01
+ *
+ * Solution: Check whether the pointer to the input parameter is usable.
+ */
+#define LOS_ERRNO_CPUP_TASK_PTR_NULL            LOS_ERRNO_OS_ERROR(LOS_MOD_CPUP, 0x01)
+
+/**
+ * @ingroup los_cpup
+ * CPU usage error code: The CPU usage is not initialized.
+ *
+ * Value: 0x02001e02
+ *
+ * Solution: Check whether the CPU usage is initialized.
+ */
+#define LOS_ERRNO_CPUP_NO_INIT                  LOS_ERRNO_OS_ERROR(LOS_MOD_CPUP, 0x02)
+
+/**
+ * @ingroup los_cpup
+ * CPU usage error code: The number of threads is invalid.
+ *
+ * Value: 0x02001e03
+ *
+ * Solution: Check whether the number of threads is applicable for the current operation.
+ */
+#define LOS_ERRNO_CPUP_MAXNUM_INVALID           LOS_ERRNO_OS_ERROR(LOS_MOD_CPUP, 0x03)
+
+/**
+ * @ingroup los_cpup
+ * CPU usage error code: The target thread is not created.
+ *
+ * Value: 0x02001e04
+ *
+ * Solution: Check whether the target thread is created.
+ */
+#define LOS_ERRNO_CPUP_THREAD_NO_CREATED        LOS_ERRNO_OS_ERROR(LOS_MOD_CPUP, 0x04)
+
+/**
+ * @ingroup los_cpup
+ * CPU usage error code: The target task ID is invalid.
+ *
+ * Value: 0x02001e05
+ *
+ * Solution: Check whether the target task ID is applicable for the current operation.
+ */
+#define LOS_ERRNO_CPUP_TSK_ID_INVALID           LOS_ERRNO_OS_ERROR(LOS_MOD_CPUP, 0x05)
+
+/**
+ * @ingroup los_cpup
+ * CPU usage error code: The interrupt number is invalid or interrupt accounting is not configured.
+ *
+ * Value: 0x02001e06
+ *
+ * Solution: Pass in an interrupt number below OS_CPUP_HWI_NUM and set LOSCFG_BASE_CORE_CPUP_HWI to YES.
+ */
+#define LOS_ERRNO_CPUP_HWI_NUM_INVALID          LOS_ERRNO_OS_ERROR(LOS_MOD_CPUP, 0x06)
+
+/**
+ * @ingroup los_cpup
+ * CPU usage error code: The usage mode is invalid.
+ *
+ * Value: 0x02001e07
+ *
+ * Solution: Pass in CPUP_LAST_TEN_SECONDS, CPUP_LAST_ONE_SECONDS or CPUP_ALL_TIME.
+ */
+#define LOS_ERRNO_CPUP_MODE_INVALID             LOS_ERRNO_OS_ERROR(LOS_MOD_CPUP, 0x07)
+
+/**
+ * @ingroup los_cpup
+ * Full scale of a usage value: 1000 means 100 percent.
+ */
+#define LOS_CPUP_PRECISION                      1000
+
+/**
+ * @ingroup los_cpup
+ * Divisor turning a usage value into percent, the remainder being the tenths.
+ */
+#define LOS_CPUP_PRECISION_MULT                 (LOS_CPUP_PRECISION / 100)
+
+/**
+ * @ingroup los_cpup
+ * Usage mode: the last ten seconds.
+ */
+#define CPUP_LAST_TEN_SECONDS                   0
+
+/**
+ * @ingroup los_cpup
+ * Usage mode: the last second.
+ */
+#define CPUP_LAST_ONE_SECONDS                   1
+
+/**
+ * @ingroup los_cpup
+ * Usage mode: since initialization or the last LOS_CpupReset.
+ */
+#define CPUP_ALL_TIME                           0xffff
+
+/**
+ * @ingroup los_cpup
+ * CPU usage of a task.
+ */
+typedef struct tagCpupInfo
+{
+    UINT16 usStatus;            /**< Task status, OS_TASK_STATUS_UNUSED if the entry is not valid */
+    UINT32 uwUsage;             /**< Usage, in units of 1/LOS_CPUP_PRECISION */
+} CPUP_INFO_S;
+
+/**
+ *@ingroup los_cpup
+ *@brief Obtain the CPU usage of the system.
+ *
+ *@par Description:
+ *This API is used to obtain the CPU usage of the system since initialization or the last reset.
+ *@attention
+ *<ul>
+ *<li>The usage is the share of time not spent in the idle task.</li>
+ *</ul>
+ *
+ *@param None.
+ *
+ *@retval #LOS_ERRNO_CPUP_NO_INIT             The CPU usage is not initialized.
+ *@retval #UINT32                             [0, LOS_CPUP_PRECISION], the CPU usage of the system.
+ *@par Dependency:
+ *<ul><li>los_cpup.h: the header file that contains the API declaration.</li></ul>
+ *@see LOS_HistorySysCpuUsage
+ *@since Huawei LiteOS V100R001C00
+ */
+extern UINT32 LOS_SysCpuUsage(VOID);
+
+/**
+ *@ingroup los_cpup
+ *@brief Obtain the CPU usage of the system over a window.
+ *
+ *@par Description:
+ *This API is used to obtain the CPU usage of the system over the last second, the last ten seconds, or all the time.
+ *@attention
+ *<ul>
+ *<li>The windows are sampled once a second, so a window ends at the latest sample.</li>
+ *<li>Until the first samples are taken a window covers the time since initialization.</li>
+ *</ul>
+ *
+ *@param usMode [IN] CPUP_LAST_ONE_SECONDS, CPUP_LAST_TEN_SECONDS or CPUP_ALL_TIME.
+ *
+ *@retval #LOS_ERRNO_CPUP_NO_INIT             The CPU usage is not initialized.
+ *@retval #LOS_ERRNO_CPUP_MODE_INVALID        Invalid mode.
+ *@retval #UINT32                             [0, LOS_CPUP_PRECISION], the CPU usage of the system.
+ *@par Dependency:
+ *<ul><li>los_cpup.h: the header file that contains the API declaration.</li></ul>
+ *@see LOS_SysCpuUsage
+ *@since Huawei LiteOS V100R001C00
+ */
+extern UINT32 LOS_HistorySysCpuUsage(UINT16 usMode);
+
+/**
+ *@ingroup los_cpup
+ *@brief Obtain the CPU usage of a task.
+ *
+ *@par Description:
+ *This API is used to obtain the CPU usage of a task since initialization or the last reset.
+ *@attention
+ *<ul>
+ *<li>The task must be created.</li>
+ *</ul>
+ *
+ *@param uwTaskID [IN] Task ID.
+ *
+ *@retval #LOS_ERRNO_CPUP_NO_INIT             The CPU usage is not initialized.
+ *@retval #LOS_ERRNO_CPUP_TSK_ID_INVALID      Invalid task ID.
+ *@retval #LOS_ERRNO_CPUP_THREAD_NO_CREATED   The task is not created.
+ *@retval #UINT32                             [0, LOS_CPUP_PRECISION], the CPU usage of the task.
+ *@par Dependency:
+ *<ul><li>los_cpup.h: the header file that contains the API declaration.</li></ul>
+ *@see LOS_HistoryTaskCpuUsage
+ *@since Huawei LiteOS V100R001C00
+ */
+extern UINT32 LOS_TaskCpuUsage(UINT32 uwTaskID);
+
+/**
+ *@ingroup los_cpup
+ *@brief Obtain the CPU usage of a task over a window.
+ *
+ *@par Description:
+ *This API is used to obtain the CPU usage of a task over the last second, the last ten seconds, or all the time.
+ *@attention
+ *<ul>
+ *<li>The task must be created.</li>
+ *<li>The windows are sampled once a second, so a window ends at the latest sample.</li>
+ *</ul>
+ *
+ *@param uwTaskID [IN] Task ID.
+ *@param usMode   [IN] CPUP_LAST_ONE_SECONDS, CPUP_LAST_TEN_SECONDS or CPUP_ALL_TIME.
+ *
+ *@retval #LOS_ERRNO_CPUP_NO_INIT             The CPU usage is not initialized.
+ *@retval #LOS_ERRNO_CPUP_TSK_ID_INVALID      Invalid task ID.
+ *@retval #LOS_ERRNO_CPUP_THREAD_NO_CREATED   The task is not created.
+ *@retval #LOS_ERRNO_CPUP_MODE_INVALID        Invalid mode.
+ *@retval #UINT32                             [0, LOS_CPUP_PRECISION], the CPU usage of the task.
+ *@par Dependency:
+ *<ul><li>los_cpup.h: the header file that contains the API declaration.</li></ul>
+ *@see LOS_TaskCpuUsage
+ *@since Huawei LiteOS V100R001C00
+ */
+extern UINT32 LOS_HistoryTaskCpuUsage(UINT32 uwTaskID, UINT16 usMode);
+
+/**
+ *@ingroup los_cpup
+ *@brief Obtain the CPU usage of all tasks.
+ *
+ *@par Description:
+ *This API is used to obtain the CPU usage of the first uwMaxNum tasks over a window. Entry i describes task i.
+ *@attention
+ *<ul>
+ *<li>The entries of tasks that are not created have usStatus set to OS_TASK_STATUS_UNUSED.</li>
+ *</ul>
+ *
+ *@param uwMaxNum    [IN]  Number of entries in pstCpupInfo, in [1, LOSCFG_BASE_CORE_TSK_LIMIT + 1].
+ *@param pstCpupInfo [OUT] Array receiving the usage of each task.
+ *@param usMode      [IN]  CPUP_LAST_ONE_SECONDS, CPUP_LAST_TEN_SECONDS or CPUP_ALL_TIME.
+ *
+ *@retval #LOS_ERRNO_CPUP_NO_INIT             The CPU usage is not initialized.
+ *@retval #LOS_ERRNO_CPUP_TASK_PTR_NULL       pstCpupInfo is NULL.
+ *@retval #LOS_ERRNO_CPUP_MAXNUM_INVALID      Invalid uwMaxNum.
+ *@retval #LOS_ERRNO_CPUP_MODE_INVALID        Invalid mode.
+ *@retval #LOS_OK                             The usage is obtained.
+ *@par Dependency:
+ *<ul><li>los_cpup.h: the header file that contains the API declaration.</li></ul>
+ *@see LOS_HistoryTaskCpuUsage
+ *@since Huawei LiteOS V100R001C00
+ */
+extern UINT32 LOS_AllTaskCpuUsage(UINT32 uwMaxNum, CPUP_INFO_S *pstCpupInfo, UINT16 usMode);
+
+/**
+ *@ingroup los_cpup
+ *@brief Obtain the CPU usage of an interrupt.
+ *
+ *@par Description:
+ *This API is used to obtain the share of time spent in the handler of an interrupt over a window.
+ *@attention
+ *<ul>
+ *<li>Only available with LOSCFG_BASE_CORE_CPUP_HWI set to YES.</li>
+ *<li>uwHwiNum is the exception number: the interrupt number passed to LOS_HwiCreate plus 16. The system tick is 15.</li>
+ *<li>Time spent in a nested interrupt is counted for the nested interrupt only.</li>
+ *</ul>
+ *
+ *@param uwHwiNum [IN] Exception number, in [0, OS_CPUP_HWI_NUM - 1].
+ *@param usMode   [IN] CPUP_LAST_ONE_SECONDS, CPUP_LAST_TEN_SECONDS or CPUP_ALL_TIME.
+ *
+ *@retval #LOS_ERRNO_CPUP_NO_INIT             The CPU usage is not initialized.
+ *@retval #LOS_ERRNO_CPUP_HWI_NUM_INVALID     Invalid interrupt number, or interrupt accounting not configured.
+ *@retval #LOS_ERRNO_CPUP_MODE_INVALID        Invalid mode.
+ *@retval #UINT32                             [0, LOS_CPUP_PRECISION], the CPU usage of the interrupt.
+ *@par Dependency:
+ *<ul><li>los_cpup.h: the header file that contains the API declaration.</li></ul>
+ *@see LOS_HistoryTaskCpuUsage
+ *@since Huawei LiteOS V100R001C00
+ */
+extern UINT32 LOS_HwiCpuUsage(UINT32 uwHwiNum, UINT16 usMode);
+
+/**
+ *@ingroup los_cpup
+ *@brief Reset the CPU usage.
+ *
+ *@par Description:
+ *This API is used to clear the recorded running time of all tasks and interrupts and restart the measurement.
+ *@attention
+ *<ul>
+ *<li>None.</li>
+ *</ul>
+ *
+ *@param None.
+ *
+ *@retval None.
+ *@par Dependency:
+ *<ul><li>los_cpup.h: the header file that contains the API declaration.</li></ul>
+ *@see LOS_SysCpuUsage
+ *@since Huawei LiteOS V100R001C00
+ */
+extern VOID LOS_CpupReset(VOID);
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* __cplusplus */
+
+#endif /* _LOS_CPUP_H */
@@ -155,6 +155,12 @@ enum LOS_MOUDLE_ID
     LOS_MOD_EVENT            = 0x1c,
     LOS_MOD_MUX              = 0X1d,
     LOS_MOD_CPUP             = 0x1e,
+    LOS_MOD_WORKQ            = 0x1f,
+    LOS_MOD_MULTIWAIT        = 0x20,
+    LOS_MOD_RINGBUF          = 0x21,
+    LOS_MOD_MEMREGION        = 0x22,
+    LOS_MOD_MEMSTAT          = 0x23,
+    LOS_MOD_HEAPCHECK        = 0x24,
     LOS_MOD_SHELL            = 0x31,
     LOS_MOD_BUTT
 };
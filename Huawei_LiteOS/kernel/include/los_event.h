@@ -136,6 +136,26 @@ extern "C" {
  */
 #define LOS_ERRNO_EVENT_PTR_NULL                            LOS_ERRNO_OS_ERROR(LOS_MOD_EVENT, 0x06)
 
+/**
+ * @ingroup los_event
+ * Event error code: Invalid pend order.
+ *
+ * Value: 0x02001c07
+ *
+ * Solution: Pass in LOS_PEND_FIFO or LOS_PEND_PRIO.
+ */
+#define LOS_ERRNO_EVENT_PEND_ORDER_INVALID                  LOS_ERRNO_OS_ERROR(LOS_MOD_EVENT, 0x07)
+
+/**
+ * @ingroup los_event
+ * Event error code: The event is being waited on by LOS_MultiWait and cannot be destroyed.
+ *
+ * Value: 0x02001c08
+ *
+ * Solution: Destroy the event after no task is waiting on it.
+ */
+#define LOS_ERRNO_EVENT_SHOULD_NOT_DESTORY                  LOS_ERRNO_OS_ERROR(LOS_MOD_EVENT, 0x08)
+
 /**
  * @ingroup los_event
  * Event control structure
@@ -144,6 +164,10 @@ typedef struct tagEvent
 {
     UINT32      uwEventID;      /**< Event mask in the event control block, indicating the event that has been logically processed.*/
     LOS_DL_LIST stEventList;    /**< Event control block linked list*/
+    UINT32      uwPendOrder;    /**< Order of the tasks pending on the event, LOS_PEND_FIFO or LOS_PEND_PRIO*/
+#if (LOSCFG_BASE_IPC_MULTIWAIT == YES)
+    LOS_DL_LIST stMultiWaitList;    /**< Multi-wait items of the event*/
+#endif
 } EVENT_CB_S, *PEVENT_CB_S;
 
 /**
@@ -289,8 +313,9 @@ extern UINT32 LOS_EventClear(PEVENT_CB_S pstEventCB, UINT32 uwEvents);
  *
  *@param pstEventCB     [IN/OUT] Pointer to the event control block to be Destroyed.
  *
- *@retval #LOS_ERRNO_EVENT_PTR_NULL Null pointer.
- *@retval #LOS_OK                   The event is successfully cleared.
+ *@retval #LOS_ERRNO_EVENT_PTR_NULL           Null pointer.
+ *@retval #LOS_ERRNO_EVENT_SHOULD_NOT_DESTORY Tasks are multi-waiting on the event.
+ *@retval #LOS_OK                             The event is successfully cleared.
  *@par Dependency:
  *<ul><li>los_event.h: the header file that contains the API declaration.</li></ul>
  *@see LOS_EventPoll | LOS_EventRead | LOS_EventWrite
@@ -298,6 +323,31 @@ extern UINT32 LOS_EventClear(PEVENT_CB_S pstEventCB, UINT32 uwEvents);
  */
 extern UINT32 LOS_EventDestory(PEVENT_CB_S pstEventCB);
 
+/**
+ *@ingroup los_event
+ *@brief Set the pend order of a event control block.
+ *
+ *@par Description:
+ *This API is used to set the order in which the tasks pending on a event control block are woken up.
+ *@attention
+ *<ul>
+ *<li>The tasks that are already pending are reordered.</li>
+ *<li>With LOS_PEND_PRIO a task that changes its priority while pending moves to its new place.</li>
+ *</ul>
+ *
+ *@param pstEventCB    [IN] Pointer to the event control block to be set.
+ *@param uwPendOrder   [IN] LOS_PEND_FIFO (default) or LOS_PEND_PRIO.
+ *
+ *@retval #LOS_ERRNO_EVENT_PTR_NULL         Null pointer.
+ *@retval #LOS_ERRNO_EVENT_PEND_ORDER_INVALID Invalid pend order.
+ *@retval #LOS_OK                           The pend order is successfully set.
+ *@par Dependency:
+ *<ul><li>los_event.h: the header file that contains the API declaration.</li></ul>
+ *@see LOS_EventRead
+ *@since Huawei LiteOS V100R001C00
+ */
+extern UINT32 LOS_EventPendOrderSet(PEVENT_CB_S pstEventCB, UINT32 uwPendOrder);
+
 
 #ifdef __cplusplus
 #if __cplusplus
@@ -57,10 +57,56 @@ extern "C" {
 #define DDR_HEAP_FREE(p)                LOS_HeapFree((VOID *)DDR_HEAP_START, p)
 #endif
 
+#if (LOSCFG_MEMORY_TLSF == YES)
+/**
+ * @ingroup los_heap
+ * Number of second level lists in each first level class is 2^OS_HEAP_TLSF_SL_SHIFT.
+ */
+#define OS_HEAP_TLSF_SL_SHIFT           3
+#define OS_HEAP_TLSF_SL_COUNT           (1 << OS_HEAP_TLSF_SL_SHIFT)
+
+/**
+ * @ingroup los_heap
+ * Blocks below 2^OS_HEAP_TLSF_FL_SHIFT bytes are kept in first level class 0, one list per 8 bytes.
+ */
+#define OS_HEAP_TLSF_FL_SHIFT           (OS_HEAP_TLSF_SL_SHIFT + 3)
+
+/**
+ * @ingroup los_heap
+ * Blocks must be smaller than 2^OS_HEAP_TLSF_FL_MAX bytes, LOS_HeapInit rejects a larger pool.
+ */
+#define OS_HEAP_TLSF_FL_MAX             24
+#define OS_HEAP_TLSF_FL_COUNT           (OS_HEAP_TLSF_FL_MAX - OS_HEAP_TLSF_FL_SHIFT + 1)
+#endif
+
+#if (LOSCFG_MEM_TASK_STAT == YES)
+/**
+ * @ingroup los_heap
+ * The node keeps the task a block is charged to in the top bits of its size. The task field is as narrow as
+ * LOSCFG_BASE_CORE_TSK_LIMIT allows, the size field bounds the pool: 16M up to 126 tasks, 8M up to 254, 2M up to 1022.
+ */
+#if (LOSCFG_BASE_CORE_TSK_LIMIT + 1 < (1 << 7))
+#define OS_HEAP_NODE_TASK_BITS          7
+#elif (LOSCFG_BASE_CORE_TSK_LIMIT + 1 < (1 << 8))
+#define OS_HEAP_NODE_TASK_BITS          8
+#elif (LOSCFG_BASE_CORE_TSK_LIMIT + 1 < (1 << 10))
+#define OS_HEAP_NODE_TASK_BITS          10
+#else
+#error "LOSCFG_MEM_TASK_STAT supports up to 1022 tasks"
+#endif
+#define OS_HEAP_NODE_SIZE_BITS          (31 - OS_HEAP_NODE_TASK_BITS)
+#else
+#define OS_HEAP_NODE_SIZE_BITS          31
+#endif
+#define OS_HEAP_NODE_SIZE_MAX           ((1U << OS_HEAP_NODE_SIZE_BITS) - 1)
+
 struct LOS_HEAP_NODE {
 
     struct LOS_HEAP_NODE* pstPrev;
-    UINT32 uwSize:31;
+    UINT32 uwSize:OS_HEAP_NODE_SIZE_BITS;
+#if (LOSCFG_MEM_TASK_STAT == YES)
+    UINT32 uwTaskID:OS_HEAP_NODE_TASK_BITS;
+#endif
     UINT32 uwUsed: 1;
     UINT8  ucData[];/*lint !e43*/
 };
@@ -75,6 +121,16 @@ struct LOS_HEAP_MANAGER{
 #ifdef LOSCFG_KERNEL_MEM_SLAB
     struct LOS_SLAB_CONTROL_HEADER stSlabCtrlHdr;
 #endif
+#if (LOSCFG_MEMORY_TLSF == YES)
+    UINT32 uwUsedSize;
+    UINT32 uwFlBitmap;
+    UINT32 auwSlBitmap[OS_HEAP_TLSF_FL_COUNT];
+    struct LOS_HEAP_NODE *apstFreeList[OS_HEAP_TLSF_FL_COUNT][OS_HEAP_TLSF_SL_COUNT];
+#endif
+#if (LOSCFG_MEM_BGCHECK == YES)
+    struct LOS_HEAP_NODE *pstCheckLast;     /* last block the heap check found intact, NULL to start over */
+    UINT32 uwCheckPass;
+#endif
 };
 
 extern struct LOS_HEAP_MANAGER g_stDdrHeap;
@@ -89,7 +145,8 @@ extern struct LOS_HEAP_NODE* osHeapPrvGetNext(struct LOS_HEAP_MANAGER *pstHeapMa
  *This API is used to initialization heap memory.
  *@attention
  *<ul>
- *<li>None.</li>
+ *<li>A pool whose first block would not fit in OS_HEAP_NODE_SIZE_MAX bytes, or with TLSF in 2^OS_HEAP_TLSF_FL_MAX
+ *bytes, is rejected, it is not truncated.</li>
  *</ul>
  *
  *@param pPool   [IN/OUT] A pointer pointed to the memory pool.
@@ -148,6 +205,54 @@ extern VOID* LOS_HeapAlloc(VOID *pPool, UINT32 uwSz);
  */
 extern BOOL LOS_HeapFree(VOID *pPool, VOID* pPtr);
 
+#if (LOSCFG_MEMORY_TLSF == YES)
+/**
+ *@ingroup los_heap
+ *@brief Alloc an aligned memory block from heap memory.
+ *
+ *@par Description:
+ *This API is used to alloc a memory block whose address is a multiple of uwBoundary from heap memory.
+ *@attention
+ *<ul>
+ *<li>uwBoundary must be a power of 2, a boundary not above 8 bytes is the same as #LOS_HeapAlloc.</li>
+ *</ul>
+ *
+ *@param pPool   [IN/OUT] A pointer pointed to the memory pool.
+ *@param uwSz   [IN] Size of heap memory.
+ *@param uwBoundary   [IN] Alignment of the returned address.
+ *
+ *@retval VOID*
+ *@par Dependency:
+ *<ul><li>los_heap.h: the header file that contains the API declaration.</li></ul>
+ *@see LOS_HeapFree
+ *@since Huawei LiteOS
+ */
+extern VOID* LOS_HeapAllocAlign(VOID *pPool, UINT32 uwSz, UINT32 uwBoundary);
+
+/**
+ *@ingroup los_heap
+ *@brief Resize a memory block of heap memory.
+ *
+ *@par Description:
+ *This API is used to resize a memory block, in place when the block shrinks or the block after it is free.
+ *@attention
+ *<ul>
+ *<li>When the block has to move, the old block is freed only if the new one was allocated.</li>
+ *</ul>
+ *
+ *@param pPool   [IN/OUT] A pointer pointed to the memory pool.
+ *@param pPtr   [IN] Block returned by #LOS_HeapAlloc or #LOS_HeapAllocAlign.
+ *@param uwSz   [IN] New size of the block.
+ *
+ *@retval VOID* The resized block, NULL if it could not grow.
+ *@par Dependency:
+ *<ul><li>los_heap.h: the header file that contains the API declaration.</li></ul>
+ *@see LOS_HeapAlloc
+ *@since Huawei LiteOS
+ */
+extern VOID* LOS_HeapRealloc(VOID *pPool, VOID *pPtr, UINT32 uwSz);
+#endif
+
 /**
  *@ingroup los_memory
  *@brief Get the memory info from Heap.
@@ -0,0 +1,149 @@
+/*----------------------------------------------------------------------------
+ * Copyright (c) <2013-2015>, <Huawei Technologies Co., Ltd>
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *---------------------------------------------------------------------------*/
+/*----------------------------------------------------------------------------
+ * Notice of Export Control Law
+ * ===============================================
+ * Huawei LiteOS may be subject to applicable export control laws and regulations, which might
+ * include those applicable to Huawei LiteOS of U.S. and the country in which you are located.
+ * Import, export and usage of Huawei LiteOS in any manner by you shall be in compliance with such
+ * applicable export control laws and regulations.
+ *---------------------------------------------------------------------------*/
+
+/**@defgroup los_heapcheck Heap check
+ * @ingroup kernel
+ */
+
+#ifndef _LOS_HEAPCHECK_H
+#define _LOS_HEAPCHECK_H
+
+#include "los_base.h"
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+#endif /* __cplusplus */
+
+/**
+ * @ingroup los_heapcheck
+ * Heap check error code: Null pointer.
+ *
+ * Value: 0x02002400
+ *
+ * Solution: Check whether the input parameter is null.
+ */
+#define LOS_ERRNO_HEAPCHECK_PTR_NULL                LOS_ERRNO_OS_ERROR(LOS_MOD_HEAPCHECK, 0x00)
+
+/**
+ * @ingroup los_heapcheck
+ * Heap check error code: A block header is damaged.
+ *
+ * Value: 0x02002401
+ *
+ * Solution: Look for a write past the end of the block before the damaged one.
+ */
+#define LOS_ERRNO_HEAPCHECK_NODE_DAMAGED            LOS_ERRNO_OS_ERROR(LOS_MOD_HEAPCHECK, 0x01)
+
+/**
+ * @ingroup los_heapcheck
+ * Owner reported for a free block, or when the owner of blocks is not recorded.
+ */
+#define LOS_HEAP_CHECK_NO_OWNER                     0xFFFFFFFF
+
+/**
+ * @ingroup los_heapcheck
+ * Damaged block found by the heap check.
+ */
+typedef struct tagHeapCheckInfo
+{
+    VOID    *pNode;         /**< Header of the damaged block                                    */
+    VOID    *pPrevNode;     /**< Header of the block before it, NULL for the first block        */
+    UINT32  uwOwner;        /**< Task the damaged block is charged to                           */
+    UINT32  uwPrevOwner;    /**< Task the block before it is charged to, most likely the writer */
+} LOS_HEAP_CHECK_INFO;
+
+/**
+ * @ingroup los_heapcheck
+ * @brief Check the next blocks of a heap.
+ *
+ * @par Description:
+ * This API is used to check the headers of at most uwNodeNum blocks, starting after the last block the previous call
+ * checked, and to start over at the first block after the last one. Each block is checked against its neighbours:
+ * the bounds of the pool, its link to the block before it and the merging of free blocks.
+ *
+ * @attention
+ * <ul>
+ * <li>The interrupts are locked while the blocks are checked, uwNodeNum bounds the latency.</li>
+ * <li>Blocks allocated and freed between two calls do not lose the position, a block merged into the one before it
+ * moves the position to that block.</li>
+ * <li>The owners are recorded with LOSCFG_MEM_TASK_STAT only, they are #LOS_HEAP_CHECK_NO_OWNER otherwise.</li>
+ * <li>After a damaged block is reported, the next call checks it again.</li>
+ * </ul>
+ *
+ * @param  pPool      [IN]  Type #VOID * Memory pool initialized by LOS_MemInit.
+ * @param  uwNodeNum  [IN]  Type #UINT32 Maximum number of blocks to check.
+ * @param  pstInfo    [OUT] Type #LOS_HEAP_CHECK_INFO * Damaged block, may be NULL.
+ *
+ * @retval #LOS_ERRNO_HEAPCHECK_PTR_NULL        pPool is NULL.
+ * @retval #LOS_ERRNO_HEAPCHECK_NODE_DAMAGED    A damaged block is found, it is reported in pstInfo.
+ * @retval #LOS_OK                              The blocks checked are intact.
+ * @par Dependency:
+ * <ul><li>los_heapcheck.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_HeapCheckPassGet
+ * @since Huawei LiteOS V100R001C00
+ */
+extern UINT32 LOS_HeapCheckStep(VOID *pPool, UINT32 uwNodeNum, LOS_HEAP_CHECK_INFO *pstInfo);
+
+/**
+ * @ingroup los_heapcheck
+ * @brief Get the number of complete checks of a heap.
+ *
+ * @par Description:
+ * This API is used to get how many times LOS_HeapCheckStep has reached the last block of a heap with every block
+ * intact.
+ *
+ * @attention
+ * <ul>
+ * <li>None.</li>
+ * </ul>
+ *
+ * @param  pPool      [IN]  Type #VOID * Memory pool initialized by LOS_MemInit.
+ *
+ * @retval #UINT32  Number of complete checks, 0 for a NULL pool.
+ * @par Dependency:
+ * <ul><li>los_heapcheck.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_HeapCheckStep
+ * @since Huawei LiteOS V100R001C00
+ */
+extern UINT32 LOS_HeapCheckPassGet(VOID *pPool);
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* __cplusplus */
+
+#endif /* _LOS_HEAPCHECK_H */
@@ -53,11 +53,27 @@
 extern UINT8 g_aucMemMang[];
 #endif
 
+/**
+ * @ingroup los_membox
+ * Free memory block, linked through its first word
+ */
+typedef struct tagMemBoxNode
+{
+    struct tagMemBoxNode *pstNext;
+}LOS_MEMBOX_NODE;
+
+/**
+ * @ingroup los_membox
+ * Memory pool control block, placed at the start of the memory pool and followed by the blocks
+ */
 typedef struct tagMemBoxCB
 {
     UINT32  uwMaxBlk;
     UINT32  uwBlkCnt;
-    UINT32  uwBlkSize;                  /* Memory block size                       */
+    UINT32  uwBlkSize;                  /* Memory block size, including the magic word */
+    UINT32  uwBlkPeak;                  /* High-water mark of uwBlkCnt             */
+    LOS_MEMBOX_NODE stFreeList;         /* Head of the free block list             */
+    UINT8   *pucBlkStart;               /* Address of the first block              */
 }OS_MEMBOX_S;
 
 typedef OS_MEMBOX_S * OS_MEMBOX_S_P;
@@ -68,6 +84,21 @@ typedef OS_MEMBOX_S * OS_MEMBOX_S_P;
 #define LOS_MEMBOX_MAGIC_SIZE    0
 #endif
 
+/**
+ * @ingroup los_membox
+ * Size of a block carved from the memory pool for a uwBlkSize request
+ */
+#define LOS_MEMBOX_BLK_SIZE(uwBlkSize) \
+    ((((UINT32)(uwBlkSize) + LOS_MEMBOX_MAGIC_SIZE) + sizeof(UINT32) - 1) & ~(sizeof(UINT32) - 1))
+
+/**
+ * @ingroup los_membox
+ * Memory pool size needed for uwBlkNum blocks of uwBlkSize bytes, control block included.
+ * With BOX_ALIGN_8 blocks are 8 byte multiples, round LOS_MEMBOX_BLK_SIZE up to 8 and add 4 bytes instead.
+ */
+#define LOS_MEMBOX_SIZE(uwBlkSize, uwBlkNum) \
+    (sizeof(OS_MEMBOX_S) + LOS_MEMBOX_BLK_SIZE(uwBlkSize) * (UINT32)(uwBlkNum))
+
 /**
  *@ingroup los_membox
  *@brief Initialize a memory pool.
@@ -79,11 +110,13 @@ typedef OS_MEMBOX_S * OS_MEMBOX_S_P;
  *@attention
  *<ul>
  *<li>The uwBoxSize parameter value should match the following two conditions : 1) Be less than or equal to the Memory pool size; 2) Be greater than the size of LOS_MEMBOX_INFO.</li>
+ *<li>The control block and the blocks are all carved from the memory pool, use LOS_MEMBOX_SIZE to size it.</li>
+ *<li>The memory pool address must be 4 byte aligned. Or uwBlkSize with BOX_ALIGN_8 to get 8 byte aligned blocks.</li>
  *</ul>
  *
  *@param pBoxMem     [IN] Memory pool address.
  *@param uwBoxSize   [IN] Memory pool size.
- *@param uwBlkSize   [IN] Memory block size.
+ *@param uwBlkSize   [IN] Memory block size, may be ORed with BOX_ALIGN_8.
  *
  *@retval #LOS_NOK   The memory pool fails to be initialized.
  *@retval #LOS_OK    The memory pool is successfully initialized.
@@ -107,6 +140,7 @@ extern UINT32    LOS_MemboxInit   (VOID *pBoxMem, UINT32 uwBoxSize, UINT32 uwBlk
  *@attention
  *<ul>
  *<li>The input pPool parameter must be initialized via func LOS_MemboxInit.</li>
+ *<li>This API takes O(1) time and can be called in interrupt. With LOSCFG_MEMBOX_LOCKFREE it does not lock interrupts on Cortex-M3 and above.</li>
  *</ul>
  *
  *@param pBoxMem     [IN] Memory pool address.
@@ -134,6 +168,7 @@ extern VOID *LOS_MemboxAlloc  (VOID *pBoxMem);
  *<ul>
  *<li>The input pPool parameter must be initialized via func LOS_MemboxInit.</li>
  *<li>The input pBox parameter must be allocated by LOS_MemboxAlloc.</li>
+ *<li>This API takes O(1) time and can be called in interrupt. A block freed twice is only rejected when LOS_MEMBOX_CHECK is defined.</li>
  *</ul>
  *
  *@param pBoxMem     [IN] Memory pool address.
@@ -205,4 +240,29 @@ extern VOID LOS_MemboxClr (VOID *pBoxMem, VOID *pBox);
  */
 extern UINT32 LOS_MemboxStatisticsGet(VOID *pBoxMem, UINT32 *puwMaxBlk, UINT32 *puwBlkCnt, UINT32 *puwBlkSize);
 
+/**
+ *@ingroup los_membox
+ *@brief Get the membox high-water mark.
+ *
+ *@par Description:
+ *<ul>
+ *<li>This API is used to get the largest number of blocks allocated at the same time since the membox was initialized.</li>
+ *</ul>
+ *@attention
+ *<ul>
+ *<li>The input pBoxMem parameter must be initialized via func LOS_MemboxInit.</li>
+ *</ul>
+ *
+ *@param  pBoxMem        [IN]  Type  #VOID*   Pointer to the membox.
+ *@param  puwBlkPeak     [OUT] Type  #UINT32* Record membox block count high-water mark.
+ *
+ *@retval #LOS_OK        The high-water mark is got.
+ *@retval #LOS_NOK       The input parameter is NULL.
+ *@par Dependency:
+ *<ul><li>los_membox.h: the header file that contains the API declaration.</li></ul>
+ *@see LOS_MemboxStatisticsGet
+ *@since Huawei LiteOS V100R001C00
+ */
+extern UINT32 LOS_MemboxPeakGet(VOID *pBoxMem, UINT32 *puwBlkPeak);
+
 #endif
@@ -25,6 +25,7 @@
 #define _LOS_MEMCHECK_H
 
 #include "los_base.h"
+#include "los_slab.h"
 
 #ifdef __cplusplus
 #if __cplusplus
@@ -64,7 +65,7 @@ typedef struct _SLAB_INFO
     UINT32 cur_usage;
 }SLAB_INFO;
 
-#define SLAB_CLASS_NUM                  (4U)
+#define SLAB_CLASS_NUM                  SLAB_MEM_COUNT
 typedef struct _MEM_INFO_S
 {
     UINT32 uwType;
@@ -381,6 +381,34 @@ extern UINT32 LOS_MemCheckLevelSet(UINT8 ucLevel);
 extern UINT8 LOS_MemCheckLevelGet(VOID);
 #else
 
+/**
+ *@ingroup los_memory
+ *@brief Initialize dynamic memory.
+ *
+ *@par Description:
+ *<ul>
+ *<li>This API is used to initialize a memory pool.</li>
+ *</ul>
+ *@attention
+ *<ul>
+ *<li>The parameter input must be four byte-aligned.</li>
+ *<li>The init area [pPool, pPool + uwSize] should not conflict with other pools.</li>
+ *</ul>
+ *
+ *@param pPool          [IN] Starting address of memory.
+ *@param uwSize         [IN] Memory size.
+ *
+ *@retval #LOS_NOK    The dynamic memory fails to be initialized.
+ *@retval #LOS_OK     The dynamic memory is successfully initialized.
+ *@par Dependency:
+ *<ul>
+ *<li>los_memory.h: the header file that contains the API declaration.</li>
+ *</ul>
+ *@see None.
+ *@since Huawei LiteOS V100R001C00
+ */
+extern UINT32 LOS_MemInit(VOID *pPool, UINT32 uwSize);
+
 /**
  *@ingroup los_memory
  *@brief calculate heap information.
@@ -429,6 +457,38 @@ extern UINT32 LOS_MemStatisticsGet(VOID *pPool, LOS_MEM_STATUS *pstStatus);
  *@since Huawei LiteOS V100R001C00
  */
 extern UINT32 LOS_MemGetMaxFreeBlkSize(VOID *pPool);
+
+#if (LOSCFG_MEMORY_TLSF == YES)
+#if (LOSCFG_BASE_MEM_NODE_INTEGRITY_CHECK == YES)
+#define OS_MEM_ENABLE_ALLOC_CHECK
+#endif
+
+/**
+ *@ingroup los_memory
+ *@brief Check the memory pool Integrity.
+ *
+ *@par Description:
+ *<ul>
+ *<li>This API is used to check the block list and the free lists of a TLSF memory pool.</li>
+ *</ul>
+ *@attention
+ *<ul>
+ *<li>The input pPool parameter must be initialized via func LOS_MemInit.</li>
+ *<li>LOS_MemIntegrityCheck will be called by malloc function when the macro of LOSCFG_BASE_MEM_NODE_INTEGRITY_CHECK is defined in LiteOS,
+ *which makes allocation linear in the number of blocks, so enable it for debugging only.</li>
+ *</ul>
+ *
+ *@param  pPool              [IN] A pointer pointed to the memory pool.
+ *
+ *@retval #LOS_NOK           The memory pool (pPool) is impaired.
+ *@retval #LOS_OK            The memory pool (pPool) is integrated.
+ *@par Dependency:
+ *<ul><li>los_memory.h: the header file that contains the API declaration.</li></ul>
+ *@see None.
+ *@since Huawei LiteOS
+ */
+extern UINT32 LOS_MemIntegrityCheck(VOID *pPool);
+#endif
 #endif
 
 
@@ -0,0 +1,301 @@
+/*----------------------------------------------------------------------------
+ * Copyright (c) <2013-2015>, <Huawei Technologies Co., Ltd>
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *---------------------------------------------------------------------------*/
+/*----------------------------------------------------------------------------
+ * Notice of Export Control Law
+ * ===============================================
+ * Huawei LiteOS may be subject to applicable export control laws and regulations, which might
+ * include those applicable to Huawei LiteOS of U.S. and the country in which you are located.
+ * Import, export and usage of Huawei LiteOS in any manner by you shall be in compliance with such
+ * applicable export control laws and regulations.
+ *---------------------------------------------------------------------------*/
+
+/**@defgroup los_memregion Memory region
+ * @ingroup kernel
+ */
+
+#ifndef _LOS_MEMREGION_H
+#define _LOS_MEMREGION_H
+
+#include "los_base.h"
+#include "los_memory.h"
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+#endif /* __cplusplus */
+
+/**
+ * @ingroup los_memregion
+ * Memory region error code: Null pointer.
+ *
+ * Value: 0x02002200
+ *
+ * Solution: Check whether the input parameter is null.
+ */
+#define LOS_ERRNO_MEMREGION_PTR_NULL                LOS_ERRNO_OS_ERROR(LOS_MOD_MEMREGION, 0x00)
+
+/**
+ * @ingroup los_memregion
+ * Memory region error code: The pool cannot hold a memory pool, or overlaps a registered region.
+ *
+ * Value: 0x02002201
+ *
+ * Solution: Pass in a 4-byte aligned pool that is not registered yet and is large enough for the pool header.
+ */
+#define LOS_ERRNO_MEMREGION_POOL_INVALID            LOS_ERRNO_OS_ERROR(LOS_MOD_MEMREGION, 0x01)
+
+/**
+ * @ingroup los_memregion
+ * Memory region error code: The attributes are invalid.
+ *
+ * Value: 0x02002202
+ *
+ * Solution: Combine only the LOS_MEM_REGION_FAST, LOS_MEM_REGION_DMA and LOS_MEM_REGION_LARGE attributes.
+ */
+#define LOS_ERRNO_MEMREGION_ATTR_INVALID            LOS_ERRNO_OS_ERROR(LOS_MOD_MEMREGION, 0x02)
+
+/**
+ * @ingroup los_memregion
+ * Memory region error code: All region slots are in use.
+ *
+ * Value: 0x02002203
+ *
+ * Solution: Increase LOSCFG_MEM_REGION_LIMIT.
+ */
+#define LOS_ERRNO_MEMREGION_ALL_BUSY                LOS_ERRNO_OS_ERROR(LOS_MOD_MEMREGION, 0x03)
+
+/**
+ * @ingroup los_memregion
+ * Memory region error code: The region ID is invalid.
+ *
+ * Value: 0x02002204
+ *
+ * Solution: Pass in an ID returned by LOS_MemRegionAdd.
+ */
+#define LOS_ERRNO_MEMREGION_ID_INVALID              LOS_ERRNO_OS_ERROR(LOS_MOD_MEMREGION, 0x04)
+
+/**
+ * @ingroup los_memregion
+ * Memory region error code: The memory does not belong to a region, or the region pool rejects it.
+ *
+ * Value: 0x02002205
+ *
+ * Solution: Pass in memory returned by LOS_MemRegionAlloc or LOS_MemRegionAllocAlign that is not freed yet.
+ */
+#define LOS_ERRNO_MEMREGION_MEM_INVALID             LOS_ERRNO_OS_ERROR(LOS_MOD_MEMREGION, 0x05)
+
+/**
+ * @ingroup los_memregion
+ * Region attribute: zero wait-state memory such as the core coupled memory of the STM32F4. Such memory is usually
+ * not reachable by the DMA controllers.
+ */
+#define LOS_MEM_REGION_FAST                         0x01
+
+/**
+ * @ingroup los_memregion
+ * Region attribute: memory the DMA controllers can access.
+ */
+#define LOS_MEM_REGION_DMA                          0x02
+
+/**
+ * @ingroup los_memregion
+ * Region attribute: large and slow memory such as external SDRAM.
+ */
+#define LOS_MEM_REGION_LARGE                        0x04
+
+/**
+ * @ingroup los_memregion
+ * Placement hint flag: fail instead of falling back to regions that lack a hinted attribute.
+ */
+#define LOS_MEM_REGION_STRICT                       0x80000000
+
+/**
+ * @ingroup los_memregion
+ * All region attributes.
+ */
+#define LOS_MEM_REGION_ATTR_MASK                    (LOS_MEM_REGION_FAST | LOS_MEM_REGION_DMA | LOS_MEM_REGION_LARGE)
+
+/**
+ * @ingroup los_memregion
+ * Region status.
+ */
+typedef struct tagMemRegionStatus
+{
+    VOID            *pPool;         /**< Start address of the region pool                                   */
+    UINT32          uwPoolSize;     /**< Size of the region pool                                            */
+    UINT32          uwAttr;         /**< Region attributes                                                  */
+    LOS_MEM_STATUS  stMemStatus;    /**< Statistics of the region pool                                      */
+    UINT32          uwMaxFreeSize;  /**< Largest free block of the region pool                              */
+    UINT32          uwHitCnt;       /**< Allocations served with every hinted attribute                     */
+    UINT32          uwFallbackCnt;  /**< Allocations served as a fallback for a hint the region lacks       */
+    UINT32          uwMissCnt;      /**< Allocations tried on the region and not served                     */
+} LOS_MEM_REGION_STATUS;
+
+/**
+ * @ingroup los_memregion
+ * @brief Register a memory region.
+ *
+ * @par Description:
+ * This API is used to initialize pPool as a memory pool and to register it as a region with attributes uwAttr. The
+ * system memory pool is region 0 with #LOS_MEM_REGION_DMA, and a fast region is registered at startup when
+ * OS_MEM_REGION_FAST_SIZE is not 0. Memory that needs board setup first, such as external SDRAM behind the FMC, is
+ * registered by the board code after that setup.
+ *
+ * @attention
+ * <ul>
+ * <li>Regions are tried in the order they are registered, register the preferred fallbacks first.</li>
+ * <li>Regions cannot be removed.</li>
+ * <li>pPool must not be used by anything else, including the linker.</li>
+ * </ul>
+ *
+ * @param  pPool       [IN]  Type #VOID * Start address of the region, 4-byte aligned.
+ * @param  uwSize      [IN]  Type #UINT32 Size of the region.
+ * @param  uwAttr      [IN]  Type #UINT32 Region attributes, a combination of LOS_MEM_REGION_FAST,
+ *                                        LOS_MEM_REGION_DMA and LOS_MEM_REGION_LARGE.
+ * @param  puwRegionID [OUT] Type #UINT32 * ID of the region.
+ *
+ * @retval #LOS_ERRNO_MEMREGION_PTR_NULL        pPool or puwRegionID is NULL.
+ * @retval #LOS_ERRNO_MEMREGION_ATTR_INVALID    uwAttr is invalid.
+ * @retval #LOS_ERRNO_MEMREGION_POOL_INVALID    The pool is invalid or overlaps a registered region.
+ * @retval #LOS_ERRNO_MEMREGION_ALL_BUSY        All region slots are in use.
+ * @retval #LOS_OK                              The region is registered.
+ * @par Dependency:
+ * <ul><li>los_memregion.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_MemRegionAlloc
+ * @since Huawei LiteOS V100R001C00
+ */
+extern UINT32 LOS_MemRegionAdd(VOID *pPool, UINT32 uwSize, UINT32 uwAttr, UINT32 *puwRegionID);
+
+/**
+ * @ingroup los_memregion
+ * @brief Allocate memory with a placement hint.
+ *
+ * @par Description:
+ * This API is used to allocate uwSize bytes from the first region that has every attribute of uwHint. When none of
+ * them can serve it, the regions are tried again in their order, except that #LOS_MEM_REGION_DMA stays a requirement
+ * and #LOS_MEM_REGION_STRICT disables the fallback. A hint of 0 takes the first region that can serve it.
+ *
+ * @attention
+ * <ul>
+ * <li>Free the memory with LOS_MemRegionFree.</li>
+ * </ul>
+ *
+ * @param  uwSize [IN] Type #UINT32 Number of bytes to allocate.
+ * @param  uwHint [IN] Type #UINT32 Placement hint, region attributes optionally with LOS_MEM_REGION_STRICT.
+ *
+ * @retval #NULL      No region can serve the allocation, or the parameters are invalid.
+ * @retval #VOID*     Start address of the allocated memory.
+ * @par Dependency:
+ * <ul><li>los_memregion.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_MemRegionFree
+ * @since Huawei LiteOS V100R001C00
+ */
+extern VOID *LOS_MemRegionAlloc(UINT32 uwSize, UINT32 uwHint);
+
+/**
+ * @ingroup los_memregion
+ * @brief Allocate aligned memory with a placement hint.
+ *
+ * @par Description:
+ * This API is the aligned version of #LOS_MemRegionAlloc, for example for DMA buffers that have to start on a cache
+ * line.
+ *
+ * @attention
+ * <ul>
+ * <li>Free the memory with LOS_MemRegionFree.</li>
+ * </ul>
+ *
+ * @param  uwSize     [IN] Type #UINT32 Number of bytes to allocate.
+ * @param  uwBoundary [IN] Type #UINT32 Alignment of the memory, a power of 2 that is at least 4.
+ * @param  uwHint     [IN] Type #UINT32 Placement hint, region attributes optionally with LOS_MEM_REGION_STRICT.
+ *
+ * @retval #NULL      No region can serve the allocation, or the parameters are invalid.
+ * @retval #VOID*     Start address of the allocated memory.
+ * @par Dependency:
+ * <ul><li>los_memregion.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_MemRegionFree
+ * @since Huawei LiteOS V100R001C00
+ */
+extern VOID *LOS_MemRegionAllocAlign(UINT32 uwSize, UINT32 uwBoundary, UINT32 uwHint);
+
+/**
+ * @ingroup los_memregion
+ * @brief Free memory of a region.
+ *
+ * @par Description:
+ * This API is used to give memory back to the region it is allocated from, which is found by its address.
+ *
+ * @attention
+ * <ul>
+ * <li>None.</li>
+ * </ul>
+ *
+ * @param  pMem [IN] Type #VOID * Memory returned by LOS_MemRegionAlloc or LOS_MemRegionAllocAlign.
+ *
+ * @retval #LOS_ERRNO_MEMREGION_PTR_NULL        pMem is NULL.
+ * @retval #LOS_ERRNO_MEMREGION_MEM_INVALID     pMem does not belong to a region or cannot be freed.
+ * @retval #LOS_OK                              The memory is freed.
+ * @par Dependency:
+ * <ul><li>los_memregion.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_MemRegionAlloc
+ * @since Huawei LiteOS V100R001C00
+ */
+extern UINT32 LOS_MemRegionFree(VOID *pMem);
+
+/**
+ * @ingroup los_memregion
+ * @brief Get the status of a region.
+ *
+ * @par Description:
+ * This API is used to get the pool statistics and the placement counters of a region.
+ *
+ * @attention
+ * <ul>
+ * <li>The placement counters only count LOS_MemRegionAlloc and LOS_MemRegionAllocAlign, the pool statistics also
+ * cover LOS_MemAlloc on the region pool.</li>
+ * </ul>
+ *
+ * @param  uwRegionID [IN]  Type #UINT32 Region ID.
+ * @param  pstStatus  [OUT] Type #LOS_MEM_REGION_STATUS * Status of the region.
+ *
+ * @retval #LOS_ERRNO_MEMREGION_PTR_NULL        pstStatus is NULL.
+ * @retval #LOS_ERRNO_MEMREGION_ID_INVALID      uwRegionID is not registered.
+ * @retval #LOS_OK                              The status is got.
+ * @par Dependency:
+ * <ul><li>los_memregion.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_MemRegionAdd
+ * @since Huawei LiteOS V100R001C00
+ */
+extern UINT32 LOS_MemRegionStatusGet(UINT32 uwRegionID, LOS_MEM_REGION_STATUS *pstStatus);
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* __cplusplus */
+
+#endif /* _LOS_MEMREGION_H */
@@ -0,0 +1,241 @@
+/*----------------------------------------------------------------------------
+ * Copyright (c) <2013-2015>, <Huawei Technologies Co., Ltd>
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *---------------------------------------------------------------------------*/
+/*----------------------------------------------------------------------------
+ * Notice of Export Control Law
+ * ===============================================
+ * Huawei LiteOS may be subject to applicable export control laws and regulations, which might
+ * include those applicable to Huawei LiteOS of U.S. and the country in which you are located.
+ * Import, export and usage of Huawei LiteOS in any manner by you shall be in compliance with such
+ * applicable export control laws and regulations.
+ *---------------------------------------------------------------------------*/
+
+/**@defgroup los_memstat Memory statistics
+ * @ingroup kernel
+ */
+
+#ifndef _LOS_MEMSTAT_H
+#define _LOS_MEMSTAT_H
+
+#include "los_base.h"
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+#endif /* __cplusplus */
+
+/**
+ * @ingroup los_memstat
+ * Memory statistics error code: Null pointer.
+ *
+ * Value: 0x02002300
+ *
+ * Solution: Check whether the input parameter is null.
+ */
+#define LOS_ERRNO_MEMSTAT_PTR_NULL                  LOS_ERRNO_OS_ERROR(LOS_MOD_MEMSTAT, 0x00)
+
+/**
+ * @ingroup los_memstat
+ * Memory statistics error code: The task ID is invalid.
+ *
+ * Value: 0x02002301
+ *
+ * Solution: Pass in a task ID or LOS_MEM_STAT_NO_TASK.
+ */
+#define LOS_ERRNO_MEMSTAT_TSKID_INVALID             LOS_ERRNO_OS_ERROR(LOS_MOD_MEMSTAT, 0x01)
+
+/**
+ * @ingroup los_memstat
+ * Memory statistics error code: There are more call sites than the array holds, the rest are not reported.
+ *
+ * Value: 0x02002302
+ *
+ * Solution: Pass in a larger array.
+ */
+#define LOS_ERRNO_MEMSTAT_SITE_FULL                 LOS_ERRNO_OS_ERROR(LOS_MOD_MEMSTAT, 0x02)
+
+/**
+ * @ingroup los_memstat
+ * ID the memory allocated in interrupts or before the first task runs is charged to.
+ */
+#define LOS_MEM_STAT_NO_TASK                        (LOSCFG_BASE_CORE_TSK_LIMIT + 1)
+
+/**
+ * @ingroup los_memstat
+ * Memory usage of a task.
+ */
+typedef struct tagMemTaskStat
+{
+    UINT32  uwCurSize;      /**< Size of the blocks the task holds                  */
+    UINT32  uwPeakSize;     /**< Peak of uwCurSize                                  */
+    UINT32  uwAllocCnt;     /**< Number of blocks allocated by the task             */
+    UINT32  uwFreeCnt;      /**< Number of blocks of the task freed                 */
+} LOS_MEM_TASK_STAT;
+
+/**
+ * @ingroup los_memstat
+ * @brief Get the memory usage of a task.
+ *
+ * @par Description:
+ * This API is used to get the counters of the memory a task holds. A block is charged to the task that allocates it
+ * from a pool initialized by LOS_MemInit, and is given back to that task whichever task frees it.
+ *
+ * @attention
+ * <ul>
+ * <li>Sizes are the block sizes of the allocator, at least the requested sizes.</li>
+ * <li>A new task with the ID of a deleted one takes over the blocks that task did not free.</li>
+ * </ul>
+ *
+ * @param  uwTaskID [IN]  Type #UINT32 Task ID, or #LOS_MEM_STAT_NO_TASK.
+ * @param  pstStat  [OUT] Type #LOS_MEM_TASK_STAT * Memory usage of the task.
+ *
+ * @retval #LOS_ERRNO_MEMSTAT_PTR_NULL          pstStat is NULL.
+ * @retval #LOS_ERRNO_MEMSTAT_TSKID_INVALID     uwTaskID is invalid.
+ * @retval #LOS_OK                              The memory usage is got.
+ * @par Dependency:
+ * <ul><li>los_memstat.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_MemTaskPeakReset
+ * @since Huawei LiteOS V100R001C00
+ */
+extern UINT32 LOS_MemTaskStatGet(UINT32 uwTaskID, LOS_MEM_TASK_STAT *pstStat);
+
+/**
+ * @ingroup los_memstat
+ * @brief Reset the peak memory usage of a task.
+ *
+ * @par Description:
+ * This API is used to set the peak of a task to the size it holds now.
+ *
+ * @attention
+ * <ul>
+ * <li>None.</li>
+ * </ul>
+ *
+ * @param  uwTaskID [IN] Type #UINT32 Task ID, or #LOS_MEM_STAT_NO_TASK.
+ *
+ * @retval #LOS_ERRNO_MEMSTAT_TSKID_INVALID     uwTaskID is invalid.
+ * @retval #LOS_OK                              The peak is reset.
+ * @par Dependency:
+ * <ul><li>los_memstat.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_MemTaskStatGet
+ * @since Huawei LiteOS V100R001C00
+ */
+extern UINT32 LOS_MemTaskPeakReset(UINT32 uwTaskID);
+
+#if (LOSCFG_MEM_LEAKCHECK == YES)
+/**
+ * @ingroup los_memstat
+ * Outstanding memory of a call site.
+ */
+typedef struct tagMemLeakSite
+{
+    UINTPTR uvCaller;       /**< Return address of the allocating call              */
+    UINT32  uwCount;        /**< Number of outstanding blocks                       */
+    UINT32  uwSize;         /**< Size of the outstanding blocks                     */
+} LOS_MEM_LEAK_SITE;
+
+/**
+ * @ingroup los_memstat
+ * @brief Mark a point in time.
+ *
+ * @par Description:
+ * This API is used to get a mark that LOS_MemLeakDiff compares the allocations with. Every allocation after the mark
+ * that is not freed when LOS_MemLeakDiff is called is reported.
+ *
+ * @attention
+ * <ul>
+ * <li>The marks wrap after 2^31 allocations.</li>
+ * </ul>
+ *
+ * @param  None.
+ *
+ * @retval #UINT32  The mark.
+ * @par Dependency:
+ * <ul><li>los_memstat.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_MemLeakDiff
+ * @since Huawei LiteOS V100R001C00
+ */
+extern UINT32 LOS_MemLeakMark(VOID);
+
+/**
+ * @ingroup los_memstat
+ * @brief Get the outstanding allocations made after a mark.
+ *
+ * @par Description:
+ * This API is used to sum up, per call site, the blocks allocated after uwMark that are not freed yet. A site that
+ * keeps growing between two calls with the same mark is a leak candidate.
+ *
+ * @attention
+ * <ul>
+ * <li>The interrupts are locked while the table of LOSCFG_MEM_LEAKCHECK_SIZE allocations is walked.</li>
+ * <li>Allocations that did not fit in the table are not reported, see LOS_MemLeakLostGet.</li>
+ * </ul>
+ *
+ * @param  uwMark     [IN]     Type #UINT32 Mark returned by LOS_MemLeakMark.
+ * @param  pstSites   [OUT]    Type #LOS_MEM_LEAK_SITE * Call sites.
+ * @param  puwSiteNum [IN/OUT] Type #UINT32 * Number of entries of pstSites, then the number of sites reported.
+ *
+ * @retval #LOS_ERRNO_MEMSTAT_PTR_NULL          pstSites or puwSiteNum is NULL.
+ * @retval #LOS_ERRNO_MEMSTAT_SITE_FULL         pstSites is full, more sites are not reported.
+ * @retval #LOS_OK                              Every site is reported.
+ * @par Dependency:
+ * <ul><li>los_memstat.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_MemLeakMark
+ * @since Huawei LiteOS V100R001C00
+ */
+extern UINT32 LOS_MemLeakDiff(UINT32 uwMark, LOS_MEM_LEAK_SITE *pstSites, UINT32 *puwSiteNum);
+
+/**
+ * @ingroup los_memstat
+ * @brief Get the number of allocations not tracked.
+ *
+ * @par Description:
+ * This API is used to get the number of allocations that found the allocation table full. They are not reported by
+ * LOS_MemLeakDiff.
+ *
+ * @attention
+ * <ul>
+ * <li>Increase LOSCFG_MEM_LEAKCHECK_SIZE when it is not 0.</li>
+ * </ul>
+ *
+ * @param  None.
+ *
+ * @retval #UINT32  Number of allocations not tracked.
+ * @par Dependency:
+ * <ul><li>los_memstat.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_MemLeakDiff
+ * @since Huawei LiteOS V100R001C00
+ */
+extern UINT32 LOS_MemLeakLostGet(VOID);
+#endif
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* __cplusplus */
+
+#endif /* _LOS_MEMSTAT_H */
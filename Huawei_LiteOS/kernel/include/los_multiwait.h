@@ -0,0 +1,210 @@
+/*----------------------------------------------------------------------------
+ * Copyright (c) <2013-2015>, <Huawei Technologies Co., Ltd>
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *---------------------------------------------------------------------------*/
+/*----------------------------------------------------------------------------
+ * Notice of Export Control Law
+ * ===============================================
+ * Huawei LiteOS may be subject to applicable export control laws and regulations, which might
+ * include those applicable to Huawei LiteOS of U.S. and the country in which you are located.
+ * Import, export and usage of Huawei LiteOS in any manner by you shall be in compliance with such
+ * applicable export control laws and regulations.
+ *---------------------------------------------------------------------------*/
+
+/**@defgroup los_multiwait Multi-wait
+ * @ingroup kernel
+ */
+
+#ifndef _LOS_MULTIWAIT_H
+#define _LOS_MULTIWAIT_H
+
+#include "los_base.h"
+#include "los_list.h"
+#include "los_event.h"
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+#endif /* __cplusplus */
+
+/**
+ * @ingroup los_multiwait
+ * Multi-wait error code: Null pointer.
+ *
+ * Value: 0x02002000
+ *
+ * Solution: Check whether the input parameter is null.
+ */
+#define LOS_ERRNO_MULTIWAIT_PTR_NULL                LOS_ERRNO_OS_ERROR(LOS_MOD_MULTIWAIT, 0x00)
+
+/**
+ * @ingroup los_multiwait
+ * Multi-wait error code: The number of items is 0.
+ *
+ * Value: 0x02002001
+ *
+ * Solution: Pass in at least one item.
+ */
+#define LOS_ERRNO_MULTIWAIT_COUNT_INVALID           LOS_ERRNO_OS_ERROR(LOS_MOD_MULTIWAIT, 0x01)
+
+/**
+ * @ingroup los_multiwait
+ * Multi-wait error code: An item has an invalid type, refers to an object that is not created, or has an invalid
+ * event mask or mode.
+ *
+ * Value: 0x02002002
+ *
+ * Solution: Check the items.
+ */
+#define LOS_ERRNO_MULTIWAIT_ITEM_INVALID            LOS_ERRNO_OS_ERROR(LOS_MOD_MULTIWAIT, 0x02)
+
+/**
+ * @ingroup los_multiwait
+ * Multi-wait error code: The wait is requested during an interrupt.
+ *
+ * Value: 0x03002003
+ *
+ * Solution: Perform this operation after exiting from the interrupt.
+ */
+#define LOS_ERRNO_MULTIWAIT_IN_INT                  LOS_ERRNO_OS_FATAL(LOS_MOD_MULTIWAIT, 0x03)
+
+/**
+ * @ingroup los_multiwait
+ * Multi-wait error code: The wait would block when the task is locked.
+ *
+ * Value: 0x02002004
+ *
+ * Solution: Perform this operation after unlocking the task.
+ */
+#define LOS_ERRNO_MULTIWAIT_IN_LOCK                 LOS_ERRNO_OS_ERROR(LOS_MOD_MULTIWAIT, 0x04)
+
+/**
+ * @ingroup los_multiwait
+ * Multi-wait error code: No object is ready and the timeout is 0.
+ *
+ * Value: 0x02002005
+ *
+ * Solution: Wait with a non-zero timeout or try again later.
+ */
+#define LOS_ERRNO_MULTIWAIT_UNAVAILABLE             LOS_ERRNO_OS_ERROR(LOS_MOD_MULTIWAIT, 0x05)
+
+/**
+ * @ingroup los_multiwait
+ * Multi-wait error code: No object gets ready before the timeout.
+ *
+ * Value: 0x02002006
+ *
+ * Solution: Increase the timeout.
+ */
+#define LOS_ERRNO_MULTIWAIT_TIMEOUT                 LOS_ERRNO_OS_ERROR(LOS_MOD_MULTIWAIT, 0x06)
+
+/**
+ * @ingroup los_multiwait
+ * Item type: a semaphore with a non-zero count, uwHandle is the semaphore ID.
+ */
+#define LOS_MULTIWAIT_SEM                           0
+
+/**
+ * @ingroup los_multiwait
+ * Item type: a queue with a message to read, uwHandle is the queue ID.
+ */
+#define LOS_MULTIWAIT_QUEUE_READ                    1
+
+/**
+ * @ingroup los_multiwait
+ * Item type: a queue with room to write, uwHandle is the queue ID.
+ */
+#define LOS_MULTIWAIT_QUEUE_WRITE                   2
+
+/**
+ * @ingroup los_multiwait
+ * Item type: an event control block with uwEventMask set as uwEventMode requires, pstEventCB is the event.
+ */
+#define LOS_MULTIWAIT_EVENT                         3
+
+/**
+ * @ingroup los_multiwait
+ * Multi-wait item, one per object waited for.
+ *
+ * The caller fills in uwType and uwHandle, or pstEventCB, uwEventMask and uwEventMode for an event. The kernel
+ * sets uwReady and uses the remaining members while the task waits, so the item must stay valid during the wait.
+ */
+typedef struct tagMultiWaitItem
+{
+    UINT32          uwType;         /**< LOS_MULTIWAIT_SEM, LOS_MULTIWAIT_QUEUE_READ, LOS_MULTIWAIT_QUEUE_WRITE or LOS_MULTIWAIT_EVENT */
+    UINT32          uwHandle;       /**< Semaphore ID or queue ID */
+    EVENT_CB_S      *pstEventCB;    /**< Event control block */
+    UINT32          uwEventMask;    /**< Events waited for */
+    UINT32          uwEventMode;    /**< LOS_WAITMODE_AND or LOS_WAITMODE_OR */
+    UINT32          uwReady;        /**< Set to 1 by the kernel when the object is ready */
+    LOS_DL_LIST     stList;         /**< Node in the multi-wait list of the object, kernel internal */
+    VOID            *pTask;         /**< Waiting task, kernel internal */
+} MULTIWAIT_ITEM_S;
+
+/**
+ * @ingroup los_multiwait
+ * @brief Wait until one of several IPC objects is ready.
+ *
+ * @par Description:
+ * This API is used to block the current task until at least one of the objects described by pstItems is ready,
+ * that is a semaphore can be taken, a queue can be read or written, or an event condition is met.
+ * uwReady of every ready item is set to 1 and the others to 0.
+ *
+ * @attention
+ * <ul>
+ * <li>Nothing is taken from the objects. Take the semaphore, read or write the queue, or read the event with
+ * timeout 0 afterwards; it can fail if another task took the object first, then wait again.</li>
+ * <li>A task woken by a semaphore post or a queue operation has priority over the multi-waiters of the object,
+ * which are only woken when the object stays ready.</li>
+ * <li>The objects cannot be deleted while a task multi-waits on them.</li>
+ * <li>This API cannot be called in interrupts or, if it would block, when the task scheduling is locked.</li>
+ * </ul>
+ *
+ * @param  pstItems  [IN/OUT] Type #MULTIWAIT_ITEM_S * Items, one per object.
+ * @param  uwCount   [IN] Type #UINT32 Number of items.
+ * @param  uwTimeOut [IN] Type #UINT32 Timeout in ticks, 0 to poll, #LOS_WAIT_FOREVER to wait forever.
+ *
+ * @retval #LOS_ERRNO_MULTIWAIT_PTR_NULL          pstItems is NULL.
+ * @retval #LOS_ERRNO_MULTIWAIT_COUNT_INVALID     uwCount is 0.
+ * @retval #LOS_ERRNO_MULTIWAIT_ITEM_INVALID      An item is invalid.
+ * @retval #LOS_ERRNO_MULTIWAIT_IN_INT            The API is called in an interrupt.
+ * @retval #LOS_ERRNO_MULTIWAIT_IN_LOCK           The API would block when the task scheduling is locked.
+ * @retval #LOS_ERRNO_MULTIWAIT_UNAVAILABLE       No object is ready and uwTimeOut is 0.
+ * @retval #LOS_ERRNO_MULTIWAIT_TIMEOUT           No object gets ready before the timeout.
+ * @retval #LOS_OK                                At least one object is ready.
+ * @par Dependency:
+ * <ul><li>los_multiwait.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_SemPend | LOS_QueueRead | LOS_EventRead
+ * @since Huawei LiteOS V100R001C00
+ */
+extern UINT32 LOS_MultiWait(MULTIWAIT_ITEM_S *pstItems, UINT32 uwCount, UINT32 uwTimeOut);
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* __cplusplus */
+
+#endif /* _LOS_MULTIWAIT_H */
@@ -57,7 +57,7 @@ extern "C"{
  *
  * Value: 0x02001d00
  *
- * Solution: Decrease the number of mutexes defined by LOSCFG_BASE_IPC_MUX_LIMIT.
+ * Solution: Decrease the number of mutexes defined by LOSCFG_BASE_IPC_MUX_LIMIT or the uwMuxLimit passed to LOS_KernelInitConfig.
  */
 #define LOS_ERRNO_MUX_NO_MEMORY         LOS_ERRNO_OS_ERROR(LOS_MOD_MUX, 0x00)
 
@@ -87,7 +87,7 @@ extern "C"{
 *
 * Value: 0x02001d03
 *
-* Solution: Increase the number of mutexes defined by LOSCFG_BASE_IPC_MUX_LIMIT.
+* Solution: Increase the number of mutexes defined by LOSCFG_BASE_IPC_MUX_LIMIT or the uwMuxLimit passed to LOS_KernelInitConfig.
 */
 #define LOS_ERRNO_MUX_ALL_BUSY           LOS_ERRNO_OS_ERROR(LOS_MOD_MUX, 0x03)
 
@@ -165,6 +165,16 @@ extern "C"{
  */
 #define LOS_ERRNO_MUX_REG_ERROR         LOS_ERRNO_OS_ERROR(LOS_MOD_MUX, 0x0B)
 
+/**
+ * @ingroup los_mux
+ * Mutex error code: Invalid pend order.
+ *
+ * Value: 0x02001d0C
+ *
+ * Solution: Pass in LOS_PEND_FIFO or LOS_PEND_PRIO.
+ */
+#define LOS_ERRNO_MUX_PEND_ORDER_INVALID    LOS_ERRNO_OS_ERROR(LOS_MOD_MUX, 0x0C)
+
 
 /**
  *@ingroup los_mux
@@ -177,7 +187,7 @@ extern "C"{
  *<li>The total number of mutexes is pre-configured. If there are no available mutexes, the mutex creation fails.</li>
  *</ul>
  *
- *@param puwMuxHandle   [OUT] Handle pointer of the successfully created mutex. The value of handle should be in [0, LOSCFG_BASE_IPC_MUX_LIMIT - 1].
+ *@param puwMuxHandle   [OUT] Handle pointer of the successfully created mutex.
  *
  *@retval #LOS_ERRNO_MUX_PTR_NULL           The puwMuxHandle pointer is NULL.
  *@retval #LOS_ERRNO_MUX_ALL_BUSY           No available mutex.
@@ -201,7 +211,7 @@ extern UINT32 LOS_MuxCreate(UINT32 *puwMuxHandle);
  *<li>The mutex can be deleted successfully only if no other tasks pend on it.</li>
  *</ul>
  *
- *@param puwMuxHandle   [IN] Handle of the mutex to be deleted. The value of handle should be in [0, LOSCFG_BASE_IPC_MUX_LIMIT - 1].
+ *@param puwMuxHandle   [IN] Handle of the mutex to be deleted.
  *
  *@retval #LOS_ERRNO_MUX_INVALID            Invalid handle or mutex in use.
  *@retval #LOS_ERRNO_MUX_PENDED             Tasks pended on this mutex.
@@ -225,10 +235,11 @@ extern UINT32 LOS_MuxDelete(UINT32 puwMuxHandle);
  *<li>The function fails if the mutex that is waited on is already locked by another thread when the task scheduling is disabled.</li>
  *<li>Do not wait on a mutex during an interrupt.</li>
  *<li>The priority inheritance protocol is supported. If a higher-priority thread is waiting on a mutex, it changes the priority of the thread that owns the mutex to avoid priority inversion.</li>
+ *<li>Inheritance is transitive: if the owner is itself waiting on a mutex, the owner of that mutex is raised too. When the waiter times out or is deleted, the owners fall back to the highest priority still required by their remaining waiters.</li>
  *<li>A recursive mutex can be locked more than once by the same thread.</li>
  *</ul>
  *
- *@param uwMuxHandle    [IN] Handle of the mutex to be waited on.  The value of handle should be in [0, LOSCFG_BASE_IPC_MUX_LIMIT - 1].
+ *@param uwMuxHandle    [IN] Handle of the mutex to be waited on. 
  *@param uwTimeout      [IN] Waiting time. The value range is [0, LOS_WAIT_FOREVER](unit: Tick).
  *
  *@retval #LOS_ERRNO_MUX_INVALID            The mutex state (for example, the mutex does not exist or is not in use) is not applicable for the current operation.
@@ -257,7 +268,7 @@ extern UINT32 LOS_MuxPend(UINT32 uwMuxHandle, UINT32 uwTimeout);
  *<li>If a recursive mutex is locked for many times, it must be unlocked for the same times to be released.</li>
  *</ul>
  *
- *@param uwMuxHandle    [IN] Handle of the mutex to be released. The value of handle should be in [0, LOSCFG_BASE_IPC_MUX_LIMIT - 1].
+ *@param uwMuxHandle    [IN] Handle of the mutex to be released.
  *
  *@retval #LOS_ERRNO_MUX_INVALID            The mutex state (for example, the mutex does not exist or is not in use or owned by other thread) is not applicable for the current operation.
  *@retval #LOS_ERRNO_MUX_PEND_INTERR        The mutex is being released during an interrupt.
@@ -269,6 +280,31 @@ extern UINT32 LOS_MuxPend(UINT32 uwMuxHandle, UINT32 uwTimeout);
  */
 extern UINT32 LOS_MuxPost(UINT32 uwMuxHandle);
 
+/**
+ *@ingroup los_mux
+ *@brief Set the pend order of a mutex.
+ *
+ *@par Description:
+ *This API is used to set the order in which the tasks pending on a mutex are woken up.
+ *@attention
+ *<ul>
+ *<li>The tasks that are already pending are reordered.</li>
+ *<li>With LOS_PEND_PRIO a task that changes its priority while pending moves to its new place.</li>
+ *</ul>
+ *
+ *@param uwMuxHandle   [IN] Handle of the mutex.
+ *@param uwPendOrder   [IN] LOS_PEND_FIFO (default) or LOS_PEND_PRIO.
+ *
+ *@retval #LOS_ERRNO_MUX_INVALID            The mutex handle is invalid.
+ *@retval #LOS_ERRNO_MUX_PEND_ORDER_INVALID Invalid pend order.
+ *@retval #LOS_OK                           The pend order is successfully set.
+ *@par Dependency:
+ *<ul><li>los_mux.h: the header file that contains the API declaration.</li></ul>
+ *@see LOS_MuxPend
+ *@since Huawei LiteOS V100R001C00
+ */
+extern UINT32 LOS_MuxPendOrderSet(UINT32 uwMuxHandle, UINT32 uwPendOrder);
+
 
 #ifdef __cplusplus
 #if __cplusplus
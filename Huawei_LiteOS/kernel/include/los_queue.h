@@ -331,6 +331,62 @@ extern "C" {
   */
 #define LOS_ERRNO_QUEUE_READ_SIZE_TOO_SMALL             LOS_ERRNO_OS_ERROR(LOS_MOD_QUE, 0x1f)
 
+/**
+  * @ingroup los_queue
+  * Queue error code: Invalid pend order.
+  *
+  * Value: 0x02000620
+  *
+  * Solution: Pass in LOS_PEND_FIFO or LOS_PEND_PRIO.
+  */
+#define LOS_ERRNO_QUEUE_PEND_ORDER_INVALID              LOS_ERRNO_OS_ERROR(LOS_MOD_QUE, 0x20)
+
+/**
+  * @ingroup los_queue
+  * Queue error code: The storage passed in during static queue creation is null, not aligned or too small.
+  *
+  * Value: 0x02000621
+  *
+  * Solution: Pass in 4 bytes aligned storage of at least LOS_QUEUE_STATIC_SIZE(usLen, usMaxMsgSize) bytes.
+  */
+#define LOS_ERRNO_QUEUE_STATIC_BUF_INVALID              LOS_ERRNO_OS_ERROR(LOS_MOD_QUE, 0x21)
+
+/**
+  * @ingroup los_queue
+  * Queue error code: The buffer passed in is not a node reserved or peeked in the queue, or it is already committed or released.
+  *
+  * Value: 0x02000622
+  *
+  * Solution: Pass in the buffer returned by LOS_QueueReserve or LOS_QueuePeek, once.
+  */
+#define LOS_ERRNO_QUEUE_BUF_INVALID                     LOS_ERRNO_OS_ERROR(LOS_MOD_QUE, 0x22)
+
+/**
+  * @ingroup los_queue
+  * Queue error code: The queue head cannot be written while peeked nodes are not released.
+  *
+  * Value: 0x02000623
+  *
+  * Solution: Release the peeked nodes before writing the queue head.
+  */
+#define LOS_ERRNO_QUEUE_PEEK_BUSY                       LOS_ERRNO_OS_ERROR(LOS_MOD_QUE, 0x23)
+
+/**
+  * @ingroup los_queue
+  * Queue error code: The message count passed in during batch reading or writing is null or 0.
+  *
+  * Value: 0x02000624
+  *
+  * Solution: Pass in a message count of at least 1.
+  */
+#define LOS_ERRNO_QUEUE_BATCH_COUNT_INVALID             LOS_ERRNO_OS_ERROR(LOS_MOD_QUE, 0x24)
+
+/**
+  * @ingroup los_queue
+  * Size in bytes of the storage of a queue of usLen messages of at most usMaxMsgSize bytes.
+  */
+#define LOS_QUEUE_STATIC_SIZE(usLen, usMaxMsgSize)      ((UINT32)(usLen) * ((UINT32)(usMaxMsgSize) + sizeof(UINT32)))
+
 
 /**
   * @ingroup los_queue
@@ -358,7 +414,7 @@ typedef struct tagQueueInfo
  *This API is used to create a message queue.
  *@attention
  *<ul>
- *<li>Threre are LOSCFG_BASE_IPC_QUEUE_LIMIT queues available, change it's value when necessory.</li>
+ *<li>Threre are LOSCFG_BASE_IPC_QUEUE_LIMIT queues available, or the uwQueueLimit passed to LOS_KernelInitConfig, change it's value when necessory.</li>
  *</ul>
  *@param pcQueueName        [IN]    Message queue name. Reserved parameter, not used for now.
  *@param usLen              [IN]    Queue length. The value range is [1,0xffff].
@@ -383,6 +439,45 @@ extern UINT32 LOS_QueueCreate(CHAR *pcQueueName,
                              UINT32 uwFlags,
                              UINT16 usMaxMsgSize);
 
+/**
+ *@ingroup los_queue
+ *@brief Create a message queue in storage provided by the caller.
+ *
+ *@par Description:
+ *This API is used to create a message queue like LOS_QueueCreate, with the message storage owned by the caller
+ *instead of allocated from the system heap.
+ *@attention
+ *<ul>
+ *<li>pBuf must be aligned on the boundary of 4 bytes and hold at least LOS_QUEUE_STATIC_SIZE(usLen, usMaxMsgSize) bytes.</li>
+ *<li>The storage is not freed when the queue is deleted. It must not be reused before the queue is deleted.</li>
+ *</ul>
+ *@param pcQueueName        [IN]    Message queue name. Reserved parameter, not used for now.
+ *@param usLen              [IN]    Queue length. The value range is [1,0xffff].
+ *@param puwQueueID         [OUT]   ID of the queue control structure that is successfully created.
+ *@param uwFlags            [IN]    Queue mode. Reserved parameter, not used for now.
+ *@param usMaxMsgSize       [IN]    Node size. The value range is [1,0xffff-4].
+ *@param pBuf               [IN]    Message storage.
+ *@param uwBufSize          [IN]    Size of pBuf in bytes.
+ *
+ *@retval   #LOS_OK                               The message queue is successfully created.
+ *@retval   #LOS_ERRNO_QUEUE_CB_UNAVAILABLE       The upper limit of the number of created queues is exceeded.
+ *@retval   #LOS_ERRNO_QUEUE_CREAT_PTR_NULL       Null pointer, puwQueueID is NULL.
+ *@retval   #LOS_ERRNO_QUEUE_PARA_ISZERO          The queue length or message node size passed in during queue creation is 0.
+ *@retval   #LOS_ERRNO_QUEUE_SIZE_TOO_BIG         The parameter usMaxMsgSize is larger than 0xffff - 4.
+ *@retval   #LOS_ERRNO_QUEUE_STATIC_BUF_INVALID   pBuf is NULL, not aligned or too small.
+ *@par Dependency:
+ *<ul><li>los_queue.h: the header file that contains the API declaration.</li></ul>
+ *@see LOS_QueueCreate | LOS_QueueDelete
+ *@since Huawei LiteOS V100R001C00
+ */
+extern UINT32 LOS_QueueCreateStatic(CHAR *pcQueueName,
+                                    UINT16 usLen,
+                                    UINT32 *puwQueueID,
+                                    UINT32 uwFlags,
+                                    UINT16 usMaxMsgSize,
+                                    VOID *pBuf,
+                                    UINT32 uwBufSize);
+
 /**
  *@ingroup los_queue
  *@brief Read a queue.
@@ -399,7 +494,7 @@ extern UINT32 LOS_QueueCreate(CHAR *pcQueueName,
  *<li>The argument uwTimeOut is a relative time.</li>
  *</ul>
  *
- *@param uwQueueID        [IN]     Queue ID created by LOS_QueueCreate. The value range is [1,LOSCFG_BASE_IPC_QUEUE_LIMIT].
+ *@param uwQueueID        [IN]     Queue ID created by LOS_QueueCreate.
  *@param pBufferAddr      [OUT]    Starting address that stores the obtained data. The starting address must not be null.
  *@param puwBufferSize    [IN/OUT] Where to maintain the buffer wantted-size before read, and the real-size after read.
  *@param uwTimeOut        [IN]     Expiry time. The value range is [0,LOS_WAIT_FOREVER](unit: Tick).
@@ -439,7 +534,7 @@ extern UINT32 LOS_QueueReadCopy(UINT32 uwQueueID,
  *<li>The argument uwTimeOut is a relative time.</li>
  *</ul>
  *
- *@param uwQueueID        [IN]        Queue ID created by LOS_QueueCreate. The value range is [1,LOSCFG_BASE_IPC_QUEUE_LIMIT].
+ *@param uwQueueID        [IN]        Queue ID created by LOS_QueueCreate.
  *@param pBufferAddr      [IN]        Starting address that stores the data to be written.The starting address must not be null.
  *@param uwBufferSize     [IN]        Passed-in buffer size. The value range is [1,USHRT_MAX - sizeof(UINT32)].
  *@param uwTimeOut        [IN]        Expiry time. The value range is [0,LOS_WAIT_FOREVER](unit: Tick).
@@ -482,7 +577,7 @@ extern UINT32 LOS_QueueWriteCopy(UINT32 uwQueueID,
  *<li>The buffer which the pBufferAddr pointing to must be greater than or equal to 4 bytes.</li>
  *</ul>
  *
- *@param uwQueueID        [IN]        Queue ID created by LOS_QueueCreate. The value range is [1,LOSCFG_BASE_IPC_QUEUE_LIMIT].
+ *@param uwQueueID        [IN]        Queue ID created by LOS_QueueCreate.
  *@param pBufferAddr      [OUT]       Starting address that stores the obtained data. The starting address must not be null.
  *@param uwBufferSize     [IN]        Passed-in buffer size, which must not be 0. The value range is [1,0xffffffff].
  *@param uwTimeOut        [IN]        Expiry time. The value range is [0,LOS_WAIT_FOREVER](unit: Tick).
@@ -522,7 +617,7 @@ extern UINT32 LOS_QueueRead(UINT32 uwQueueID,
  *<li>The uwBufferSize is not really used in LOS_QueueWrite, because the interface is only used to write the address of data specified by pBufferAddr into a queue.</li>
  *</ul>
  *
- *@param uwQueueID        [IN]        Queue ID created by LOS_QueueCreate. The value range is [1,LOSCFG_BASE_IPC_QUEUE_LIMIT].
+ *@param uwQueueID        [IN]        Queue ID created by LOS_QueueCreate.
  *@param pBufferAddr      [IN]       Starting address that stores the data to be written. The starting address must not be null.
  *@param uwBufferSize     [IN]        Passed-in buffer size, which must not be 0. The value range is [1,0xffffffff].
  *@param uwTimeOut        [IN]        Expiry time. The value range is [0,LOS_WAIT_FOREVER](unit: Tick).
@@ -562,7 +657,7 @@ extern UINT32 LOS_QueueWrite(UINT32 uwQueueID,
  *<li>LOS_QueueRead and LOS_QueueWriteHead are a set of interfaces, and the two groups of interfaces need to be used.<li>
  *</ul>
  *
- *@param uwQueueID        [IN]        Queue ID created by LOS_QueueCreate. The value range is [1,LOSCFG_BASE_IPC_QUEUE_LIMIT].
+ *@param uwQueueID        [IN]        Queue ID created by LOS_QueueCreate.
  *@param pBufferAddr      [OUT]       Starting address that stores the data to be written. The starting address must not be null.
  *@param uwBufferSize     [IN]        Passed-in buffer size, which must not be 0. The value range is [1,0xffffffff].
  *@param uwTimeOut        [IN]        Expiry time. The value range is [0,LOS_WAIT_FOREVER](unit: Tick).
@@ -602,7 +697,7 @@ extern UINT32 LOS_QueueWriteHead(UINT32 uwQueueID,
  *<li>LOS_QueueRead and LOS_QueueWriteHead are a set of interfaces, and the two groups of interfaces need to be used.<li>
  *</ul>
  *
- *@param uwQueueID        [IN]        Queue ID created by LOS_QueueCreate. The value range is [1,LOSCFG_BASE_IPC_QUEUE_LIMIT].
+ *@param uwQueueID        [IN]        Queue ID created by LOS_QueueCreate.
  *@param pBufferAddr      [OUT]       Starting address that stores the data to be written. The starting address must not be null.
  *@param uwBufferSize     [IN]        Passed-in buffer size, which must not be 0. The value range is [1,0xffffffff].
  *@param uwTimeOut        [IN]        Expiry time. The value range is [0,LOS_WAIT_FOREVER](unit: Tick).
@@ -617,6 +712,7 @@ extern UINT32 LOS_QueueWriteHead(UINT32 uwQueueID,
  *@retval   #LOS_ERRNO_QUEUE_ISFULL                 No free node is available during queue writing.
  *@retval   #LOS_ERRNO_QUEUE_PEND_IN_LOCK           The task is forbidden to be blocked on a queue when the task is locked.
  *@retval   #LOS_ERRNO_QUEUE_TIMEOUT                The time set for waiting to processing the queue expires.
+ *@retval   #LOS_ERRNO_QUEUE_PEEK_BUSY              Nodes taken by LOS_QueuePeek are not released.
  *@par Dependency:
  *<ul><li>los_queue.h: The header file that contains the API declaration.</li></ul>
  *@see LOS_QueueWrite | LOS_QueueWriteHead
@@ -627,6 +723,213 @@ extern UINT32 LOS_QueueWriteHeadCopy(UINT32 uwQueueID,
                                      UINT32 uwBufferSize,
                                      UINT32 uwTimeOut );
 
+/**
+ *@ingroup los_queue
+ *@brief Reserve a node at the tail of a queue.
+ *
+ *@par Description:
+ *This API is used to reserve the tail node of a queue so that the message can be built in place, without the copy of LOS_QueueWriteCopy.
+ *The message becomes readable when it is committed by LOS_QueueCommit.
+ *@attention
+ *<ul>
+ *<li>The node holds at most usMaxMsgSize bytes. It is 4 bytes aligned when usMaxMsgSize is a multiple of 4.</li>
+ *<li>Messages are read in reservation order. A message committed before an earlier reservation is readable only after that reservation is committed.</li>
+ *<li>Every reserved node must be committed, the queue cannot be deleted before.</li>
+ *<li>Do not wait on a queue in an interrupt, uwTimeOut must be LOS_NO_WAIT there.</li>
+ *</ul>
+ *
+ *@param uwQueueID        [IN]        Queue ID created by LOS_QueueCreate.
+ *@param ppBuffer         [OUT]       Address of the reserved node.
+ *@param uwTimeOut        [IN]        Expiry time. The value range is [0,LOS_WAIT_FOREVER](unit: Tick).
+ *
+ *@retval   #LOS_OK                                 The node is successfully reserved.
+ *@retval   #LOS_ERRNO_QUEUE_INVALID                The queue handle passed in is invalid.
+ *@retval   #LOS_ERRNO_QUEUE_WRITE_PTR_NULL         The pointer passed in is null.
+ *@retval   #LOS_ERRNO_QUEUE_WRITE_IN_INTERRUPT     The queue cannot be waited on during an interrupt.
+ *@retval   #LOS_ERRNO_QUEUE_NOT_CREATE             The queue is not created.
+ *@retval   #LOS_ERRNO_QUEUE_ISFULL                 No free node is available.
+ *@retval   #LOS_ERRNO_QUEUE_PEND_IN_LOCK           The task is forbidden to be blocked on a queue when the task is locked.
+ *@retval   #LOS_ERRNO_QUEUE_TIMEOUT                The time set for waiting to processing the queue expires.
+ *@par Dependency:
+ *<ul><li>los_queue.h: The header file that contains the API declaration.</li></ul>
+ *@see LOS_QueueCommit | LOS_QueuePeek
+ *@since Huawei LiteOS V100R001C00
+ */
+extern UINT32 LOS_QueueReserve(UINT32 uwQueueID, VOID **ppBuffer, UINT32 uwTimeOut);
+
+/**
+ *@ingroup los_queue
+ *@brief Commit a reserved node.
+ *
+ *@par Description:
+ *This API is used to commit a node reserved by LOS_QueueReserve, making the message in it readable.
+ *@attention
+ *<ul>
+ *<li>The API does not block and can be called in an interrupt.</li>
+ *</ul>
+ *
+ *@param uwQueueID        [IN]        Queue ID created by LOS_QueueCreate.
+ *@param pBuffer          [IN]        Node returned by LOS_QueueReserve.
+ *@param uwBufferSize     [IN]        Size of the message in the node. The value range is [1,usMaxMsgSize].
+ *
+ *@retval   #LOS_OK                                 The node is successfully committed.
+ *@retval   #LOS_ERRNO_QUEUE_INVALID                The queue handle passed in is invalid.
+ *@retval   #LOS_ERRNO_QUEUE_WRITE_PTR_NULL         The pointer passed in is null.
+ *@retval   #LOS_ERRNO_QUEUE_WRITESIZE_ISZERO       The message size passed in is 0.
+ *@retval   #LOS_ERRNO_QUEUE_NOT_CREATE             The queue is not created.
+ *@retval   #LOS_ERRNO_QUEUE_WRITE_SIZE_TOO_BIG     The message size passed in is bigger than the queue node.
+ *@retval   #LOS_ERRNO_QUEUE_BUF_INVALID            The buffer is not a reserved node of the queue.
+ *@par Dependency:
+ *<ul><li>los_queue.h: The header file that contains the API declaration.</li></ul>
+ *@see LOS_QueueReserve
+ *@since Huawei LiteOS V100R001C00
+ */
+extern UINT32 LOS_QueueCommit(UINT32 uwQueueID, VOID *pBuffer, UINT32 uwBufferSize);
+
+/**
+ *@ingroup los_queue
+ *@brief Peek the message at the head of a queue.
+ *
+ *@par Description:
+ *This API is used to take the head message of a queue and read it in place, without the copy of LOS_QueueReadCopy.
+ *The node is given back to writers when it is released by LOS_QueueRelease.
+ *@attention
+ *<ul>
+ *<li>Nodes are given back in peek order. A node released before an earlier peeked one is writable only after that one is released.</li>
+ *<li>LOS_QueueWriteHead fails while peeked nodes are not released.</li>
+ *<li>Do not wait on a queue in an interrupt, uwTimeOut must be LOS_NO_WAIT there.</li>
+ *</ul>
+ *
+ *@param uwQueueID        [IN]        Queue ID created by LOS_QueueCreate.
+ *@param ppBuffer         [OUT]       Address of the node holding the message.
+ *@param puwBufferSize    [OUT]       Size of the message.
+ *@param uwTimeOut        [IN]        Expiry time. The value range is [0,LOS_WAIT_FOREVER](unit: Tick).
+ *
+ *@retval   #LOS_OK                                 The message is successfully peeked.
+ *@retval   #LOS_ERRNO_QUEUE_INVALID                The queue handle passed in is invalid.
+ *@retval   #LOS_ERRNO_QUEUE_READ_PTR_NULL          The pointer passed in is null.
+ *@retval   #LOS_ERRNO_QUEUE_READ_IN_INTERRUPT      The queue cannot be waited on during an interrupt.
+ *@retval   #LOS_ERRNO_QUEUE_NOT_CREATE             The queue is not created.
+ *@retval   #LOS_ERRNO_QUEUE_ISEMPTY                No message is available.
+ *@retval   #LOS_ERRNO_QUEUE_PEND_IN_LOCK           The task is forbidden to be blocked on a queue when the task is locked.
+ *@retval   #LOS_ERRNO_QUEUE_TIMEOUT                The time set for waiting to processing the queue expires.
+ *@par Dependency:
+ *<ul><li>los_queue.h: The header file that contains the API declaration.</li></ul>
+ *@see LOS_QueueRelease | LOS_QueueReserve
+ *@since Huawei LiteOS V100R001C00
+ */
+extern UINT32 LOS_QueuePeek(UINT32 uwQueueID, VOID **ppBuffer, UINT32 *puwBufferSize, UINT32 uwTimeOut);
+
+/**
+ *@ingroup los_queue
+ *@brief Release a peeked node.
+ *
+ *@par Description:
+ *This API is used to release a node taken by LOS_QueuePeek after its message is consumed.
+ *@attention
+ *<ul>
+ *<li>The API does not block and can be called in an interrupt.</li>
+ *</ul>
+ *
+ *@param uwQueueID        [IN]        Queue ID created by LOS_QueueCreate.
+ *@param pBuffer          [IN]        Node returned by LOS_QueuePeek.
+ *
+ *@retval   #LOS_OK                                 The node is successfully released.
+ *@retval   #LOS_ERRNO_QUEUE_INVALID                The queue handle passed in is invalid.
+ *@retval   #LOS_ERRNO_QUEUE_READ_PTR_NULL          The pointer passed in is null.
+ *@retval   #LOS_ERRNO_QUEUE_NOT_CREATE             The queue is not created.
+ *@retval   #LOS_ERRNO_QUEUE_BUF_INVALID            The buffer is not a peeked node of the queue.
+ *@par Dependency:
+ *<ul><li>los_queue.h: The header file that contains the API declaration.</li></ul>
+ *@see LOS_QueuePeek
+ *@since Huawei LiteOS V100R001C00
+ */
+extern UINT32 LOS_QueueRelease(UINT32 uwQueueID, VOID *pBuffer);
+
+/**
+ *@ingroup los_queue
+ *@brief Read several messages from a queue.
+ *
+ *@par Description:
+ *This API is used to read up to *puwCount messages under one interrupt lock. It waits for the first message only,
+ *then reads those already in the queue.
+ *@attention
+ *<ul>
+ *<li>Message n is copied to pBufferAddr + n * uwBufferSize.</li>
+ *<li>Do not wait on a queue in an interrupt, uwTimeOut must be LOS_NO_WAIT there.</li>
+ *</ul>
+ *
+ *@param uwQueueID        [IN]        Queue ID created by LOS_QueueCreate.
+ *@param pBufferAddr      [OUT]       Starting address that stores the messages.
+ *@param uwBufferSize     [IN]        Size of each message buffer, not smaller than the queue node.
+ *@param puwSizes         [OUT]       Size of each message read, NULL if not needed.
+ *@param puwCount         [IN/OUT]    Number of messages wanted before read, and read after read.
+ *@param uwTimeOut        [IN]        Expiry time. The value range is [0,LOS_WAIT_FOREVER](unit: Tick).
+ *
+ *@retval   #LOS_OK                                 At least one message is successfully read.
+ *@retval   #LOS_ERRNO_QUEUE_INVALID                The queue handle passed in is invalid.
+ *@retval   #LOS_ERRNO_QUEUE_READ_PTR_NULL          The pointer passed in is null.
+ *@retval   #LOS_ERRNO_QUEUE_READSIZE_ISZERO        The buffer size passed in is 0.
+ *@retval   #LOS_ERRNO_QUEUE_BATCH_COUNT_INVALID    The message count passed in is null or 0.
+ *@retval   #LOS_ERRNO_QUEUE_READ_IN_INTERRUPT      The queue cannot be waited on during an interrupt.
+ *@retval   #LOS_ERRNO_QUEUE_NOT_CREATE             The queue is not created.
+ *@retval   #LOS_ERRNO_QUEUE_READ_SIZE_TOO_SMALL    The buffer size passed in is smaller than the queue node.
+ *@retval   #LOS_ERRNO_QUEUE_ISEMPTY                No message is available.
+ *@retval   #LOS_ERRNO_QUEUE_PEND_IN_LOCK           The task is forbidden to be blocked on a queue when the task is locked.
+ *@retval   #LOS_ERRNO_QUEUE_TIMEOUT                The time set for waiting to processing the queue expires.
+ *@par Dependency:
+ *<ul><li>los_queue.h: The header file that contains the API declaration.</li></ul>
+ *@see LOS_QueueWriteBatch | LOS_QueueReadCopy
+ *@since Huawei LiteOS V100R001C00
+ */
+extern UINT32 LOS_QueueReadBatch(UINT32 uwQueueID,
+                                 VOID *pBufferAddr,
+                                 UINT32 uwBufferSize,
+                                 UINT32 *puwSizes,
+                                 UINT32 *puwCount,
+                                 UINT32 uwTimeOut);
+
+/**
+ *@ingroup los_queue
+ *@brief Write several messages into a queue tail.
+ *
+ *@par Description:
+ *This API is used to write up to *puwCount messages of uwBufferSize bytes under one interrupt lock. It waits for the
+ *first free node only, then writes as many messages as there are free nodes.
+ *@attention
+ *<ul>
+ *<li>Message n is copied from pBufferAddr + n * uwBufferSize.</li>
+ *<li>Do not wait on a queue in an interrupt, uwTimeOut must be LOS_NO_WAIT there.</li>
+ *</ul>
+ *
+ *@param uwQueueID        [IN]        Queue ID created by LOS_QueueCreate.
+ *@param pBufferAddr      [IN]        Starting address of the messages.
+ *@param uwBufferSize     [IN]        Size of each message. The value range is [1,usMaxMsgSize].
+ *@param puwCount         [IN/OUT]    Number of messages to write before write, and written after write.
+ *@param uwTimeOut        [IN]        Expiry time. The value range is [0,LOS_WAIT_FOREVER](unit: Tick).
+ *
+ *@retval   #LOS_OK                                 At least one message is successfully written.
+ *@retval   #LOS_ERRNO_QUEUE_INVALID                The queue handle passed in is invalid.
+ *@retval   #LOS_ERRNO_QUEUE_WRITE_PTR_NULL         The pointer passed in is null.
+ *@retval   #LOS_ERRNO_QUEUE_WRITESIZE_ISZERO       The message size passed in is 0.
+ *@retval   #LOS_ERRNO_QUEUE_BATCH_COUNT_INVALID    The message count passed in is null or 0.
+ *@retval   #LOS_ERRNO_QUEUE_WRITE_IN_INTERRUPT     The queue cannot be waited on during an interrupt.
+ *@retval   #LOS_ERRNO_QUEUE_NOT_CREATE             The queue is not created.
+ *@retval   #LOS_ERRNO_QUEUE_WRITE_SIZE_TOO_BIG     The message size passed in is bigger than the queue node.
+ *@retval   #LOS_ERRNO_QUEUE_ISFULL                 No free node is available.
+ *@retval   #LOS_ERRNO_QUEUE_PEND_IN_LOCK           The task is forbidden to be blocked on a queue when the task is locked.
+ *@retval   #LOS_ERRNO_QUEUE_TIMEOUT                The time set for waiting to processing the queue expires.
+ *@par Dependency:
+ *<ul><li>los_queue.h: The header file that contains the API declaration.</li></ul>
+ *@see LOS_QueueReadBatch | LOS_QueueWriteCopy
+ *@since Huawei LiteOS V100R001C00
+ */
+extern UINT32 LOS_QueueWriteBatch(UINT32 uwQueueID,
+                                  VOID *pBufferAddr,
+                                  UINT32 uwBufferSize,
+                                  UINT32 *puwCount,
+                                  UINT32 uwTimeOut);
+
 
  /**
   *@ingroup los_queue
@@ -640,7 +943,7 @@ extern UINT32 LOS_QueueWriteHeadCopy(UINT32 uwQueueID,
   *<li>A synchronous queue fails to be deleted if any tasks are blocked on it, or some queues are being read or written.</li>
   *</ul>
   *
-  *@param uwQueueID     [IN]      Queue ID created by LOS_QueueCreate. The value range is [1,LOSCFG_BASE_IPC_QUEUE_LIMIT].
+  *@param uwQueueID     [IN]      Queue ID created by LOS_QueueCreate.
   *
   *@retval   #LOS_OK                           The queue is successfully deleted.
   *@retval   #LOS_ERRNO_QUEUE_NOT_FOUND        The queue cannot be found.
@@ -664,7 +967,7 @@ extern UINT32 LOS_QueueDelete(UINT32 uwQueueID);
  *<ul>
  *<li>The specific queue should be created firstly.</li>
  *</ul>
- *@param uwQueueID       [IN]        Queue ID created by LOS_QueueCreate. The value range is [1,LOSCFG_BASE_IPC_QUEUE_LIMIT].
+ *@param uwQueueID       [IN]        Queue ID created by LOS_QueueCreate.
  *@param pstQueueInfo    [OUT]       The queue information to be read must not be null.
  *
  *@retval   #LOS_OK                            The queue information is successfully obtained.
@@ -679,6 +982,32 @@ extern UINT32 LOS_QueueDelete(UINT32 uwQueueID);
  */
 extern UINT32 LOS_QueueInfoGet(UINT32 uwQueueID, QUEUE_INFO_S *pstQueueInfo);
 
+/**
+ *@ingroup los_queue
+ *@brief Set the pend order of a queue.
+ *
+ *@par Description:
+ *This API is used to set the order in which the tasks pending on a queue are woken up.
+ *@attention
+ *<ul>
+ *<li>The tasks that are already pending are reordered.</li>
+ *<li>With LOS_PEND_PRIO a task that changes its priority while pending moves to its new place.</li>
+ *</ul>
+ *
+ *@param uwQueueID     [IN] Queue ID created by LOS_QueueCreate.
+ *@param uwPendOrder   [IN] LOS_PEND_FIFO (default) or LOS_PEND_PRIO.
+ *
+ *@retval #LOS_ERRNO_QUEUE_INVALID          The queue ID passed in is invalid.
+ *@retval #LOS_ERRNO_QUEUE_NOT_CREATE       The queue is not created.
+ *@retval #LOS_ERRNO_QUEUE_PEND_ORDER_INVALID Invalid pend order.
+ *@retval #LOS_OK                           The pend order is successfully set.
+ *@par Dependency:
+ *<ul><li>los_queue.h: the header file that contains the API declaration.</li></ul>
+ *@see LOS_QueueRead | LOS_QueueWrite
+ *@since Huawei LiteOS V100R001C00
+ */
+extern UINT32 LOS_QueuePendOrderSet(UINT32 uwQueueID, UINT32 uwPendOrder);
+
 
 #ifdef __cplusplus
 #if __cplusplus
@@ -0,0 +1,311 @@
+/*----------------------------------------------------------------------------
+ * Copyright (c) <2013-2015>, <Huawei Technologies Co., Ltd>
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *---------------------------------------------------------------------------*/
+/*----------------------------------------------------------------------------
+ * Notice of Export Control Law
+ * ===============================================
+ * Huawei LiteOS may be subject to applicable export control laws and regulations, which might
+ * include those applicable to Huawei LiteOS of U.S. and the country in which you are located.
+ * Import, export and usage of Huawei LiteOS in any manner by you shall be in compliance with such
+ * applicable export control laws and regulations.
+ *---------------------------------------------------------------------------*/
+
+/**@defgroup los_ringbuf Ring buffer
+ * @ingroup kernel
+ */
+
+#ifndef _LOS_RINGBUF_H
+#define _LOS_RINGBUF_H
+
+#include "los_base.h"
+#include "los_list.h"
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+#endif /* __cplusplus */
+
+/**
+ * @ingroup los_ringbuf
+ * Ring buffer error code: Null pointer.
+ *
+ * Value: 0x02002100
+ *
+ * Solution: Check whether the input parameter is null.
+ */
+#define LOS_ERRNO_RINGBUF_PTR_NULL                  LOS_ERRNO_OS_ERROR(LOS_MOD_RINGBUF, 0x00)
+
+/**
+ * @ingroup los_ringbuf
+ * Ring buffer error code: The size is not a power of 2 or is larger than LOS_RINGBUF_SIZE_MAX.
+ *
+ * Value: 0x02002101
+ *
+ * Solution: Pass in a power of 2 not larger than LOS_RINGBUF_SIZE_MAX.
+ */
+#define LOS_ERRNO_RINGBUF_SIZE_INVALID              LOS_ERRNO_OS_ERROR(LOS_MOD_RINGBUF, 0x01)
+
+/**
+ * @ingroup los_ringbuf
+ * Ring buffer error code: The mode is neither LOS_RINGBUF_SPSC nor LOS_RINGBUF_MPSC.
+ *
+ * Value: 0x02002102
+ *
+ * Solution: Pass in LOS_RINGBUF_SPSC or LOS_RINGBUF_MPSC.
+ */
+#define LOS_ERRNO_RINGBUF_MODE_INVALID              LOS_ERRNO_OS_ERROR(LOS_MOD_RINGBUF, 0x02)
+
+/**
+ * @ingroup los_ringbuf
+ * Ring buffer error code: The number of bytes waited for is 0 or larger than the ring buffer.
+ *
+ * Value: 0x02002103
+ *
+ * Solution: Wait for 1 to size bytes.
+ */
+#define LOS_ERRNO_RINGBUF_LEN_INVALID               LOS_ERRNO_OS_ERROR(LOS_MOD_RINGBUF, 0x03)
+
+/**
+ * @ingroup los_ringbuf
+ * Ring buffer error code: The wait is requested during an interrupt.
+ *
+ * Value: 0x03002104
+ *
+ * Solution: Perform this operation after exiting from the interrupt.
+ */
+#define LOS_ERRNO_RINGBUF_IN_INT                    LOS_ERRNO_OS_FATAL(LOS_MOD_RINGBUF, 0x04)
+
+/**
+ * @ingroup los_ringbuf
+ * Ring buffer error code: The wait would block when the task is locked.
+ *
+ * Value: 0x02002105
+ *
+ * Solution: Perform this operation after unlocking the task.
+ */
+#define LOS_ERRNO_RINGBUF_IN_LOCK                   LOS_ERRNO_OS_ERROR(LOS_MOD_RINGBUF, 0x05)
+
+/**
+ * @ingroup los_ringbuf
+ * Ring buffer error code: Another task is already waiting on the ring buffer.
+ *
+ * Value: 0x02002106
+ *
+ * Solution: Consume a ring buffer from one task only.
+ */
+#define LOS_ERRNO_RINGBUF_BUSY                      LOS_ERRNO_OS_ERROR(LOS_MOD_RINGBUF, 0x06)
+
+/**
+ * @ingroup los_ringbuf
+ * Ring buffer error code: Not enough data arrives before the timeout.
+ *
+ * Value: 0x02002107
+ *
+ * Solution: Increase the timeout.
+ */
+#define LOS_ERRNO_RINGBUF_TIMEOUT                   LOS_ERRNO_OS_ERROR(LOS_MOD_RINGBUF, 0x07)
+
+/**
+ * @ingroup los_ringbuf
+ * Mode: one producer and one consumer.
+ */
+#define LOS_RINGBUF_SPSC                            0
+
+/**
+ * @ingroup los_ringbuf
+ * Mode: several producers, for example interrupts of different priorities, and one consumer.
+ */
+#define LOS_RINGBUF_MPSC                            1
+
+/**
+ * @ingroup los_ringbuf
+ * Largest ring buffer size in bytes.
+ */
+#define LOS_RINGBUF_SIZE_MAX                        0x00800000
+
+/**
+ * @ingroup los_ringbuf
+ * Cache line size the producer and consumer members of a ring buffer are kept apart by.
+ */
+#define LOS_RINGBUF_CACHE_LINE                      32
+
+/**
+ * @ingroup los_ringbuf
+ * Ring buffer control block, owned by the caller. The members are kernel internal.
+ *
+ * The producer and consumer indexes are on different cache lines, place the control block on a
+ * LOS_RINGBUF_CACHE_LINE boundary to keep them there.
+ */
+typedef struct tagRingBuf
+{
+    volatile UINT32 uwHead;         /**< Published write index */
+    volatile UINT32 uwClaim;        /**< Claimed write index, and number of producers writing in the top byte, MPSC only */
+    UINT8           *pucBuf;        /**< Storage */
+    UINT32          uwMask;         /**< Size - 1 */
+    UINT32          uwMode;         /**< LOS_RINGBUF_SPSC or LOS_RINGBUF_MPSC */
+    UINT8           aucPad[LOS_RINGBUF_CACHE_LINE - 4 * sizeof(UINT32) - sizeof(UINT8 *)];
+    volatile UINT32 uwTail;         /**< Read index */
+    UINT32          uwWaitLen;      /**< Bytes the waiting consumer wants */
+    LOS_DL_LIST     stWaitList;     /**< Waiting consumer */
+} RINGBUF_S;
+
+/**
+ * @ingroup los_ringbuf
+ * @brief Initialize a ring buffer.
+ *
+ * @par Description:
+ * This API is used to initialize a byte ring buffer on storage provided by the caller.
+ *
+ * @attention
+ * <ul>
+ * <li>uwSize must be a power of 2. All of it can be filled.</li>
+ * <li>In LOS_RINGBUF_SPSC mode only one context may push at a time. Use LOS_RINGBUF_MPSC when interrupts
+ * of different priorities, or tasks and interrupts, push to the same ring buffer.</li>
+ * <li>There is a single consumer in both modes.</li>
+ * </ul>
+ *
+ * @param  pstRing  [OUT] Type #RINGBUF_S * Ring buffer control block.
+ * @param  pBuf     [IN] Type #VOID * Storage.
+ * @param  uwSize   [IN] Type #UINT32 Size of pBuf in bytes.
+ * @param  uwMode   [IN] Type #UINT32 LOS_RINGBUF_SPSC or LOS_RINGBUF_MPSC.
+ *
+ * @retval #LOS_ERRNO_RINGBUF_PTR_NULL          pstRing or pBuf is NULL.
+ * @retval #LOS_ERRNO_RINGBUF_SIZE_INVALID      uwSize is invalid.
+ * @retval #LOS_ERRNO_RINGBUF_MODE_INVALID      uwMode is invalid.
+ * @retval #LOS_OK                              The ring buffer is initialized.
+ * @par Dependency:
+ * <ul><li>los_ringbuf.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_RingBufPush | LOS_RingBufPop
+ * @since Huawei LiteOS V100R001C00
+ */
+extern UINT32 LOS_RingBufInit(RINGBUF_S *pstRing, VOID *pBuf, UINT32 uwSize, UINT32 uwMode);
+
+/**
+ * @ingroup los_ringbuf
+ * @brief Push bytes into a ring buffer.
+ *
+ * @par Description:
+ * This API is used to copy as many of the uwLen bytes at pData as fit into the ring buffer. It never blocks and
+ * takes no interrupt lock except on Cortex-M0, or to wake a consumer waiting in LOS_RingBufWait.
+ *
+ * @attention
+ * <ul>
+ * <li>Bytes that do not fit are not pushed, the caller counts them as overrun.</li>
+ * <li>In LOS_RINGBUF_MPSC mode the bytes of one push stay contiguous.</li>
+ * <li>Do not push from interrupts above the kernel interrupt lock when a consumer waits in LOS_RingBufWait.</li>
+ * </ul>
+ *
+ * @param  pstRing  [IN] Type #RINGBUF_S * Ring buffer control block.
+ * @param  pData    [IN] Type #const VOID * Bytes to push.
+ * @param  uwLen    [IN] Type #UINT32 Number of bytes to push.
+ *
+ * @retval #UINT32  Number of bytes pushed, 0 if a pointer is NULL.
+ * @par Dependency:
+ * <ul><li>los_ringbuf.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_RingBufPop
+ * @since Huawei LiteOS V100R001C00
+ */
+extern UINT32 LOS_RingBufPush(RINGBUF_S *pstRing, const VOID *pData, UINT32 uwLen);
+
+/**
+ * @ingroup los_ringbuf
+ * @brief Pop bytes from a ring buffer.
+ *
+ * @par Description:
+ * This API is used to copy up to uwLen bytes out of the ring buffer. It never blocks.
+ *
+ * @attention
+ * <ul>
+ * <li>Only one context may pop at a time.</li>
+ * </ul>
+ *
+ * @param  pstRing  [IN] Type #RINGBUF_S * Ring buffer control block.
+ * @param  pData    [OUT] Type #VOID * Where to copy the bytes.
+ * @param  uwLen    [IN] Type #UINT32 Size of pData in bytes.
+ *
+ * @retval #UINT32  Number of bytes popped, 0 if a pointer is NULL.
+ * @par Dependency:
+ * <ul><li>los_ringbuf.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_RingBufPush | LOS_RingBufWait
+ * @since Huawei LiteOS V100R001C00
+ */
+extern UINT32 LOS_RingBufPop(RINGBUF_S *pstRing, VOID *pData, UINT32 uwLen);
+
+/**
+ * @ingroup los_ringbuf
+ * @brief Get the number of bytes in a ring buffer.
+ *
+ * @par Description:
+ * This API is used to get the number of bytes that can be popped.
+ *
+ * @param  pstRing  [IN] Type #RINGBUF_S * Ring buffer control block.
+ *
+ * @retval #UINT32  Number of bytes, 0 if pstRing is NULL.
+ * @par Dependency:
+ * <ul><li>los_ringbuf.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_RingBufPop
+ * @since Huawei LiteOS V100R001C00
+ */
+extern UINT32 LOS_RingBufUsed(RINGBUF_S *pstRing);
+
+/**
+ * @ingroup los_ringbuf
+ * @brief Wait for bytes in a ring buffer.
+ *
+ * @par Description:
+ * This API is used to block the consumer task until at least uwLen bytes can be popped.
+ *
+ * @attention
+ * <ul>
+ * <li>Nothing is popped, call LOS_RingBufPop afterwards.</li>
+ * <li>This API cannot be called in interrupts or, if it would block, when the task scheduling is locked.</li>
+ * </ul>
+ *
+ * @param  pstRing   [IN] Type #RINGBUF_S * Ring buffer control block.
+ * @param  uwLen     [IN] Type #UINT32 Number of bytes to wait for, in [1, size].
+ * @param  uwTimeOut [IN] Type #UINT32 Timeout in ticks, #LOS_WAIT_FOREVER to wait forever.
+ *
+ * @retval #LOS_ERRNO_RINGBUF_PTR_NULL          pstRing is NULL.
+ * @retval #LOS_ERRNO_RINGBUF_LEN_INVALID       uwLen is invalid.
+ * @retval #LOS_ERRNO_RINGBUF_IN_INT            The API is called in an interrupt.
+ * @retval #LOS_ERRNO_RINGBUF_IN_LOCK           The API would block when the task scheduling is locked.
+ * @retval #LOS_ERRNO_RINGBUF_BUSY              Another task is waiting on the ring buffer.
+ * @retval #LOS_ERRNO_RINGBUF_TIMEOUT           Not enough bytes arrive before the timeout, or uwTimeOut is 0.
+ * @retval #LOS_OK                              At least uwLen bytes can be popped.
+ * @par Dependency:
+ * <ul><li>los_ringbuf.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_RingBufPop
+ * @since Huawei LiteOS V100R001C00
+ */
+extern UINT32 LOS_RingBufWait(RINGBUF_S *pstRing, UINT32 uwLen, UINT32 uwTimeOut);
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* __cplusplus */
+
+#endif /* _LOS_RINGBUF_H */
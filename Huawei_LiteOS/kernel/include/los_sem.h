@@ -152,6 +152,16 @@ extern "C" {
  */
 #define LOS_ERRNO_SEM_PENDED                    LOS_ERRNO_OS_ERROR(LOS_MOD_SEM, 0x09)
 
+/**
+ * @ingroup los_sem
+ * Semaphore error code: Invalid pend order.
+ *
+ * Value: 0x0200070a
+ *
+ * Solution: Pass in LOS_PEND_FIFO or LOS_PEND_PRIO.
+ */
+#define LOS_ERRNO_SEM_PEND_ORDER_INVALID        LOS_ERRNO_OS_ERROR(LOS_MOD_SEM, 0x0a)
+
 /**
  *@ingroup los_sem
  *@brief Create a Counting semaphore.
@@ -275,6 +285,31 @@ extern UINT32 LOS_SemPend(UINT32 uwSemHandle, UINT32 uwTimeout);
  */
 extern UINT32 LOS_SemPost(UINT32 uwSemHandle);
 
+/**
+ *@ingroup los_sem
+ *@brief Set the pend order of a semaphore.
+ *
+ *@par Description:
+ *This API is used to set the order in which the tasks pending on a semaphore are woken up.
+ *@attention
+ *<ul>
+ *<li>The tasks that are already pending are reordered.</li>
+ *<li>With LOS_PEND_PRIO a task that changes its priority while pending moves to its new place.</li>
+ *</ul>
+ *
+ *@param uwSemHandle   [IN] ID of the semaphore control structure.
+ *@param uwPendOrder   [IN] LOS_PEND_FIFO (default) or LOS_PEND_PRIO.
+ *
+ *@retval #LOS_ERRNO_SEM_INVALID            The passed-in uwSemHandle value is invalid.
+ *@retval #LOS_ERRNO_SEM_PEND_ORDER_INVALID Invalid pend order.
+ *@retval #LOS_OK                           The pend order is successfully set.
+ *@par Dependency:
+ *<ul><li>los_sem.h: the header file that contains the API declaration.</li></ul>
+ *@see LOS_SemPend
+ *@since Huawei LiteOS V100R001C00
+ */
+extern UINT32 LOS_SemPendOrderSet(UINT32 uwSemHandle, UINT32 uwPendOrder);
+
 
 #ifdef __cplusplus
 #if __cplusplus
@@ -40,6 +40,7 @@
 #define _LOS_SLAB_H
 
 #include <los_typedef.h>
+#include "los_config.h"
 
 #ifdef __cplusplus
 #if __cplusplus
@@ -48,13 +49,72 @@ extern "C" {
 #endif /* __cplusplus */
 
 //number of slab class
+#ifdef LOSCFG_SLAB_MEM_COUNT
+#define SLAB_MEM_COUNT LOSCFG_SLAB_MEM_COUNT
+#else
 #define SLAB_MEM_COUNT 4
+#endif
+
+//{block size, blocks per slab page} of each class, in ascending block size
+#ifdef LOSCFG_SLAB_CLASS_TABLE
+#define SLAB_CLASS_TABLE LOSCFG_SLAB_CLASS_TABLE
+#else
+#define SLAB_CLASS_TABLE {{0x10, 32}, {0x20, 16}, {0x40, 8}, {0x80, 4}}
+#endif
 
-//max size of each class
-#define SLAB_MEM_ALLOCATOR_SIZE 512
+//max number of slab pages of each class, the pages after the first are added when the class is full
+#ifdef LOSCFG_SLAB_PAGE_MAX
+#define SLAB_PAGE_MAX LOSCFG_SLAB_PAGE_MAX
+#else
+#define SLAB_PAGE_MAX 1
+#endif
 
 #define SLAB_BASIC_NEED_SIZE 0x1000
 
+/**
+ * @ingroup los_slab
+ * Slab class status
+ */
+typedef struct tagSlabClassStatus
+{
+    UINT32 uwBlkSize;       /**< Block size of the class                                     */
+    UINT32 uwBlkCnt;        /**< Number of blocks in all the pages of the class              */
+    UINT32 uwBlkUsedCnt;    /**< Number of blocks allocated                                  */
+    UINT32 uwPageCnt;       /**< Number of slab pages                                        */
+    UINT32 uwHitCnt;        /**< Requests of the class served by the class                   */
+    UINT32 uwMissCnt;       /**< Requests of the class served by a larger class              */
+    UINT32 uwFallbackCnt;   /**< Requests of the class left to the heap, every class was full */
+} LOS_SLAB_CLASS_STATUS;
+
+/**
+ *@ingroup los_slab
+ *@brief Get the status of a slab class.
+ *
+ *@par Description:
+ *<ul>
+ *<li>This API is used to get the size, usage and hit/miss/fallback counters of a slab class of a memory pool.</li>
+ *</ul>
+ *@attention
+ *<ul>
+ *<li>The counters count the requests whose size selects the class, a request served by a larger class counts as a
+ *miss of the class it selected.</li>
+ *</ul>
+ *
+ *@param pPool        [IN]  Memory pool address.
+ *@param uwClassIdx   [IN]  Class index, less than SLAB_MEM_COUNT.
+ *@param pstStatus    [OUT] Class status.
+ *
+ *@retval #LOS_NOK    The parameter is invalid or the pool has no slab.
+ *@retval #LOS_OK     The status is got.
+ *@par Dependency:
+ *<ul>
+ *<li>los_slab.h: the header file that contains the API declaration.</li>
+ *</ul>
+ *@see LOS_MemStatisticsGet
+ *@since Huawei LiteOS V100R002C00
+ */
+extern UINT32 LOS_SlabClassStatusGet(VOID *pPool, UINT32 uwClassIdx, LOS_SLAB_CLASS_STATUS *pstStatus);
+
 #ifdef __cplusplus
 #if __cplusplus
 }
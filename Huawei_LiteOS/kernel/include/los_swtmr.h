@@ -283,27 +283,6 @@ enum enSwTmrType
 */
 typedef VOID (*SWTMR_PROC_FUNC)(UINT32 uwPar);
 
-/**
- * @ingroup los_swtmr
- * Software timer control structure
- */
-typedef struct tagSwTmrCtrl
-{
-    struct tagSwTmrCtrl *pstNext;       /**< Pointer to the next software timer                      */
-    UINT8               ucState;        /**< Software timer state                                    */
-    UINT8               ucMode;         /**< Software timer mode                                     */
-#if (LOSCFG_BASE_CORE_SWTMR_ALIGN == YES)
-    UINT8               ucRouses;       /*wake up enable                                             */
-    UINT8               ucSensitive;    /*align enable                                               */
-#endif
-    UINT16              usTimerID;      /**< Software timer ID                                       */
-    UINT32              uwCount;        /**< Times that a software timer works                       */
-    UINT32              uwInterval;     /**< Timeout interval of a periodic software timer           */
-    UINT32              uwArg;          /**< Parameter passed in when the callback function that handles software timer timeout is called */
-    SWTMR_PROC_FUNC     pfnHandler;     /**< Callback function that handles software timer timeout   */
-} SWTMR_CTRL_S;
-
-
 /**
  *@ingroup los_swtmr
  *@brief Start a software timer.
@@ -315,7 +294,7 @@ typedef struct tagSwTmrCtrl
  *<li>The specific timer must be created first</li>
  *</ul>
  *
- *@param  usSwTmrID  [IN] Software timer ID created by LOS_SwtmrCreate. The value of ID should be in [0, LOSCFG_BASE_CORE_SWTMR_LIMIT - 1].
+ *@param  usSwTmrID  [IN] Software timer ID created by LOS_SwtmrCreate.
  *
  *@retval #LOS_ERRNO_SWTMR_ID_INVALID       Invalid software timer ID.
  *@retval #LOS_ERRNO_SWTMR_NOT_CREATED      The software timer is not created.
@@ -339,7 +318,7 @@ extern UINT32 LOS_SwtmrStart(UINT16 usSwTmrID);
  *<li>The specific timer should be created and started firstly.</li>
  *</ul>
  *
- *@param  usSwTmrID  [IN] Software timer ID created by LOS_SwtmrCreate. The value of ID should be in [0, LOSCFG_BASE_CORE_SWTMR_LIMIT - 1].
+ *@param  usSwTmrID  [IN] Software timer ID created by LOS_SwtmrCreate.
  *
  *@retval #LOS_ERRNO_SWTMR_ID_INVALID       Invalid software timer ID.
  *@retval #LOS_ERRNO_SWTMR_NOT_CREATED      The software timer is not created.
@@ -364,7 +343,7 @@ extern UINT32 LOS_SwtmrStop(UINT16 usSwTmrID);
  *<li>The specific timer should be created and started successfully, error happends otherwise.</li>
  *</ul>
  *
- *@param  usSwTmrID  [IN]  Software timer ID created by LOS_SwtmrCreate. The value of ID should be in [0, LOSCFG_BASE_CORE_SWTMR_LIMIT - 1].
+ *@param  usSwTmrID  [IN]  Software timer ID created by LOS_SwtmrCreate.
  *@param  uwTick     [OUT] Number of remaining Ticks configured on the software timer.
  *
  *@retval #LOS_ERRNO_SWTMR_ID_INVALID      Invalid software timer ID.
@@ -388,7 +367,8 @@ extern UINT32 LOS_SwtmrTimeGet(UINT16 usSwTmrID, UINT32 *uwTick);
  *@attention
  *<ul>
  *<li>Do not use the delay interface in the callback function that handles software timer timeout.</li>
- *<li>Threre are LOSCFG_BASE_CORE_SWTMR_LIMIT timers available, change it's value when necessory.</li>
+ *<li>Threre are LOSCFG_BASE_CORE_SWTMR_LIMIT timers available, or the uwSwtmrLimit passed to LOS_KernelInitConfig, change it's value when necessory.</li>
+ *<li>The control blocks are allocated from the system memory pool LOSCFG_BASE_CORE_SWTMR_ALLOC_STEP at a time when no free one is left.</li>
  *</ul>
  *
  *@param  uwInterval     [IN] Timing duration of the software timer to be created (unit: ms).
@@ -402,6 +382,7 @@ extern UINT32 LOS_SwtmrTimeGet(UINT16 usSwTmrID, UINT32 *uwTick);
  *@retval #LOS_ERRNO_SWTMR_PTR_NULL              The callback function that handles software timer timeout is NULL.
  *@retval #LOS_ERRNO_SWTMR_RET_PTR_NULL          The passed-in software timer ID is NULL.
  *@retval #LOS_ERRNO_SWTMR_MAXSIZE               The number of software timers exceeds the configured permitted maximum number.
+ *@retval #LOS_ERRNO_SWTMR_NO_MEMORY             Insufficient memory for the software timer control blocks.
  *@retval #LOS_OK                                The software timer is successfully created.
  *@par Dependency:
  *<ul><li>los_swtmr.h: the header file that contains the API declaration.</li></ul>
@@ -425,7 +406,7 @@ extern UINT32 LOS_SwtmrTimeGet(UINT16 usSwTmrID, UINT32 *uwTick);
  *<li>The specific timer should be created and then stopped firstly.</li>
  *</ul>
  *
- *@param  usSwTmrID     [IN] Software timer ID created by LOS_SwtmrCreate. The value of ID should be in [0, LOSCFG_BASE_CORE_SWTMR_LIMIT - 1].
+ *@param  usSwTmrID     [IN] Software timer ID created by LOS_SwtmrCreate.
  *
  *@retval #LOS_ERRNO_SWTMR_ID_INVALID        Invalid software timer ID.
  *@retval #LOS_ERRNO_SWTMR_NOT_CREATED       The software timer is not created.
@@ -198,6 +198,28 @@ extern UINT32 LOS_Tick2MS(UINT32 uwTick);
  */
 extern UINT32 LOS_MS2Tick(UINT32 uwMillisec);
 
+/**
+ *@ingroup los_sys
+ *@brief Obtain the number of cycles since the system started.
+ *
+ *@par Description:
+ *This API is used to obtain the 64-bit cycle count, derived from the tick count and the tick timer.
+ *@attention
+ *<ul>
+ *<li>None</li>
+ *</ul>
+ *
+ *@param  puwCntHi  [OUT] High 32 bits of the cycle count.
+ *@param  puwCntLo  [OUT] Low 32 bits of the cycle count.
+ *
+ *@retval None.
+ *@par Dependency:
+ *<ul><li>los_sys.h: the header file that contains the API declaration.</li></ul>
+ *@see LOS_TickCountGet
+ *@since Huawei LiteOS V100R001C00
+ */
+extern VOID LOS_GetCpuCycle(UINT32 *puwCntHi, UINT32 *puwCntLo);
+
 #ifdef __cplusplus
 #if __cplusplus
 }
@@ -373,6 +373,104 @@ extern "C" {
  */
 #define LOS_ERRNO_TSK_SUSPEND_SWTMR_NOT_ALLOWED                LOS_ERRNO_OS_ERROR(LOS_MOD_TSK, 0x21)
 
+/**
+ * @ingroup los_task
+ * Task error code: The notification action is invalid.
+ *
+ * Value: 0x02000222
+ *
+ * Solution: Pass LOS_NOTIFY_SET_BITS, LOS_NOTIFY_INCREMENT or LOS_NOTIFY_OVERWRITE.
+ */
+#define LOS_ERRNO_TSK_NOTIFY_ACTION_INVALID         LOS_ERRNO_OS_ERROR(LOS_MOD_TSK, 0x22)
+
+/**
+ * @ingroup los_task
+ * Task error code: The notification mask is 0 or the wait mode is invalid.
+ *
+ * Value: 0x02000223
+ *
+ * Solution: Pass a non-zero mask and one of LOS_WAITMODE_AND or LOS_WAITMODE_OR, optionally with LOS_WAITMODE_CLR.
+ */
+#define LOS_ERRNO_TSK_NOTIFY_MODE_INVALID           LOS_ERRNO_OS_ERROR(LOS_MOD_TSK, 0x23)
+
+/**
+ * @ingroup los_task
+ * Task error code: The notification is waited for during an interrupt.
+ *
+ * Value: 0x03000224
+ *
+ * Solution: Perform this operation after exiting from the interrupt.
+ */
+#define LOS_ERRNO_TSK_NOTIFY_IN_INT                 LOS_ERRNO_OS_FATAL(LOS_MOD_TSK, 0x24)
+
+/**
+ * @ingroup los_task
+ * Task error code: The notification is waited for when the task is locked.
+ *
+ * Value: 0x02000225
+ *
+ * Solution: Perform this operation after unlocking the task.
+ */
+#define LOS_ERRNO_TSK_NOTIFY_IN_LOCK                LOS_ERRNO_OS_ERROR(LOS_MOD_TSK, 0x25)
+
+/**
+ * @ingroup los_task
+ * Task error code: The notification is not available and the timeout is 0.
+ *
+ * Value: 0x02000226
+ *
+ * Solution: Wait with a non-zero timeout or try again later.
+ */
+#define LOS_ERRNO_TSK_NOTIFY_UNAVAILABLE            LOS_ERRNO_OS_ERROR(LOS_MOD_TSK, 0x26)
+
+/**
+ * @ingroup los_task
+ * Task error code: Waiting for the notification times out.
+ *
+ * Value: 0x02000227
+ *
+ * Solution: Increase the timeout.
+ */
+#define LOS_ERRNO_TSK_NOTIFY_TIMEOUT                LOS_ERRNO_OS_ERROR(LOS_MOD_TSK, 0x27)
+
+/**
+ * @ingroup los_task
+ * Task error code: The period of a periodic task is 0.
+ *
+ * Value: 0x02000228
+ *
+ * Solution: Pass a period of at least one tick.
+ */
+#define LOS_ERRNO_TSK_PERIOD_INVALID                LOS_ERRNO_OS_ERROR(LOS_MOD_TSK, 0x28)
+
+/**
+ * @ingroup los_task
+ * Task error code: The task waits for its next release but it is not periodic.
+ *
+ * Value: 0x02000229
+ *
+ * Solution: Make the task periodic with LOS_TaskPeriodSet first.
+ */
+#define LOS_ERRNO_TSK_PERIOD_NOT_SET                LOS_ERRNO_OS_ERROR(LOS_MOD_TSK, 0x29)
+
+/**
+ * @ingroup los_task
+ * Notification action: OR the value into the notification value of the task.
+ */
+#define LOS_NOTIFY_SET_BITS                         0
+
+/**
+ * @ingroup los_task
+ * Notification action: increment the notification value of the task, the value passed in is ignored.
+ */
+#define LOS_NOTIFY_INCREMENT                        1
+
+/**
+ * @ingroup los_task
+ * Notification action: overwrite the notification value of the task.
+ */
+#define LOS_NOTIFY_OVERWRITE                        2
+
 /**
  * @ingroup los_task
  * Define the type of the task switching hook function.
@@ -455,6 +553,42 @@ typedef struct tagTskInfo
     BOOL                bOvf;                       /**< Flag that indicates whether a task stack overflow occurs         */
 } TSK_INFO_S;
 
+/**
+ * @ingroup los_task
+ * Statistics of a periodic task, times are in cycles.
+ */
+typedef struct tagTskPeriodInfo
+{
+    UINT32              uwPeriod;                   /**< Period in ticks                */
+    UINT32              uwDeadline;                 /**< Deadline after each release in ticks */
+    UINT32              uwJobCount;                 /**< Completed jobs                 */
+    UINT32              uwMissCount;                /**< Jobs not completed by their deadline */
+    UINT32              uwSkipCount;                /**< Releases dropped because a job overran into the next one */
+    UINT32              uwExecLast;                 /**< CPU time of the last job, 0 without LOSCFG_BASE_CORE_CPUP */
+    UINT32              uwExecMax;                  /**< Longest CPU time of a job      */
+    UINT32              uwRespLast;                 /**< Release to completion of the last job */
+    UINT32              uwRespMax;                  /**< Longest release to completion  */
+} TSK_PERIOD_INFO_S;
+
+/**
+ * @ingroup los_task
+ * Define the type of the function called when a job of a periodic task misses its deadline.
+ * It is usually called from the tick interrupt and must not block.
+ */
+typedef VOID (*TSK_OVERRUN_FUNC)(UINT32 uwTaskID, TSK_PERIOD_INFO_S *pstInfo);
+
+/**
+ * @ingroup los_task
+ * Parameters of a periodic task.
+ */
+typedef struct tagTskPeriodParam
+{
+    UINT32              uwPeriod;                   /**< Ticks between two releases, not 0 */
+    UINT32              uwOffset;                   /**< Ticks from now to the first release */
+    UINT32              uwDeadline;                 /**< Ticks after each release the job has to complete in, 0 for the period */
+    TSK_OVERRUN_FUNC    pfnOverrun;                 /**< Called when a job misses its deadline, may be NULL */
+} TSK_PERIOD_PARAM_S;
+
 /**
  * @ingroup los_task
  * Task switch information structure.
@@ -487,6 +621,7 @@ typedef struct tagTaskSwitchInfo
  * <li>The task name cannot be null.</li>
  * <li>The pointer to the task executing function cannot be null.</li>
  * <li>The two parameters of this interface is pointer, it should be a correct value, otherwise, the system may be abnormal.</li>
+ * <li>The task control blocks are allocated once at kernel initialization for #LOSCFG_BASE_CORE_TSK_LIMIT tasks (or the lower limit passed to LOS_KernelInitConfig), the table does not grow with the number of tasks created.</li>
  * </ul>
  *
  * @param  puwTaskID    [OUT] Type  #UINT32 * Task ID.
@@ -528,6 +663,7 @@ extern UINT32 LOS_TaskCreateOnly(UINT32 *puwTaskID, TSK_INIT_PARAM_S *pstInitPar
  * <li>The task name cannot be null.</li>
  * <li>The pointer to the task executing function cannot be null.</li>
  * <li>The two parameters of this interface is pointer, it should be a correct value, otherwise, the system may be abnormal.</li>
+ * <li>The task control blocks are allocated once at kernel initialization for #LOSCFG_BASE_CORE_TSK_LIMIT tasks (or the lower limit passed to LOS_KernelInitConfig), the table does not grow with the number of tasks created.</li>
  * </ul>
  *
  * @param  puwTaskID    [OUT] Type  #UINT32 * Task ID.
@@ -551,6 +687,79 @@ extern UINT32 LOS_TaskCreateOnly(UINT32 *puwTaskID, TSK_INIT_PARAM_S *pstInitPar
  */
 extern UINT32 LOS_TaskCreate(UINT32 *puwTaskID, TSK_INIT_PARAM_S *pstInitParam);
 
+/**
+ * @ingroup  los_task
+ * @brief Create a task on a stack provided by the caller and suspend.
+ *
+ * @par Description:
+ * This API is used to create a suspended task like #LOS_TaskCreateOnly, with a stack owned by the caller instead of one
+ * allocated from the system heap, for example a static array placed in fast memory.
+ *
+ * @attention
+ * <ul>
+ * <li>pStackMem and uwStackSize in pstInitParam must both be aligned on the boundary of 8 bytes, uwStackSize is not rounded up and not defaulted.</li>
+ * <li>The stack is not freed when the task is deleted. It must not be reused before the task is deleted.</li>
+ * <li>With LOSCFG_BASE_CORE_TSK_STACK_GUARD, the stack guard takes the 32 bytes at the first 32 bytes boundary of pStackMem, the task gets the memory above them.</li>
+ * <li>The task control block comes from the table allocated at initialization, so no memory is allocated from the heap.</li>
+ * <li>The other restrictions of #LOS_TaskCreateOnly apply.</li>
+ * </ul>
+ *
+ * @param  puwTaskID    [OUT] Type  #UINT32 * Task ID.
+ * @param  pstInitParam [IN]  Type  #TSK_INIT_PARAM_S * Parameter for task creation.
+ * @param  pStackMem    [IN]  Type  #VOID * Task stack of uwStackSize bytes.
+ *
+ * @retval #LOS_ERRNO_TSK_ID_INVALID        Invalid Task ID, param puwTaskID is NULL.
+ * @retval #LOS_ERRNO_TSK_PTR_NULL          Param pstInitParam or pStackMem is NULL.
+ * @retval #LOS_ERRNO_TSK_NAME_EMPTY        The task name is NULL.
+ * @retval #LOS_ERRNO_TSK_ENTRY_NULL        The task entrance is NULL.
+ * @retval #LOS_ERRNO_TSK_PRIOR_ERROR       Incorrect task priority.
+ * @retval #LOS_ERRNO_TSK_STKSZ_NOT_ALIGN   The stack address or size is not aligned on the boundary of 8 bytes.
+ * @retval #LOS_ERRNO_TSK_STKSZ_TOO_SMALL   The task stack size is too small.
+ * @retval #LOS_ERRNO_TSK_TCB_UNAVAILABLE   No free task control block is available.
+ * @retval #LOS_OK                          The task is successfully created.
+ * @par Dependency:
+ * <ul><li>los_task.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_TaskCreateStatic | LOS_TaskDelete
+ * @since Huawei LiteOS V100R001C00
+ */
+extern UINT32 LOS_TaskCreateOnlyStatic(UINT32 *puwTaskID, TSK_INIT_PARAM_S *pstInitParam, VOID *pStackMem);
+
+/**
+ * @ingroup  los_task
+ * @brief Create a task on a stack provided by the caller.
+ *
+ * @par Description:
+ * This API is used to create a task like #LOS_TaskCreate, with a stack owned by the caller instead of one allocated from
+ * the system heap.
+ *
+ * @attention
+ * <ul>
+ * <li>pStackMem and uwStackSize in pstInitParam must both be aligned on the boundary of 8 bytes, uwStackSize is not rounded up and not defaulted.</li>
+ * <li>The stack is not freed when the task is deleted. It must not be reused before the task is deleted.</li>
+ * <li>With LOSCFG_BASE_CORE_TSK_STACK_GUARD, the stack guard takes the 32 bytes at the first 32 bytes boundary of pStackMem, the task gets the memory above them.</li>
+ * <li>The other restrictions of #LOS_TaskCreate apply.</li>
+ * </ul>
+ *
+ * @param  puwTaskID    [OUT] Type  #UINT32 * Task ID.
+ * @param  pstInitParam [IN]  Type  #TSK_INIT_PARAM_S * Parameter for task creation.
+ * @param  pStackMem    [IN]  Type  #VOID * Task stack of uwStackSize bytes.
+ *
+ * @retval #LOS_ERRNO_TSK_ID_INVALID        Invalid Task ID, param puwTaskID is NULL.
+ * @retval #LOS_ERRNO_TSK_PTR_NULL          Param pstInitParam or pStackMem is NULL.
+ * @retval #LOS_ERRNO_TSK_NAME_EMPTY        The task name is NULL.
+ * @retval #LOS_ERRNO_TSK_ENTRY_NULL        The task entrance is NULL.
+ * @retval #LOS_ERRNO_TSK_PRIOR_ERROR       Incorrect task priority.
+ * @retval #LOS_ERRNO_TSK_STKSZ_NOT_ALIGN   The stack address or size is not aligned on the boundary of 8 bytes.
+ * @retval #LOS_ERRNO_TSK_STKSZ_TOO_SMALL   The task stack size is too small.
+ * @retval #LOS_ERRNO_TSK_TCB_UNAVAILABLE   No free task control block is available.
+ * @retval #LOS_OK                          The task is successfully created.
+ * @par Dependency:
+ * <ul><li>los_task.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_TaskCreateOnlyStatic | LOS_TaskDelete
+ * @since Huawei LiteOS V100R001C00
+ */
+extern UINT32 LOS_TaskCreateStatic(UINT32 *puwTaskID, TSK_INIT_PARAM_S *pstInitParam, VOID *pStackMem);
+
 /**
  * @ingroup  los_task
  * @brief Resume a task.
@@ -664,6 +873,33 @@ extern UINT32 LOS_TaskDelete(UINT32 uwTaskID);
  */
 extern UINT32 LOS_TaskDelay(UINT32 uwTick);
 
+/**
+ * @ingroup  los_task
+ * @brief Delay the current task until a tick count.
+ *
+ * @par Description:
+ * This API is used to delay the current task until the tick count returned by #LOS_TickCountGet reaches ullTick.
+ * The wake-up time is absolute, so a loop that adds a fixed period to ullTick does not drift by the time spent
+ * between two calls.
+ *
+ * @attention
+ * <ul>
+ * <li>The delay task cannot be performed during an interrupt or when the task scheduling is locked.</li>
+ * <li>The API returns at once if ullTick has been reached.</li>
+ * </ul>
+ *
+ * @param  ullTick [IN] Type #UINT64 Tick count to wake up at.
+ *
+ * @retval #LOS_ERRNO_TSK_DELAY_IN_INT              The task delay occurs during an interrupt.
+ * @retval #LOS_ERRNO_TSK_DELAY_IN_LOCK             The task delay occurs when the task scheduling is locked.
+ * @retval #LOS_OK                                  The tick count is reached.
+ * @par Dependency:
+ * <ul><li>los_task.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_TaskDelay | LOS_TaskPeriodWait
+ * @since Huawei LiteOS V100R001C00
+ */
+extern UINT32 LOS_TaskDelayUntil(UINT64 ullTick);
+
 /**
  * @ingroup  los_task
  * @brief Lock the task scheduling.
@@ -1019,6 +1255,246 @@ extern BOOL LOS_TaskIsRunning(VOID);
   */
  extern CHAR* LOS_TaskNameGet(UINT32 uwTaskID);
 
+/**
+ * @ingroup  los_task
+ * @brief Notify a task.
+ *
+ * @par Description:
+ * This API is used to update the notification value of a task with uwAction and wake the task up if it waits for
+ * its notification value and the new value satisfies its wait condition.
+ * The notification value is a word in the task control block, so no IPC object is needed to signal a single task.
+ *
+ * @attention
+ * <ul>
+ * <li>This API can be called in interrupts.</li>
+ * <li>#LOS_NOTIFY_INCREMENT ignores uwValue and #LOS_NOTIFY_OVERWRITE drops the previous value even if it has not been consumed.</li>
+ * </ul>
+ *
+ * @param  uwTaskID      [IN]  Type #UINT32 Task ID.
+ * @param  uwValue       [IN]  Type #UINT32 Value applied by uwAction.
+ * @param  uwAction      [IN]  Type #UINT32 #LOS_NOTIFY_SET_BITS, #LOS_NOTIFY_INCREMENT or #LOS_NOTIFY_OVERWRITE.
+ * @param  puwPrevValue  [OUT] Type #UINT32 * Notification value before the update, may be NULL.
+ *
+ * @retval #LOS_ERRNO_TSK_ID_INVALID              Invalid Task ID.
+ * @retval #LOS_ERRNO_TSK_NOTIFY_ACTION_INVALID   Invalid action.
+ * @retval #LOS_ERRNO_TSK_NOT_CREATED             The task is not created.
+ * @retval #LOS_OK                                The task is successfully notified.
+ * @par Dependency:
+ * <ul><li>los_task.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_TaskNotifyWait | LOS_TaskNotifyTake
+ * @since Huawei LiteOS V100R001C00
+ */
+extern UINT32 LOS_TaskNotify(UINT32 uwTaskID, UINT32 uwValue, UINT32 uwAction, UINT32 *puwPrevValue);
+
+/**
+ * @ingroup  los_task
+ * @brief Wait for bits of the notification value.
+ *
+ * @par Description:
+ * This API is used to block the current task until any (#LOS_WAITMODE_OR) or all (#LOS_WAITMODE_AND) of uwBits are
+ * set in its notification value, the same way #LOS_EventRead waits for events.
+ *
+ * @attention
+ * <ul>
+ * <li>This API cannot be called in interrupts or when the task scheduling is locked.</li>
+ * <li>With #LOS_WAITMODE_CLR, uwBits are cleared from the notification value before the API returns.</li>
+ * </ul>
+ *
+ * @param  uwBits    [IN]  Type #UINT32 Bits to wait for, not 0.
+ * @param  uwMode    [IN]  Type #UINT32 #LOS_WAITMODE_AND or #LOS_WAITMODE_OR, optionally with #LOS_WAITMODE_CLR.
+ * @param  uwTimeOut [IN]  Type #UINT32 Timeout in ticks, 0 to poll, #LOS_WAIT_FOREVER to wait forever.
+ * @param  puwValue  [OUT] Type #UINT32 * Notification value before the bits are cleared, may be NULL.
+ *
+ * @retval #LOS_ERRNO_TSK_NOTIFY_MODE_INVALID     The bits are 0 or the mode is invalid.
+ * @retval #LOS_ERRNO_TSK_NOTIFY_IN_INT           The API is called in an interrupt.
+ * @retval #LOS_ERRNO_TSK_NOTIFY_IN_LOCK          The API would block when the task scheduling is locked.
+ * @retval #LOS_ERRNO_TSK_NOTIFY_UNAVAILABLE      The bits are not set and uwTimeOut is 0.
+ * @retval #LOS_ERRNO_TSK_NOTIFY_TIMEOUT          The bits are not set before the timeout.
+ * @retval #LOS_OK                                The bits are set.
+ * @par Dependency:
+ * <ul><li>los_task.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_TaskNotify | LOS_TaskNotifyClear
+ * @since Huawei LiteOS V100R001C00
+ */
+extern UINT32 LOS_TaskNotifyWait(UINT32 uwBits, UINT32 uwMode, UINT32 uwTimeOut, UINT32 *puwValue);
+
+/**
+ * @ingroup  los_task
+ * @brief Take the notification value as a counter.
+ *
+ * @par Description:
+ * This API is used to block the current task until its notification value is not 0, then decrement it, or clear it
+ * if bClear is TRUE. Together with #LOS_NOTIFY_INCREMENT this is a lightweight counting or binary semaphore
+ * owned by the task.
+ *
+ * @attention
+ * <ul>
+ * <li>This API cannot be called in interrupts or when the task scheduling is locked.</li>
+ * </ul>
+ *
+ * @param  bClear    [IN]  Type #BOOL TRUE to clear the value, FALSE to decrement it.
+ * @param  uwTimeOut [IN]  Type #UINT32 Timeout in ticks, 0 to poll, #LOS_WAIT_FOREVER to wait forever.
+ * @param  puwValue  [OUT] Type #UINT32 * Notification value before it is taken, may be NULL.
+ *
+ * @retval #LOS_ERRNO_TSK_NOTIFY_IN_INT           The API is called in an interrupt.
+ * @retval #LOS_ERRNO_TSK_NOTIFY_IN_LOCK          The API would block when the task scheduling is locked.
+ * @retval #LOS_ERRNO_TSK_NOTIFY_UNAVAILABLE      The value is 0 and uwTimeOut is 0.
+ * @retval #LOS_ERRNO_TSK_NOTIFY_TIMEOUT          The value is still 0 at the timeout.
+ * @retval #LOS_OK                                The value is taken.
+ * @par Dependency:
+ * <ul><li>los_task.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_TaskNotify
+ * @since Huawei LiteOS V100R001C00
+ */
+extern UINT32 LOS_TaskNotifyTake(BOOL bClear, UINT32 uwTimeOut, UINT32 *puwValue);
+
+/**
+ * @ingroup  los_task
+ * @brief Clear bits of the notification value.
+ *
+ * @par Description:
+ * This API is used to clear uwBits from the notification value of a task. With uwBits 0 it only reads the value.
+ *
+ * @attention
+ * <ul>
+ * <li>This API can be called in interrupts.</li>
+ * </ul>
+ *
+ * @param  uwTaskID      [IN]  Type #UINT32 Task ID.
+ * @param  uwBits        [IN]  Type #UINT32 Bits to clear.
+ * @param  puwPrevValue  [OUT] Type #UINT32 * Notification value before the bits are cleared, may be NULL.
+ *
+ * @retval #LOS_ERRNO_TSK_ID_INVALID              Invalid Task ID.
+ * @retval #LOS_ERRNO_TSK_NOT_CREATED             The task is not created.
+ * @retval #LOS_OK                                The bits are cleared.
+ * @par Dependency:
+ * <ul><li>los_task.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_TaskNotifyWait
+ * @since Huawei LiteOS V100R001C00
+ */
+extern UINT32 LOS_TaskNotifyClear(UINT32 uwTaskID, UINT32 uwBits, UINT32 *puwPrevValue);
+
+#if (LOSCFG_BASE_CORE_TSK_PERIODIC == YES)
+/**
+ * @ingroup  los_task
+ * @brief Make a task periodic.
+ *
+ * @par Description:
+ * This API is used to release the jobs of a task every uwPeriod ticks, the first one uwOffset ticks from now.
+ * The task runs a job after each return of #LOS_TaskPeriodWait. The release times are kept on a fixed grid, so
+ * the time a job takes does not shift the later releases.
+ * With pstParam NULL, the task is no longer periodic.
+ *
+ * @attention
+ * <ul>
+ * <li>The statistics of the task are cleared.</li>
+ * <li>A task already waiting in #LOS_TaskPeriodWait is woken up at the release it waits for, and waits again if
+ * the new first release is later.</li>
+ * </ul>
+ *
+ * @param  uwTaskID  [IN] Type #UINT32 Task ID.
+ * @param  pstParam  [IN] Type #TSK_PERIOD_PARAM_S * Period, offset, deadline and overrun function, may be NULL.
+ *
+ * @retval #LOS_ERRNO_TSK_ID_INVALID              Invalid Task ID.
+ * @retval #LOS_ERRNO_TSK_OPERATE_IDLE            The task is the idle task.
+ * @retval #LOS_ERRNO_TSK_PERIOD_INVALID          The period is 0.
+ * @retval #LOS_ERRNO_TSK_NOT_CREATED             The task is not created.
+ * @retval #LOS_OK                                The period is set.
+ * @par Dependency:
+ * <ul><li>los_task.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_TaskPeriodWait | LOS_TaskPeriodInfoGet
+ * @since Huawei LiteOS V100R001C00
+ */
+extern UINT32 LOS_TaskPeriodSet(UINT32 uwTaskID, TSK_PERIOD_PARAM_S *pstParam);
+
+/**
+ * @ingroup  los_task
+ * @brief Complete the current job and wait for the next release.
+ *
+ * @par Description:
+ * This API is used by a periodic task to account the job it completes and to block until the release of its next
+ * job. A deadline timer is armed for each release. If the deadline passes before the job completes, the tick
+ * that reaches it counts the job as missed and calls the overrun function of the task, even if the task has not
+ * run yet.
+ * If the next release has already passed, the API returns at once. Releases older than the latest passed one are
+ * dropped and counted as skipped, so an overrun does not cause a burst of late jobs.
+ *
+ * @attention
+ * <ul>
+ * <li>This API cannot be called in interrupts or when the task scheduling is locked.</li>
+ * <li>The first call after #LOS_TaskPeriodSet only waits for the first release.</li>
+ * <li>The overrun function runs in the tick interrupt. It runs in the periodic task only when the job completes
+ * after its deadline but before the tick that reports the miss.</li>
+ * </ul>
+ *
+ * @retval #LOS_ERRNO_TSK_DELAY_IN_INT            The API is called in an interrupt.
+ * @retval #LOS_ERRNO_TSK_DELAY_IN_LOCK           The API is called when the task scheduling is locked.
+ * @retval #LOS_ERRNO_TSK_PERIOD_NOT_SET          The current task is not periodic.
+ * @retval #LOS_OK                                The next job is released.
+ * @par Dependency:
+ * <ul><li>los_task.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_TaskPeriodSet
+ * @since Huawei LiteOS V100R001C00
+ */
+extern UINT32 LOS_TaskPeriodWait(VOID);
+
+/**
+ * @ingroup  los_task
+ * @brief Obtain the statistics of a periodic task.
+ *
+ * @par Description:
+ * This API is used to obtain the job counts and the execution and response times of a periodic task.
+ *
+ * @attention
+ * <ul>
+ * <li>The execution time is the CPU time charged to the task, it is measured only with LOSCFG_BASE_CORE_CPUP.</li>
+ * <li>The response time runs from the tick of the release to the completion of the job. It is measured with
+ * #LOS_GetCpuCycle against g_ullTickCount * g_uwCyclesPerTick, so it is only correct while the cycle count stays
+ * in step with the tick count. With LOSCFG_KERNEL_TICKLESS, the cycle source has to keep counting through the
+ * sleep and the tick count has to be caught up with the whole sleep.</li>
+ * </ul>
+ *
+ * @param  uwTaskID  [IN]  Type #UINT32 Task ID.
+ * @param  pstInfo   [OUT] Type #TSK_PERIOD_INFO_S * Statistics of the task.
+ *
+ * @retval #LOS_ERRNO_TSK_PTR_NULL                pstInfo is NULL.
+ * @retval #LOS_ERRNO_TSK_ID_INVALID              Invalid Task ID.
+ * @retval #LOS_ERRNO_TSK_NOT_CREATED             The task is not created.
+ * @retval #LOS_ERRNO_TSK_PERIOD_NOT_SET          The task is not periodic.
+ * @retval #LOS_OK                                The statistics are obtained.
+ * @par Dependency:
+ * <ul><li>los_task.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_TaskPeriodSet
+ * @since Huawei LiteOS V100R001C00
+ */
+extern UINT32 LOS_TaskPeriodInfoGet(UINT32 uwTaskID, TSK_PERIOD_INFO_S *pstInfo);
+
+/**
+ * @ingroup  los_task
+ * @brief Assign rate monotonic priorities to the periodic tasks.
+ *
+ * @par Description:
+ * This API is used to give the periodic tasks priorities in the order of their periods, the shortest period gets
+ * usHighestPrio and tasks of the same period share a priority. Tasks that are not periodic keep their priorities.
+ *
+ * @attention
+ * <ul>
+ * <li>Nothing is changed if the periodic tasks need priorities beyond OS_TASK_PRIORITY_LOWEST - 1.</li>
+ * <li>Priorities inherited from mutexes are kept until the mutexes are released.</li>
+ * </ul>
+ *
+ * @param  usHighestPrio  [IN] Type #UINT16 Priority of the periodic tasks with the shortest period.
+ *
+ * @retval #LOS_ERRNO_TSK_PRIOR_ERROR             The priorities do not fit below the idle task.
+ * @retval #LOS_OK                                The priorities are assigned.
+ * @par Dependency:
+ * <ul><li>los_task.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_TaskPeriodSet | LOS_TaskPriSet
+ * @since Huawei LiteOS V100R001C00
+ */
+extern UINT32 LOS_TaskPeriodPriAssign(UINT16 usHighestPrio);
+#endif
+
 #ifdef __cplusplus
 #if __cplusplus
 }
@@ -0,0 +1,141 @@
+/*----------------------------------------------------------------------------
+ * Copyright (c) <2013-2015>, <Huawei Technologies Co., Ltd>
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *---------------------------------------------------------------------------*/
+/*----------------------------------------------------------------------------
+ * Notice of Export Control Law
+ * ===============================================
+ * Huawei LiteOS may be subject to applicable export control laws and regulations, which might
+ * include those applicable to Huawei LiteOS of U.S. and the country in which you are located.
+ * Import, export and usage of Huawei LiteOS in any manner by you shall be in compliance with such
+ * applicable export control laws and regulations.
+ *---------------------------------------------------------------------------*/
+
+/**@defgroup los_tickless Tickless
+ * @ingroup kernel
+ */
+
+#ifndef _LOS_TICKLESS_H
+#define _LOS_TICKLESS_H
+
+#include "los_base.h"
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+#endif /* __cplusplus */
+
+/**
+ * @ingroup los_tickless
+ * Wakeup timer used by the idle task in tickless mode.
+ *
+ * pfnSleepStart stops the periodic tick and arms the timer to fire after at most uwSleepTicks ticks.
+ * It returns the number of ticks actually armed, or 0 if the sleep should be skipped.
+ *
+ * pfnSleepEnd is called after the wakeup, restores the periodic tick and returns the number of whole
+ * ticks that passed without a tick interrupt. The tick whose interrupt is pending, if any, is not counted.
+ */
+typedef struct tagTicklessTimer
+{
+    UINT32 (*pfnSleepStart)(UINT32 uwSleepTicks);      /**< Arm the wakeup timer  */
+    UINT32 (*pfnSleepEnd)(UINT32 uwSleepTicks);        /**< Restore the periodic tick, return the skipped ticks */
+} TICKLESS_TIMER_S;
+
+/**
+ * @ingroup  los_tickless
+ * @brief Enable the tickless mode.
+ *
+ * @par Description:
+ * This API is used to let the idle task stop the periodic tick and sleep until the nearest task or software timer timeout.
+ *
+ * @attention
+ * <ul>
+ * <li>The tickless mode is enabled by default when LOSCFG_KERNEL_TICKLESS is YES.</li>
+ * </ul>
+ *
+ * @param  None.
+ *
+ * @retval None.
+ * @par Dependency:
+ * <ul><li>los_tickless.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_TicklessDisable
+ * @since Huawei LiteOS V100R001C00
+ */
+extern VOID LOS_TicklessEnable(VOID);
+
+/**
+ * @ingroup  los_tickless
+ * @brief Disable the tickless mode.
+ *
+ * @par Description:
+ * This API is used to keep the periodic tick running while the system is idle.
+ *
+ * @attention
+ * <ul>
+ * <li>None.</li>
+ * </ul>
+ *
+ * @param  None.
+ *
+ * @retval None.
+ * @par Dependency:
+ * <ul><li>los_tickless.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_TicklessEnable
+ * @since Huawei LiteOS V100R001C00
+ */
+extern VOID LOS_TicklessDisable(VOID);
+
+/**
+ * @ingroup  los_tickless
+ * @brief Register the wakeup timer used in tickless mode.
+ *
+ * @par Description:
+ * This API is used to replace the SysTick based wakeup with a board specific low power timer.
+ *
+ * @attention
+ * <ul>
+ * <li>Both hooks are called with interrupts locked, the idle task executes WFI between them.</li>
+ * <li>If the low power timer does not drive the tick interrupt itself, pfnSleepEnd should pend the tick
+ * interrupt when the whole sleep has elapsed.</li>
+ * <li>Passing NULL restores the default SysTick wakeup.</li>
+ * </ul>
+ *
+ * @param  pstTimer [IN] Type #TICKLESS_TIMER_S * wakeup timer hooks.
+ *
+ * @retval None.
+ * @par Dependency:
+ * <ul><li>los_tickless.h: the header file that contains the API declaration.</li></ul>
+ * @see None.
+ * @since Huawei LiteOS V100R001C00
+ */
+extern VOID LOS_TicklessTimerReg(TICKLESS_TIMER_S *pstTimer);
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* __cplusplus */
+
+#endif /* _LOS_TICKLESS_H */
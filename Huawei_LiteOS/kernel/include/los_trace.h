@@ -0,0 +1,261 @@
+/*----------------------------------------------------------------------------
+ * Copyright (c) <2013-2015>, <Huawei Technologies Co., Ltd>
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *---------------------------------------------------------------------------*/
+/*----------------------------------------------------------------------------
+ * Notice of Export Control Law
+ * ===============================================
+ * Huawei LiteOS may be subject to applicable export control laws and regulations, which might
+ * include those applicable to Huawei LiteOS of U.S. and the country in which you are located.
+ * Import, export and usage of Huawei LiteOS in any manner by you shall be in compliance with such
+ * applicable export control laws and regulations.
+ *---------------------------------------------------------------------------*/
+
+/**@defgroup los_trace Trace
+ * @ingroup kernel
+ */
+
+#ifndef _LOS_TRACE_H
+#define _LOS_TRACE_H
+
+#include "los_base.h"
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+#endif /* __cplusplus */
+
+/**
+ * @ingroup los_trace
+ * Event classes, the high nibble of an event type. Each class has one bit in the trace mask.
+ */
+#define LOS_TRACE_CLASS_TASK                0
+#define LOS_TRACE_CLASS_IRQ                 1
+#define LOS_TRACE_CLASS_IPC                 2
+#define LOS_TRACE_CLASS_SWTMR               3
+#define LOS_TRACE_CLASS_MEM                 4
+
+/**
+ * @ingroup los_trace
+ * Trace mask bits.
+ */
+#define LOS_TRACE_MASK_TASK                 (1U << LOS_TRACE_CLASS_TASK)
+#define LOS_TRACE_MASK_IRQ                  (1U << LOS_TRACE_CLASS_IRQ)
+#define LOS_TRACE_MASK_IPC                  (1U << LOS_TRACE_CLASS_IPC)
+#define LOS_TRACE_MASK_SWTMR                (1U << LOS_TRACE_CLASS_SWTMR)
+#define LOS_TRACE_MASK_MEM                  (1U << LOS_TRACE_CLASS_MEM)
+#define LOS_TRACE_MASK_ALL                  0x1FU
+
+/**
+ * @ingroup los_trace
+ * Event types, with the meaning of the two arguments of the record.
+ */
+#define LOS_TRACE_TASK_SWITCH               0x00    /**< old task ID, new task ID */
+#define LOS_TRACE_TASK_TIMEOUT              0x01    /**< task ID, task status before the timeout */
+#define LOS_TRACE_IRQ_ENTER                 0x10    /**< exception number, 0 */
+#define LOS_TRACE_IRQ_EXIT                  0x11    /**< exception number, 0 */
+#define LOS_TRACE_SEM_PEND                  0x20    /**< semaphore ID, timeout, recorded when the task blocks */
+#define LOS_TRACE_SEM_POST                  0x21    /**< semaphore ID, woken task ID or LOS_TRACE_NONE */
+#define LOS_TRACE_MUX_PEND                  0x22    /**< mutex ID, timeout, recorded when the task blocks */
+#define LOS_TRACE_MUX_POST                  0x23    /**< mutex ID, new owner task ID or LOS_TRACE_NONE */
+#define LOS_TRACE_QUEUE_READ                0x24    /**< queue ID, timeout, recorded when the message is copied */
+#define LOS_TRACE_QUEUE_WRITE               0x25    /**< queue ID, timeout, recorded when the message is copied */
+#define LOS_TRACE_EVENT_READ                0x26    /**< event control block address, event mask, recorded when the task blocks */
+#define LOS_TRACE_EVENT_WRITE               0x27    /**< event control block address, events */
+#define LOS_TRACE_NOTIFY_WAIT               0x28    /**< task ID, notification mask, recorded when the task blocks */
+#define LOS_TRACE_NOTIFY                    0x29    /**< task ID, new notification value */
+#define LOS_TRACE_SWTMR_EXPIRE              0x30    /**< timer ID, handler address */
+#define LOS_TRACE_SWTMR_DROP                0x31    /**< timer ID, handler address, the handler ring was full */
+#define LOS_TRACE_MEM_ALLOC                 0x40    /**< address, size */
+#define LOS_TRACE_MEM_FREE                  0x41    /**< address, pool address */
+
+/**
+ * @ingroup los_trace
+ * Argument value meaning "no task".
+ */
+#define LOS_TRACE_NONE                      0xFFFFFFFFU
+
+/**
+ * @ingroup los_trace
+ * Magic number at the start of the trace buffer, "LTRC" in a little-endian dump.
+ */
+#define LOS_TRACE_MAGIC                     0x4352544CU
+
+/**
+ * @ingroup los_trace
+ * Version of the trace buffer layout.
+ */
+#define LOS_TRACE_VERSION                   1
+
+/**
+ * @ingroup los_trace
+ * Trace record, 16 bytes.
+ */
+typedef struct tagTraceRecord
+{
+    UINT32 uwTimeLo;            /**< Cycle count, bits 0-31  */
+    UINT16 usTimeHi;            /**< Cycle count, bits 32-47 */
+    UINT8  ucType;              /**< Event type              */
+    UINT8  ucReserved;
+    UINT32 uwArg0;              /**< First argument          */
+    UINT32 uwArg1;              /**< Second argument         */
+} TRACE_RECORD_S;
+
+/**
+ * @ingroup los_trace
+ * Trace buffer. The header makes a raw memory snapshot of the buffer self-describing.
+ */
+typedef struct tagTraceBuffer
+{
+    UINT32          uwMagic;                                        /**< LOS_TRACE_MAGIC                      */
+    UINT16          usVersion;                                      /**< LOS_TRACE_VERSION                    */
+    UINT16          usRecordSize;                                   /**< sizeof(TRACE_RECORD_S)               */
+    UINT32          uwRecordNum;                                    /**< Number of records, a power of 2      */
+    UINT32          uwClock;                                        /**< Cycles per second                    */
+    volatile UINT32 uwWriteIdx;                                     /**< Records written since the last reset */
+    volatile UINT32 uwMask;                                         /**< Enabled event classes, 0 when stopped */
+    TRACE_RECORD_S  astRecord[LOSCFG_KERNEL_TRACE_RECORD_NUM];      /**< Ring of records                      */
+} TRACE_BUFFER_S;
+
+/**
+ * @ingroup  los_trace
+ * @brief Start tracing.
+ *
+ * @par Description:
+ * This API is used to record the event classes in uwMask from now on.
+ *
+ * @attention
+ * <ul>
+ * <li>Tracing starts with LOSCFG_KERNEL_TRACE_MASK at initialization.</li>
+ * <li>Pass 0 to stop tracing.</li>
+ * </ul>
+ *
+ * @param  uwMask [IN] Bitwise OR of LOS_TRACE_MASK_* values.
+ *
+ * @retval None.
+ * @par Dependency:
+ * <ul><li>los_trace.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_TraceStop
+ * @since Huawei LiteOS V100R001C00
+ */
+extern VOID LOS_TraceStart(UINT32 uwMask);
+
+/**
+ * @ingroup  los_trace
+ * @brief Stop tracing.
+ *
+ * @par Description:
+ * This API is used to stop recording events. The records are kept.
+ *
+ * @attention
+ * <ul>
+ * <li>None.</li>
+ * </ul>
+ *
+ * @param  None.
+ *
+ * @retval UINT32 The mask that was active, to be passed to LOS_TraceStart later.
+ * @par Dependency:
+ * <ul><li>los_trace.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_TraceStart
+ * @since Huawei LiteOS V100R001C00
+ */
+extern UINT32 LOS_TraceStop(VOID);
+
+/**
+ * @ingroup  los_trace
+ * @brief Clear the trace buffer.
+ *
+ * @par Description:
+ * This API is used to drop all the records.
+ *
+ * @attention
+ * <ul>
+ * <li>None.</li>
+ * </ul>
+ *
+ * @param  None.
+ *
+ * @retval None.
+ * @par Dependency:
+ * <ul><li>los_trace.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_TraceDump
+ * @since Huawei LiteOS V100R001C00
+ */
+extern VOID LOS_TraceReset(VOID);
+
+/**
+ * @ingroup  los_trace
+ * @brief Get the trace buffer.
+ *
+ * @par Description:
+ * This API is used to get the address and size of the trace buffer, for example to save a memory snapshot
+ * through a debugger or to send it over a link.
+ *
+ * @attention
+ * <ul>
+ * <li>Stop tracing first for a consistent snapshot.</li>
+ * </ul>
+ *
+ * @param  puwSize [OUT] Size of the trace buffer in bytes, may be NULL.
+ *
+ * @retval TRACE_BUFFER_S* The trace buffer.
+ * @par Dependency:
+ * <ul><li>los_trace.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_TraceDump
+ * @since Huawei LiteOS V100R001C00
+ */
+extern TRACE_BUFFER_S *LOS_TraceBufGet(UINT32 *puwSize);
+
+/**
+ * @ingroup  los_trace
+ * @brief Print the trace buffer.
+ *
+ * @par Description:
+ * This API is used to print the header, the task names and the records as hexadecimal text through the console,
+ * for the host decoder.
+ *
+ * @attention
+ * <ul>
+ * <li>Tracing is stopped while printing and restarted afterwards.</li>
+ * </ul>
+ *
+ * @param  None.
+ *
+ * @retval None.
+ * @par Dependency:
+ * <ul><li>los_trace.h: the header file that contains the API declaration.</li></ul>
+ * @see LOS_TraceBufGet
+ * @since Huawei LiteOS V100R001C00
+ */
+extern VOID LOS_TraceDump(VOID);
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* __cplusplus */
+
+#endif /* _LOS_TRACE_H */
@@ -0,0 +1,432 @@
+/*----------------------------------------------------------------------------
+ * Copyright (c) <2013-2015>, <Huawei Technologies Co., Ltd>
+ * All rights reserved.
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ * 1. Redistributions of source code must retain the above copyright notice, this list of
+ * conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright notice, this list
+ * of conditions and the following disclaimer in the documentation and/or other materials
+ * provided with the distribution.
+ * 3. Neither the name of the copyright holder nor the names of its contributors may be used
+ * to endorse or promote products derived from this software without specific prior written
+ * permission.
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+ * THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ * PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+ * CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ * EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *---------------------------------------------------------------------------*/
+/*----------------------------------------------------------------------------
+ * Notice of Export Control Law
+ * ===============================================
+ * Huawei LiteOS may be subject to applicable export control laws and regulations, which might
+ * include those applicable to Huawei LiteOS of U.S. and the country in which you are located.
+ * Import, export and usage of Huawei LiteOS in any manner by you shall be in compliance with such
+ * applicable export control laws and regulations.
+ *---------------------------------------------------------------------------*/
+
+/**@defgroup los_workqueue Work queue
+ * @ingroup kernel
+ */
+
+#ifndef _LOS_WORKQUEUE_H
+#define _LOS_WORKQUEUE_H
+
+#include "los_base.h"
+#include "los_list.h"
+#include "los_hwi.h"
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+#endif /* __cplusplus */
+
+/**
+ * @ingroup los_workqueue
+ * Work queue error code: Null pointer.
+ *
+ * Value: 0x02001f00
+ *
+ * Solution: Check whether the input parameter is null.
+ */
+#define LOS_ERRNO_WORKQUEUE_PTR_NULL                LOS_ERRNO_OS_ERROR(LOS_MOD_WORKQ, 0x00)
+
+/**
+ * @ingroup los_workqueue
+ * Work queue error code: Invalid work queue ID.
+ *
+ * Value: 0x02001f01
+ *
+ * Solution: Pass in a work queue ID returned by LOS_WorkQueueCreate, or LOS_WORKQUEUE_SYS.
+ */
+#define LOS_ERRNO_WORKQUEUE_ID_INVALID              LOS_ERRNO_OS_ERROR(LOS_MOD_WORKQ, 0x01)
+
+/**
+ * @ingroup los_workqueue
+ * Work queue error code: No free work queue control block.
+ *
+ * Value: 0x02001f02
+ *
+ * Solution: Delete unused work queues or increase LOSCFG_KERNEL_WORKQUEUE_LIMIT.
+ */
+#define LOS_ERRNO_WORKQUEUE_ALL_BUSY                LOS_ERRNO_OS_ERROR(LOS_MOD_WORKQ, 0x02)
+
+/**
+ * @ingroup los_workqueue
+ * Work queue error code: Invalid number of worker tasks.
+ *
+ * Value: 0x02001f03
+ *
+ * Solution: Pass in a number of workers in [1, LOSCFG_KERNEL_WORKQUEUE_WORKER_LIMIT].
+ */
+#define LOS_ERRNO_WORKQUEUE_WORKER_INVALID          LOS_ERRNO_OS_ERROR(LOS_MOD_WORKQ, 0x03)
+
+/**
+ * @ingroup los_workqueue
+ * Work queue error code: The semaphore or a worker task of the work queue could not be created.
+ *
+ * Value: 0x02001f04
+ *
+ * Solution: Increase LOSCFG_BASE_IPC_SEM_LIMIT, LOSCFG_BASE_CORE_TSK_LIMIT or the system memory,
+ * or check the priority and stack size.
+ */
+#define LOS_ERRNO_WORKQUEUE_CREATE_FAILED           LOS_ERRNO_OS_ERROR(LOS_MOD_WORKQ, 0x04)
+
+/**
+ * @ingroup los_workqueue
+ * Work queue error code: The work is already queued.
+ *
+ * Value: 0x02001f05
+ *
+ * Solution: None, the work will run once. Cancel it first to submit it again with another delay.
+ */
+#define LOS_ERRNO_WORKQUEUE_WORK_PENDING            LOS_ERRNO_OS_ERROR(LOS_MOD_WORKQ, 0x05)
+
+/**
+ * @ingroup los_workqueue
+ * Work queue error code: The work function is running.
+ *
+ * Value: 0x02001f06
+ *
+ * Solution: Retry after the work function returns.
+ */
+#define LOS_ERRNO_WORKQUEUE_WORK_RUNNING            LOS_ERRNO_OS_ERROR(LOS_MOD_WORKQ, 0x06)
+
+/**
+ * @ingroup los_workqueue
+ * Work queue error code: The work queue still has queued or running work.
+ *
+ * Value: 0x02001f07
+ *
+ * Solution: Cancel the queued work and wait for the running work before deleting the work queue.
+ */
+#define LOS_ERRNO_WORKQUEUE_BUSY                    LOS_ERRNO_OS_ERROR(LOS_MOD_WORKQ, 0x07)
+
+/**
+ * @ingroup los_workqueue
+ * Work queue error code: The operation is not allowed from a worker task or an interrupt.
+ *
+ * Value: 0x02001f08
+ *
+ * Solution: Call the API from another task.
+ */
+#define LOS_ERRNO_WORKQUEUE_CONTEXT_INVALID         LOS_ERRNO_OS_ERROR(LOS_MOD_WORKQ, 0x08)
+
+/**
+ * @ingroup los_workqueue
+ * Work queue error code: No free threaded interrupt slot.
+ *
+ * Value: 0x02001f09
+ *
+ * Solution: Increase LOSCFG_KERNEL_WORKQUEUE_HWI_LIMIT.
+ */
+#define LOS_ERRNO_WORKQUEUE_HWI_ALL_BUSY            LOS_ERRNO_OS_ERROR(LOS_MOD_WORKQ, 0x09)
+
+/**
+ * @ingroup los_workqueue
+ * Work queue error code: The interrupt has no threaded handler.
+ *
+ * Value: 0x02001f0a
+ *
+ * Solution: Pass in an interrupt number registered with LOS_HwiCreateThreaded.
+ */
+#define LOS_ERRNO_WORKQUEUE_HWI_NOT_CREATED         LOS_ERRNO_OS_ERROR(LOS_MOD_WORKQ, 0x0a)
+
+/**
+ * @ingroup los_workqueue
+ * ID of the system work queue, created at initialization.
+ */
+#define LOS_WORKQUEUE_SYS                           0
+
+/**
+ * @ingroup los_workqueue
+ * Return value of a top-half handler: the interrupt is handled, do not run the threaded handler.
+ */
+#define LOS_HWI_HANDLED                             0
+
+/**
+ * @ingroup los_workqueue
+ * Return value of a top-half handler: mask the interrupt and run the threaded handler.
+ */
+#define LOS_HWI_WAKE_THREAD                         1
+
+/**
+ * @ingroup los_workqueue
+ * Define the type of a work function.
+ */
+typedef VOID (*WORK_FUNC)(UINT32 uwArg);
+
+/**
+ * @ingroup los_workqueue
+ * Define the type of a top-half handler, called in interrupt context. Returns LOS_HWI_HANDLED or LOS_HWI_WAKE_THREAD.
+ */
+typedef UINT32 (*HWI_TOP_FUNC)(HWI_ARG_T uwArg);
+
+/**
+ * @ingroup los_workqueue
+ * Define the type of a threaded interrupt handler, called in a worker task.
+ */
+typedef VOID (*HWI_THREAD_FUNC)(HWI_ARG_T uwArg);
+
+/**
+ * @ingroup los_workqueue
+ * Work item, allocated by the caller and initialized with LOS_WorkInit. The fields are private.
+ */
+typedef struct tagWork
+{
+    LOS_DL_LIST stList;         /**< Node in the pending or delayed list of the work queue */
+    WORK_FUNC   pfnFunc;        /**< Work function                                         */
+    UINT32      uwArg;          /**< Argument of the work function                         */
+    UINT32      uwExpire;       /**< Tick count at which delayed work becomes pending      */
+    UINT16      usWqID;         /**< Work queue the work is queued on                      */
+    UINT16      usState;        /**< OS_WORK_* state bits                                  */
+} WORK_S;
+
+/**
+ *@ingroup los_workqueue
+ *@brief Initialize a work item.
+ *
+ *@par Description:
+ *This API is used to set the function and argument of a work item before it is submitted.
+ *@attention
+ *<ul>
+ *<li>Do not initialize a work item that is queued or running.</li>
+ *</ul>
+ *
+ *@param pstWork  [OUT] Work item.
+ *@param pfnFunc  [IN] Work function, called in a worker task.
+ *@param uwArg    [IN] Argument of the work function.
+ *
+ *@retval #LOS_ERRNO_WORKQUEUE_PTR_NULL  pstWork or pfnFunc is NULL.
+ *@retval #LOS_OK                        The work item is initialized.
+ *@par Dependency:
+ *<ul><li>los_workqueue.h: the header file that contains the API declaration.</li></ul>
+ *@see LOS_WorkQueueSubmit
+ *@since Huawei LiteOS V100R001C00
+ */
+extern UINT32 LOS_WorkInit(WORK_S *pstWork, WORK_FUNC pfnFunc, UINT32 uwArg);
+
+/**
+ *@ingroup los_workqueue
+ *@brief Create a work queue.
+ *
+ *@par Description:
+ *This API is used to create a work queue served by usWorkers tasks of priority usPriority.
+ *@attention
+ *<ul>
+ *<li>Each worker uses one task control block, and the work queue uses one semaphore.</li>
+ *<li>Work submitted to a queue with several workers may run concurrently and out of order.</li>
+ *</ul>
+ *
+ *@param pcName       [IN] Name of the worker tasks.
+ *@param usPriority   [IN] Priority of the worker tasks.
+ *@param usWorkers    [IN] Number of worker tasks, in [1, LOSCFG_KERNEL_WORKQUEUE_WORKER_LIMIT].
+ *@param uwStackSize  [IN] Stack size of each worker task.
+ *@param puwWqID      [OUT] ID of the work queue.
+ *
+ *@retval #LOS_ERRNO_WORKQUEUE_PTR_NULL        pcName or puwWqID is NULL.
+ *@retval #LOS_ERRNO_WORKQUEUE_WORKER_INVALID  usWorkers is out of range.
+ *@retval #LOS_ERRNO_WORKQUEUE_ALL_BUSY        No free work queue control block.
+ *@retval #LOS_ERRNO_WORKQUEUE_CREATE_FAILED   The semaphore or a worker could not be created.
+ *@retval #LOS_OK                              The work queue is created.
+ *@par Dependency:
+ *<ul><li>los_workqueue.h: the header file that contains the API declaration.</li></ul>
+ *@see LOS_WorkQueueDelete
+ *@since Huawei LiteOS V100R001C00
+ */
+extern UINT32 LOS_WorkQueueCreate(CHAR *pcName, UINT16 usPriority, UINT16 usWorkers, UINT32 uwStackSize, UINT32 *puwWqID);
+
+/**
+ *@ingroup los_workqueue
+ *@brief Delete a work queue.
+ *
+ *@par Description:
+ *This API is used to delete an idle work queue and its worker tasks.
+ *@attention
+ *<ul>
+ *<li>The system work queue cannot be deleted.</li>
+ *<li>Cannot be called from an interrupt or from a worker of the work queue.</li>
+ *</ul>
+ *
+ *@param uwWqID  [IN] ID of the work queue.
+ *
+ *@retval #LOS_ERRNO_WORKQUEUE_ID_INVALID       uwWqID is invalid or LOS_WORKQUEUE_SYS.
+ *@retval #LOS_ERRNO_WORKQUEUE_CONTEXT_INVALID  Called from an interrupt or a worker of the work queue.
+ *@retval #LOS_ERRNO_WORKQUEUE_BUSY             Work is queued or running.
+ *@retval #LOS_OK                               The work queue is deleted.
+ *@par Dependency:
+ *<ul><li>los_workqueue.h: the header file that contains the API declaration.</li></ul>
+ *@see LOS_WorkQueueCreate
+ *@since Huawei LiteOS V100R001C00
+ */
+extern UINT32 LOS_WorkQueueDelete(UINT32 uwWqID);
+
+/**
+ *@ingroup los_workqueue
+ *@brief Submit work.
+ *
+ *@par Description:
+ *This API is used to queue a work item so that a worker calls its function as soon as possible.
+ *@attention
+ *<ul>
+ *<li>May be called from an interrupt.</li>
+ *<li>A work item that is running may be submitted again, it then runs once more.</li>
+ *</ul>
+ *
+ *@param uwWqID   [IN] ID of the work queue.
+ *@param pstWork  [IN] Work item initialized with LOS_WorkInit.
+ *
+ *@retval #LOS_ERRNO_WORKQUEUE_PTR_NULL      pstWork is NULL.
+ *@retval #LOS_ERRNO_WORKQUEUE_ID_INVALID    uwWqID is invalid.
+ *@retval #LOS_ERRNO_WORKQUEUE_WORK_PENDING  The work is already queued, it is not queued twice.
+ *@retval #LOS_OK                            The work is queued.
+ *@par Dependency:
+ *<ul><li>los_workqueue.h: the header file that contains the API declaration.</li></ul>
+ *@see LOS_WorkQueueSubmitDelayed
+ *@since Huawei LiteOS V100R001C00
+ */
+extern UINT32 LOS_WorkQueueSubmit(UINT32 uwWqID, WORK_S *pstWork);
+
+/**
+ *@ingroup los_workqueue
+ *@brief Submit delayed work.
+ *
+ *@par Description:
+ *This API is used to queue a work item after uwDelay ticks.
+ *@attention
+ *<ul>
+ *<li>May be called from an interrupt.</li>
+ *<li>A delay of 0 is the same as LOS_WorkQueueSubmit.</li>
+ *</ul>
+ *
+ *@param uwWqID   [IN] ID of the work queue.
+ *@param pstWork  [IN] Work item initialized with LOS_WorkInit.
+ *@param uwDelay  [IN] Delay in ticks, less than 0x80000000.
+ *
+ *@retval #LOS_ERRNO_WORKQUEUE_PTR_NULL      pstWork is NULL.
+ *@retval #LOS_ERRNO_WORKQUEUE_ID_INVALID    uwWqID is invalid.
+ *@retval #LOS_ERRNO_WORKQUEUE_WORK_PENDING  The work is already queued, it is not queued twice.
+ *@retval #LOS_OK                            The work is queued.
+ *@par Dependency:
+ *<ul><li>los_workqueue.h: the header file that contains the API declaration.</li></ul>
+ *@see LOS_WorkCancel
+ *@since Huawei LiteOS V100R001C00
+ */
+extern UINT32 LOS_WorkQueueSubmitDelayed(UINT32 uwWqID, WORK_S *pstWork, UINT32 uwDelay);
+
+/**
+ *@ingroup los_workqueue
+ *@brief Cancel work.
+ *
+ *@par Description:
+ *This API is used to remove a work item from its work queue if it has not started.
+ *@attention
+ *<ul>
+ *<li>May be called from an interrupt.</li>
+ *</ul>
+ *
+ *@param pstWork  [IN] Work item.
+ *
+ *@retval #LOS_ERRNO_WORKQUEUE_PTR_NULL      pstWork is NULL.
+ *@retval #LOS_ERRNO_WORKQUEUE_WORK_RUNNING  The work is no longer queued but its function is still running.
+ *@retval #LOS_OK                            The work is neither queued nor running.
+ *@par Dependency:
+ *<ul><li>los_workqueue.h: the header file that contains the API declaration.</li></ul>
+ *@see LOS_WorkQueueSubmit
+ *@since Huawei LiteOS V100R001C00
+ */
+extern UINT32 LOS_WorkCancel(WORK_S *pstWork);
+
+/**
+ *@ingroup los_workqueue
+ *@brief Create a threaded hardware interrupt.
+ *
+ *@par Description:
+ *This API is used to split an interrupt handler into a short top half run in the interrupt and a threaded handler
+ *run by a worker of work queue uwWqID. When the top half returns LOS_HWI_WAKE_THREAD, or when it is NULL, the
+ *interrupt is disabled and the threaded handler is queued. The interrupt is enabled again when the threaded handler
+ *returns, so a level-triggered source does not fire again before it is served.
+ *@attention
+ *<ul>
+ *<li>Both handlers receive uwArg.</li>
+ *<li>The top half must acknowledge the interrupt source, or return LOS_HWI_WAKE_THREAD.</li>
+ *</ul>
+ *
+ *@param uwHwiNum   [IN] Hardware interrupt number.
+ *@param usHwiPrio  [IN] Hardware interrupt priority.
+ *@param pfnTop     [IN] Top-half handler, may be NULL.
+ *@param pfnThread  [IN] Threaded handler.
+ *@param uwArg      [IN] Argument of both handlers.
+ *@param uwWqID     [IN] Work queue that runs the threaded handler.
+ *
+ *@retval #LOS_ERRNO_WORKQUEUE_PTR_NULL      pfnThread is NULL.
+ *@retval #LOS_ERRNO_WORKQUEUE_ID_INVALID    uwWqID is invalid.
+ *@retval #LOS_ERRNO_WORKQUEUE_HWI_ALL_BUSY  No free threaded interrupt slot.
+ *@retval #OS_ERRNO_HWI_*                    Error returned by LOS_HwiCreate.
+ *@retval #LOS_OK                            The interrupt is created.
+ *@par Dependency:
+ *<ul><li>los_workqueue.h: the header file that contains the API declaration.</li></ul>
+ *@see LOS_HwiDeleteThreaded
+ *@since Huawei LiteOS V100R001C00
+ */
+extern UINT32 LOS_HwiCreateThreaded(HWI_HANDLE_T uwHwiNum, HWI_PRIOR_T usHwiPrio, HWI_TOP_FUNC pfnTop,
+                                    HWI_THREAD_FUNC pfnThread, HWI_ARG_T uwArg, UINT32 uwWqID);
+
+/**
+ *@ingroup los_workqueue
+ *@brief Delete a threaded hardware interrupt.
+ *
+ *@par Description:
+ *This API is used to delete an interrupt created with LOS_HwiCreateThreaded.
+ *@attention
+ *<ul>
+ *<li>Fails while the threaded handler is running.</li>
+ *</ul>
+ *
+ *@param uwHwiNum  [IN] Hardware interrupt number.
+ *
+ *@retval #LOS_ERRNO_WORKQUEUE_HWI_NOT_CREATED  The interrupt has no threaded handler.
+ *@retval #LOS_ERRNO_WORKQUEUE_WORK_RUNNING     The threaded handler is running.
+ *@retval #LOS_OK                               The interrupt is deleted.
+ *@par Dependency:
+ *<ul><li>los_workqueue.h: the header file that contains the API declaration.</li></ul>
+ *@see LOS_HwiCreateThreaded
+ *@since Huawei LiteOS V100R001C00
+ */
+extern UINT32 LOS_HwiDeleteThreaded(HWI_HANDLE_T uwHwiNum);
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* __cplusplus */
+
+#endif /* _LOS_WORKQUEUE_H */
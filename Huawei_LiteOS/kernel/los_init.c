@@ -36,6 +36,24 @@
 #include "los_tick.h"
 #include "los_task.ph"
 #include "los_config.h"
+#if (LOSCFG_KERNEL_TICKLESS == YES)
+#include "los_tickless.ph"
+#endif
+#if (LOSCFG_KERNEL_TRACE == YES)
+#include "los_trace.ph"
+#endif
+#if (LOSCFG_KERNEL_WORKQUEUE == YES)
+#include "los_workqueue.ph"
+#endif
+#if (LOSCFG_MEM_REGION == YES)
+#include "los_memregion.ph"
+#endif
+#if (LOSCFG_MEM_BGCHECK == YES)
+#include "los_heapcheck.ph"
+#endif
+#if (LOSCFG_BASE_CORE_MPU == YES)
+#include "los_mpu.h"
+#endif
 
 #ifdef __cplusplus
 #if __cplusplus
@@ -47,6 +65,25 @@ UINT8 m_aucSysMem0[OS_SYS_MEM_SIZE];
 
 extern UINT32 osTickInit(UINT32 uwSystemClock, UINT32 uwTickPerSecond);
 extern UINT32   g_uwTskMaxNum;
+#if (LOSCFG_BASE_IPC_SEM == YES)
+extern UINT32   g_uwSemLimit;
+#endif
+#if (LOSCFG_BASE_IPC_MUX == YES)
+extern UINT32   g_uwMuxLimit;
+#endif
+#if (LOSCFG_BASE_IPC_QUEUE == YES)
+extern UINT32   g_uwQueueLimit;
+#endif
+#if (LOSCFG_BASE_CORE_SWTMR == YES)
+extern UINT32   g_uwSwtmrLimit;
+#endif
+
+/* largest limits the handles leave room for, 16 bits of index for IPC and 12 bits for the 16 bit timer IDs */
+#define OS_KERNEL_IPC_LIMIT_MAX         0x10000
+#define OS_KERNEL_SWTMR_LIMIT_MAX       0x1000
+
+/* object limits passed to LOS_KernelInitConfig, 0 keeps the LOSCFG_* default */
+LITE_OS_SEC_BSS static LOS_KERNEL_CONFIG_S m_stKernelConfig;
 
 void osEnableFPU(void)
 {
@@ -65,20 +102,39 @@ LITE_OS_SEC_TEXT VOID osIdleTask(VOID)
 {
     while (1)
     {
+#if (LOSCFG_MEM_BGCHECK == YES)
+        osHeapCheckIdle();
+#endif
+#if (LOSCFG_KERNEL_TICKLESS == YES)
+        osTicklessHandler();
+#endif
     }
 }
 
 
 /*****************************************************************************
  Function    : osRegister
- Description : Configuring the maximum number of tasks
+ Description : Configuring the maximum number of tasks and kernel objects
  Input       : None
  Output      : None
  Return      : None
  *****************************************************************************/
 LITE_OS_SEC_TEXT_INIT VOID osRegister(VOID)
 {
-    g_uwTskMaxNum = LOSCFG_BASE_CORE_TSK_LIMIT + 1; /* Reserved 1 for IDLE */
+    g_uwTskMaxNum = ((0 != m_stKernelConfig.uwTaskLimit) ? m_stKernelConfig.uwTaskLimit : LOSCFG_BASE_CORE_TSK_LIMIT)
+                    + 1; /* Reserved 1 for IDLE */
+#if (LOSCFG_BASE_IPC_SEM == YES)
+    g_uwSemLimit = (0 != m_stKernelConfig.uwSemLimit) ? m_stKernelConfig.uwSemLimit : LOSCFG_BASE_IPC_SEM_LIMIT;
+#endif
+#if (LOSCFG_BASE_IPC_MUX == YES)
+    g_uwMuxLimit = (0 != m_stKernelConfig.uwMuxLimit) ? m_stKernelConfig.uwMuxLimit : LOSCFG_BASE_IPC_MUX_LIMIT;
+#endif
+#if (LOSCFG_BASE_IPC_QUEUE == YES)
+    g_uwQueueLimit = (0 != m_stKernelConfig.uwQueueLimit) ? m_stKernelConfig.uwQueueLimit : LOSCFG_BASE_IPC_QUEUE_LIMIT;
+#endif
+#if (LOSCFG_BASE_CORE_SWTMR == YES)
+    g_uwSwtmrLimit = (0 != m_stKernelConfig.uwSwtmrLimit) ? m_stKernelConfig.uwSwtmrLimit : LOSCFG_BASE_CORE_SWTMR_LIMIT;
+#endif
 
     return;
 }
@@ -94,6 +150,10 @@ LITE_OS_SEC_TEXT_INIT UINT32 LOS_Start()
 {
     UINT32 uwRet = LOS_OK;
 
+#if (LOSCFG_BASE_CORE_TSK_STACK_GUARD == YES)
+    /* later switches move the guard from osPendSV */
+    osMpuStackGuardStart(g_stLosTask.pstNewTask->uwTopOfStack - OS_MPU_STACK_GUARD_SIZE);
+#endif
     LOS_StartToRun();
 
     return uwRet;
@@ -112,6 +172,10 @@ LITE_OS_SEC_TEXT_INIT int osMain(void)
 
     osRegister();
 
+#if (LOSCFG_KERNEL_TRACE == YES)
+    osTraceInit();
+#endif
+
     uwRet = osMemSystemInit();
     if (uwRet != LOS_OK)
     {
@@ -119,12 +183,30 @@ LITE_OS_SEC_TEXT_INIT int osMain(void)
         return uwRet;
     }
 
+#if (LOSCFG_MEM_REGION == YES)
+    uwRet = osMemRegionInit();
+    if (uwRet != LOS_OK)
+    {
+        PRINT_ERR("osMemRegionInit error %d\n", uwRet);
+        return uwRet;
+    }
+#endif
+
 #if (LOSCFG_PLATFORM_HWI == YES)
     {
         osHwiInit();
     }
 #endif
 
+#if (LOSCFG_BASE_CORE_MPU == YES)
+    uwRet = osMpuInit();
+    if (uwRet != LOS_OK)
+    {
+        PRINT_ERR("osMpuInit error %d\n", uwRet);
+        return uwRet;
+    }
+#endif
+
     uwRet =osTaskInit();
     if (uwRet != LOS_OK)
     {
@@ -194,6 +276,17 @@ LITE_OS_SEC_TEXT_INIT int osMain(void)
     osTimesliceInit();
 #endif
 
+#if (LOSCFG_KERNEL_WORKQUEUE == YES)
+    {
+        uwRet = osWorkQueueInit();
+        if (uwRet != LOS_OK)
+        {
+            PRINT_ERR("osWorkQueueInit error\n");
+            return uwRet;
+        }
+    }
+#endif
+
 #if (LOSCFG_BASE_CORE_TICK_HW_TIME == NO)
     uwRet = osTickStart();
 
@@ -232,6 +325,33 @@ int LOS_KernelInit(void)
 		return LOS_OK;
 }
 
+/*****************************************************************************
+ Function    : LOS_KernelInitConfig
+ Description : LiteOS Initialize with the object limits chosen at run time
+ Input       : pstConfig --- object limits, NULL keeps the defaults
+ Output      : None
+ Return      : LOS_OK on success or LOS_NOK on failure
+ *****************************************************************************/
+LITE_OS_SEC_TEXT_INIT
+int LOS_KernelInitConfig(LOS_KERNEL_CONFIG_S *pstConfig)
+{
+    if (NULL != pstConfig)
+    {
+        if ((pstConfig->uwTaskLimit > LOSCFG_BASE_CORE_TSK_LIMIT) ||
+            (pstConfig->uwSemLimit > OS_KERNEL_IPC_LIMIT_MAX) ||
+            (pstConfig->uwMuxLimit > OS_KERNEL_IPC_LIMIT_MAX) ||
+            (pstConfig->uwQueueLimit > OS_KERNEL_IPC_LIMIT_MAX) ||
+            (pstConfig->uwSwtmrLimit > OS_KERNEL_SWTMR_LIMIT_MAX))
+        {
+            return LOS_NOK;
+        }
+
+        m_stKernelConfig = *pstConfig;
+    }
+
+    return LOS_KernelInit();
+}
+
 #ifdef __cplusplus
 #if __cplusplus
 }
@@ -78,6 +78,33 @@ extern char __bss_start;
  */
 #define LOSCFG_BASE_CORE_TICK_HW_TIME                  NO
 
+/**
+ * @ingroup los_config
+ * Configuration item for tickless idle tailoring, not available with LOSCFG_BASE_CORE_TICK_HW_TIME
+ */
+#define LOSCFG_KERNEL_TICKLESS                          NO
+
+/**
+ * @ingroup los_config
+ * Configuration item for kernel event trace tailoring
+ */
+#define LOSCFG_KERNEL_TRACE                             NO
+
+/**
+ * @ingroup los_config
+ * Number of records in the trace ring buffer, must be a power of 2. Each record takes 16 bytes.
+ */
+#define LOSCFG_KERNEL_TRACE_RECORD_NUM                  512
+
+/**
+ * @ingroup los_config
+ * Event classes recorded from initialization, see LOS_TRACE_MASK_* in los_trace.h
+ */
+#define LOSCFG_KERNEL_TRACE_MASK                        0x1F
+#if (LOSCFG_KERNEL_TRACE_RECORD_NUM & (LOSCFG_KERNEL_TRACE_RECORD_NUM - 1))
+    #error "LOSCFG_KERNEL_TRACE_RECORD_NUM must be a power of 2"
+#endif
+
 /****************************** Hardware interrupt module configuration ******************************/
 /**
  * @ingroup los_config
@@ -91,6 +118,26 @@ extern char __bss_start;
  */
 #define LOSCFG_PLATFORM_HWI_LIMIT                       96
 
+/**
+ * @ingroup los_config
+ * Configuration item for masking interrupts with BASEPRI instead of PRIMASK in LOS_IntLock, Cortex-M3/M4/M7 only
+ */
+#define LOSCFG_ARCH_INT_LOCK_BASEPRI                    NO
+
+/**
+ * @ingroup los_config
+ * Highest priority masked by LOS_IntLock when LOSCFG_ARCH_INT_LOCK_BASEPRI is YES, in [1, OS_HWI_PRIO_LOWEST].
+ * Interrupts of a higher priority (lower value) are never delayed by the kernel and must not call any LOS_ API.
+ */
+#define LOSCFG_ARCH_INT_LOCK_BASEPRI_PRIO               4
+
+/**
+ * @ingroup los_config
+ * Configuration item for rejecting kernel API calls from interrupts above LOSCFG_ARCH_INT_LOCK_BASEPRI_PRIO.
+ * A debug aid: the calls return OS_ERRNO_HWI_PRIO_ABOVE_LOCK. Set it to NO in release builds.
+ */
+#define LOSCFG_ARCH_INT_PRIO_CHECK                      YES
+
 /****************************** Task module configuration ********************************/
 /**
  * @ingroup los_config
@@ -100,7 +147,8 @@ extern char __bss_start;
 
 /**
  * @ingroup los_config
- * Maximum supported number of tasks except the idle task rather than the number of usable tasks
+ * Maximum supported number of tasks except the idle task rather than the number of usable tasks,
+ * LOS_KernelInitConfig can lower it at run time but not raise it, the task control blocks are allocated once at initialization
  */
 #define LOSCFG_BASE_CORE_TSK_LIMIT                      15              // max num task
 
@@ -150,7 +198,29 @@ extern char __bss_start;
  * @ingroup los_config
  * Configuration item for CPU usage tailoring
  */
-//#define LOSCFG_BASE_CORE_CPUP                           YES         //CPUP
+#define LOSCFG_BASE_CORE_CPUP                           NO
+
+/**
+ * @ingroup los_config
+ * Configuration item for CPU usage of each interrupt, costs two cycle reads per interrupt
+ */
+#define LOSCFG_BASE_CORE_CPUP_HWI                       NO
+#if (LOSCFG_BASE_CORE_CPUP == YES && LOSCFG_BASE_CORE_TSK_MONITOR == NO)
+    #error "cpup is driven by the task switch hook, should make LOSCFG_BASE_CORE_TSK_MONITOR = YES"
+#endif
+#if (LOSCFG_BASE_CORE_CPUP == NO && LOSCFG_BASE_CORE_CPUP_HWI == YES)
+    #error "interrupt cpup first need support cpup, should make LOSCFG_BASE_CORE_CPUP = YES"
+#endif
+#if (LOSCFG_KERNEL_TRACE == YES && LOSCFG_BASE_CORE_TSK_MONITOR == NO)
+    #error "task switches are traced from the task switch hook, should make LOSCFG_BASE_CORE_TSK_MONITOR = YES"
+#endif
+
+/**
+ * @ingroup los_config
+ * Configuration item for periodic tasks, see LOS_TaskPeriodSet. The execution time of the jobs is measured
+ * only with LOSCFG_BASE_CORE_CPUP
+ */
+#define LOSCFG_BASE_CORE_TSK_PERIODIC                   YES
 
 /**
  * @ingroup los_config
@@ -169,7 +239,7 @@ extern char __bss_start;
  * @ingroup los_config
  * Configuration item for MPU
  */
-#define LOSCFG_BASE_CORE_MPU                            YES             //MPU
+#define LOSCFG_BASE_CORE_MPU                            NO              //MPU, not on this chip
 
 /**
  * @ingroup los_config
@@ -184,6 +254,17 @@ extern char __bss_start;
 #define LOSCFG_MPU_MIN_ADDRESS                   0x0UL    // Minimum protected address
 #define LOSCFG_MPU_MAX_ADDRESS                   0xFFFFFFFFUL    // Maximum protected address
 
+/**
+ * @ingroup los_config
+ * Configuration item for the MPU stack guard, a no access region below the stack of the running task.
+ * It replaces the stack checks of the task switch hook.
+ */
+#define LOSCFG_BASE_CORE_TSK_STACK_GUARD                NO
+
+#if (LOSCFG_BASE_CORE_TSK_STACK_GUARD == YES && LOSCFG_BASE_CORE_MPU == NO)
+    #error "the stack guard is a region of the MPU, should make LOSCFG_BASE_CORE_MPU = YES"
+#endif
+
 /****************************** Semaphore module configuration ******************************/
 /**
  * @ingroup los_config
@@ -223,6 +304,31 @@ extern char __bss_start;
  */
 #define LOSCFG_BASE_IPC_QUEUE_LIMIT                     10              //the max queue-numb
 
+/****************************** IPC control block configuration ***************************/
+/**
+ * @ingroup los_config
+ * Number of semaphore, mutex and queue control blocks allocated at a time when all are in use, a power of 2.
+ * The limits above are the defaults, LOS_KernelInitConfig can change them at run time.
+ */
+#define LOSCFG_BASE_IPC_ALLOC_STEP                      8
+#if (LOSCFG_BASE_IPC_ALLOC_STEP & (LOSCFG_BASE_IPC_ALLOC_STEP - 1))
+#error "LOSCFG_BASE_IPC_ALLOC_STEP must be a power of 2"
+#endif
+
+/****************************** Multi-wait module configuration ****************************/
+/**
+ * @ingroup los_config
+ * Configuration item for waiting on several semaphores, queues and events at once
+ */
+#define LOSCFG_BASE_IPC_MULTIWAIT                       NO
+
+/****************************** Ring buffer module configuration ***************************/
+/**
+ * @ingroup los_config
+ * Configuration item for the lock-free byte ring buffer
+ */
+#define LOSCFG_BASE_IPC_RINGBUF                         NO
+
 /****************************** Software timer module configuration **************************/
 #if (LOSCFG_BASE_IPC_QUEUE == YES)
 /**
@@ -248,21 +354,51 @@ extern char __bss_start;
 
 /**
  * @ingroup los_config
- * Max number of software timers ID
+ * Number of software timer control blocks allocated at a time, a power of 2
  */
-#define OS_SWTMR_MAX_TIMERID                            ((65535/LOSCFG_BASE_CORE_SWTMR_LIMIT) * LOSCFG_BASE_CORE_SWTMR_LIMIT)
+#define LOSCFG_BASE_CORE_SWTMR_ALLOC_STEP               8
 
 /**
  * @ingroup los_config
- * Maximum size of a software timer queue
+ * Minimum divisor of software timer multiple alignment
  */
-#define OS_SWTMR_HANDLE_QUEUE_SIZE                      (LOSCFG_BASE_CORE_SWTMR_LIMIT + 0)
+ #define LOS_COMMON_DIVISOR                             10
+#endif
 
+/****************************** Work queue module configuration **************************/
 /**
  * @ingroup los_config
- * Minimum divisor of software timer multiple alignment
+ * Configuration item for work queue and threaded interrupt tailoring
  */
- #define LOS_COMMON_DIVISOR                             10
+#define LOSCFG_KERNEL_WORKQUEUE                         NO
+
+/**
+ * @ingroup los_config
+ * Maximum supported number of work queues, including the system work queue
+ */
+#define LOSCFG_KERNEL_WORKQUEUE_LIMIT                   4
+
+/**
+ * @ingroup los_config
+ * Maximum number of worker tasks of a work queue
+ */
+#define LOSCFG_KERNEL_WORKQUEUE_WORKER_LIMIT            4
+
+/**
+ * @ingroup los_config
+ * Priority, number of workers and worker stack size of the system work queue
+ */
+#define LOSCFG_KERNEL_WORKQUEUE_SYS_PRIO                3
+#define LOSCFG_KERNEL_WORKQUEUE_SYS_WORKERS             1
+#define LOSCFG_KERNEL_WORKQUEUE_SYS_STACK_SIZE          LOSCFG_BASE_CORE_TSK_DEFAULT_STACK_SIZE
+
+/**
+ * @ingroup los_config
+ * Maximum supported number of threaded interrupts
+ */
+#define LOSCFG_KERNEL_WORKQUEUE_HWI_LIMIT               4
+#if (LOSCFG_KERNEL_WORKQUEUE == YES && LOSCFG_BASE_IPC_SEM == NO)
+    #error "work queues need semaphores, should make LOSCFG_BASE_IPC_SEM = YES"
 #endif
 
 /****************************** Memory module configuration **************************/
@@ -313,6 +449,88 @@ extern char _PT0_END;
  */
 #define LOSCFG_KERNEL_MEM_SLAB                     YES
 
+/**
+ * @ingroup los_config
+ * Slab size classes, {block size, blocks per slab page} in ascending block size. Tune them to the sizes the
+ * application allocates most, such as pbufs, CoAP PDUs or TLS records
+ */
+#define LOSCFG_SLAB_MEM_COUNT                      4
+#define LOSCFG_SLAB_CLASS_TABLE                    {{0x10, 32}, {0x20, 16}, {0x40, 8}, {0x80, 4}}
+
+/**
+ * @ingroup los_config
+ * Maximum number of slab pages of each class. Pages after the first are taken from the heap when the class is
+ * full and given back once empty, 1 keeps the slab at its initial size
+ */
+#define LOSCFG_SLAB_PAGE_MAX                       1
+
+/**
+ * @ingroup los_config
+ * Configuration module tailoring of the TLSF memory algorithm, set to YES when kernel/base/mem/tlsf is built
+ * instead of bestfit_little
+ */
+#define LOSCFG_MEMORY_TLSF                         NO
+
+/**
+ * @ingroup los_config
+ * Configuration module tailoring of lock-free membox alloc and free, only takes effect on cores with
+ * exclusive access instructions (Cortex-M3 and above), others always lock interrupts
+ */
+#define LOSCFG_MEMBOX_LOCKFREE                     NO
+
+/**
+ * @ingroup los_config
+ * Configuration module tailoring of memory regions, placing allocations in several pools by their attributes
+ */
+#define LOSCFG_MEM_REGION                          NO
+
+/**
+ * @ingroup los_config
+ * Maximum number of memory regions, including the system memory pool
+ */
+#define LOSCFG_MEM_REGION_LIMIT                    4
+
+/**
+ * @ingroup los_config
+ * Fast memory region registered at startup, 0 when the chip has none
+ */
+#define OS_MEM_REGION_FAST_ADDR                    0
+#define OS_MEM_REGION_FAST_SIZE                    0
+
+/**
+ * @ingroup los_config
+ * Configuration module tailoring of the per-task memory counters, the task a block is charged to is kept in its
+ * header and limits heap pools to 16M with up to 126 tasks, smaller with more tasks (see OS_HEAP_NODE_TASK_BITS).
+ * With LOSCFG_KERNEL_MEM_SLAB the slab block header keeps it in one byte, limiting tasks to 254
+ */
+#define LOSCFG_MEM_TASK_STAT                       NO
+
+/**
+ * @ingroup los_config
+ * Configuration module tailoring of the leak tracker, recording the call site of every outstanding allocation, only
+ * takes effect with LOSCFG_MEM_TASK_STAT
+ */
+#define LOSCFG_MEM_LEAKCHECK                       NO
+
+/**
+ * @ingroup los_config
+ * Number of outstanding allocations the leak tracker holds, a power of 2, 16 bytes each
+ */
+#define LOSCFG_MEM_LEAKCHECK_SIZE                  128
+
+/**
+ * @ingroup los_config
+ * Configuration module tailoring of the background heap check, the idle task checks the block headers of the
+ * system memory pool a few at a time
+ */
+#define LOSCFG_MEM_BGCHECK                         NO
+
+/**
+ * @ingroup los_config
+ * Number of blocks the idle task checks with the interrupts locked
+ */
+#define LOSCFG_MEM_BGCHECK_STEP                    16
+
 /****************************** fw Interface configuration **************************/
 /**
  * @ingroup los_config
@@ -664,6 +882,46 @@ extern UINT32 osTickStart(VOID);
 extern LITE_OS_SEC_TEXT_INIT UINT32 LOS_Start(VOID);
 extern LITE_OS_SEC_TEXT_INIT int LOS_KernelInit(void);
 
+/**
+ * @ingroup los_config
+ * Kernel object limits chosen at run time, 0 keeps the LOSCFG_* default of a limit.
+ */
+typedef struct tagKernelConfig
+{
+    UINT32 uwTaskLimit;     /**< Tasks except the idle task, at most LOSCFG_BASE_CORE_TSK_LIMIT */
+    UINT32 uwSemLimit;      /**< Semaphores, at most 0x10000 */
+    UINT32 uwMuxLimit;      /**< Mutexes, at most 0x10000 */
+    UINT32 uwQueueLimit;    /**< Queues, at most 0x10000 */
+    UINT32 uwSwtmrLimit;    /**< Software timers, at most 0x1000 */
+} LOS_KERNEL_CONFIG_S;
+
+/**
+ *@ingroup los_config
+ *@brief System kernel initialization with object limits chosen at run time.
+ *
+ *@par Description:
+ *This API is used to initialize the kernel like LOS_KernelInit, with the limits of pstConfig instead of the
+ *LOSCFG_* defaults. The control blocks of semaphores, mutexes, queues and software timers are allocated
+ *from the system memory pool a block at a time when all are in use, so a large limit only costs memory once used.
+ *
+ *@attention
+ *<ul>
+ *<li>The task limit cannot exceed LOSCFG_BASE_CORE_TSK_LIMIT, the memory statistics and the heap nodes size task IDs by it.</li>
+ *<li>Unlike the IPC and software timer tables, the task table is allocated once with the task limit and cannot grow, LOS_TaskCreate returns #LOS_ERRNO_TSK_TCB_UNAVAILABLE once it is used up.</li>
+ *</ul>
+ *
+ *@param pstConfig  [IN] Object limits, NULL keeps all defaults.
+ *
+ *@retval #LOS_OK                                  0:System kernel initialization success.
+ *@retval #LOS_NOK                                 1:A limit is out of range or the initialization failed.
+ *
+ *@par Dependency:
+ *<ul><li>los_config.h: the header file that contains the API declaration.</li></ul>
+ *@see LOS_KernelInit
+ *@since Huawei LiteOS V100R001C00
+ */
+extern LITE_OS_SEC_TEXT_INIT int LOS_KernelInitConfig(LOS_KERNEL_CONFIG_S *pstConfig);
+
 /**
  *@ingroup los_config
  *@brief Scheduling initialization.